@@ -7,6 +7,11 @@ add_executable(pplcv_benchmark
 
 if(PPLCV_USE_X86)
     target_compile_definitions(pplcv_benchmark PRIVATE PPLCV_BENCHMARK_OPENCV)
+    target_include_directories(pplcv_benchmark PRIVATE
+        ${opencv_SOURCE_DIR}/modules/flann/include
+        ${opencv_SOURCE_DIR}/modules/features2d/include
+        ${opencv_SOURCE_DIR}/modules/calib3d/include)
+    target_link_libraries(pplcv_benchmark PRIVATE opencv_calib3d opencv_features2d opencv_flann)
 endif()
 if(PPLCV_USE_CUDA)
     target_compile_definitions(pplcv_benchmark PRIVATE PPLCV_BENCHMARK_OPENCV_CUDA)
@@ -1,7 +1,12 @@
 set(opencv_INCLUDE_DIRECTORIES )
 set(opencv_LIBRARIES )
 
-set(BUILD_LIST "core,imgproc" CACHE INTERNAL "")
+set(BUILD_LIST "core,imgproc,photo" CACHE INTERNAL "")
+
+if(PPLCV_BUILD_BENCHMARK AND PPLCV_USE_X86)
+    # only the opencv comparison of the x86 benchmark uses calib3d
+    set(BUILD_LIST "${BUILD_LIST},flann,features2d,calib3d" CACHE INTERNAL "")
+endif()
 
 # --------------------------------------------------------------------------- #
 
@@ -31,5 +36,6 @@ hpcc_populate_dep(opencv)
 list(APPEND opencv_INCLUDE_DIRECTORIES
     ${opencv_SOURCE_DIR}/include
     ${opencv_SOURCE_DIR}/modules/core/include
-    ${opencv_SOURCE_DIR}/modules/imgproc/include)
-list(APPEND opencv_LIBRARIES opencv_imgproc opencv_core)
+    ${opencv_SOURCE_DIR}/modules/imgproc/include
+    ${opencv_SOURCE_DIR}/modules/photo/include)
+list(APPEND opencv_LIBRARIES opencv_photo opencv_imgproc opencv_core)
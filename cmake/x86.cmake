@@ -29,6 +29,12 @@ set(PPLCV_X86_SRC
 foreach(filename ${PPLCV_X86_FMA_SRC})
     set_source_files_properties(${filename} PROPERTIES COMPILE_FLAGS "${FMA_ENABLED_FLAGS}")
 endforeach()
+# the small matrix determinants must round every product like the SSE path, a fused
+# multiply-subtract turns exactly singular matrices into invertible ones
+if(NOT MSVC)
+    set_source_files_properties(${CMAKE_CURRENT_SOURCE_DIR}/src/ppl/cv/x86/fma/invert_fma.cpp
+                                PROPERTIES COMPILE_FLAGS "${FMA_ENABLED_FLAGS} -ffp-contract=off")
+endif()
 foreach(filename ${PPLCV_X86_AVX_SRC})
     set_source_files_properties(${filename} PROPERTIES COMPILE_FLAGS "${AVX_ENABLED_FLAGS}")
 endforeach()
@@ -143,6 +143,12 @@ enum
     WARP_INVERSE_MAP  =16
 };
 
+// robust estimation methods, values copied from opencv-4.1.0/modules/calib3d/include/opencv2/calib3d.hpp
+enum EstimateMethod {
+    ESTIMATE_LEAST_SQUARES = 0,
+    ESTIMATE_RANSAC        = 8,
+};
+
 // wavelet kernels
 enum WaveletFamily {
     WAVELET_HAAR = 0,
@@ -203,6 +209,17 @@ enum
     INPAINT_TELEA = 1 //!< Use the algorithm proposed by Alexandru Telea @cite Telea04
 };
 
+// copied from opencv-4.1.0/modules/imgproc/include/opencv2/imgproc.hpp
+//! columns of the statistics written by ConnectedComponentsWithStats
+enum ConnectedComponentsTypes {
+    CC_STAT_LEFT   = 0, //!< The leftmost (x) coordinate which is the inclusive start of the bounding box in the horizontal direction.
+    CC_STAT_TOP    = 1, //!< The topmost (y) coordinate which is the inclusive start of the bounding box in the vertical direction.
+    CC_STAT_WIDTH  = 2, //!< The horizontal size of the bounding box
+    CC_STAT_HEIGHT = 3, //!< The vertical size of the bounding box
+    CC_STAT_AREA   = 4, //!< The total area (in pixels) of the connected component
+    CC_STAT_MAX    = 5
+};
+
 } // namespace cv
 } // namespace ppl
 
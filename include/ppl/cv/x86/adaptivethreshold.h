@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_ADAPTIVETHRESHOLD_H_
+#define __ST_HPC_PPL_CV_X86_ADAPTIVETHRESHOLD_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Applies an adaptive threshold to an image.
+* @param height            input&output image's height
+* @param width             input&output image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width`
+* @param inData            input image data
+* @param outWidthStride    output image's width stride, usually it equals to `width`
+* @param outData           output image data
+* @param maxValue          non-zero value assigned to the pixels for which the condition is satisfied
+* @param adaptiveMethod    adaptive thresholding algorithm to use, ADAPTIVE_THRESH_MEAN_C and ADAPTIVE_THRESH_GAUSSIAN_C are supported
+* @param thresholdType     thresholding type, THRESH_BINARY and THRESH_BINARY_INV are supported
+* @param blockSize         size of a pixel neighborhood that is used to calculate a threshold value for the pixel, it must be odd and greater than 1
+* @param delta             constant subtracted from the mean or weighted mean
+* @param border_type       ways to deal with border. BORDER_TYPE_REPLICATE, BORDER_TYPE_REFLECT and BORDER_TYPE_REFLECT_101 are supported now
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. ADAPTIVE_THRESH_MEAN_C costs O(1) per pixel regardless of blockSize, the box sum is kept as running column sums
+*            and the threshold comparison is fused into the same pass.
+*         2. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type<th>channels
+* <tr><td>uint8_t<td>1
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/adaptivethreshold.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/adaptivethreshold.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*
+*     ppl::cv::x86::AdaptiveThreshold(H, W, W, dev_iImage, W, dev_oImage,
+*                                     255.0f, ppl::cv::ADAPTIVE_THRESH_MEAN_C,
+*                                     ppl::cv::THRESH_BINARY, 11, 2.0f,
+*                                     ppl::cv::BORDER_TYPE_REPLICATE);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+
+::ppl::common::RetCode AdaptiveThreshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float maxValue,
+    int32_t adaptiveMethod,
+    int32_t thresholdType,
+    int32_t blockSize,
+    float delta,
+    BorderType border_type = BORDER_TYPE_REPLICATE);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_ADAPTIVETHRESHOLD_H_
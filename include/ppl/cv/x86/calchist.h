@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_CALCHIST_H_
+#define __ST_HPC_PPL_CV_X86_CALCHIST_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Calculates the 256-bin histogram of every channel of an image.
+* @tparam T The data type of input image, currently only \a uint8_t is supported.
+* @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param outHist           output histogram of `256 * channels` bins, channel c uses outHist[c * 256] ~ outHist[c * 256 + 255]
+* @param maskWidthStride   the width stride of mask, usually it equals to `width`
+* @param mask              optional operation mask, it must have the same size as inData, and is uint8_t and single channel,
+*                          only pixels with non-zero mask are counted
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. Every channel is counted into several sub-histograms which are interleaved pixel by pixel, so
+*            runs of equal values do not stall on the same counter, and the sub-histograms are added at the end.
+*         2. Rows are counted in fixed stripes in parallel and the stripe histograms are merged in order.
+*         3. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/calchist.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/calchist.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     int32_t* dev_hist = (int32_t*)malloc(256 * C * sizeof(int32_t));
+*
+*     ppl::cv::x86::CalcHist<uint8_t, 3>(H, W, W * C, dev_iImage, dev_hist);
+*
+*     free(dev_iImage);
+*     free(dev_hist);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode CalcHist(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t *outHist,
+    int32_t maskWidthStride = 0,
+    const uint8_t *mask = nullptr);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_CALCHIST_H_
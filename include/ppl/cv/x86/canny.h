@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_CANNY_H_
+#define __ST_HPC_PPL_CV_X86_CANNY_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Finds edges with the Canny algorithm.
+* @tparam T The data type of input image, currently only \a uint8_t is supported.
+* @tparam channels The number of channels of input image, 1 and 3 are supported.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param outWidthStride    the width stride of output edge map, usually it equals to `width`
+* @param outData           output edge map, edges are 255 and everything else is 0
+* @param lowThreshold      lower hysteresis threshold, weak edges need a gradient magnitude above it
+* @param highThreshold     upper hysteresis threshold, strong edges need a gradient magnitude above it
+* @param apertureSize      aperture of the Sobel operator, only 3 is supported
+* @param L2gradient        use sqrt(dx^2 + dy^2) as the magnitude instead of |dx| + |dy|
+* @warning All input parameters must be valid, or undefined behaviour may occur. inData and outData must not overlap.
+* @remark 1. Sobel gradients, magnitude, non-maximum suppression and double thresholding run in one pass per row
+*            stripe over a window of three gradient rows, no full-frame gradient images are allocated.
+*         2. Hysteresis first grows the strong edges of every stripe on its own, then the edges found on
+*            the stripe seams are grown once more over the whole image.
+*         3. Gradients are computed with BORDER_TYPE_REPLICATE and the result is the same as cv::Canny.
+*         4. For multi-channel images the channel with the largest magnitude is used at every pixel.
+*         5. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/canny.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/canny.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*
+*     ppl::cv::x86::Canny<uint8_t, 1>(H, W, W, dev_iImage, W, dev_oImage, 50.0f, 150.0f);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode Canny(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float lowThreshold,
+    float highThreshold,
+    int32_t apertureSize = 3,
+    bool L2gradient = false);
+
+/**
+* @brief Finds edges with the Canny algorithm from precomputed image derivatives.
+* @param height            image's height
+* @param width             image's width
+* @param dxWidthStride     width stride of dx, usually it equals to `width`
+* @param dx                single channel x derivative, for example the output of a Sobel filter
+* @param dyWidthStride     width stride of dy, usually it equals to `width`
+* @param dy                single channel y derivative
+* @param outWidthStride    the width stride of output edge map, usually it equals to `width`
+* @param outData           output edge map, edges are 255 and everything else is 0
+* @param lowThreshold      lower hysteresis threshold
+* @param highThreshold     upper hysteresis threshold
+* @param L2gradient        use sqrt(dx^2 + dy^2) as the magnitude instead of |dx| + |dy|
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The result is the same as the cv::Canny overload taking dx and dy.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/canny.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/canny.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     int16_t* dx = (int16_t*)malloc(W * H * sizeof(int16_t));
+*     int16_t* dy = (int16_t*)malloc(W * H * sizeof(int16_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*
+*     ppl::cv::x86::Canny(H, W, W, dx, W, dy, W, dev_oImage, 50.0f, 150.0f);
+*
+*     free(dx);
+*     free(dy);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode Canny(
+    int32_t height,
+    int32_t width,
+    int32_t dxWidthStride,
+    const int16_t *dx,
+    int32_t dyWidthStride,
+    const int16_t *dy,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float lowThreshold,
+    float highThreshold,
+    bool L2gradient = false);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_CANNY_H_
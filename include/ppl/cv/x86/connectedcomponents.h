@@ -0,0 +1,142 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_CONNECTEDCOMPONENTS_H_
+#define __ST_HPC_PPL_CV_X86_CONNECTEDCOMPONENTS_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Labels the connected components of a binary image.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width`
+* @param inData            single channel input image data, every non-zero pixel is foreground
+* @param outWidthStride    the width stride of the label image, in elements, usually it equals to `width`
+* @param outLabels         output labels, 0 is the background and components are numbered from 1
+* @param numLabels         output number of labels, the background included
+* @param connectivity      4 or 8
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. 8-connectivity uses the 2x2 block based union-find scan of Grana et al. (BBDT), 4-connectivity
+*            a pixel based scan over the runs of the rows, the same split as cv::connectedComponents.
+*         2. The image is labelled in stripes of rows in parallel with OpenMP, the labels on both sides
+*            of every stripe boundary are merged afterwards and the equivalences are flattened once.
+*         3. The numbering does not depend on the number of threads, but it may differ from the one of
+*            cv::connectedComponents, the partition into components is the same.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/connectedcomponents.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/connectedcomponents.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     int32_t* dev_oLabels = (int32_t*)malloc(W * H * sizeof(int32_t));
+*     int32_t numLabels = 0;
+*
+*     ppl::cv::x86::ConnectedComponents(H, W, W, dev_iImage, W, dev_oLabels, &numLabels, 8);
+*
+*     free(dev_iImage);
+*     free(dev_oLabels);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode ConnectedComponents(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    int32_t *outLabels,
+    int32_t *numLabels,
+    int32_t connectivity = 8);
+
+/**
+* @brief Labels the connected components of a binary image and computes the statistics of every label.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width`
+* @param inData            single channel input image data, every non-zero pixel is foreground
+* @param outWidthStride    the width stride of the label image, in elements, usually it equals to `width`
+* @param outLabels         output labels, 0 is the background and components are numbered from 1
+* @param stats             output statistics, `CC_STAT_MAX` int32_t values per label indexed by ppl::cv::ConnectedComponentsTypes
+* @param centroids         output centroids, x and y of every label
+* @param numLabels         output number of labels, the background included
+* @param connectivity      4 or 8
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. The labelling is the same as ConnectedComponents.
+*         2. stats and centroids must have room for every label, numLabels never exceeds `(height * width + 1) / 2 + 1`.
+*         3. The statistics are gathered per stripe for the provisional labels and reduced in label order, so
+*            they do not depend on the number of threads. They match cv::connectedComponentsWithStats.
+*         4. When there is no background pixel the bounding box of label 0 is empty and its centroid is NaN.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/connectedcomponents.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/connectedcomponents.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t maxLabels = (W * H + 1) / 2 + 1;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     int32_t* dev_oLabels = (int32_t*)malloc(W * H * sizeof(int32_t));
+*     int32_t* stats = (int32_t*)malloc(maxLabels * ppl::cv::CC_STAT_MAX * sizeof(int32_t));
+*     double* centroids = (double*)malloc(maxLabels * 2 * sizeof(double));
+*     int32_t numLabels = 0;
+*
+*     ppl::cv::x86::ConnectedComponentsWithStats(H, W, W, dev_iImage, W, dev_oLabels, stats, centroids, &numLabels, 8);
+*
+*     free(dev_iImage);
+*     free(dev_oLabels);
+*     free(stats);
+*     free(centroids);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode ConnectedComponentsWithStats(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    int32_t *outLabels,
+    int32_t *stats,
+    double *centroids,
+    int32_t *numLabels,
+    int32_t connectivity = 8);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_CONNECTEDCOMPONENTS_H_
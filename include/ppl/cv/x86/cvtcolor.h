@@ -3848,6 +3848,2439 @@ template <typename T>
     int32_t outStrideV,
     T* outDataV);
 
+//BGR_HSV
+/**
+ * @brief Convert BGR images to HSV images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark H is in [0, 180) for \a uint8_t and [0, 360) for \a float, S and V are scaled to [0, 255]
+ *         for \a uint8_t, S is in [0, 1] for \a float. \a uint8_t results are identical to OpenCV.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BGR2HSV<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGR2HSV(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGB images to HSV images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark H is in [0, 180) for \a uint8_t and [0, 360) for \a float, S and V are scaled to [0, 255]
+ *         for \a uint8_t, S is in [0, 1] for \a float. \a uint8_t results are identical to OpenCV.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::RGB2HSV<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGB2HSV(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BGRA images to HSV images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark H is in [0, 180) for \a uint8_t and [0, 360) for \a float, S and V are scaled to [0, 255]
+ *         for \a uint8_t, S is in [0, 1] for \a float. \a uint8_t results are identical to OpenCV.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>3
+ * <tr><td>float<td>4<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BGRA2HSV<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGRA2HSV(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGBA images to HSV images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark H is in [0, 180) for \a uint8_t and [0, 360) for \a float, S and V are scaled to [0, 255]
+ *         for \a uint8_t, S is in [0, 1] for \a float. \a uint8_t results are identical to OpenCV.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>3
+ * <tr><td>float<td>4<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::RGBA2HSV<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGBA2HSV(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert HSV images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark H is expected in [0, 180) for \a uint8_t and [0, 360) for \a float, S and V in [0, 255]
+ *         for \a uint8_t and S in [0, 1] for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::HSV2BGR<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode HSV2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert HSV images to RGB images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark H is expected in [0, 180) for \a uint8_t and [0, 360) for \a float, S and V in [0, 255]
+ *         for \a uint8_t and S in [0, 1] for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::HSV2RGB<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode HSV2RGB(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert HSV images to BGRA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark H is expected in [0, 180) for \a uint8_t and [0, 360) for \a float, S and V in [0, 255]
+ *         for \a uint8_t and S in [0, 1] for \a float. Alpha is set to 255 or 1.0f.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>4
+ * <tr><td>float<td>3<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 4;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::HSV2BGRA<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode HSV2BGRA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert HSV images to RGBA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark H is expected in [0, 180) for \a uint8_t and [0, 360) for \a float, S and V in [0, 255]
+ *         for \a uint8_t and S in [0, 1] for \a float. Alpha is set to 255 or 1.0f.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>4
+ * <tr><td>float<td>3<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 4;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::HSV2RGBA<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode HSV2RGBA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+//BGR_LAB
+/**
+ * @brief Convert BGR images to LAB images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark sRGB gamma and D65 white point are used. \a float input is expected in [0, 1], L is in [0, 100];
+ *         for \a uint8_t L is scaled by 255 / 100 and a, b are offset by 128.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::BGR2LAB<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGR2LAB(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGB images to LAB images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark sRGB gamma and D65 white point are used. \a float input is expected in [0, 1], L is in [0, 100];
+ *         for \a uint8_t L is scaled by 255 / 100 and a, b are offset by 128.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::RGB2LAB<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGB2LAB(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BGRA images to LAB images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark sRGB gamma and D65 white point are used. \a float input is expected in [0, 1], L is in [0, 100];
+ *         for \a uint8_t L is scaled by 255 / 100 and a, b are offset by 128.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>3
+ * <tr><td>float<td>4<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::BGRA2LAB<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGRA2LAB(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGBA images to LAB images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark sRGB gamma and D65 white point are used. \a float input is expected in [0, 1], L is in [0, 100];
+ *         for \a uint8_t L is scaled by 255 / 100 and a, b are offset by 128.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>3
+ * <tr><td>float<td>4<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::RGBA2LAB<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGBA2LAB(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert LAB images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark sRGB gamma and D65 white point are used. \a float output is in [0, 1]; for \a uint8_t
+ *         L is expected scaled by 255 / 100 and a, b offset by 128.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::LAB2BGR<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode LAB2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert LAB images to RGB images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark sRGB gamma and D65 white point are used. \a float output is in [0, 1]; for \a uint8_t
+ *         L is expected scaled by 255 / 100 and a, b offset by 128.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::LAB2RGB<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode LAB2RGB(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert LAB images to BGRA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark sRGB gamma and D65 white point are used. \a float output is in [0, 1]; for \a uint8_t
+ *         L is expected scaled by 255 / 100 and a, b offset by 128. Alpha is set to 255 or 1.0f.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>4
+ * <tr><td>float<td>3<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 4;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::LAB2BGRA<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode LAB2BGRA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert LAB images to RGBA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark sRGB gamma and D65 white point are used. \a float output is in [0, 1]; for \a uint8_t
+ *         L is expected scaled by 255 / 100 and a, b offset by 128. Alpha is set to 255 or 1.0f.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>4
+ * <tr><td>float<td>3<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 4;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::LAB2RGBA<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode LAB2RGBA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+//BGR_YCrCb
+/**
+ * @brief Convert BGR images to YCrCb images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark BT.601 full range, the channel order is Y, Cr, Cb. Cr and Cb are offset by 128 for \a uint8_t and 0.5 for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::BGR2YCrCb<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGR2YCrCb(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGB images to YCrCb images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark BT.601 full range, the channel order is Y, Cr, Cb. Cr and Cb are offset by 128 for \a uint8_t and 0.5 for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::RGB2YCrCb<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGB2YCrCb(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BGRA images to YCrCb images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark BT.601 full range, the channel order is Y, Cr, Cb. Cr and Cb are offset by 128 for \a uint8_t and 0.5 for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>3
+ * <tr><td>float<td>4<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::BGRA2YCrCb<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGRA2YCrCb(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGBA images to YCrCb images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark BT.601 full range, the channel order is Y, Cr, Cb. Cr and Cb are offset by 128 for \a uint8_t and 0.5 for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>3
+ * <tr><td>float<td>4<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::RGBA2YCrCb<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGBA2YCrCb(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert YCrCb images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark BT.601 full range, the channel order is Y, Cr, Cb. Cr and Cb are offset by 128 for \a uint8_t and 0.5 for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::YCrCb2BGR<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode YCrCb2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert YCrCb images to RGB images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark BT.601 full range, the channel order is Y, Cr, Cb. Cr and Cb are offset by 128 for \a uint8_t and 0.5 for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::YCrCb2RGB<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode YCrCb2RGB(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert YCrCb images to BGRA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark BT.601 full range, the channel order is Y, Cr, Cb. Cr and Cb are offset by 128 for \a uint8_t and 0.5 for \a float.
+ *         Alpha is set to 255 or 1.0f.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>4
+ * <tr><td>float<td>3<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 4;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::YCrCb2BGRA<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode YCrCb2BGRA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert YCrCb images to RGBA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark BT.601 full range, the channel order is Y, Cr, Cb. Cr and Cb are offset by 128 for \a uint8_t and 0.5 for \a float.
+ *         Alpha is set to 255 or 1.0f.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>4
+ * <tr><td>float<td>3<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 4;
+ *     float* iImage = (float*)malloc(W * H * input_channels * sizeof(float));
+ *     float* oImage = (float*)malloc(W * H * output_channels * sizeof(float));
+ *
+ *     ppl::cv::x86::YCrCb2RGBA<float>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode YCrCb2RGBA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+//YUV422_BGR
+/**
+ * @brief Convert UYVY images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @tparam ncSrc The number of channels of input image, 2 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * 2`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Packed 4:2:2 input with 2 bytes per pixel, `width` counts pixels and should be even.
+ *         BT.601 limited range, the same coefficients as NV12/NV21.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>2<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 2;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::UYVY2BGR<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode UYVY2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert UYVY images to BGRA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @tparam ncSrc The number of channels of input image, 2 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * 2`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Packed 4:2:2 input with 2 bytes per pixel, `width` counts pixels and should be even.
+ *         BT.601 limited range, the same coefficients as NV12/NV21. Alpha is set to 255.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>2<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 2;
+ *     const int32_t output_channels = 4;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::UYVY2BGRA<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode UYVY2BGRA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert UYVY images to GRAY images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @tparam ncSrc The number of channels of input image, 2 is supported.
+ * @tparam ncDst The number of channels of output image, 1 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * 2`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Packed 4:2:2 input with 2 bytes per pixel, `width` counts pixels and should be even.
+ *         Only the luma bytes are copied.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>2<td>1
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 2;
+ *     const int32_t output_channels = 1;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::UYVY2GRAY<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode UYVY2GRAY(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert YUYV images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @tparam ncSrc The number of channels of input image, 2 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * 2`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Packed 4:2:2 input with 2 bytes per pixel, `width` counts pixels and should be even.
+ *         BT.601 limited range, the same coefficients as NV12/NV21.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>2<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 2;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::YUYV2BGR<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode YUYV2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert YUYV images to BGRA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @tparam ncSrc The number of channels of input image, 2 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * 2`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Packed 4:2:2 input with 2 bytes per pixel, `width` counts pixels and should be even.
+ *         BT.601 limited range, the same coefficients as NV12/NV21. Alpha is set to 255.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>2<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 2;
+ *     const int32_t output_channels = 4;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::YUYV2BGRA<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode YUYV2BGRA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert YUYV images to GRAY images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @tparam ncSrc The number of channels of input image, 2 is supported.
+ * @tparam ncDst The number of channels of output image, 1 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * 2`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Packed 4:2:2 input with 2 bytes per pixel, `width` counts pixels and should be even.
+ *         Only the luma bytes are copied.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>2<td>1
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 2;
+ *     const int32_t output_channels = 1;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::YUYV2GRAY<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode YUYV2GRAY(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+//BGR_RGB_BGRA_RGBA
+/**
+ * @brief Convert BGR images to BGRA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Alpha is set to 255 for \a uint8_t and 1.0f for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>4
+ * <tr><td>float<td>3<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 4;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BGR2BGRA<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGR2BGRA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGB images to RGBA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Alpha is set to 255 for \a uint8_t and 1.0f for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>4
+ * <tr><td>float<td>3<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 4;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::RGB2RGBA<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGB2RGBA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BGRA images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Alpha is dropped.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>3
+ * <tr><td>float<td>4<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BGRA2BGR<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGRA2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGBA images to RGB images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Alpha is dropped.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>3
+ * <tr><td>float<td>4<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::RGBA2RGB<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGBA2RGB(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BGR images to RGBA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Alpha is set to 255 for \a uint8_t and 1.0f for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>4
+ * <tr><td>float<td>3<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 4;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BGR2RGBA<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGR2RGBA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGB images to BGRA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Alpha is set to 255 for \a uint8_t and 1.0f for \a float.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>4
+ * <tr><td>float<td>3<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 4;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::RGB2BGRA<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGB2BGRA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGBA images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Alpha is dropped.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>3
+ * <tr><td>float<td>4<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::RGBA2BGR<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGBA2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BGRA images to RGB images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Alpha is dropped.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>3
+ * <tr><td>float<td>4<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BGRA2RGB<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGRA2RGB(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BGR images to RGB images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark `inData` may equal `outData` for in-place conversion when both strides are the same.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BGR2RGB<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGR2RGB(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGB images to BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 3 is supported.
+ * @tparam ncDst The number of channels of output image, 3 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark `inData` may equal `outData` for in-place conversion when both strides are the same.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>3<td>3
+ * <tr><td>float<td>3<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 3;
+ *     const int32_t output_channels = 3;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::RGB2BGR<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGB2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BGRA images to RGBA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark `inData` may equal `outData` for in-place conversion when both strides are the same.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>4
+ * <tr><td>float<td>4<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 4;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::BGRA2RGBA<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode BGRA2RGBA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert RGBA images to BGRA images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam ncSrc The number of channels of input image, 4 is supported.
+ * @tparam ncDst The number of channels of output image, 4 is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark `inData` may equal `outData` for in-place conversion when both strides are the same.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t(uint8_t)<td>4<td>4
+ * <tr><td>float<td>4<td>4
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t input_channels = 4;
+ *     const int32_t output_channels = 4;
+ *     uint8_t* iImage = (uint8_t*)malloc(W * H * input_channels * sizeof(uint8_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::RGBA2BGRA<uint8_t>(H, W, W * input_channels, iImage, W * output_channels, oImage);
+ *
+ *     free(iImage);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode RGBA2BGRA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+//P010_P016_I010
+/**
+ * @brief Convert P010 images to BGR images
+ * @tparam T The data type of output image, \a uint8_t, \a uint16_t and \a float are supported, input is always \a uint16_t.
+ * @param height            input image's height, must be even
+ * @param width             input image's width need to be processed, must be even
+ * @param inYStride         input Y plane stride in uint16_t elements, usually it equals to `width`
+ * @param inY               input Y plane data
+ * @param inUVStride        input interleaved UV plane stride in uint16_t elements, usually it equals to `width`
+ * @param inUV              input interleaved UV plane data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark P010 stores 10-bit samples in the high bits of each uint16_t, UV is interleaved at half resolution.
+ * The planes are read directly, so decoder buffers can be passed without a down-conversion pass.
+ * uint16_t output spans the full 0~65535 range and float output spans 0~1.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t<td>1<td>3
+ * <tr><td>uint16_t<td>1<td>3
+ * <tr><td>float<td>1<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t output_channels = 3;
+ *     uint16_t* iImage_y = (uint16_t*)malloc(W * H * sizeof(uint16_t));
+ *     uint16_t* iImage_uv = (uint16_t*)malloc(W * H / 2 * sizeof(uint16_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::P0102BGR<uint8_t>(H, W, W, iImage_y, W, iImage_uv, W * output_channels, oImage);
+ *
+ *     free(iImage_y);
+ *     free(iImage_uv);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode P0102BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t* inY,
+    int32_t inUVStride,
+    const uint16_t* inUV,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert P016 images to BGR images
+ * @tparam T The data type of output image, \a uint8_t, \a uint16_t and \a float are supported, input is always \a uint16_t.
+ * @param height            input image's height, must be even
+ * @param width             input image's width need to be processed, must be even
+ * @param inYStride         input Y plane stride in uint16_t elements, usually it equals to `width`
+ * @param inY               input Y plane data
+ * @param inUVStride        input interleaved UV plane stride in uint16_t elements, usually it equals to `width`
+ * @param inUV              input interleaved UV plane data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark P016 has the same layout as P010 with 16-bit samples, which are converted at 13-bit precision.
+ * The planes are read directly, so decoder buffers can be passed without a down-conversion pass.
+ * uint16_t output spans the full 0~65535 range and float output spans 0~1.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t<td>1<td>3
+ * <tr><td>uint16_t<td>1<td>3
+ * <tr><td>float<td>1<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t output_channels = 3;
+ *     uint16_t* iImage_y = (uint16_t*)malloc(W * H * sizeof(uint16_t));
+ *     uint16_t* iImage_uv = (uint16_t*)malloc(W * H / 2 * sizeof(uint16_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::P0162BGR<uint8_t>(H, W, W, iImage_y, W, iImage_uv, W * output_channels, oImage);
+ *
+ *     free(iImage_y);
+ *     free(iImage_uv);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode P0162BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t* inY,
+    int32_t inUVStride,
+    const uint16_t* inUV,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert I010 images to BGR images
+ * @tparam T The data type of output image, \a uint8_t, \a uint16_t and \a float are supported, input is always \a uint16_t.
+ * @param height            input image's height, must be even
+ * @param width             input image's width need to be processed, must be even
+ * @param inYStride         input Y plane stride in uint16_t elements, usually it equals to `width`
+ * @param inY               input Y plane data
+ * @param inUStride         input U plane stride in uint16_t elements, usually it equals to `width / 2`
+ * @param inU               input U plane data
+ * @param inVStride         input V plane stride in uint16_t elements, usually it equals to `width / 2`
+ * @param inV               input V plane data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark I010 stores 10-bit samples in the low bits of each uint16_t, U and V are separate planes at half resolution.
+ * The planes are read directly, so decoder buffers can be passed without a down-conversion pass.
+ * uint16_t output spans the full 0~65535 range and float output spans 0~1.
+ * <table>
+ * <tr><th>Data type(T)<th>ncSrc<th>ncDst
+ * <tr><td>uint8_t<td>1<td>3
+ * <tr><td>uint16_t<td>1<td>3
+ * <tr><td>float<td>1<td>3
+ * </table>
+ * <table>
+ * <caption align="left">Requirements</caption>
+ * <tr><td>X86 platforms supported<td> All
+ * <tr><td>Header files<td> #include &lt;ppl/cv/x86/cvtcolor.h&gt;
+ * <tr><td>Project<td> ppl.cv
+ * @since ppl.cv-v1.0.0
+ * ###Example
+ * @code{.cpp}
+ * #include <ppl/cv/x86/cvtcolor.h>
+ * #include <stdlib.h>
+ * int32_t main(int32_t argc, char** argv) {
+ *     const int32_t W = 640;
+ *     const int32_t H = 480;
+ *     const int32_t output_channels = 3;
+ *     uint16_t* iImage_y = (uint16_t*)malloc(W * H * sizeof(uint16_t));
+ *     uint16_t* iImage_u = (uint16_t*)malloc(W * H / 4 * sizeof(uint16_t));
+ *     uint16_t* iImage_v = (uint16_t*)malloc(W * H / 4 * sizeof(uint16_t));
+ *     uint8_t* oImage = (uint8_t*)malloc(W * H * output_channels * sizeof(uint8_t));
+ *
+ *     ppl::cv::x86::I0102BGR<uint8_t>(H, W, W, iImage_y, W / 2, iImage_u, W / 2, iImage_v, W * output_channels, oImage);
+ *
+ *     free(iImage_y);
+ *     free(iImage_u);
+ *     free(iImage_v);
+ *     free(oImage);
+ *     return 0;
+ * }
+ * @endcode
+ ****************************************************************************************************/
+template <typename T>
+::ppl::common::RetCode I0102BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t* inY,
+    int32_t inUStride,
+    const uint16_t* inU,
+    int32_t inVStride,
+    const uint16_t* inV,
+    int32_t outWidthStride,
+    T* outData);
+
 }
 }
 } // namespace ppl::cv::x86
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_DISTANCETRANSFORM_H_
+#define __ST_HPC_PPL_CV_X86_DISTANCETRANSFORM_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Calculates the distance from every non-zero pixel to the nearest zero pixel.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width`
+* @param inData            single channel input image data, zero pixels are the background
+* @param outWidthStride    the width stride of output image, usually it equals to `width`
+* @param outData           output distances, zero pixels get 0
+* @param distanceType      ppl::cv::DIST_L1, ppl::cv::DIST_L2 or ppl::cv::DIST_C
+* @param maskSize          ppl::cv::DIST_MASK_3, ppl::cv::DIST_MASK_5 or ppl::cv::DIST_MASK_PRECISE
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. DIST_L1 and DIST_C are exact with a 3x3 mask whatever maskSize is, the same as cv::distanceTransform.
+*         2. DIST_L2 with DIST_MASK_3 or DIST_MASK_5 is the chamfer approximation of cv::distanceTransform, a forward
+*            and a backward scan in which the terms from the neighbouring rows are taken for a whole row with SIMD
+*            and only the running minimum along the row is sequential.
+*         3. DIST_L2 with DIST_MASK_PRECISE is the exact Euclidean distance of Felzenszwalb and Huttenlocher,
+*            a pass over the columns, 16 columns per SIMD lane group, followed by a lower envelope pass over the rows,
+*            both parallelized with OpenMP. Pixels of an image without any zero pixel get very large distances.
+*         4. Results are bit exact with cv::distanceTransform and CV_32F output.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/distancetransform.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/distancetransform.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     float* dev_oImage = (float*)malloc(W * H * sizeof(float));
+*
+*     ppl::cv::x86::DistanceTransform(H, W, W, dev_iImage, W, dev_oImage, ppl::cv::DIST_L2, ppl::cv::DIST_MASK_PRECISE);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode DistanceTransform(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    DistTypes distanceType,
+    DistanceTransformMasks maskSize);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_DISTANCETRANSFORM_H_
@@ -0,0 +1,134 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_DWT_H_
+#define __ST_HPC_PPL_CV_X86_DWT_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Multi-level 2D discrete wavelet transform of a float image.
+* @param height            input image's height, a multiple of `2^levels`
+* @param width             input image's width, a multiple of `2^levels`
+* @param inWidthStride     input image's width stride, usually it equals to `width`
+* @param inData            single channel input image data
+* @param outWidthStride    the width stride of output image, usually it equals to `width`
+* @param outData           output coefficients, outData may be the same as inData
+* @param levels            number of decomposition levels, at least 1
+* @param family            ppl::cv::WAVELET_HAAR, ppl::cv::WAVELET_DB1 or ppl::cv::WAVELET_DB2
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. The wavelets are orthonormal with periodic extension, so the output has the size of the input.
+*            With the analysis filters h and g, a row x of length N gives for n < N / 2
+*            approximation a[n] = sum_k h[k] * x[(2n + k) % N] and detail d[n] = sum_k g[k] * x[(2n + k) % N],
+*            where g[k] = (-1)^k * h[K - 1 - k]. WAVELET_DB1 is the same wavelet as WAVELET_HAAR.
+*         2. The output uses the Mallat layout. Each level transforms the rows and then the columns of the
+*            top left quarter left by the previous level, which holds the approximation in its top left quarter,
+*            the horizontal detail in its top right quarter, the vertical detail in its bottom left quarter
+*            and the diagonal detail in its bottom right quarter.
+*         3. DB2 is computed with its lifting factorization per pass: a predict step, an update step and a second
+*            predict step folded into the scaling. The row pass splits even and odd samples with SIMD shuffles,
+*            the column pass runs the lifting steps on whole rows with SIMD across columns, streaming down column
+*            tiles that stay in cache.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/dwt.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/dwt.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     float* dev_iImage = (float*)malloc(W * H * sizeof(float));
+*     float* dev_oImage = (float*)malloc(W * H * sizeof(float));
+*
+*     ppl::cv::x86::DWT(H, W, W, dev_iImage, W, dev_oImage, 3, ppl::cv::WAVELET_DB2);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode DWT(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t levels,
+    WaveletFamily family);
+
+/**
+* @brief Inverse of the multi-level 2D discrete wavelet transform, see DWT.
+* @param height            image's height, a multiple of `2^levels`
+* @param width             image's width, a multiple of `2^levels`
+* @param inWidthStride     coefficients' width stride, usually it equals to `width`
+* @param inData            coefficients in the layout DWT writes
+* @param outWidthStride    the width stride of output image, usually it equals to `width`
+* @param outData           reconstructed image, outData may be the same as inData
+* @param levels            number of decomposition levels of inData, at least 1
+* @param family            ppl::cv::WAVELET_HAAR, ppl::cv::WAVELET_DB1 or ppl::cv::WAVELET_DB2
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. The levels are undone from the coarsest one, the columns and then the rows of each.
+*         2. IDWT(DWT(x)) gives back x up to float rounding.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/dwt.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/dwt.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     float* dev_iImage = (float*)malloc(W * H * sizeof(float));
+*     float* dev_oImage = (float*)malloc(W * H * sizeof(float));
+*
+*     ppl::cv::x86::IDWT(H, W, W, dev_iImage, W, dev_oImage, 3, ppl::cv::WAVELET_DB2);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode IDWT(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t levels,
+    WaveletFamily family);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_DWT_H_
@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_ESTIMATEAFFINE_H_
+#define __ST_HPC_PPL_CV_X86_ESTIMATEAFFINE_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Estimates the affine transform between two sets of 2D points.
+* @param num_points            number of point pairs, at least 3
+* @param src_points            src points, 2 float values (x, y) per point
+* @param dst_points            dst points, 2 float values (x, y) per point
+* @param affineMatrix          output 2x3 row-major matrix mapping src points to dst points
+* @param inliers               optional output, `inliers[i]` is set to 1 if pair i is an inlier of the model and 0 if not.
+*                              Can be nullptr.
+* @param method                ppl::cv::ESTIMATE_RANSAC or ppl::cv::ESTIMATE_LEAST_SQUARES
+* @param ransacReprojThreshold maximum distance in pixels between a transformed src point and its dst point
+*                              for the pair to be an inlier, only used by ESTIMATE_RANSAC
+* @param maxIters              maximum number of RANSAC iterations
+* @param confidence            RANSAC stops once a model is found with this probability, between 0 and 1
+* @return RC_SUCCESS, or RC_INVALID_VALUE for bad arguments or when no model is found because the points are
+*         degenerate (collinear). affineMatrix and inliers are filled with zeros then.
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. ESTIMATE_LEAST_SQUARES fits all the pairs and marks them all as inliers.
+*         2. ESTIMATE_RANSAC scores hypotheses from random 3-pair samples, solved a few dozen at a time by the
+*            batch ppl::cv::x86::GetAffineTransform, counting the inliers of each with SIMD. The best hypothesis is
+*            refit by least squares on its inliers. Samples are drawn from a fixed seed, so results are repeatable.
+*         3. WarpAffineLinear and WarpAffineNearestPoint map output pixels to input pixels. To warp the image the
+*            src points come from onto the dst points, pass dst_points as src_points and src_points as dst_points.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/estimateaffine.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/estimateaffine.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t num_points = 500;
+*     float* src_points = (float*)malloc(num_points * 2 * sizeof(float));
+*     float* dst_points = (float*)malloc(num_points * 2 * sizeof(float));
+*     uint8_t* inliers = (uint8_t*)malloc(num_points * sizeof(uint8_t));
+*     double affineMatrix[6];
+*
+*     ppl::cv::x86::EstimateAffine2D(num_points, src_points, dst_points, affineMatrix, inliers, ppl::cv::ESTIMATE_RANSAC, 3.0);
+*
+*     free(src_points);
+*     free(dst_points);
+*     free(inliers);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode EstimateAffine2D(
+    int32_t num_points,
+    const float *src_points,
+    const float *dst_points,
+    double *affineMatrix,
+    uint8_t *inliers = nullptr,
+    EstimateMethod method = ESTIMATE_RANSAC,
+    double ransacReprojThreshold = 3.0,
+    int32_t maxIters = 2000,
+    double confidence = 0.99);
+
+/**
+* @brief Estimates the similarity transform (rotation, uniform scale and translation) between two sets of 2D points.
+* @param num_points            number of point pairs, at least 2
+* @param src_points            src points, 2 float values (x, y) per point
+* @param dst_points            dst points, 2 float values (x, y) per point
+* @param affineMatrix          output 2x3 row-major matrix [a -b tx; b a ty] mapping src points to dst points
+* @param inliers               optional output, `inliers[i]` is set to 1 if pair i is an inlier of the model and 0 if not.
+*                              Can be nullptr.
+* @param method                ppl::cv::ESTIMATE_RANSAC or ppl::cv::ESTIMATE_LEAST_SQUARES
+* @param ransacReprojThreshold maximum distance in pixels between a transformed src point and its dst point
+*                              for the pair to be an inlier, only used by ESTIMATE_RANSAC
+* @param maxIters              maximum number of RANSAC iterations
+* @param confidence            RANSAC stops once a model is found with this probability, between 0 and 1
+* @return RC_SUCCESS, or RC_INVALID_VALUE for bad arguments or when no model is found because the points
+*         coincide. affineMatrix and inliers are filled with zeros then.
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. The least squares fit is the closed-form Umeyama solution, which never contains a reflection.
+*            It is typically used to align 5 to 68 face landmarks to a template with ESTIMATE_LEAST_SQUARES.
+*         2. ESTIMATE_RANSAC scores hypotheses from random 2-pair samples as EstimateAffine2D does.
+*         3. See EstimateAffine2D for the direction of the matrix expected by WarpAffineLinear.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/estimateaffine.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/estimateaffine.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t num_points = 5;
+*     float landmarks[num_points * 2];
+*     float face_template[num_points * 2];
+*     double affineMatrix[6];
+*
+*     ppl::cv::x86::EstimateAffinePartial2D(num_points, face_template, landmarks, affineMatrix, nullptr, ppl::cv::ESTIMATE_LEAST_SQUARES);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+::ppl::common::RetCode EstimateAffinePartial2D(
+    int32_t num_points,
+    const float *src_points,
+    const float *dst_points,
+    double *affineMatrix,
+    uint8_t *inliers = nullptr,
+    EstimateMethod method = ESTIMATE_RANSAC,
+    double ransacReprojThreshold = 3.0,
+    int32_t maxIters = 2000,
+    double confidence = 0.99);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_ESTIMATEAFFINE_H_
@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_INPAINT_H_
+#define __ST_HPC_PPL_CV_X86_INPAINT_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Restores the region of an image selected by a mask from the pixels around it.
+* @tparam T The data type of input and output image, currently only \a uint8_t is supported.
+* @tparam channels The number of channels of input image and output image, 1 and 3 are supported.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param maskWidthStride   the width stride of mask, usually it equals to `width`
+* @param mask              single channel mask of the same size as the image, non-zero pixels are inpainted
+* @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+* @param outData           output image data, it may be the same as inData
+* @param inpaintRadius     radius of the neighbourhood every inpainted pixel is computed from, rounded and clamped to [1, 100]
+* @param flags             ppl::cv::INPAINT_NS or ppl::cv::INPAINT_TELEA
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. Both methods are the fast marching ones of cv::inpaint: the front moves from the boundary of the mask
+*            into it and every pixel it reaches is computed from the known pixels within inpaintRadius.
+*         2. The front is kept in a bucket queue on the arrival time, pixels with the same time leave it in
+*            the order they reached the front, the same order as the queue of cv::inpaint.
+*         3. Mask pixels are grouped into clusters that are too far apart to see each other and every cluster is
+*            worked on in its own box grown by inpaintRadius. Apart from one pass over the mask, the cost follows
+*            the size of the mask and the radius and not the size of the image.
+*         4. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/inpaint.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/inpaint.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_mask = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*
+*     ppl::cv::x86::Inpaint<uint8_t, 3>(H, W, W * C, dev_iImage, W, dev_mask, W * C, dev_oImage, 3.0f, ppl::cv::INPAINT_TELEA);
+*
+*     free(dev_iImage);
+*     free(dev_mask);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode Inpaint(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t outWidthStride,
+    T *outData,
+    float inpaintRadius,
+    int32_t flags);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_INPAINT_H_
@@ -0,0 +1,212 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_INTEGRAL_H_
+#define __ST_HPC_PPL_CV_X86_INTEGRAL_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Calculates the integral of an image.
+* @tparam TSrc The data type of input image, currently \a uint8_t and \a float are supported.
+* @tparam TDst The data type of output image, see the table below.
+* @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param outHeight         output image's height, it must be `inHeight + 1`
+* @param outWidth          output image's width, it must be `inWidth + 1`
+* @param outWidthStride    output image's width stride, usually it equals to `outWidth * channels`
+* @param outData           output image data, sum(X, Y) = sum of inData(x, y) over x < X and y < Y
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. Each row is summed with an in-register log-step prefix scan and added to the previous output row.
+*         2. With several OpenMP threads the rows are split into fixed stripes, each stripe is summed on its
+*            own and a carry pass adds the last row of the stripes above. Integer sums are exact either way,
+*            float sums may differ in the last bits from the single-threaded order.
+*         3. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(TSrc)<th>Data type(TDst)<th>channels
+* <tr><td>uint8_t<td>int32_t<td>1, 3, 4
+* <tr><td>uint8_t<td>float<td>1, 3, 4
+* <tr><td>uint8_t<td>double<td>1, 3, 4
+* <tr><td>float<td>float<td>1, 3, 4
+* <tr><td>float<td>double<td>1, 3, 4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/integral.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/integral.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 1;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     int32_t* dev_oImage = (int32_t*)malloc((W + 1) * (H + 1) * C * sizeof(int32_t));
+*
+*     ppl::cv::x86::Integral<uint8_t, int32_t, 1>(H, W, W * C, dev_iImage, H + 1, W + 1, (W + 1) * C, dev_oImage);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename TSrc, typename TDst, int32_t channels>
+::ppl::common::RetCode Integral(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const TSrc *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    TDst *outData);
+
+/**
+* @brief Calculates the integral and the squared integral of an image.
+* @tparam TSrc The data type of input image, currently \a uint8_t and \a float are supported.
+* @tparam TDst The data type of the sum image, see Integral.
+* @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param outHeight         output images' height, it must be `inHeight + 1`
+* @param outWidth          output images' width, it must be `inWidth + 1`
+* @param outWidthStride    sum image's width stride, usually it equals to `outWidth * channels`
+* @param outData           sum image data
+* @param outSqWidthStride  squared sum image's width stride, usually it equals to `outWidth * channels`
+* @param outSqData         squared sum image data, always double
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The supported data types and channels are the same as Integral.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/integral.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/integral.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     int32_t* dev_sum = (int32_t*)malloc((W + 1) * (H + 1) * sizeof(int32_t));
+*     double* dev_sqsum = (double*)malloc((W + 1) * (H + 1) * sizeof(double));
+*
+*     ppl::cv::x86::Integral<uint8_t, int32_t, 1>(H, W, W, dev_iImage, H + 1, W + 1, W + 1, dev_sum, W + 1, dev_sqsum);
+*
+*     free(dev_iImage);
+*     free(dev_sum);
+*     free(dev_sqsum);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename TSrc, typename TDst, int32_t channels>
+::ppl::common::RetCode Integral(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const TSrc *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    TDst *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+/**
+* @brief Calculates the integral, the squared integral and the 45 degree tilted integral of an image.
+* @tparam TSrc The data type of input image, currently \a uint8_t and \a float are supported.
+* @tparam TDst The data type of the sum and tilted images, see Integral.
+* @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+* @param inHeight            input image's height
+* @param inWidth             input image's width
+* @param inWidthStride       input image's width stride, usually it equals to `width * channels`
+* @param inData              input image data
+* @param outHeight           output images' height, it must be `inHeight + 1`
+* @param outWidth            output images' width, it must be `inWidth + 1`
+* @param outWidthStride      sum image's width stride, usually it equals to `outWidth * channels`
+* @param outData             sum image data
+* @param outSqWidthStride    squared sum image's width stride, usually it equals to `outWidth * channels`
+* @param outSqData           squared sum image data, always double
+* @param outTiltedWidthStride tilted sum image's width stride, usually it equals to `outWidth * channels`
+* @param outTiltedData       tilted sum image data, tilted(X, Y) = sum of inData(x, y) over y < Y and |x - X + 1| <= Y - y - 1
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. The supported data types and channels are the same as Integral.
+*         2. Each tilted row only depends on the two rows above it, so it is computed with plain vector adds.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/integral.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/integral.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     int32_t* dev_sum = (int32_t*)malloc((W + 1) * (H + 1) * sizeof(int32_t));
+*     double* dev_sqsum = (double*)malloc((W + 1) * (H + 1) * sizeof(double));
+*     int32_t* dev_tilted = (int32_t*)malloc((W + 1) * (H + 1) * sizeof(int32_t));
+*
+*     ppl::cv::x86::Integral<uint8_t, int32_t, 1>(H, W, W, dev_iImage, H + 1, W + 1, W + 1, dev_sum,
+*                                                 W + 1, dev_sqsum, W + 1, dev_tilted);
+*
+*     free(dev_iImage);
+*     free(dev_sum);
+*     free(dev_sqsum);
+*     free(dev_tilted);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename TSrc, typename TDst, int32_t channels>
+::ppl::common::RetCode Integral(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const TSrc *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    TDst *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    TDst *outTiltedData);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_INTEGRAL_H_
@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_INVERT_H_
+#define __ST_HPC_PPL_CV_X86_INVERT_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Inverts a batch of small square matrices.
+* @tparam T The data type of the matrices, \a float and \a double are supported.
+* @tparam n The order of the matrices, 2, 3 and 6 are supported.
+* @param batch             number of matrices
+* @param src               input matrices in structure of arrays layout, element (r, c) of matrix b is
+*                          `src[(r * n + c) * batch + b]`. With batch 1 this is a plain row-major matrix.
+* @param dst               output inverses in the same layout, dst may be the same as src
+* @param method            ppl::cv::DECOMP_LU or ppl::cv::DECOMP_CHOLESKY
+* @param valid             optional output, `valid[b]` is set to 1 if matrix b was inverted and 0 if it was singular
+*                          (or not positive definite for DECOMP_CHOLESKY). Can be nullptr.
+* @return RC_SUCCESS if every matrix was inverted, RC_INVALID_VALUE for bad arguments or when any matrix is singular.
+*         The inverse of a singular matrix is filled with zeros, the other matrices of the batch are still inverted.
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. Each SIMD lane holds one matrix of the batch, so all the matrices of a register are eliminated together.
+*         2. DECOMP_LU inverts 2x2 and 3x3 matrices with their adjugate and treats a zero determinant as singular,
+*            the determinant is evaluated in double for float matrices too. Larger matrices are inverted by
+*            Gauss-Jordan elimination with partial pivoting and are singular when a pivot is below 10 * FLT_EPSILON
+*            for float or 100 * DBL_EPSILON for double, the same as cv::invert.
+*         3. DECOMP_CHOLESKY only reads the lower triangle of the symmetric matrix, a matrix is rejected when a
+*            pivot of the factorization is below the machine epsilon of T.
+*         4. The following table show which data type and orders are supported.
+* <table>
+* <tr><th>Data type(T)<th>n
+* <tr><td>float<td>2
+* <tr><td>float<td>3
+* <tr><td>float<td>6
+* <tr><td>double<td>2
+* <tr><td>double<td>3
+* <tr><td>double<td>6
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/invert.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/invert.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t batch = 1024;
+*     double* src = (double*)malloc(batch * 3 * 3 * sizeof(double));
+*     double* dst = (double*)malloc(batch * 3 * 3 * sizeof(double));
+*     uint8_t* valid = (uint8_t*)malloc(batch * sizeof(uint8_t));
+*
+*     ppl::cv::x86::Invert<double, 3>(batch, src, dst, ppl::cv::DECOMP_LU, valid);
+*
+*     free(src);
+*     free(dst);
+*     free(valid);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t n>
+::ppl::common::RetCode Invert(
+    int32_t batch,
+    const T *src,
+    T *dst,
+    InvertMethod method = DECOMP_LU,
+    uint8_t *valid = nullptr);
+
+/**
+* @brief Solves a batch of small linear systems A * x = b.
+* @tparam T The data type of the systems, \a float and \a double are supported.
+* @tparam n The order of the systems, 2, 3 and 6 are supported.
+* @param batch             number of systems
+* @param src               matrices A in structure of arrays layout, element (r, c) of matrix b is `src[(r * n + c) * batch + b]`
+* @param rhs               right-hand sides, element r of vector b is `rhs[r * batch + b]`
+* @param dst               solutions in the layout of rhs, dst may be the same as rhs
+* @param method            ppl::cv::DECOMP_LU or ppl::cv::DECOMP_CHOLESKY
+* @param valid             optional output, `valid[b]` is set to 1 if system b was solved and 0 if its matrix was singular
+*                          (or not positive definite for DECOMP_CHOLESKY). Can be nullptr.
+* @return RC_SUCCESS if every system was solved, RC_INVALID_VALUE for bad arguments or when any matrix is singular.
+*         The solution of a singular system is filled with zeros, the other systems of the batch are still solved.
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. The methods and the singularity tests are the ones of Invert.
+*         2. The following table show which data type and orders are supported.
+* <table>
+* <tr><th>Data type(T)<th>n
+* <tr><td>float<td>2
+* <tr><td>float<td>3
+* <tr><td>float<td>6
+* <tr><td>double<td>2
+* <tr><td>double<td>3
+* <tr><td>double<td>6
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/invert.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/invert.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t batch = 1024;
+*     double* src = (double*)malloc(batch * 6 * 6 * sizeof(double));
+*     double* rhs = (double*)malloc(batch * 6 * sizeof(double));
+*     double* dst = (double*)malloc(batch * 6 * sizeof(double));
+*
+*     ppl::cv::x86::Solve<double, 6>(batch, src, rhs, dst, ppl::cv::DECOMP_LU);
+*
+*     free(src);
+*     free(rhs);
+*     free(dst);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t n>
+::ppl::common::RetCode Solve(
+    int32_t batch,
+    const T *src,
+    const T *rhs,
+    T *dst,
+    InvertMethod method = DECOMP_LU,
+    uint8_t *valid = nullptr);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_INVERT_H_
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_LUT_H_
+#define __ST_HPC_PPL_CV_X86_LUT_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Performs a look-up table transform of an uint8_t image.
+* @tparam T The data type of output image and look-up table, currently \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param height            input&output image's height
+* @param width             input&output image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+* @param outData           output image data, outData(x, c) = lut[inData(x, c) * lutChannels + c % lutChannels]
+* @param lut               look-up table of 256 entries, with lutChannels interleaved channels as cv::LUT
+* @param lutChannels       1 to share one table between all channels, or `channels` for one table per channel
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. On AVX2 machines a shared uint8_t table is looked up 32 pixels at a time with vpshufb,
+*            per-channel uint8_t tables and float tables are looked up 8 elements at a time with vpgatherdd.
+*         2. inData may equal outData for in-place operation when T is uint8_t.
+*         3. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels<th>lutChannels
+* <tr><td>uint8_t<td>1, 3, 4<td>1 or channels
+* <tr><td>float<td>1, 3, 4<td>1 or channels
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/lut.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/lut.h>
+* #include <cmath>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t gamma[256];
+*     for (int32_t i = 0; i < 256; ++i) {
+*         gamma[i] = (uint8_t)(std::pow(i / 255.f, 1 / 2.2f) * 255.f + 0.5f);
+*     }
+*
+*     ppl::cv::x86::LUT<uint8_t, 3>(H, W, W * C, dev_iImage, W * C, dev_oImage, gamma);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode LUT(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    T *outData,
+    const T *lut,
+    int32_t lutChannels = 1);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_LUT_H_
@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_MEAN_H_
+#define __ST_HPC_PPL_CV_X86_MEAN_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Calculates the mean of each channel of an image.
+* @tparam T The data type of input image, currently \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param meanValue         the mean of each channel, an array of `channels` values
+* @param maskWidthStride   the width stride of mask, usually it equals to `width`
+* @param mask              optional operation mask, it must have the same size as inData, and is uint8_t and single channel
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. uint8_t elements are widened and summed in integer lanes over blocks short enough not to overflow,
+*            so the sums are exact. float sums are accumulated in blocks with several float accumulators and
+*            the block sums are added in double.
+*         2. Rows are reduced in fixed stripes which are merged in order, so the result does not depend on
+*            the number of OpenMP threads.
+*         3. When mask selects no pixel, the mean is 0.
+*         4. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/mean.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/mean.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     double mean_value[C];
+*
+*     ppl::cv::x86::Mean<uint8_t, 3>(H, W, W * C, dev_iImage, mean_value);
+*
+*     free(dev_iImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode Mean(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    double *meanValue,
+    int32_t maskWidthStride = 0,
+    const uint8_t *mask = nullptr);
+
+/**
+* @brief Calculates the mean and the standard deviation of each channel of an image.
+* @tparam T The data type of input image, currently \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param meanValue         the mean of each channel, an array of `channels` values
+* @param stdDevValue       the standard deviation of each channel, an array of `channels` values
+* @param maskWidthStride   the width stride of mask, usually it equals to `width`
+* @param mask              optional operation mask, it must have the same size as inData, and is uint8_t and single channel
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. The standard deviation is sqrt(E[x^2] - E[x]^2) from the sums of the elements and of their squares,
+*            the same as cv::meanStdDev. The sums are accumulated as in Mean.
+*         2. Rows are reduced in fixed stripes which are merged in order, so the result does not depend on
+*            the number of OpenMP threads.
+*         3. When mask selects no pixel, the mean and the standard deviation are 0.
+*         4. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/mean.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/mean.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     float* dev_iImage = (float*)malloc(W * H * C * sizeof(float));
+*     double mean_value[C], stddev_value[C];
+*
+*     ppl::cv::x86::MeanStdDev<float, 3>(H, W, W * C, dev_iImage, mean_value, stddev_value);
+*
+*     free(dev_iImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode MeanStdDev(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    double *meanValue,
+    double *stdDevValue,
+    int32_t maskWidthStride = 0,
+    const uint8_t *mask = nullptr);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_MEAN_H_
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_MEDIANBLUR_H_
+#define __ST_HPC_PPL_CV_X86_MEDIANBLUR_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Replaces every pixel with the median of its ksize x ksize neighbourhood, channels are filtered independently.
+* @tparam T The data type of input and output image, currently only \a uint8_t is supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+* @param outData           output image data
+* @param ksize             aperture size, an odd number between 1 and 255
+* @param border_type       support ppl::cv::BORDER_TYPE_REPLICATE, ppl::cv::BORDER_TYPE_REFLECT and ppl::cv::BORDER_TYPE_REFLECT_101
+* @warning All input parameters must be valid, or undefined behaviour may occur. inData and outData must not overlap.
+* @remark 1. 3x3 and 5x5 apertures use min/max sorting networks on whole SIMD registers.
+*         2. Larger apertures use the constant-time histogram method of Perreault and Hebert: every column keeps
+*            a 16-bin coarse and a 256-bin fine histogram, the fine bins of the kernel are only brought up to date
+*            for the coarse bin that holds the median, so the cost per pixel does not depend on ksize.
+*         3. The default border is the same as cv::medianBlur.
+*         4. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/medianblur.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/medianblur.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*
+*     ppl::cv::x86::MedianBlur<uint8_t, 3>(H, W, W * C, dev_iImage, W * C, dev_oImage, 5);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode MedianBlur(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t ksize,
+    BorderType border_type = BORDER_TYPE_REPLICATE);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_MEDIANBLUR_H_
@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_MINMAXLOC_H_
+#define __ST_HPC_PPL_CV_X86_MINMAXLOC_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Finds the minimum and maximum values of each channel of an image and their locations.
+* @tparam T The data type of input image, currently \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param minVal            the minimum of each channel, an array of `channels` values. Can be nullptr.
+* @param maxVal            the maximum of each channel, an array of `channels` values. Can be nullptr.
+* @param minLoc            the location of the minimum of each channel, `channels` pairs of (x, y). Can be nullptr.
+* @param maxLoc            the location of the maximum of each channel, `channels` pairs of (x, y). Can be nullptr.
+* @param maskWidthStride   the width stride of mask, usually it equals to `width`
+* @param mask              optional operation mask, it must have the same size as inData, and is uint8_t and single channel
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. The location of the first extremum in row-major order is reported, the same as cv::minMaxLoc.
+*            Rows are reduced in fixed stripes which are merged in order, so the result does not depend on
+*            the number of OpenMP threads.
+*         2. When mask selects no pixel, the values are 0 and the locations are (-1, -1).
+*         3. NaN values of float images are skipped.
+*         4. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/minmaxloc.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/minmaxloc.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     double min_value[C], max_value[C];
+*     int32_t min_loc[C * 2], max_loc[C * 2];
+*
+*     ppl::cv::x86::MinMaxLoc<uint8_t, 3>(H, W, W * C, dev_iImage, min_value, max_value, min_loc, max_loc);
+*
+*     free(dev_iImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode MinMaxLoc(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    double *minVal,
+    double *maxVal,
+    int32_t *minLoc,
+    int32_t *maxLoc,
+    int32_t maskWidthStride = 0,
+    const uint8_t *mask = nullptr);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_MINMAXLOC_H_
@@ -0,0 +1,165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_PYRDOWN_H_
+#define __ST_HPC_PPL_CV_X86_PYRDOWN_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Blurs an image with the 5x5 Gaussian kernel [1 4 6 4 1]^T * [1 4 6 4 1] / 256 and downsamples it by 2.
+* @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outWidthStride    output image's width stride, usually it equals to `(inWidth + 1) / 2 * channels`
+* @param outData           output image data, its size is `(inHeight + 1) / 2` x `(inWidth + 1) / 2`
+* @param border_type       support ppl::cv::BORDER_TYPE_REFLECT_101, ppl::cv::BORDER_TYPE_REFLECT and ppl::cv::BORDER_TYPE_REPLICATE
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. Filtering and decimation are done in one pass, only the even output positions are computed.
+*         2. uint8_t images are filtered in 16-bit fixed point and are bit exact with cv::pyrDown.
+*         3. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/pyrdown.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/pyrdown.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     const int32_t outW = (W + 1) / 2;
+*     const int32_t outH = (H + 1) / 2;
+*     float* dev_iImage = (float*)malloc(W * H * C * sizeof(float));
+*     float* dev_oImage = (float*)malloc(outW * outH * C * sizeof(float));
+*
+*     ppl::cv::x86::PyrDown<float, 3>(H, W, W * C, dev_iImage, outW * C, dev_oImage);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode PyrDown(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    BorderType border_type = BORDER_TYPE_REFLECT_101);
+
+/**
+* @brief Builds a Gaussian pyramid, every level is the PyrDown result of the level above it.
+* @tparam T The data type of input and output images, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output images, 1, 3 and 4 are supported.
+* @param height            input image's height
+* @param width             input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data, it is pyramid level 0 and is not copied
+* @param maxLevel          number of levels to build below the input image, must be at least 1
+* @param outWidthStrides   width strides of the maxLevel output images
+* @param outData           maxLevel output images, outData[i] holds level i + 1 of size
+*                          `(h_i + 1) / 2` x `(w_i + 1) / 2` where h_i x w_i is the size of level i
+* @param border_type       support ppl::cv::BORDER_TYPE_REFLECT_101, ppl::cv::BORDER_TYPE_REFLECT and ppl::cv::BORDER_TYPE_REPLICATE
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. With a single thread all levels are produced in one top-down sweep: each level keeps a ring of five filtered
+*            rows and emits a row as soon as the level above has produced the rows it depends on, so every
+*            source row is read once and the intermediate levels are consumed while they are still in cache.
+*            With several OpenMP threads the levels are built one after another, each split into stripes.
+*         2. The result of every level is identical to calling PyrDown level by level.
+*         3. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/pyrdown.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/pyrdown.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t levels = 4;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_oImages[levels];
+*     int32_t outStrides[levels];
+*     for (int32_t i = 0, w = W, h = H; i < levels; ++i) {
+*         w = (w + 1) / 2;
+*         h = (h + 1) / 2;
+*         outStrides[i] = w;
+*         dev_oImages[i] = (uint8_t*)malloc(w * h * sizeof(uint8_t));
+*     }
+*
+*     ppl::cv::x86::BuildPyramid<uint8_t, 1>(H, W, W, dev_iImage, levels, outStrides, dev_oImages);
+*
+*     for (int32_t i = 0; i < levels; ++i) {
+*         free(dev_oImages[i]);
+*     }
+*     free(dev_iImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode BuildPyramid(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t maxLevel,
+    const int32_t *outWidthStrides,
+    T **outData,
+    BorderType border_type = BORDER_TYPE_REFLECT_101);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_PYRDOWN_H_
@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_PYRUP_H_
+#define __ST_HPC_PPL_CV_X86_PYRUP_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Upsamples an image by 2 and blurs it with the 5x5 Gaussian kernel [1 4 6 4 1]^T * [1 4 6 4 1] / 64.
+* @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outWidthStride    output image's width stride, usually it equals to `inWidth * 2 * channels`
+* @param outData           output image data, its size is `inHeight * 2` x `inWidth * 2`
+* @param border_type       only ppl::cv::BORDER_TYPE_REFLECT_101 is supported, the same as cv::pyrUp
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. Upsampling and filtering are done in one pass, the zero samples inserted by upsampling are
+*            skipped, so every output pixel is a 3-tap or 2-tap sum of input pixels in each direction.
+*         2. uint8_t images are filtered in 16-bit fixed point and are bit exact with cv::pyrUp.
+*         3. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/pyrup.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/pyrup.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 320;
+*     const int32_t H = 240;
+*     const int32_t C = 3;
+*     float* dev_iImage = (float*)malloc(W * H * C * sizeof(float));
+*     float* dev_oImage = (float*)malloc(W * 2 * H * 2 * C * sizeof(float));
+*
+*     ppl::cv::x86::PyrUp<float, 3>(H, W, W * C, dev_iImage, W * 2 * C, dev_oImage);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode PyrUp(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    BorderType border_type = BORDER_TYPE_REFLECT_101);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_PYRUP_H_
@@ -0,0 +1,317 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_REMAP_H_
+#define __ST_HPC_PPL_CV_X86_REMAP_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Remaps an image with linear interpolation, outData(x, y) = inData(mapX(x, y), mapY(x, y)).
+* @tparam T The data type of input image and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outHeight         output image's height, also the height of the maps
+* @param outWidth          output image's width, also the width of the maps
+* @param outWidthStride    output image's width stride, usually it equals to `outWidth * channels`
+* @param outData           output image data
+* @param mapX              x coordinates of the sampled input pixels, outHeight x outWidth without padding
+* @param mapY              y coordinates of the sampled input pixels, outHeight x outWidth without padding
+* @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT/ppl::cv::BORDER_TYPE_REPLICATE/ppl::cv::BORDER_TYPE_TRANSPARENT
+* @param border_value      border value for BORDER_TYPE_CONSTANT
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. Coordinates are rounded to 1/32 pixel like cv::remap, the float maps are converted row by row
+*            with the same rules as ConvertMaps, so both overloads give identical results.
+*         2. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/remap.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/remap.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * C * sizeof(uint8_t));
+*     float* mapX = (float*)malloc(W * H * sizeof(float));
+*     float* mapY = (float*)malloc(W * H * sizeof(float));
+*     for (int32_t i = 0; i < H; ++i) {
+*         for (int32_t j = 0; j < W; ++j) {
+*             mapX[i * W + j] = W - 1 - j;
+*             mapY[i * W + j] = i;
+*         }
+*     }
+*
+*     ppl::cv::x86::RemapLinear<uint8_t, 3>(H, W, W * C, dev_iImage, H, W, W * C, dev_oImage, mapX, mapY);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     free(mapX);
+*     free(mapY);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode RemapLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type = BORDER_TYPE_CONSTANT,
+    T border_value = 0);
+
+/**
+* @brief Remaps an image with linear interpolation using the fixed-point maps made by ConvertMaps.
+* @tparam T The data type of input image and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outHeight         output image's height, also the height of the maps
+* @param outWidth          output image's width, also the width of the maps
+* @param outWidthStride    output image's width stride, usually it equals to `outWidth * channels`
+* @param outData           output image data
+* @param mapXY             integer (x, y) pairs of the top-left taps, outHeight x outWidth x 2 without padding
+* @param mapFrac           fractional offsets `fy * 32 + fx` in 1/32 pixel, outHeight x outWidth without padding
+* @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT/ppl::cv::BORDER_TYPE_REPLICATE/ppl::cv::BORDER_TYPE_TRANSPARENT
+* @param border_value      border value for BORDER_TYPE_CONSTANT
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. This is the per-frame path when the same maps are applied to many images. On AVX2 machines
+*            the taps are fetched with gathers and uint8_t images are blended with 16-bit integer weights.
+*         2. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/remap.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/remap.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     float* mapX = (float*)malloc(W * H * sizeof(float));
+*     float* mapY = (float*)malloc(W * H * sizeof(float));
+*     int16_t* mapXY = (int16_t*)malloc(W * H * 2 * sizeof(int16_t));
+*     uint16_t* mapFrac = (uint16_t*)malloc(W * H * sizeof(uint16_t));
+*     // fill mapX and mapY once, e.g. with an undistortion model
+*     ppl::cv::x86::ConvertMaps(H, W, mapX, mapY, mapXY, mapFrac);
+*
+*     // for every frame
+*     ppl::cv::x86::RemapLinear<uint8_t, 1>(H, W, W, dev_iImage, H, W, W, dev_oImage, mapXY, mapFrac);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     free(mapX);
+*     free(mapY);
+*     free(mapXY);
+*     free(mapFrac);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode RemapLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    BorderType border_type = BORDER_TYPE_CONSTANT,
+    T border_value = 0);
+
+/**
+* @brief Remaps an image with nearest neighbor interpolation, outData(x, y) = inData(mapX(x, y), mapY(x, y)).
+* @tparam T The data type of input image and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outHeight         output image's height, also the height of the maps
+* @param outWidth          output image's width, also the width of the maps
+* @param outWidthStride    output image's width stride, usually it equals to `outWidth * channels`
+* @param outData           output image data
+* @param mapX              x coordinates of the sampled input pixels, outHeight x outWidth without padding
+* @param mapY              y coordinates of the sampled input pixels, outHeight x outWidth without padding
+* @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT/ppl::cv::BORDER_TYPE_REPLICATE/ppl::cv::BORDER_TYPE_TRANSPARENT
+* @param border_value      border value for BORDER_TYPE_CONSTANT
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. Coordinates are rounded to the nearest integer like cv::remap.
+*         2. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/remap.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode RemapNearestPoint(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type = BORDER_TYPE_CONSTANT,
+    T border_value = 0);
+
+/**
+* @brief Remaps an image with nearest neighbor interpolation using the integer map made by ConvertMaps.
+* @tparam T The data type of input image and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outHeight         output image's height, also the height of the map
+* @param outWidth          output image's width, also the width of the map
+* @param outWidthStride    output image's width stride, usually it equals to `outWidth * channels`
+* @param outData           output image data
+* @param mapXY             integer (x, y) pairs of the sampled pixels, outHeight x outWidth x 2 without padding
+* @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT/ppl::cv::BORDER_TYPE_REPLICATE/ppl::cv::BORDER_TYPE_TRANSPARENT
+* @param border_value      border value for BORDER_TYPE_CONSTANT
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. On AVX2 machines 4-byte pixels (uint8_t with 4 channels, float with 1 channel) are fetched
+*            with masked gathers.
+*         2. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/remap.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode RemapNearestPoint(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const int16_t *mapXY,
+    BorderType border_type = BORDER_TYPE_CONSTANT,
+    T border_value = 0);
+
+/**
+* @brief Converts float maps to the packed fixed-point maps used by the per-frame Remap overloads.
+* @param height            height of the maps
+* @param width             width of the maps
+* @param mapX              x coordinates, height x width without padding
+* @param mapY              y coordinates, height x width without padding
+* @param mapXY             output integer (x, y) pairs, height x width x 2 without padding
+* @param mapFrac           output fractional offsets `fy * 32 + fx` in 1/32 pixel, height x width without padding,
+*                          it is not written and may be nullptr for INTERPOLATION_TYPE_NEAREST_POINT
+* @param inter_mode        INTERPOLATION_TYPE_LINEAR keeps the floor of the coordinates and their fraction,
+*                          INTERPOLATION_TYPE_NEAREST_POINT keeps the rounded coordinates only
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. The packed layout is the CV_16SC2 plus CV_16UC1 pair produced by cv::convertMaps, coordinates
+*            outside the int16_t range saturate.
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/remap.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+***************************************************************************************************/
+::ppl::common::RetCode ConvertMaps(
+    int32_t height,
+    int32_t width,
+    const float *mapX,
+    const float *mapY,
+    int16_t *mapXY,
+    uint16_t *mapFrac,
+    InterpolationType inter_mode = INTERPOLATION_TYPE_LINEAR);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_REMAP_H_
@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_ROTATE_H_
+#define __ST_HPC_PPL_CV_X86_ROTATE_H_
+
+#include "ppl/common/retcode.h"
+#include <stdint.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Rotates a 2D array clockwise in multiples of 90 degrees.
+* @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outHeight         output image's height, equals to `inWidth` for 90 and 270 degrees and `inHeight` for 180 degrees
+* @param outWidth          output image's width, equals to `inHeight` for 90 and 270 degrees and `inWidth` for 180 degrees
+* @param outWidthStride    output image's width stride, usually it equals to `outWidth * channels`
+* @param outData           output image data, must not overlap with inData
+* @param degree            rotation angle, 90, 180 and 270 are supported.
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The fllowing table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/rotate.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/rotate.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     const int32_t C = 3;
+*     float* dev_iImage = (float*)malloc(W * H * C * sizeof(float));
+*     float* dev_oImage = (float*)malloc(W * H * C * sizeof(float));
+*
+*     ppl::cv::x86::Rotate<float, 3>(H, W, W * C, dev_iImage, W, H, H * C, dev_oImage, 90);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode Rotate(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t degree);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_ROTATE_H_
@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_THRESHOLD_H_
+#define __ST_HPC_PPL_CV_X86_THRESHOLD_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Applies a fixed-level threshold to each array element.
+* @tparam T The data type of input and output image, currently \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param height            input&output image's height
+* @param width             input&output image's width
+* @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+* @param inData            input image data
+* @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+* @param outData           output image data
+* @param thresh            threshold value, ignored when CV_THRESH_OTSU or CV_THRESH_TRIANGLE is set
+* @param maxValue          maximum value to use with the CV_THRESH_BINARY and CV_THRESH_BINARY_INV thresholding types
+* @param thresholdType     one of CV_THRESH_BINARY, CV_THRESH_BINARY_INV, CV_THRESH_TRUNC, CV_THRESH_TOZERO and
+*                          CV_THRESH_TOZERO_INV, optionally combined with CV_THRESH_OTSU or CV_THRESH_TRIANGLE
+* @param computedThresh    if not nullptr, receives the threshold value actually used
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. CV_THRESH_OTSU and CV_THRESH_TRIANGLE are only supported for uint8_t single-channel images.
+*         2. For uint8_t images the threshold is rounded down to an integer, the same as OpenCV.
+*         3. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t<td>1
+* <tr><td>uint8_t<td>3
+* <tr><td>uint8_t<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/threshold.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/threshold.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t W = 640;
+*     const int32_t H = 480;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(W * H * sizeof(uint8_t));
+*     float otsu_thresh;
+*
+*     ppl::cv::x86::Threshold<uint8_t, 1>(H, W, W, dev_iImage, W, dev_oImage, 0.0f, 255.0f,
+*                                         ppl::cv::CV_THRESH_BINARY | ppl::cv::CV_THRESH_OTSU,
+*                                         &otsu_thresh);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode Threshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    float thresh,
+    float maxValue,
+    int32_t thresholdType,
+    float *computedThresh = nullptr);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_THRESHOLD_H_
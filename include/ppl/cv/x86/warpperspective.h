@@ -0,0 +1,171 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_WARPPERSPECTIVE_H_
+#define __ST_HPC_PPL_CV_X86_WARPPERSPECTIVE_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/cv/types.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+/**
+* @brief Perspective transformation with nearest neighbor interpolation method
+* @tparam T The data type of input image and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outHeight         output image's height
+* @param outWidth          output image's width
+* @param outWidthStride    the width stride of output image, usually it equals to `outWidth * channels`
+* @param outData           output image data
+* @param perspectiveMatrix 3x3 row-major matrix mapping output coordinates to input coordinates,
+*                          inData(x', y') is sampled with (x' * w, y' * w, w) = M * (x, y, 1)
+* @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT/ppl::cv::BORDER_TYPE_REPLICATE/ppl::cv::BORDER_TYPE_TRANSPARENT
+* @param border_value      border value for BORDER_TYPE_CONSTANT
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. The matrix is the inverse map, the same as cv::warpPerspective with cv::WARP_INVERSE_MAP.
+*         2. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/warpperspective.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/warpperspective.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t inWidth = 640;
+*     const int32_t inHeight = 480;
+*     const int32_t outWidth = 320;
+*     const int32_t outHeight = 240;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(inWidth * inHeight * C * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(outWidth * outHeight * C * sizeof(uint8_t));
+*     double perspectiveMatrix[9] = {2.0, 0.1, 0.0, 0.0, 2.0, 0.0, 0.0, 0.0005, 1.0};
+*
+*     ppl::cv::x86::WarpPerspectiveNearestPoint<uint8_t, 3>(inHeight, inWidth, inWidth * C, dev_iImage, outHeight, outWidth, outWidth * C, dev_oImage, perspectiveMatrix, ppl::cv::BORDER_TYPE_CONSTANT);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode WarpPerspectiveNearestPoint(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type = BORDER_TYPE_CONSTANT,
+    T border_value = 0);
+
+/**
+* @brief Perspective transformation with linear interpolation method
+* @tparam T The data type of input image and output image, currently only \a uint8_t and \a float are supported.
+* @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+* @param inHeight          input image's height
+* @param inWidth           input image's width
+* @param inWidthStride     input image's width stride, usually it equals to `inWidth * channels`
+* @param inData            input image data
+* @param outHeight         output image's height
+* @param outWidth          output image's width
+* @param outWidthStride    the width stride of output image, usually it equals to `outWidth * channels`
+* @param outData           output image data
+* @param perspectiveMatrix 3x3 row-major matrix mapping output coordinates to input coordinates,
+*                          inData(x', y') is sampled with (x' * w, y' * w, w) = M * (x, y, 1)
+* @param border_type       support ppl::cv::BORDER_TYPE_CONSTANT/ppl::cv::BORDER_TYPE_REPLICATE/ppl::cv::BORDER_TYPE_TRANSPARENT
+* @param border_value      border value for BORDER_TYPE_CONSTANT
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark 1. The matrix is the inverse map, the same as cv::warpPerspective with cv::WARP_INVERSE_MAP.
+*         2. Source coordinates are rounded to 1/32 pixel and sampled like RemapLinear.
+*         3. The following table show which data type and channels are supported.
+* <table>
+* <tr><th>Data type(T)<th>channels
+* <tr><td>uint8_t(uchar)<td>1
+* <tr><td>uint8_t(uchar)<td>3
+* <tr><td>uint8_t(uchar)<td>4
+* <tr><td>float<td>1
+* <tr><td>float<td>3
+* <tr><td>float<td>4
+* </table>
+* <table>
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/warpperspective.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/warpperspective.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t inWidth = 640;
+*     const int32_t inHeight = 480;
+*     const int32_t outWidth = 320;
+*     const int32_t outHeight = 240;
+*     const int32_t C = 3;
+*     uint8_t* dev_iImage = (uint8_t*)malloc(inWidth * inHeight * C * sizeof(uint8_t));
+*     uint8_t* dev_oImage = (uint8_t*)malloc(outWidth * outHeight * C * sizeof(uint8_t));
+*     double perspectiveMatrix[9] = {2.0, 0.1, 0.0, 0.0, 2.0, 0.0, 0.0, 0.0005, 1.0};
+*
+*     ppl::cv::x86::WarpPerspectiveLinear<uint8_t, 3>(inHeight, inWidth, inWidth * C, dev_iImage, outHeight, outWidth, outWidth * C, dev_oImage, perspectiveMatrix, ppl::cv::BORDER_TYPE_CONSTANT);
+*
+*     free(dev_iImage);
+*     free(dev_oImage);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+template <typename T, int32_t channels>
+::ppl::common::RetCode WarpPerspectiveLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type = BORDER_TYPE_CONSTANT,
+    T border_value = 0);
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //!__ST_HPC_PPL_CV_X86_WARPPERSPECTIVE_H_
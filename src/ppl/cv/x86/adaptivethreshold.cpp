@@ -0,0 +1,449 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/adaptivethreshold.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <string.h>
+#include <cmath>
+#include <vector>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// same kernel as cv::getGaussianKernel(ksize, 0) used by cv::adaptiveThreshold
+static void create_gaussian_kernel(int32_t ksize, float *kernel)
+{
+    static const float small_gaussian_tab[][7] = {
+        {1.f},
+        {0.25f, 0.5f, 0.25f},
+        {0.0625f, 0.25f, 0.375f, 0.25f, 0.0625f},
+        {0.03125f, 0.109375f, 0.21875f, 0.28125f, 0.21875f, 0.109375f, 0.03125f}};
+    if (ksize <= 7) {
+        memcpy(kernel, small_gaussian_tab[ksize >> 1], ksize * sizeof(float));
+        return;
+    }
+    double sigma  = ((ksize - 1) * 0.5 - 1) * 0.3 + 0.8;
+    double scale2 = -0.5 / (sigma * sigma);
+    std::vector<double> values(ksize);
+    double sum = 0;
+    for (int32_t i = 0; i < ksize; ++i) {
+        double x  = i - (ksize - 1) * 0.5;
+        values[i] = std::exp(scale2 * x * x);
+        sum += values[i];
+    }
+    sum = 1. / sum;
+    for (int32_t i = 0; i < ksize; ++i) {
+        kernel[i] = static_cast<float>(values[i] * sum);
+    }
+}
+
+static inline uint8_t threshold_mask(bool cond, uint8_t imaxval, int32_t thresholdType)
+{
+    return (cond ^ (thresholdType == THRESH_BINARY_INV)) ? imaxval : 0;
+}
+
+static void colsum_update_sse(
+    int32_t width,
+    const uint8_t *add_row,
+    const uint8_t *sub_row,
+    int32_t *colsum)
+{
+    int32_t x = 0;
+    for (; x <= width - 16; x += 16) {
+        __m128i v_add  = _mm_loadu_si128((const __m128i *)(add_row + x));
+        __m128i v_sub  = _mm_loadu_si128((const __m128i *)(sub_row + x));
+        __m128i v_diff0 = _mm_sub_epi16(_mm_cvtepu8_epi16(v_add), _mm_cvtepu8_epi16(v_sub));
+        __m128i v_diff1 = _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(v_add, 8)),
+                                        _mm_cvtepu8_epi16(_mm_srli_si128(v_sub, 8)));
+        __m128i *p = (__m128i *)(colsum + x);
+        _mm_storeu_si128(p + 0, _mm_add_epi32(_mm_loadu_si128(p + 0), _mm_cvtepi16_epi32(v_diff0)));
+        _mm_storeu_si128(p + 1, _mm_add_epi32(_mm_loadu_si128(p + 1), _mm_cvtepi16_epi32(_mm_srli_si128(v_diff0, 8))));
+        _mm_storeu_si128(p + 2, _mm_add_epi32(_mm_loadu_si128(p + 2), _mm_cvtepi16_epi32(v_diff1)));
+        _mm_storeu_si128(p + 3, _mm_add_epi32(_mm_loadu_si128(p + 3), _mm_cvtepi16_epi32(_mm_srli_si128(v_diff1, 8))));
+    }
+    for (; x < width; ++x) {
+        colsum[x] += add_row[x] - sub_row[x];
+    }
+}
+
+// prefix[0] = 0, prefix[i + 1] = prefix[i] + src[i] modulo 2^32, differences of prefix give
+// the sums of src exactly as long as they fit uint32
+static void prefix_sum_sse(int32_t n, const int32_t *src, uint32_t *prefix)
+{
+    prefix[0]     = 0;
+    __m128i carry = _mm_setzero_si128();
+    int32_t i     = 0;
+    for (; i <= n - 4; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        v         = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+        v         = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+        v         = _mm_add_epi32(v, carry);
+        _mm_storeu_si128((__m128i *)(prefix + i + 1), v);
+        carry = _mm_shuffle_epi32(v, 0xFF);
+    }
+    for (; i < n; ++i) {
+        prefix[i + 1] = prefix[i] + (uint32_t)src[i];
+    }
+}
+
+// src - round(sum / area) > -idelta  <=>  area * (2 * (src + idelta) - 1) > 2 * sum,
+// area is odd so there is no tie and no division is needed. With |idelta| <= 256 both sides
+// take up to 43 bits and are compared in int64.
+// The box sums fit uint32 for blockSize <= MEAN_MAX_UINT32_BLOCK_SIZE, larger blocks use int64 prefix sums.
+static const int32_t MEAN_MAX_UINT32_BLOCK_SIZE = 4103;
+
+// area * u > 2 * sum in int64 for 4 lanes of int32 u and uint32 sum, as int32 masks
+static inline __m128i mean_compare_epi64(__m128i v_u, __m128i v_sum, __m128i v_area)
+{
+    __m128i v_lhs0 = _mm_mul_epi32(v_u, v_area);
+    __m128i v_lhs1 = _mm_mul_epi32(_mm_srli_epi64(v_u, 32), v_area);
+    __m128i v_rhs0 = _mm_slli_epi64(_mm_and_si128(v_sum, _mm_set_epi32(0, -1, 0, -1)), 1);
+    __m128i v_rhs1 = _mm_slli_epi64(_mm_srli_epi64(v_sum, 32), 1);
+    // the sign of rhs - lhs is in the high half of every 64-bit lane
+    __m128i v_neg0 = _mm_srai_epi32(_mm_sub_epi64(v_rhs0, v_lhs0), 31);
+    __m128i v_neg1 = _mm_srai_epi32(_mm_sub_epi64(v_rhs1, v_lhs1), 31);
+    return _mm_blend_epi16(_mm_srli_epi64(v_neg0, 32), v_neg1, 0xCC);
+}
+
+static void mean_threshold_row_sse(
+    int32_t width,
+    int32_t ksize,
+    const uint32_t *prefix,
+    const uint8_t *src,
+    int32_t idelta,
+    uint8_t imaxval,
+    int32_t thresholdType,
+    uint8_t *dst)
+{
+    const int32_t area  = ksize * ksize;
+    const int32_t bias  = 2 * idelta - 1;
+    __m128i v_area      = _mm_set1_epi32(area);
+    __m128i v_bias      = _mm_set1_epi32(bias);
+    __m128i v_maxval    = _mm_set1_epi8(static_cast<char>(imaxval));
+    int32_t x           = 0;
+    for (; x <= width - 16; x += 16) {
+        __m128i v_src = _mm_loadu_si128((const __m128i *)(src + x));
+        __m128i v_mask[4];
+        for (int32_t k = 0; k < 4; ++k) {
+            __m128i v_sum = _mm_sub_epi32(_mm_loadu_si128((const __m128i *)(prefix + x + 4 * k + ksize)),
+                                          _mm_loadu_si128((const __m128i *)(prefix + x + 4 * k)));
+            __m128i v_u   = _mm_add_epi32(_mm_slli_epi32(_mm_cvtepu8_epi32(v_src), 1), v_bias);
+            v_mask[k]     = mean_compare_epi64(v_u, v_sum, v_area);
+            v_src         = _mm_srli_si128(v_src, 4);
+        }
+        __m128i v_dst = _mm_packs_epi16(_mm_packs_epi32(v_mask[0], v_mask[1]),
+                                        _mm_packs_epi32(v_mask[2], v_mask[3]));
+        if (thresholdType == THRESH_BINARY) {
+            v_dst = _mm_and_si128(v_dst, v_maxval);
+        } else {
+            v_dst = _mm_andnot_si128(v_dst, v_maxval);
+        }
+        _mm_storeu_si128((__m128i *)(dst + x), v_dst);
+    }
+    for (; x < width; ++x) {
+        uint32_t sum = prefix[x + ksize] - prefix[x];
+        dst[x]       = threshold_mask((int64_t)area * (2 * src[x] + bias) > 2 * (int64_t)sum, imaxval, thresholdType);
+    }
+}
+
+// blocks whose box sums do not fit uint32, the same compare on int64 prefix sums
+static void mean_threshold_row_wide(
+    int32_t width,
+    int32_t ksize,
+    const int64_t *prefix,
+    const uint8_t *src,
+    int32_t idelta,
+    uint8_t imaxval,
+    int32_t thresholdType,
+    uint8_t *dst)
+{
+    const int64_t area = (int64_t)ksize * ksize;
+    const int32_t bias = 2 * idelta - 1;
+    for (int32_t x = 0; x < width; ++x) {
+        int64_t sum = prefix[x + ksize] - prefix[x];
+        dst[x]      = threshold_mask(area * (2 * src[x] + bias) > 2 * sum, imaxval, thresholdType);
+    }
+}
+
+static void gaussian_row_sse(
+    int32_t width,
+    int32_t ksize,
+    const float *kernel,
+    const float *src,
+    float *dst)
+{
+    const int32_t radius = ksize / 2;
+    int32_t x            = 0;
+    for (; x <= width - 4; x += 4) {
+        __m128 v_acc = _mm_mul_ps(_mm_set1_ps(kernel[radius]), _mm_loadu_ps(src + x + radius));
+        for (int32_t k = 0; k < radius; ++k) {
+            __m128 v_pair = _mm_add_ps(_mm_loadu_ps(src + x + k), _mm_loadu_ps(src + x + ksize - 1 - k));
+            v_acc         = _mm_add_ps(v_acc, _mm_mul_ps(_mm_set1_ps(kernel[k]), v_pair));
+        }
+        _mm_storeu_ps(dst + x, v_acc);
+    }
+    for (; x < width; ++x) {
+        float acc = kernel[radius] * src[x + radius];
+        for (int32_t k = 0; k < radius; ++k) {
+            acc += kernel[k] * (src[x + k] + src[x + ksize - 1 - k]);
+        }
+        dst[x] = acc;
+    }
+}
+
+static void gaussian_col_threshold_sse(
+    int32_t width,
+    int32_t ksize,
+    const float *kernel,
+    const float **rows,
+    const uint8_t *src,
+    int32_t idelta,
+    uint8_t imaxval,
+    int32_t thresholdType,
+    uint8_t *dst)
+{
+    const int32_t radius = ksize / 2;
+    __m128i v_idelta     = _mm_set1_epi32(idelta);
+    __m128i v_maxval     = _mm_set1_epi8(static_cast<char>(imaxval));
+    int32_t x            = 0;
+    for (; x <= width - 16; x += 16) {
+        __m128i v_src = _mm_loadu_si128((const __m128i *)(src + x));
+        __m128i v_mask[4];
+        for (int32_t i = 0; i < 4; ++i) {
+            int32_t xi   = x + 4 * i;
+            __m128 v_acc = _mm_mul_ps(_mm_set1_ps(kernel[radius]), _mm_loadu_ps(rows[radius] + xi));
+            for (int32_t k = 0; k < radius; ++k) {
+                __m128 v_pair = _mm_add_ps(_mm_loadu_ps(rows[k] + xi), _mm_loadu_ps(rows[ksize - 1 - k] + xi));
+                v_acc         = _mm_add_ps(v_acc, _mm_mul_ps(_mm_set1_ps(kernel[k]), v_pair));
+            }
+            __m128i v_mean = _mm_cvtps_epi32(v_acc);
+            v_mask[i]      = _mm_cmpgt_epi32(_mm_add_epi32(_mm_cvtepu8_epi32(v_src), v_idelta), v_mean);
+            v_src          = _mm_srli_si128(v_src, 4);
+        }
+        __m128i v_dst = _mm_packs_epi16(_mm_packs_epi32(v_mask[0], v_mask[1]),
+                                        _mm_packs_epi32(v_mask[2], v_mask[3]));
+        if (thresholdType == THRESH_BINARY) {
+            v_dst = _mm_and_si128(v_dst, v_maxval);
+        } else {
+            v_dst = _mm_andnot_si128(v_dst, v_maxval);
+        }
+        _mm_storeu_si128((__m128i *)(dst + x), v_dst);
+    }
+    for (; x < width; ++x) {
+        float acc = kernel[radius] * rows[radius][x];
+        for (int32_t k = 0; k < radius; ++k) {
+            acc += kernel[k] * (rows[k][x] + rows[ksize - 1 - k][x]);
+        }
+        int32_t mean = _mm_cvtss_si32(_mm_set_ss(acc));
+        dst[x]       = threshold_mask(src[x] + idelta > mean, imaxval, thresholdType);
+    }
+}
+
+static void adaptive_threshold_mean(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t imaxval,
+    int32_t thresholdType,
+    int32_t ksize,
+    int32_t idelta,
+    BorderType border_type)
+{
+    const bool use_fma      = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const int32_t radius    = ksize / 2;
+    const int32_t ext_width = width + ksize - 1;
+
+    std::vector<int32_t> xofs(ext_width);
+    for (int32_t i = 0; i < ext_width; ++i) {
+        xofs[i] = border_interpolate(i - radius, width, border_type);
+    }
+    // colsum[radius + x] is the vertical box sum of column x, the borders are refilled per row
+    std::vector<int32_t> colsum(ext_width, 0);
+    const bool wide = ksize > MEAN_MAX_UINT32_BLOCK_SIZE;
+    std::vector<uint32_t> prefix(wide ? 0 : ext_width + 1);
+    std::vector<int64_t> wide_prefix(wide ? ext_width + 1 : 0);
+    std::vector<uint8_t> zeros(width, 0);
+    int32_t *colsum_data = colsum.data() + radius;
+
+    for (int32_t i = -radius; i <= radius; ++i) {
+        const uint8_t *row = inData + border_interpolate(i, height, border_type) * inWidthStride;
+        if (use_fma) {
+            fma::adaptivethreshold_colsum_update_fma(width, row, zeros.data(), colsum_data);
+        } else {
+            colsum_update_sse(width, row, zeros.data(), colsum_data);
+        }
+    }
+
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t i = 0; i < radius; ++i) {
+            colsum[i]                 = colsum_data[xofs[i]];
+            colsum[radius + width + i] = colsum_data[xofs[radius + width + i]];
+        }
+        const uint8_t *src = inData + y * inWidthStride;
+        uint8_t *dst       = outData + y * outWidthStride;
+        if (wide) {
+            wide_prefix[0] = 0;
+            for (int32_t i = 0; i < ext_width; ++i) {
+                wide_prefix[i + 1] = wide_prefix[i] + colsum[i];
+            }
+            mean_threshold_row_wide(width, ksize, wide_prefix.data(), src, idelta, imaxval, thresholdType, dst);
+        } else {
+            prefix_sum_sse(ext_width, colsum.data(), prefix.data());
+            if (use_fma) {
+                fma::adaptivethreshold_mean_row_fma(width, ksize, prefix.data(), src, idelta, imaxval, thresholdType, dst);
+            } else {
+                mean_threshold_row_sse(width, ksize, prefix.data(), src, idelta, imaxval, thresholdType, dst);
+            }
+        }
+
+        if (y + 1 < height) {
+            const uint8_t *add_row = inData + border_interpolate(y + radius + 1, height, border_type) * inWidthStride;
+            const uint8_t *sub_row = inData + border_interpolate(y - radius, height, border_type) * inWidthStride;
+            if (use_fma) {
+                fma::adaptivethreshold_colsum_update_fma(width, add_row, sub_row, colsum_data);
+            } else {
+                colsum_update_sse(width, add_row, sub_row, colsum_data);
+            }
+        }
+    }
+}
+
+static void adaptive_threshold_gaussian(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t imaxval,
+    int32_t thresholdType,
+    int32_t ksize,
+    int32_t idelta,
+    BorderType border_type)
+{
+    const bool use_fma      = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const int32_t radius    = ksize / 2;
+    const int32_t ext_width = width + ksize - 1;
+
+    std::vector<float> kernel(ksize);
+    create_gaussian_kernel(ksize, kernel.data());
+    std::vector<int32_t> xofs(ext_width);
+    for (int32_t i = 0; i < ext_width; ++i) {
+        xofs[i] = border_interpolate(i - radius, width, border_type);
+    }
+    std::vector<float> ext_row(ext_width);
+    // ring buffer of horizontally filtered rows, virtual row v lives in slot (v + radius) % ksize
+    std::vector<float> ring(static_cast<size_t>(ksize) * width);
+    std::vector<const float *> rows(ksize);
+
+    auto filter_row = [&](int32_t v) {
+        const uint8_t *src = inData + border_interpolate(v, height, border_type) * inWidthStride;
+        for (int32_t i = 0; i < ext_width; ++i) {
+            ext_row[i] = src[xofs[i]];
+        }
+        float *dst = ring.data() + static_cast<size_t>((v + radius) % ksize) * width;
+        if (use_fma) {
+            fma::adaptivethreshold_gaussian_row_fma(width, ksize, kernel.data(), ext_row.data(), dst);
+        } else {
+            gaussian_row_sse(width, ksize, kernel.data(), ext_row.data(), dst);
+        }
+    };
+
+    for (int32_t v = -radius; v < radius; ++v) {
+        filter_row(v);
+    }
+    for (int32_t y = 0; y < height; ++y) {
+        filter_row(y + radius);
+        for (int32_t k = 0; k < ksize; ++k) {
+            rows[k] = ring.data() + static_cast<size_t>((y + k) % ksize) * width;
+        }
+        const uint8_t *src = inData + y * inWidthStride;
+        uint8_t *dst       = outData + y * outWidthStride;
+        if (use_fma) {
+            fma::adaptivethreshold_gaussian_col_fma(width, ksize, kernel.data(), rows.data(), src, idelta, imaxval, thresholdType, dst);
+        } else {
+            gaussian_col_threshold_sse(width, ksize, kernel.data(), rows.data(), src, idelta, imaxval, thresholdType, dst);
+        }
+    }
+}
+
+::ppl::common::RetCode AdaptiveThreshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float maxValue,
+    int32_t adaptiveMethod,
+    int32_t thresholdType,
+    int32_t blockSize,
+    float delta,
+    BorderType border_type)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width || outWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (adaptiveMethod != ADAPTIVE_THRESH_MEAN_C && adaptiveMethod != ADAPTIVE_THRESH_GAUSSIAN_C) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (thresholdType != THRESH_BINARY && thresholdType != THRESH_BINARY_INV) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (blockSize <= 1 || (blockSize & 1) == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (border_type != BORDER_TYPE_REPLICATE && border_type != BORDER_TYPE_REFLECT &&
+        border_type != BORDER_TYPE_REFLECT_101) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    if (maxValue < 0) {
+        for (int32_t i = 0; i < height; ++i) {
+            memset(outData + i * outWidthStride, 0, width * sizeof(uint8_t));
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+    uint8_t imaxval = maxValue > 255.f ? 255 : static_cast<uint8_t>(std::rint(maxValue));
+    // |src - mean| <= 255, so clamping delta keeps the result and avoids overflow
+    float fdelta   = thresholdType == THRESH_BINARY ? std::ceil(delta) : std::floor(delta);
+    fdelta         = fdelta > 256.f ? 256.f : (fdelta < -256.f ? -256.f : fdelta);
+    int32_t idelta = static_cast<int32_t>(fdelta);
+
+    if (adaptiveMethod == ADAPTIVE_THRESH_MEAN_C) {
+        adaptive_threshold_mean(height, width, inWidthStride, inData, outWidthStride, outData, imaxval, thresholdType, blockSize, idelta, border_type);
+    } else {
+        adaptive_threshold_gaussian(height, width, inWidthStride, inData, outWidthStride, outData, imaxval, thresholdType, blockSize, idelta, border_type);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/adaptivethreshold.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+
+namespace {
+
+template<int32_t adaptive_method, int32_t block_size>
+void BM_AdaptiveThreshold_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::AdaptiveThreshold(height, width, width, src.get(), width, dst.get(),
+                                        255.f, adaptive_method, ppl::cv::THRESH_BINARY, block_size, 2.f,
+                                        ppl::cv::BORDER_TYPE_REPLICATE);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_AdaptiveThreshold_ppl_x86, ppl::cv::ADAPTIVE_THRESH_MEAN_C, 3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AdaptiveThreshold_ppl_x86, ppl::cv::ADAPTIVE_THRESH_MEAN_C, 31)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AdaptiveThreshold_ppl_x86, ppl::cv::ADAPTIVE_THRESH_GAUSSIAN_C, 3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AdaptiveThreshold_ppl_x86, ppl::cv::ADAPTIVE_THRESH_GAUSSIAN_C, 31)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<int32_t adaptive_method, int32_t block_size>
+void BM_AdaptiveThreshold_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    cv::Mat src_opencv(height, width, CV_8UC1, src.get(), width);
+    cv::Mat dst_opencv(height, width, CV_8UC1, dst.get(), width);
+    int32_t cv_method = adaptive_method == ppl::cv::ADAPTIVE_THRESH_MEAN_C ? cv::ADAPTIVE_THRESH_MEAN_C : cv::ADAPTIVE_THRESH_GAUSSIAN_C;
+    for (auto _ : state) {
+        cv::adaptiveThreshold(src_opencv, dst_opencv, 255., cv_method, cv::THRESH_BINARY, block_size, 2.);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_AdaptiveThreshold_opencv_x86, ppl::cv::ADAPTIVE_THRESH_MEAN_C, 3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AdaptiveThreshold_opencv_x86, ppl::cv::ADAPTIVE_THRESH_MEAN_C, 31)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AdaptiveThreshold_opencv_x86, ppl::cv::ADAPTIVE_THRESH_GAUSSIAN_C, 3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_AdaptiveThreshold_opencv_x86, ppl::cv::ADAPTIVE_THRESH_GAUSSIAN_C, 31)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+#endif //! PPLCV_BENCHMARK_OPENCV
+}
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/adaptivethreshold.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+
+template<int32_t adaptive_method, int32_t threshold_type, ppl::cv::BorderType border_type>
+void AdaptiveThresholdTest(int32_t height, int32_t width, int32_t block_size, float delta) {
+    float max_value = 155.f;
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst_ref(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    cv::Mat src_opencv(height, width, CV_8UC1, src.get(), width);
+    cv::Mat dst_opencv(height, width, CV_8UC1, dst_ref.get(), width);
+    cv::BorderTypes cv_border_type = cv::BORDER_REPLICATE;
+    if (border_type == ppl::cv::BORDER_TYPE_REFLECT) {
+        cv_border_type = cv::BORDER_REFLECT;
+    } else if (border_type == ppl::cv::BORDER_TYPE_REFLECT_101) {
+        cv_border_type = cv::BORDER_REFLECT101;
+    }
+    ppl::cv::x86::AdaptiveThreshold(height, width, width, src.get(), width, dst.get(),
+                                    max_value, adaptive_method, threshold_type, block_size, delta, border_type);
+    // cv::adaptiveThreshold always uses BORDER_REPLICATE, build the reference from its two steps instead
+    cv::Mat mean;
+    if (adaptive_method == ppl::cv::ADAPTIVE_THRESH_MEAN_C) {
+        cv::boxFilter(src_opencv, mean, CV_8U, cv::Size(block_size, block_size), cv::Point(-1, -1), true, cv_border_type | cv::BORDER_ISOLATED);
+    } else {
+        cv::GaussianBlur(src_opencv, mean, cv::Size(block_size, block_size), 0, 0, cv_border_type | cv::BORDER_ISOLATED);
+    }
+    int32_t idelta = threshold_type == ppl::cv::THRESH_BINARY ? cvCeil(delta) : cvFloor(delta);
+    for (int32_t i = 0; i < height * width; ++i) {
+        int32_t diff = src[i] - mean.data[i];
+        bool cond = threshold_type == ppl::cv::THRESH_BINARY ? diff > -idelta : diff <= -idelta;
+        dst_ref[i] = cond ? static_cast<uint8_t>(max_value) : 0;
+    }
+    if (adaptive_method == ppl::cv::ADAPTIVE_THRESH_MEAN_C) {
+        checkResult<uint8_t, 1>(dst_ref.get(), dst.get(), height, width, width, width, 1.01f);
+    } else {
+        // the gaussian mean is computed in float instead of opencv's fixed point,
+        // a pixel sitting exactly on the threshold may flip
+        int32_t mismatch = 0;
+        for (int32_t i = 0; i < height * width; ++i) {
+            mismatch += dst_ref[i] != dst[i];
+        }
+        EXPECT_LE(mismatch, height * width / 200);
+    }
+}
+
+#define R(name, method, type, border_type) \
+    TEST(name, x86) \
+    { \
+        AdaptiveThresholdTest<method, type, border_type>(240, 320, 3, 2.f); \
+        AdaptiveThresholdTest<method, type, border_type>(241, 321, 5, -3.5f); \
+        AdaptiveThresholdTest<method, type, border_type>(480, 640, 11, 0.f); \
+        AdaptiveThresholdTest<method, type, border_type>(480, 640, 31, 5.f); \
+        AdaptiveThresholdTest<method, type, border_type>(720, 1280, 101, 1.5f); \
+    } \
+
+R(adaptivethreshold_mean_binary_replicate_x86, ppl::cv::ADAPTIVE_THRESH_MEAN_C, ppl::cv::THRESH_BINARY, ppl::cv::BORDER_TYPE_REPLICATE);
+R(adaptivethreshold_mean_binary_inv_replicate_x86, ppl::cv::ADAPTIVE_THRESH_MEAN_C, ppl::cv::THRESH_BINARY_INV, ppl::cv::BORDER_TYPE_REPLICATE);
+R(adaptivethreshold_mean_binary_reflect_x86, ppl::cv::ADAPTIVE_THRESH_MEAN_C, ppl::cv::THRESH_BINARY, ppl::cv::BORDER_TYPE_REFLECT);
+R(adaptivethreshold_mean_binary_reflect101_x86, ppl::cv::ADAPTIVE_THRESH_MEAN_C, ppl::cv::THRESH_BINARY, ppl::cv::BORDER_TYPE_REFLECT_101);
+R(adaptivethreshold_gaussian_binary_replicate_x86, ppl::cv::ADAPTIVE_THRESH_GAUSSIAN_C, ppl::cv::THRESH_BINARY, ppl::cv::BORDER_TYPE_REPLICATE);
+R(adaptivethreshold_gaussian_binary_inv_replicate_x86, ppl::cv::ADAPTIVE_THRESH_GAUSSIAN_C, ppl::cv::THRESH_BINARY_INV, ppl::cv::BORDER_TYPE_REPLICATE);
+R(adaptivethreshold_gaussian_binary_reflect_x86, ppl::cv::ADAPTIVE_THRESH_GAUSSIAN_C, ppl::cv::THRESH_BINARY, ppl::cv::BORDER_TYPE_REFLECT);
+R(adaptivethreshold_gaussian_binary_reflect101_x86, ppl::cv::ADAPTIVE_THRESH_GAUSSIAN_C, ppl::cv::THRESH_BINARY, ppl::cv::BORDER_TYPE_REFLECT_101);
+
+TEST(adaptivethreshold_mean_block_size_x86, x86)
+{
+    // blocks past the int32 compare, with delta clamped at both ends
+    AdaptiveThresholdTest<ppl::cv::ADAPTIVE_THRESH_MEAN_C, ppl::cv::THRESH_BINARY, ppl::cv::BORDER_TYPE_REPLICATE>(32, 48, 1451, 300.f);
+    AdaptiveThresholdTest<ppl::cv::ADAPTIVE_THRESH_MEAN_C, ppl::cv::THRESH_BINARY_INV, ppl::cv::BORDER_TYPE_REFLECT_101>(33, 47, 2901, -300.f);
+    // row sums of a wide image past INT32_MAX
+    AdaptiveThresholdTest<ppl::cv::ADAPTIVE_THRESH_MEAN_C, ppl::cv::THRESH_BINARY, ppl::cv::BORDER_TYPE_REFLECT>(8, 6000, 1449, 2.f);
+    // box sums past UINT32_MAX
+    AdaptiveThresholdTest<ppl::cv::ADAPTIVE_THRESH_MEAN_C, ppl::cv::THRESH_BINARY, ppl::cv::BORDER_TYPE_REPLICATE>(20, 37, 4105, 1.f);
+}
@@ -0,0 +1,393 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/intrinutils.hpp"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// The 10/16-bit samples are brought to a 13-bit domain so that the whole
+// conversion fits int16 lanes: Y - 16 and U/V - 128 scaled by 4 stay in range
+// and pmulhrsw with Q13 coefficients gives x * coeff back in the 13-bit domain.
+// 8-bit 255 is 8160 there, so outputs are (v + 16) >> 5 for uint8_t,
+// v * 257 / 32 for uint16_t and v / 8160 for float. P010 keeps all 10 bits,
+// P016 is processed at 13-bit precision.
+#define HBD_CY_coeff  9535
+#define HBD_CUB_coeff 16531
+#define HBD_CUG_coeff -3203
+#define HBD_CVG_coeff -6660
+#define HBD_CVR_coeff 13074
+#define HBD_Y_OFFSET  512
+#define HBD_UV_OFFSET 4096
+#define HBD_MAX       8160
+
+static inline int32_t hbd_mulhrs(int32_t x, int32_t c)
+{
+    return (x * 4 * c + (1 << 14)) >> 15;
+}
+
+static inline void store_pixel_hbd(uint8_t *dst, int32_t b, int32_t g, int32_t r)
+{
+    dst[0] = sat_cast_u8((b + 16) >> 5);
+    dst[1] = sat_cast_u8((g + 16) >> 5);
+    dst[2] = sat_cast_u8((r + 16) >> 5);
+}
+
+static inline uint16_t hbd_to_u16(int32_t v)
+{
+    v = std::min(std::max(v, 0), HBD_MAX);
+    return (v << 3) + (v >> 5);
+}
+
+static inline void store_pixel_hbd(uint16_t *dst, int32_t b, int32_t g, int32_t r)
+{
+    dst[0] = hbd_to_u16(b);
+    dst[1] = hbd_to_u16(g);
+    dst[2] = hbd_to_u16(r);
+}
+
+static inline void store_pixel_hbd(float *dst, int32_t b, int32_t g, int32_t r)
+{
+    const float scale = 1.0f / HBD_MAX;
+    dst[0] = std::min(std::max(b, 0), HBD_MAX) * scale;
+    dst[1] = std::min(std::max(g, 0), HBD_MAX) * scale;
+    dst[2] = std::min(std::max(r, 0), HBD_MAX) * scale;
+}
+
+// b, g, r hold 16 pixels as two vectors of 8 int16 each
+static inline void store_bgr_hbd(uint8_t *dst, const __m128i *b, const __m128i *g, const __m128i *r)
+{
+    __m128i v_16 = _mm_set1_epi16(16);
+    __m128i vb   = _mm_packus_epi16(_mm_srai_epi16(_mm_add_epi16(b[0], v_16), 5), _mm_srai_epi16(_mm_add_epi16(b[1], v_16), 5));
+    __m128i vg   = _mm_packus_epi16(_mm_srai_epi16(_mm_add_epi16(g[0], v_16), 5), _mm_srai_epi16(_mm_add_epi16(g[1], v_16), 5));
+    __m128i vr   = _mm_packus_epi16(_mm_srai_epi16(_mm_add_epi16(r[0], v_16), 5), _mm_srai_epi16(_mm_add_epi16(r[1], v_16), 5));
+    v_store_interleave(dst, vb, vg, vr);
+}
+
+static inline __m128i v_hbd_to_u16(__m128i v)
+{
+    v = _mm_min_epi16(_mm_max_epi16(v, _mm_setzero_si128()), _mm_set1_epi16(HBD_MAX));
+    return _mm_add_epi16(_mm_slli_epi16(v, 3), _mm_srli_epi16(v, 5));
+}
+
+static inline void store_bgr_hbd(uint16_t *dst, const __m128i *b, const __m128i *g, const __m128i *r)
+{
+    const __m128i sh_b = _mm_setr_epi8(0, 1, 6, 7, 12, 13, 2, 3, 8, 9, 14, 15, 4, 5, 10, 11);
+    const __m128i sh_g = _mm_setr_epi8(10, 11, 0, 1, 6, 7, 12, 13, 2, 3, 8, 9, 14, 15, 4, 5);
+    const __m128i sh_r = _mm_setr_epi8(4, 5, 10, 11, 0, 1, 6, 7, 12, 13, 2, 3, 8, 9, 14, 15);
+    for (int32_t k = 0; k < 2; ++k) {
+        __m128i vb = _mm_shuffle_epi8(v_hbd_to_u16(b[k]), sh_b);
+        __m128i vg = _mm_shuffle_epi8(v_hbd_to_u16(g[k]), sh_g);
+        __m128i vr = _mm_shuffle_epi8(v_hbd_to_u16(r[k]), sh_r);
+        __m128i v0 = _mm_blend_epi16(_mm_blend_epi16(vb, vg, 0x92), vr, 0x24);
+        __m128i v1 = _mm_blend_epi16(_mm_blend_epi16(vr, vb, 0x92), vg, 0x24);
+        __m128i v2 = _mm_blend_epi16(_mm_blend_epi16(vg, vr, 0x92), vb, 0x24);
+        _mm_storeu_si128((__m128i *)(dst + k * 24), v0);
+        _mm_storeu_si128((__m128i *)(dst + k * 24 + 8), v1);
+        _mm_storeu_si128((__m128i *)(dst + k * 24 + 16), v2);
+    }
+}
+
+static inline void store_bgr_hbd(float *dst, const __m128i *b, const __m128i *g, const __m128i *r)
+{
+    __m128 v_scale = _mm_set1_ps(1.0f / HBD_MAX);
+    __m128i v_max  = _mm_set1_epi16(HBD_MAX);
+    for (int32_t k = 0; k < 2; ++k) {
+        __m128i vb = _mm_min_epi16(_mm_max_epi16(b[k], _mm_setzero_si128()), v_max);
+        __m128i vg = _mm_min_epi16(_mm_max_epi16(g[k], _mm_setzero_si128()), v_max);
+        __m128i vr = _mm_min_epi16(_mm_max_epi16(r[k], _mm_setzero_si128()), v_max);
+        v_store_interleave(dst + k * 24,
+                           _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(vb)), v_scale),
+                           _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(vg)), v_scale),
+                           _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(vr)), v_scale));
+        v_store_interleave(dst + k * 24 + 12,
+                           _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(vb, 8))), v_scale),
+                           _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(vg, 8))), v_scale),
+                           _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(vr, 8))), v_scale));
+    }
+}
+
+// samples to the 13-bit domain, P010/P016 are MSB aligned and I010 is LSB aligned
+template <bool planar>
+static inline __m128i v_hbd_normalize(__m128i v)
+{
+    if (planar) {
+        return _mm_slli_epi16(_mm_min_epu16(v, _mm_set1_epi16(1023)), 3);
+    } else {
+        return _mm_srli_epi16(v, 3);
+    }
+}
+
+template <bool planar>
+static inline int32_t hbd_normalize(uint16_t v)
+{
+    return planar ? std::min<int32_t>(v, 1023) << 3 : v >> 3;
+}
+
+template <typename T, bool planar>
+void yuv420_16u_2_bgr(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUStride,
+    const uint16_t *inU,
+    int32_t inVStride,
+    const uint16_t *inV,
+    int32_t outWidthStride,
+    T *outData)
+{
+    const __m128i v_y_offset  = _mm_set1_epi16(HBD_Y_OFFSET);
+    const __m128i v_uv_offset = _mm_set1_epi16(HBD_UV_OFFSET);
+    const __m128i v_cy        = _mm_set1_epi16(HBD_CY_coeff);
+    const __m128i v_cbr       = _mm_setr_epi16(HBD_CUB_coeff, HBD_CVR_coeff, HBD_CUB_coeff, HBD_CVR_coeff, HBD_CUB_coeff, HBD_CVR_coeff, HBD_CUB_coeff, HBD_CVR_coeff);
+    const __m128i v_cg        = _mm_setr_epi16(HBD_CUG_coeff, HBD_CVG_coeff, HBD_CUG_coeff, HBD_CVG_coeff, HBD_CUG_coeff, HBD_CVG_coeff, HBD_CUG_coeff, HBD_CVG_coeff);
+    const __m128i sh_b        = _mm_setr_epi8(0, 1, 0, 1, 4, 5, 4, 5, 8, 9, 8, 9, 12, 13, 12, 13);
+    const __m128i sh_r        = _mm_setr_epi8(2, 3, 2, 3, 6, 7, 6, 7, 10, 11, 10, 11, 14, 15, 14, 15);
+
+    for (int32_t i = 0; i < height; i += 2) {
+        const uint16_t *y0 = inY + i * inYStride;
+        const uint16_t *y1 = y0 + inYStride;
+        const uint16_t *u  = inU + (i / 2) * inUStride;
+        const uint16_t *v  = planar ? inV + (i / 2) * inVStride : nullptr;
+        T *dst0            = outData + i * outWidthStride;
+        T *dst1            = dst0 + outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i b0[2], g0[2], r0[2], b1[2], g1[2], r1[2];
+            for (int32_t k = 0; k < 2; ++k) {
+                __m128i vuv;
+                if (planar) {
+                    vuv = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(u + j / 2 + k * 4)),
+                                             _mm_loadl_epi64((const __m128i *)(v + j / 2 + k * 4)));
+                } else {
+                    vuv = _mm_loadu_si128((const __m128i *)(u + j + k * 8));
+                }
+                vuv = _mm_slli_epi16(_mm_sub_epi16(v_hbd_normalize<planar>(vuv), v_uv_offset), 2);
+
+                // per chroma sample: [bu, rv] pairs and ug + vg, each duplicated to the two pixels
+                __m128i vbr = _mm_mulhrs_epi16(vuv, v_cbr);
+                __m128i vg  = _mm_mulhrs_epi16(vuv, v_cg);
+                vg          = _mm_hadd_epi16(vg, vg);
+                __m128i vbd = _mm_shuffle_epi8(vbr, sh_b);
+                __m128i vrd = _mm_shuffle_epi8(vbr, sh_r);
+                __m128i vgd = _mm_unpacklo_epi16(vg, vg);
+
+                __m128i vy0 = _mm_max_epi16(_mm_sub_epi16(v_hbd_normalize<planar>(_mm_loadu_si128((const __m128i *)(y0 + j + k * 8))), v_y_offset), _mm_setzero_si128());
+                __m128i vy1 = _mm_max_epi16(_mm_sub_epi16(v_hbd_normalize<planar>(_mm_loadu_si128((const __m128i *)(y1 + j + k * 8))), v_y_offset), _mm_setzero_si128());
+                vy0         = _mm_mulhrs_epi16(_mm_slli_epi16(vy0, 2), v_cy);
+                vy1         = _mm_mulhrs_epi16(_mm_slli_epi16(vy1, 2), v_cy);
+
+                b0[k] = _mm_add_epi16(vy0, vbd);
+                g0[k] = _mm_add_epi16(vy0, vgd);
+                r0[k] = _mm_add_epi16(vy0, vrd);
+                b1[k] = _mm_add_epi16(vy1, vbd);
+                g1[k] = _mm_add_epi16(vy1, vgd);
+                r1[k] = _mm_add_epi16(vy1, vrd);
+            }
+            store_bgr_hbd(dst0 + j * 3, b0, g0, r0);
+            store_bgr_hbd(dst1 + j * 3, b1, g1, r1);
+        }
+        for (; j < width; j += 2) {
+            int32_t cu, cv;
+            if (planar) {
+                cu = hbd_normalize<planar>(u[j / 2]) - HBD_UV_OFFSET;
+                cv = hbd_normalize<planar>(v[j / 2]) - HBD_UV_OFFSET;
+            } else {
+                cu = hbd_normalize<planar>(u[j]) - HBD_UV_OFFSET;
+                cv = hbd_normalize<planar>(u[j + 1]) - HBD_UV_OFFSET;
+            }
+            int32_t bu = hbd_mulhrs(cu, HBD_CUB_coeff);
+            int32_t gu = hbd_mulhrs(cu, HBD_CUG_coeff) + hbd_mulhrs(cv, HBD_CVG_coeff);
+            int32_t rv = hbd_mulhrs(cv, HBD_CVR_coeff);
+            for (int32_t k = 0; k < 2; ++k) {
+                int32_t yy0 = hbd_mulhrs(std::max(hbd_normalize<planar>(y0[j + k]) - HBD_Y_OFFSET, 0), HBD_CY_coeff);
+                int32_t yy1 = hbd_mulhrs(std::max(hbd_normalize<planar>(y1[j + k]) - HBD_Y_OFFSET, 0), HBD_CY_coeff);
+                store_pixel_hbd(dst0 + (j + k) * 3, yy0 + bu, yy0 + gu, yy0 + rv);
+                store_pixel_hbd(dst1 + (j + k) * 3, yy1 + bu, yy1 + gu, yy1 + rv);
+            }
+        }
+    }
+}
+
+template <typename T>
+::ppl::common::RetCode P0102BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUVStride,
+    const uint16_t *inUV,
+    int32_t outWidthStride,
+    T *outData)
+{
+    if (nullptr == inY || nullptr == inUV || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || (width & 1) || (height & 1) || inYStride < width ||
+        inUVStride < width || outWidthStride < width * 3) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    yuv420_16u_2_bgr<T, false>(height, width, inYStride, inY, inUVStride, inUV, 0, nullptr, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+// P016 shares the MSB aligned layout of P010, the kernel only keeps the top 13 bits
+template <typename T>
+::ppl::common::RetCode P0162BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUVStride,
+    const uint16_t *inUV,
+    int32_t outWidthStride,
+    T *outData)
+{
+    return P0102BGR<T>(height, width, inYStride, inY, inUVStride, inUV, outWidthStride, outData);
+}
+
+template <typename T>
+::ppl::common::RetCode I0102BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUStride,
+    const uint16_t *inU,
+    int32_t inVStride,
+    const uint16_t *inV,
+    int32_t outWidthStride,
+    T *outData)
+{
+    if (nullptr == inY || nullptr == inU || nullptr == inV || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || (width & 1) || (height & 1) || inYStride < width ||
+        inUStride < width / 2 || inVStride < width / 2 || outWidthStride < width * 3) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    yuv420_16u_2_bgr<T, true>(height, width, inYStride, inY, inUStride, inU, inVStride, inV, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode P0102BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUVStride,
+    const uint16_t *inUV,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template ::ppl::common::RetCode P0102BGR<uint16_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUVStride,
+    const uint16_t *inUV,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template ::ppl::common::RetCode P0102BGR<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUVStride,
+    const uint16_t *inUV,
+    int32_t outWidthStride,
+    float *outData);
+
+template ::ppl::common::RetCode P0162BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUVStride,
+    const uint16_t *inUV,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template ::ppl::common::RetCode P0162BGR<uint16_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUVStride,
+    const uint16_t *inUV,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template ::ppl::common::RetCode P0162BGR<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUVStride,
+    const uint16_t *inUV,
+    int32_t outWidthStride,
+    float *outData);
+
+template ::ppl::common::RetCode I0102BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUStride,
+    const uint16_t *inU,
+    int32_t inVStride,
+    const uint16_t *inV,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template ::ppl::common::RetCode I0102BGR<uint16_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUStride,
+    const uint16_t *inU,
+    int32_t inVStride,
+    const uint16_t *inV,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template ::ppl::common::RetCode I0102BGR<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inYStride,
+    const uint16_t *inY,
+    int32_t inUStride,
+    const uint16_t *inU,
+    int32_t inVStride,
+    const uint16_t *inV,
+    int32_t outWidthStride,
+    float *outData);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include "ppl/cv/x86/cvtcolor.h"
+#include <memory>
+#include "ppl/cv/debug.h"
+
+namespace {
+
+enum HighBitDepthMode {P010_MODE, I010_MODE};
+
+template<typename T, HighBitDepthMode mode>
+void BM_HighBitDepth2BGR_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint16_t[]> srcY(new uint16_t[width * height]);
+    std::unique_ptr<uint16_t[]> srcUV(new uint16_t[width * height / 2]);
+    std::unique_ptr<T[]> dst(new T[width * height * 3]);
+    ppl::cv::debug::randomFill<uint16_t>(srcY.get(), width * height, 0, 1023);
+    ppl::cv::debug::randomFill<uint16_t>(srcUV.get(), width * height / 2, 0, 1023);
+    for (auto _ : state) {
+        if (mode == P010_MODE) {
+            ppl::cv::x86::P0102BGR<T>(height, width, width, srcY.get(), width, srcUV.get(), width * 3, dst.get());
+        } else {
+            ppl::cv::x86::I0102BGR<T>(height, width, width, srcY.get(), width / 2, srcUV.get(), width / 2, srcUV.get() + width * height / 4, width * 3, dst.get());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_HighBitDepth2BGR_ppl_x86, uint8_t, P010_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_HighBitDepth2BGR_ppl_x86, uint16_t, P010_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_HighBitDepth2BGR_ppl_x86, float, P010_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_HighBitDepth2BGR_ppl_x86, uint8_t, I010_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_HighBitDepth2BGR_ppl_x86, uint16_t, I010_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_HighBitDepth2BGR_ppl_x86, float, I010_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+} // namespace
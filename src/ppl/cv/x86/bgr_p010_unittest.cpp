@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+enum HighBitDepthMode {P010_MODE, P016_MODE, I010_MODE};
+
+// BT.601 limited range on 8-bit scaled real values, uint16_t output maps 255 to 65535
+template<typename T>
+static T HighBitDepthRef(double y, double u, double v, int32_t c) {
+    y = std::max(y - 16.0, 0.0);
+    u -= 128.0;
+    v -= 128.0;
+    double val = c == 0 ? 1.164 * y + 2.018 * u : (c == 1 ? 1.164 * y - 0.391 * u - 0.813 * v : 1.164 * y + 1.596 * v);
+    if (std::is_same<T, float>::value) {
+        return std::min(1.0, std::max(0.0, val / 255.0));
+    } else if (std::is_same<T, uint8_t>::value) {
+        return std::min(255.0, std::max(0.0, std::round(val)));
+    } else {
+        return std::min(65535.0, std::max(0.0, std::round(val * 257.0)));
+    }
+}
+
+template<typename T, HighBitDepthMode mode>
+void HighBitDepthTest(int32_t height, int32_t width, float diff) {
+    std::unique_ptr<uint16_t[]> srcY(new uint16_t[width * height]);
+    std::unique_ptr<uint16_t[]> srcUV(new uint16_t[width * height / 2]);
+    std::unique_ptr<T[]> dst(new T[width * height * 3]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * 3]);
+    uint16_t maxVal = mode == P016_MODE ? 65535 : 1023;
+    ppl::cv::debug::randomFill<uint16_t>(srcY.get(), width * height, 0, maxVal);
+    ppl::cv::debug::randomFill<uint16_t>(srcUV.get(), width * height / 2, 0, maxVal);
+    const uint16_t *srcU = srcUV.get();
+    const uint16_t *srcV = srcUV.get() + width * height / 4;
+    if (mode == P010_MODE) {
+        for (int32_t i = 0; i < width * height; ++i) srcY.get()[i] <<= 6;
+        for (int32_t i = 0; i < width * height / 2; ++i) srcUV.get()[i] <<= 6;
+    }
+
+    if (mode == P010_MODE) {
+        ppl::cv::x86::P0102BGR<T>(height, width, width, srcY.get(), width, srcUV.get(), width * 3, dst.get());
+    } else if (mode == P016_MODE) {
+        ppl::cv::x86::P0162BGR<T>(height, width, width, srcY.get(), width, srcUV.get(), width * 3, dst.get());
+    } else {
+        ppl::cv::x86::I0102BGR<T>(height, width, width, srcY.get(), width / 2, srcU, width / 2, srcV, width * 3, dst.get());
+    }
+
+    for (int32_t i = 0; i < height; ++i) {
+        for (int32_t j = 0; j < width; ++j) {
+            double y, u, v;
+            if (mode == I010_MODE) {
+                y = srcY.get()[i * width + j] / 4.0;
+                u = srcU[(i / 2) * (width / 2) + j / 2] / 4.0;
+                v = srcV[(i / 2) * (width / 2) + j / 2] / 4.0;
+            } else {
+                y = srcY.get()[i * width + j] / 256.0;
+                u = srcUV.get()[(i / 2) * width + (j & ~1)] / 256.0;
+                v = srcUV.get()[(i / 2) * width + (j & ~1) + 1] / 256.0;
+            }
+            for (int32_t c = 0; c < 3; ++c) {
+                dst_ref.get()[(i * width + j) * 3 + c] = HighBitDepthRef<T>(y, u, v, c);
+            }
+        }
+    }
+    checkResult<T, 3>(dst.get(), dst_ref.get(), height, width, width * 3, width * 3, diff);
+}
+
+TEST(P0102BGR_UINT8, x86)
+{
+    HighBitDepthTest<uint8_t, P010_MODE>(640, 720, 1.01f);
+    HighBitDepthTest<uint8_t, P010_MODE>(720, 1082, 1.01f);
+}
+
+TEST(P0102BGR_UINT16, x86)
+{
+    HighBitDepthTest<uint16_t, P010_MODE>(640, 720, 48.0f);
+    HighBitDepthTest<uint16_t, P010_MODE>(720, 1082, 48.0f);
+}
+
+TEST(P0102BGR_FP32, x86)
+{
+    HighBitDepthTest<float, P010_MODE>(640, 720, 1e-3f);
+    HighBitDepthTest<float, P010_MODE>(720, 1082, 1e-3f);
+}
+
+TEST(P0162BGR_UINT8, x86)
+{
+    HighBitDepthTest<uint8_t, P016_MODE>(640, 720, 1.01f);
+    HighBitDepthTest<uint8_t, P016_MODE>(720, 1082, 1.01f);
+}
+
+TEST(P0162BGR_UINT16, x86)
+{
+    HighBitDepthTest<uint16_t, P016_MODE>(640, 720, 48.0f);
+    HighBitDepthTest<uint16_t, P016_MODE>(720, 1082, 48.0f);
+}
+
+TEST(P0162BGR_FP32, x86)
+{
+    HighBitDepthTest<float, P016_MODE>(640, 720, 1e-3f);
+    HighBitDepthTest<float, P016_MODE>(720, 1082, 1e-3f);
+}
+
+TEST(I0102BGR_UINT8, x86)
+{
+    HighBitDepthTest<uint8_t, I010_MODE>(640, 720, 1.01f);
+    HighBitDepthTest<uint8_t, I010_MODE>(720, 1082, 1.01f);
+}
+
+TEST(I0102BGR_UINT16, x86)
+{
+    HighBitDepthTest<uint16_t, I010_MODE>(640, 720, 48.0f);
+    HighBitDepthTest<uint16_t, I010_MODE>(720, 1082, 48.0f);
+}
+
+TEST(I0102BGR_FP32, x86)
+{
+    HighBitDepthTest<float, I010_MODE>(640, 720, 1e-3f);
+    HighBitDepthTest<float, I010_MODE>(720, 1082, 1e-3f);
+}
@@ -0,0 +1,304 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/color_intrin.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <immintrin.h>
+#include <algorithm>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// same coefficients as NV12/NV21, BT.601 limited range
+#define CY_coeff  1220542
+#define CUB_coeff 2116026
+#define CUG_coeff -409993
+#define CVG_coeff -852492
+#define CVR_coeff 1673527
+#define SHIFT     20
+
+// pshufb masks picking y, u and v of pixels 0..3 (and 4..7 with +8) as 32-bit lanes,
+// UYVY is U0 Y0 V0 Y1, YUYV is Y0 U0 Y1 V0
+template <bool isUYVY>
+static inline void yuv422_masks(int32_t half, __m128i &my, __m128i &mu, __m128i &mv)
+{
+    const int8_t o  = half * 8;
+    const int8_t yo = isUYVY ? 1 : 0;
+    const int8_t uo = isUYVY ? 0 : 1;
+    const int8_t vo = isUYVY ? 2 : 3;
+    my              = _mm_setr_epi8(o + yo, -1, -1, -1, o + yo + 2, -1, -1, -1, o + yo + 4, -1, -1, -1, o + yo + 6, -1, -1, -1);
+    mu              = _mm_setr_epi8(o + uo, -1, -1, -1, o + uo, -1, -1, -1, o + uo + 4, -1, -1, -1, o + uo + 4, -1, -1, -1);
+    mv              = _mm_setr_epi8(o + vo, -1, -1, -1, o + vo, -1, -1, -1, o + vo + 4, -1, -1, -1, o + vo + 4, -1, -1, -1);
+}
+
+template <int32_t dstcn, bool isUYVY>
+static inline void yuv422_2_bgr_pair(const uint8_t *src, uint8_t *dst, bool second)
+{
+    const int32_t y0 = std::max(0, int32_t(src[isUYVY ? 1 : 0]) - 16) * CY_coeff;
+    const int32_t y1 = std::max(0, int32_t(src[isUYVY ? 3 : 2]) - 16) * CY_coeff;
+    const int32_t u  = int32_t(src[isUYVY ? 0 : 1]) - 128;
+    const int32_t v  = int32_t(src[isUYVY ? 2 : 3]) - 128;
+
+    int32_t ruv = (1 << (SHIFT - 1)) + CVR_coeff * v;
+    int32_t guv = (1 << (SHIFT - 1)) + CVG_coeff * v + CUG_coeff * u;
+    int32_t buv = (1 << (SHIFT - 1)) + CUB_coeff * u;
+
+    dst[0] = sat_cast_u8((y0 + buv) >> SHIFT);
+    dst[1] = sat_cast_u8((y0 + guv) >> SHIFT);
+    dst[2] = sat_cast_u8((y0 + ruv) >> SHIFT);
+    if (dstcn == 4) {
+        dst[3] = 255;
+    }
+    if (second) {
+        dst[dstcn + 0] = sat_cast_u8((y1 + buv) >> SHIFT);
+        dst[dstcn + 1] = sat_cast_u8((y1 + guv) >> SHIFT);
+        dst[dstcn + 2] = sat_cast_u8((y1 + ruv) >> SHIFT);
+        if (dstcn == 4) {
+            dst[dstcn + 3] = 255;
+        }
+    }
+}
+
+template <int32_t dstcn, bool isUYVY>
+static void yuv422_2_bgr(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    __m128i my[2], mu[2], mv[2];
+    yuv422_masks<isUYVY>(0, my[0], mu[0], mv[0]);
+    yuv422_masks<isUYVY>(1, my[1], mu[1], mv[1]);
+    const __m128i v_cy    = _mm_set1_epi32(CY_coeff);
+    const __m128i v_cub   = _mm_set1_epi32(CUB_coeff);
+    const __m128i v_cug   = _mm_set1_epi32(CUG_coeff);
+    const __m128i v_cvg   = _mm_set1_epi32(CVG_coeff);
+    const __m128i v_cvr   = _mm_set1_epi32(CVR_coeff);
+    const __m128i v_16    = _mm_set1_epi32(16);
+    const __m128i v_128   = _mm_set1_epi32(128);
+    const __m128i v_half  = _mm_set1_epi32(1 << (SHIFT - 1));
+    const __m128i zero    = _mm_setzero_si128();
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i s[2] = {_mm_loadu_si128((const __m128i *)(src + j * 2)),
+                            _mm_loadu_si128((const __m128i *)(src + j * 2 + 16))};
+            __m128i b[4], g[4], r[4];
+            for (int32_t k = 0; k < 4; ++k) {
+                __m128i x   = s[k >> 1];
+                __m128i y   = _mm_mullo_epi32(_mm_max_epi32(_mm_sub_epi32(_mm_shuffle_epi8(x, my[k & 1]), v_16), zero), v_cy);
+                __m128i u   = _mm_sub_epi32(_mm_shuffle_epi8(x, mu[k & 1]), v_128);
+                __m128i v   = _mm_sub_epi32(_mm_shuffle_epi8(x, mv[k & 1]), v_128);
+                __m128i buv = _mm_add_epi32(v_half, _mm_mullo_epi32(u, v_cub));
+                __m128i guv = _mm_add_epi32(v_half, _mm_add_epi32(_mm_mullo_epi32(v, v_cvg), _mm_mullo_epi32(u, v_cug)));
+                __m128i ruv = _mm_add_epi32(v_half, _mm_mullo_epi32(v, v_cvr));
+                b[k]        = _mm_srai_epi32(_mm_add_epi32(y, buv), SHIFT);
+                g[k]        = _mm_srai_epi32(_mm_add_epi32(y, guv), SHIFT);
+                r[k]        = _mm_srai_epi32(_mm_add_epi32(y, ruv), SHIFT);
+            }
+            store_bgr_u8<dstcn, 0>(dst + j * dstcn, v_pack_s32_u8(b), v_pack_s32_u8(g), v_pack_s32_u8(r));
+        }
+        for (; j < width; j += 2) {
+            yuv422_2_bgr_pair<dstcn, isUYVY>(src + j * 2, dst + j * dstcn, j + 1 < width);
+        }
+    }
+}
+
+// Y is every other byte, a shift or a mask followed by packuswb
+template <bool isUYVY>
+static void yuv422_2_gray(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const __m128i v_mask = _mm_set1_epi16(0x00ff);
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 32; j += 32) {
+            __m128i s0 = _mm_loadu_si128((const __m128i *)(src + j * 2));
+            __m128i s1 = _mm_loadu_si128((const __m128i *)(src + j * 2 + 16));
+            __m128i s2 = _mm_loadu_si128((const __m128i *)(src + j * 2 + 32));
+            __m128i s3 = _mm_loadu_si128((const __m128i *)(src + j * 2 + 48));
+            if (isUYVY) {
+                s0 = _mm_srli_epi16(s0, 8);
+                s1 = _mm_srli_epi16(s1, 8);
+                s2 = _mm_srli_epi16(s2, 8);
+                s3 = _mm_srli_epi16(s3, 8);
+            } else {
+                s0 = _mm_and_si128(s0, v_mask);
+                s1 = _mm_and_si128(s1, v_mask);
+                s2 = _mm_and_si128(s2, v_mask);
+                s3 = _mm_and_si128(s3, v_mask);
+            }
+            _mm_storeu_si128((__m128i *)(dst + j), _mm_packus_epi16(s0, s1));
+            _mm_storeu_si128((__m128i *)(dst + j + 16), _mm_packus_epi16(s2, s3));
+        }
+        for (; j < width; ++j) {
+            dst[j] = src[j * 2 + (isUYVY ? 1 : 0)];
+        }
+    }
+}
+
+template <>
+::ppl::common::RetCode UYVY2BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::yuv422_2_bgr<3, true>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        yuv422_2_bgr<3, true>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode UYVY2BGRA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::yuv422_2_bgr<4, true>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        yuv422_2_bgr<4, true>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode YUYV2BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::yuv422_2_bgr<3, false>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        yuv422_2_bgr<3, false>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode YUYV2BGRA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::yuv422_2_bgr<4, false>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        yuv422_2_bgr<4, false>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode UYVY2GRAY<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    yuv422_2_gray<true>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode YUYV2GRAY<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    yuv422_2_gray<false>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
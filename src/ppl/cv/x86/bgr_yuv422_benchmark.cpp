@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/debug.h"
+
+namespace {
+
+enum YUV422Mode {UYVY_MODE, YUYV_MODE};
+
+template<int32_t nc, YUV422Mode mode>
+void BM_YUV4222Color_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 2]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * nc]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 2, 0, 255);
+    for (auto _ : state) {
+        if (mode == UYVY_MODE) {
+            if (nc == 1) {
+                ppl::cv::x86::UYVY2GRAY<uint8_t>(height, width, width * 2, src.get(), width, dst.get());
+            } else if (nc == 3) {
+                ppl::cv::x86::UYVY2BGR<uint8_t>(height, width, width * 2, src.get(), width * 3, dst.get());
+            } else {
+                ppl::cv::x86::UYVY2BGRA<uint8_t>(height, width, width * 2, src.get(), width * 4, dst.get());
+            }
+        } else {
+            if (nc == 1) {
+                ppl::cv::x86::YUYV2GRAY<uint8_t>(height, width, width * 2, src.get(), width, dst.get());
+            } else if (nc == 3) {
+                ppl::cv::x86::YUYV2BGR<uint8_t>(height, width, width * 2, src.get(), width * 3, dst.get());
+            } else {
+                ppl::cv::x86::YUYV2BGRA<uint8_t>(height, width, width * 2, src.get(), width * 4, dst.get());
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_YUV4222Color_ppl_x86, c1, UYVY_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_YUV4222Color_ppl_x86, c3, UYVY_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_YUV4222Color_ppl_x86, c4, UYVY_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_YUV4222Color_ppl_x86, c1, YUYV_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_YUV4222Color_ppl_x86, c3, YUYV_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_YUV4222Color_ppl_x86, c4, YUYV_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<int32_t nc, YUV422Mode mode>
+void BM_YUV4222Color_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 2]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * nc]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 2, 0, 255);
+    cv::Mat srcMat(height, width, CV_8UC2, src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(CV_8U, nc), dst.get());
+    int32_t code;
+    if (mode == UYVY_MODE) {
+        code = nc == 1 ? cv::COLOR_YUV2GRAY_UYVY : (nc == 3 ? cv::COLOR_YUV2BGR_UYVY : cv::COLOR_YUV2BGRA_UYVY);
+    } else {
+        code = nc == 1 ? cv::COLOR_YUV2GRAY_YUYV : (nc == 3 ? cv::COLOR_YUV2BGR_YUYV : cv::COLOR_YUV2BGRA_YUYV);
+    }
+    for (auto _ : state) {
+        cv::cvtColor(srcMat, dstMat, code);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_YUV4222Color_opencv_x86, c1, UYVY_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_YUV4222Color_opencv_x86, c3, UYVY_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_YUV4222Color_opencv_x86, c4, UYVY_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_YUV4222Color_opencv_x86, c1, YUYV_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_YUV4222Color_opencv_x86, c3, YUYV_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_YUV4222Color_opencv_x86, c4, YUYV_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+enum YUV422Mode {UYVY_MODE, YUYV_MODE};
+template<int32_t nc, YUV422Mode mode>
+void YUV4222ColorTest(int32_t height, int32_t width) {
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 2]);
+    std::unique_ptr<uint8_t[]> dst_ref(new uint8_t[width * height * nc]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * nc]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 2, 0, 255);
+    cv::Mat srcMat(height, width, CV_8UC2, src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(CV_8U, nc), dst_ref.get());
+    if (mode == UYVY_MODE) {
+        if (nc == 1) {
+            ppl::cv::x86::UYVY2GRAY<uint8_t>(height, width, width * 2, src.get(), width, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_YUV2GRAY_UYVY);
+        } else if (nc == 3) {
+            ppl::cv::x86::UYVY2BGR<uint8_t>(height, width, width * 2, src.get(), width * 3, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_YUV2BGR_UYVY);
+        } else {
+            ppl::cv::x86::UYVY2BGRA<uint8_t>(height, width, width * 2, src.get(), width * 4, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_YUV2BGRA_UYVY);
+        }
+    } else {
+        if (nc == 1) {
+            ppl::cv::x86::YUYV2GRAY<uint8_t>(height, width, width * 2, src.get(), width, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_YUV2GRAY_YUYV);
+        } else if (nc == 3) {
+            ppl::cv::x86::YUYV2BGR<uint8_t>(height, width, width * 2, src.get(), width * 3, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_YUV2BGR_YUYV);
+        } else {
+            ppl::cv::x86::YUYV2BGRA<uint8_t>(height, width, width * 2, src.get(), width * 4, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_YUV2BGRA_YUYV);
+        }
+    }
+    checkResult<uint8_t, nc>(dst.get(), dst_ref.get(), height, width, width * nc, width * nc, 1.01f);
+}
+
+TEST(UYVY2BGR_UINT8, x86)
+{
+    YUV4222ColorTest<3, UYVY_MODE>(640, 720);
+    YUV4222ColorTest<3, UYVY_MODE>(720, 1082);
+    YUV4222ColorTest<4, UYVY_MODE>(640, 720);
+    YUV4222ColorTest<4, UYVY_MODE>(720, 1082);
+}
+
+TEST(YUYV2BGR_UINT8, x86)
+{
+    YUV4222ColorTest<3, YUYV_MODE>(640, 720);
+    YUV4222ColorTest<3, YUYV_MODE>(720, 1082);
+    YUV4222ColorTest<4, YUYV_MODE>(640, 720);
+    YUV4222ColorTest<4, YUYV_MODE>(720, 1082);
+}
+
+TEST(UYVY2GRAY_UINT8, x86)
+{
+    YUV4222ColorTest<1, UYVY_MODE>(640, 720);
+    YUV4222ColorTest<1, UYVY_MODE>(720, 1082);
+}
+
+TEST(YUYV2GRAY_UINT8, x86)
+{
+    YUV4222ColorTest<1, YUYV_MODE>(640, 720);
+    YUV4222ColorTest<1, YUYV_MODE>(720, 1082);
+}
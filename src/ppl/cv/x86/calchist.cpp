@@ -0,0 +1,203 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/calchist.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// rows per stripe, stripes are counted independently and merged in order
+#define CALCHIST_STRIPE_ROWS 64
+// consecutive pixels land in different banks, so runs of equal values do not wait on
+// each other's store-to-load forwarding
+#define CALCHIST_BANKS 4
+
+template <int32_t channels, bool masked>
+static void calc_hist_rows(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t *hist)
+{
+    uint32_t banks[CALCHIST_BANKS][channels][256];
+    memset(banks, 0, sizeof(banks));
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        const uint8_t *msk = masked ? mask + i * maskWidthStride : nullptr;
+        int32_t j          = 0;
+        if (channels == 1 && !masked) {
+            for (; j <= width - 16; j += 16) {
+                uint64_t v0, v1;
+                memcpy(&v0, src + j, sizeof(v0));
+                memcpy(&v1, src + j + 8, sizeof(v1));
+                for (int32_t k = 0; k < 64; k += 32) {
+                    ++banks[0][0][(v0 >> k) & 0xff];
+                    ++banks[1][0][(v0 >> (k + 8)) & 0xff];
+                    ++banks[2][0][(v0 >> (k + 16)) & 0xff];
+                    ++banks[3][0][(v0 >> (k + 24)) & 0xff];
+                    ++banks[0][0][(v1 >> k) & 0xff];
+                    ++banks[1][0][(v1 >> (k + 8)) & 0xff];
+                    ++banks[2][0][(v1 >> (k + 16)) & 0xff];
+                    ++banks[3][0][(v1 >> (k + 24)) & 0xff];
+                }
+            }
+        } else {
+            for (; j <= width - CALCHIST_BANKS; j += CALCHIST_BANKS) {
+                for (int32_t k = 0; k < CALCHIST_BANKS; ++k) {
+                    // masked out pixels add 0 instead of branching
+                    uint32_t inc = masked ? (msk[j + k] != 0) : 1;
+                    for (int32_t c = 0; c < channels; ++c) {
+                        banks[k][c][src[(j + k) * channels + c]] += inc;
+                    }
+                }
+            }
+        }
+        for (; j < width; ++j) {
+            uint32_t inc = masked ? (msk[j] != 0) : 1;
+            for (int32_t c = 0; c < channels; ++c) {
+                banks[0][c][src[j * channels + c]] += inc;
+            }
+        }
+    }
+    for (int32_t c = 0; c < channels; ++c) {
+        for (int32_t i = 0; i < 256; i += 4) {
+            __m128i v_sum = _mm_add_epi32(_mm_add_epi32(_mm_loadu_si128((const __m128i *)(banks[0][c] + i)),
+                                                        _mm_loadu_si128((const __m128i *)(banks[1][c] + i))),
+                                          _mm_add_epi32(_mm_loadu_si128((const __m128i *)(banks[2][c] + i)),
+                                                        _mm_loadu_si128((const __m128i *)(banks[3][c] + i))));
+            _mm_storeu_si128((__m128i *)(hist + c * 256 + i), v_sum);
+        }
+    }
+}
+
+template <int32_t channels, bool masked>
+static void calc_hist(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t *hist)
+{
+    const int32_t stripes = (height + CALCHIST_STRIPE_ROWS - 1) / CALCHIST_STRIPE_ROWS;
+    if (stripes == 1) {
+        calc_hist_rows<channels, masked>(height, width, inWidthStride, inData, maskWidthStride, mask, hist);
+        return;
+    }
+    std::vector<int32_t> partial(stripes * channels * 256);
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        int32_t y0 = s * CALCHIST_STRIPE_ROWS;
+        int32_t y1 = std::min(height, y0 + CALCHIST_STRIPE_ROWS);
+        calc_hist_rows<channels, masked>(y1 - y0, width, inWidthStride, inData + y0 * inWidthStride, maskWidthStride, masked ? mask + y0 * maskWidthStride : nullptr, partial.data() + s * channels * 256);
+    }
+    memcpy(hist, partial.data(), channels * 256 * sizeof(int32_t));
+    for (int32_t s = 1; s < stripes; ++s) {
+        const int32_t *part = partial.data() + s * channels * 256;
+        for (int32_t i = 0; i < channels * 256; i += 4) {
+            __m128i v_sum = _mm_add_epi32(_mm_loadu_si128((const __m128i *)(hist + i)), _mm_loadu_si128((const __m128i *)(part + i)));
+            _mm_storeu_si128((__m128i *)(hist + i), v_sum);
+        }
+    }
+}
+
+template <>
+::ppl::common::RetCode CalcHist<uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t *outHist,
+    int32_t maskWidthStride,
+    const uint8_t *mask)
+{
+    if (nullptr == inData || nullptr == outHist) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width || (mask != nullptr && maskWidthStride < width)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (mask != nullptr) {
+        calc_hist<1, true>(height, width, inWidthStride, inData, maskWidthStride, mask, outHist);
+    } else {
+        calc_hist<1, false>(height, width, inWidthStride, inData, maskWidthStride, mask, outHist);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode CalcHist<uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t *outHist,
+    int32_t maskWidthStride,
+    const uint8_t *mask)
+{
+    if (nullptr == inData || nullptr == outHist) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * 3 || (mask != nullptr && maskWidthStride < width)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (mask != nullptr) {
+        calc_hist<3, true>(height, width, inWidthStride, inData, maskWidthStride, mask, outHist);
+    } else {
+        calc_hist<3, false>(height, width, inWidthStride, inData, maskWidthStride, mask, outHist);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode CalcHist<uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t *outHist,
+    int32_t maskWidthStride,
+    const uint8_t *mask)
+{
+    if (nullptr == inData || nullptr == outHist) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * 4 || (mask != nullptr && maskWidthStride < width)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (mask != nullptr) {
+        calc_hist<4, true>(height, width, inWidthStride, inData, maskWidthStride, mask, outHist);
+    } else {
+        calc_hist<4, false>(height, width, inWidthStride, inData, maskWidthStride, mask, outHist);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/calchist.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+
+namespace {
+
+template<typename T, int32_t nc, bool use_mask>
+void BM_CalcHist_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    std::unique_ptr<int32_t[]> hist(new int32_t[256 * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(mask.get(), width * height, 0, 1);
+    for (auto _ : state) {
+        ppl::cv::x86::CalcHist<T, nc>(height, width, width * nc, src.get(), hist.get(), width, use_mask ? mask.get() : nullptr);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_CalcHist_ppl_x86, uint8_t, c1, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_CalcHist_ppl_x86, uint8_t, c3, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_CalcHist_ppl_x86, uint8_t, c4, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_CalcHist_ppl_x86, uint8_t, c1, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<typename T, int32_t nc, bool use_mask>
+void BM_CalcHist_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(mask.get(), width * height, 0, 1);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat mask_opencv(height, width, CV_8UC1, mask.get());
+    const int32_t histSize = 256;
+    const float range[] = {0, 256};
+    const float *ranges = range;
+    cv::Mat hist_opencv;
+    for (auto _ : state) {
+        for (int32_t c = 0; c < nc; ++c) {
+            cv::calcHist(&src_opencv, 1, &c, use_mask ? mask_opencv : cv::Mat(), hist_opencv, 1, &histSize, &ranges);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_CalcHist_opencv_x86, uint8_t, c1, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_CalcHist_opencv_x86, uint8_t, c3, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_CalcHist_opencv_x86, uint8_t, c4, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_CalcHist_opencv_x86, uint8_t, c1, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/calchist.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+template<typename T, int32_t nc, bool use_mask>
+void CalcHistTest(int32_t height, int32_t width, T maxValue) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    std::unique_ptr<int32_t[]> hist(new int32_t[256 * nc]);
+    std::unique_ptr<int32_t[]> hist_ref(new int32_t[256 * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, maxValue);
+    ppl::cv::debug::randomFill<uint8_t>(mask.get(), width * height, 0, 1);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat mask_opencv(height, width, CV_8UC1, mask.get());
+
+    if (use_mask) {
+        ppl::cv::x86::CalcHist<T, nc>(height, width, width * nc, src.get(), hist.get(), width, mask.get());
+    } else {
+        ppl::cv::x86::CalcHist<T, nc>(height, width, width * nc, src.get(), hist.get());
+    }
+    const int32_t histSize = 256;
+    const float range[]    = {0, 256};
+    const float *ranges    = range;
+    for (int32_t c = 0; c < nc; ++c) {
+        cv::Mat hist_opencv;
+        cv::calcHist(&src_opencv, 1, &c, use_mask ? mask_opencv : cv::Mat(), hist_opencv, 1, &histSize, &ranges);
+        for (int32_t i = 0; i < 256; ++i) {
+            hist_ref.get()[c * 256 + i] = static_cast<int32_t>(hist_opencv.at<float>(i));
+        }
+    }
+    checkResult<int32_t, 1>(hist.get(), hist_ref.get(), 1, 256 * nc, 256 * nc, 256 * nc, 0.01f);
+}
+
+#define R(name, dtype, nc, use_mask, maxValue) \
+    TEST(name, x86) \
+    { \
+        CalcHistTest<dtype, nc, use_mask>(240, 320, maxValue); \
+        CalcHistTest<dtype, nc, use_mask>(241, 321, maxValue); \
+        CalcHistTest<dtype, nc, use_mask>(1080, 1920, maxValue); \
+    } \
+
+R(calchist_u8c1_x86, uint8_t, 1, false, 255);
+R(calchist_u8c3_x86, uint8_t, 3, false, 255);
+R(calchist_u8c4_x86, uint8_t, 4, false, 255);
+R(calchist_u8c1_narrow_x86, uint8_t, 1, false, 3);
+R(calchist_u8c1_mask_x86, uint8_t, 1, true, 255);
+R(calchist_u8c3_mask_x86, uint8_t, 3, true, 255);
+R(calchist_u8c4_mask_x86, uint8_t, 4, true, 255);
@@ -0,0 +1,510 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/canny.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <string.h>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// output rows per stripe, every stripe recomputes two gradient rows around it
+#define CANNY_STRIPE_ROWS 64
+// tan(22.5 degrees) in Q15, the same direction quantization as cv::Canny
+#define CANNY_SHIFT       15
+#define CANNY_TG22        13573
+
+// edge map states, the map has a one pixel frame of CANNY_NONE
+enum {
+    CANNY_CANDIDATE = 0,
+    CANNY_NONE      = 1,
+    CANNY_EDGE      = 2,
+};
+
+static inline void canny_magnitude_8(__m128i v_dx, __m128i v_dy, bool L2gradient, int32_t *mag)
+{
+    __m128i v_lo, v_hi;
+    if (L2gradient) {
+        v_lo = _mm_madd_epi16(_mm_unpacklo_epi16(v_dx, v_dy), _mm_unpacklo_epi16(v_dx, v_dy));
+        v_hi = _mm_madd_epi16(_mm_unpackhi_epi16(v_dx, v_dy), _mm_unpackhi_epi16(v_dx, v_dy));
+    } else {
+        // |dx| and |dy| are up to 32768, they are widened unsigned before the sum
+        __m128i v_adx = _mm_abs_epi16(v_dx);
+        __m128i v_ady = _mm_abs_epi16(v_dy);
+        v_lo          = _mm_add_epi32(_mm_cvtepu16_epi32(v_adx), _mm_cvtepu16_epi32(v_ady));
+        v_hi          = _mm_add_epi32(_mm_cvtepu16_epi32(_mm_srli_si128(v_adx, 8)), _mm_cvtepu16_epi32(_mm_srli_si128(v_ady, 8)));
+    }
+    _mm_storeu_si128((__m128i *)mag, v_lo);
+    _mm_storeu_si128((__m128i *)(mag + 4), v_hi);
+}
+
+static inline int32_t canny_magnitude(int32_t dx, int32_t dy, bool L2gradient)
+{
+    return L2gradient ? dx * dx + dy * dy : abs(dx) + abs(dy);
+}
+
+static void canny_magnitude_row(
+    int32_t length,
+    const int16_t *dx,
+    const int16_t *dy,
+    bool L2gradient,
+    int32_t *mag)
+{
+    int32_t i = 0;
+    for (; i <= length - 8; i += 8) {
+        canny_magnitude_8(_mm_loadu_si128((const __m128i *)(dx + i)), _mm_loadu_si128((const __m128i *)(dy + i)), L2gradient, mag + i);
+    }
+    for (; i < length; ++i) {
+        mag[i] = canny_magnitude(dx[i], dy[i], L2gradient);
+    }
+}
+
+// 3x3 Sobel derivatives and magnitudes of one row, a, b and c are the rows above, at and below it,
+// padded by one replicated pixel on both sides
+template <int32_t channels>
+static void canny_sobel_row(
+    int32_t width,
+    const uint8_t *a,
+    const uint8_t *b,
+    const uint8_t *c,
+    bool L2gradient,
+    int16_t *dx,
+    int16_t *dy,
+    int32_t *mag)
+{
+    const int32_t length = width * channels;
+    int32_t i            = 0;
+    for (; i <= length - 8; i += 8) {
+        __m128i v_al = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(a + i - channels)));
+        __m128i v_ac = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(a + i)));
+        __m128i v_ar = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(a + i + channels)));
+        __m128i v_bl = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(b + i - channels)));
+        __m128i v_br = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(b + i + channels)));
+        __m128i v_cl = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(c + i - channels)));
+        __m128i v_cc = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(c + i)));
+        __m128i v_cr = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(c + i + channels)));
+        __m128i v_bd = _mm_sub_epi16(v_br, v_bl);
+        __m128i v_dx = _mm_add_epi16(_mm_add_epi16(_mm_sub_epi16(v_ar, v_al), _mm_sub_epi16(v_cr, v_cl)), _mm_add_epi16(v_bd, v_bd));
+        __m128i v_dy = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(v_cl, v_cr), _mm_add_epi16(v_cc, v_cc)),
+                                     _mm_add_epi16(_mm_add_epi16(v_al, v_ar), _mm_add_epi16(v_ac, v_ac)));
+        _mm_storeu_si128((__m128i *)(dx + i), v_dx);
+        _mm_storeu_si128((__m128i *)(dy + i), v_dy);
+        canny_magnitude_8(v_dx, v_dy, L2gradient, mag + i);
+    }
+    for (; i < length; ++i) {
+        int32_t gx = (a[i + channels] - a[i - channels]) + 2 * (b[i + channels] - b[i - channels]) + (c[i + channels] - c[i - channels]);
+        int32_t gy = (c[i - channels] + 2 * c[i] + c[i + channels]) - (a[i - channels] + 2 * a[i] + a[i + channels]);
+        dx[i]      = gx;
+        dy[i]      = gy;
+        mag[i]     = canny_magnitude(gx, gy, L2gradient);
+    }
+}
+
+// gradient rows from the image, every instance keeps a ring of three padded source rows
+template <int32_t channels>
+class CannySobelSource {
+public:
+    CannySobelSource(
+        int32_t height,
+        int32_t width,
+        int32_t inWidthStride,
+        const uint8_t *inData,
+        bool L2gradient)
+        : height_(height)
+        , width_(width)
+        , inWidthStride_(inWidthStride)
+        , inData_(inData)
+        , L2gradient_(L2gradient)
+        , rowLength_((width + 2) * channels + 8)
+        , src_(3 * rowLength_)
+        , dx_(3 * width * channels)
+        , dy_(3 * width * channels)
+        , mag_(width * channels)
+    {
+    }
+
+    // gradient row r is computed from source rows r - 1, r and r + 1, rows before r + 1 are loaded here
+    void begin(int32_t r)
+    {
+        load(r - 1);
+        load(r);
+    }
+
+    void row(int32_t r, const int16_t **dx, const int16_t **dy, int32_t *mag)
+    {
+        load(r + 1);
+        const int32_t slot = (r + 3) % 3;
+        int16_t *gx        = dx_.data() + slot * width_ * channels;
+        int16_t *gy        = dy_.data() + slot * width_ * channels;
+        int32_t *m         = channels == 1 ? mag : mag_.data();
+        canny_sobel_row<channels>(width_, padded(r - 1), padded(r), padded(r + 1), L2gradient_, gx, gy, m);
+        if (channels > 1) {
+            // keep the channel with the largest magnitude, the first one on ties
+            for (int32_t j = 0; j < width_; ++j) {
+                int32_t best = 0;
+                for (int32_t c = 1; c < channels; ++c) {
+                    best = m[j * channels + c] > m[j * channels + best] ? c : best;
+                }
+                mag[j] = m[j * channels + best];
+                gx[j]  = gx[j * channels + best];
+                gy[j]  = gy[j * channels + best];
+            }
+        }
+        *dx = gx;
+        *dy = gy;
+    }
+
+private:
+    uint8_t *padded(int32_t l)
+    {
+        return src_.data() + (l + 6) % 3 * rowLength_ + channels;
+    }
+
+    void load(int32_t l)
+    {
+        const uint8_t *s = inData_ + std::min(std::max(l, 0), height_ - 1) * inWidthStride_;
+        uint8_t *d       = padded(l);
+        memcpy(d, s, width_ * channels);
+        for (int32_t c = 0; c < channels; ++c) {
+            d[c - channels]              = s[c];
+            d[width_ * channels + c]     = s[(width_ - 1) * channels + c];
+        }
+    }
+
+    int32_t height_;
+    int32_t width_;
+    int32_t inWidthStride_;
+    const uint8_t *inData_;
+    bool L2gradient_;
+    int32_t rowLength_;
+    std::vector<uint8_t> src_;
+    std::vector<int16_t> dx_;
+    std::vector<int16_t> dy_;
+    std::vector<int32_t> mag_;
+};
+
+// gradient rows from precomputed derivatives
+class CannyDerivSource {
+public:
+    CannyDerivSource(
+        int32_t width,
+        int32_t dxWidthStride,
+        const int16_t *dx,
+        int32_t dyWidthStride,
+        const int16_t *dy,
+        bool L2gradient)
+        : width_(width)
+        , dxWidthStride_(dxWidthStride)
+        , dx_(dx)
+        , dyWidthStride_(dyWidthStride)
+        , dy_(dy)
+        , L2gradient_(L2gradient)
+    {
+    }
+
+    void begin(int32_t /*r*/) {}
+
+    void row(int32_t r, const int16_t **dx, const int16_t **dy, int32_t *mag)
+    {
+        *dx = dx_ + r * dxWidthStride_;
+        *dy = dy_ + r * dyWidthStride_;
+        canny_magnitude_row(width_, *dx, *dy, L2gradient_, mag);
+    }
+
+private:
+    int32_t width_;
+    int32_t dxWidthStride_;
+    const int16_t *dx_;
+    int32_t dyWidthStride_;
+    const int16_t *dy_;
+    bool L2gradient_;
+};
+
+// non-maximum suppression and double thresholding of one row, p, c and n are the magnitudes of the rows
+// above, at and below it with a zero on both ends; strong edges are pushed to stack
+static void canny_nms_row(
+    int32_t width,
+    const int16_t *dx,
+    const int16_t *dy,
+    const int32_t *p,
+    const int32_t *c,
+    const int32_t *n,
+    int32_t low,
+    int32_t high,
+    uint8_t *map,
+    std::vector<uint8_t *> &stack)
+{
+    const __m128i v_low = _mm_set1_epi32(low);
+    map[-1]             = CANNY_NONE;
+    map[width]          = CANNY_NONE;
+    for (int32_t j = 0; j < width; ++j) {
+        // most pixels are below the low threshold, they are skipped four at a time
+        if ((j & 3) == 0 && j + 4 <= width &&
+            0 == _mm_movemask_epi8(_mm_cmpgt_epi32(_mm_loadu_si128((const __m128i *)(c + j)), v_low))) {
+            memset(map + j, CANNY_NONE, 4);
+            j += 3;
+            continue;
+        }
+        const int32_t m = c[j];
+        map[j]          = CANNY_NONE;
+        if (m <= low) {
+            continue;
+        }
+        const int32_t xs    = dx[j];
+        const int32_t ys    = dy[j];
+        const int64_t x     = abs(xs);
+        const int64_t y     = (int64_t)abs(ys) << CANNY_SHIFT;
+        const int64_t tg22x = x * CANNY_TG22;
+        bool is_max;
+        if (y < tg22x) {
+            is_max = m > c[j - 1] && m >= c[j + 1];
+        } else if (y > tg22x + (x << (CANNY_SHIFT + 1))) {
+            is_max = m > p[j] && m >= n[j];
+        } else {
+            const int32_t s = (xs ^ ys) < 0 ? -1 : 1;
+            is_max          = m > p[j - s] && m > n[j + s];
+        }
+        if (is_max) {
+            if (m > high) {
+                map[j] = CANNY_EDGE;
+                stack.push_back(map + j);
+            } else {
+                map[j] = CANNY_CANDIDATE;
+            }
+        }
+    }
+}
+
+// grows the edges on stack into connected candidates whose map entries lie in [lo, hi)
+static void canny_hysteresis(
+    int32_t mapStep,
+    const uint8_t *lo,
+    const uint8_t *hi,
+    std::vector<uint8_t *> &stack)
+{
+    const int32_t offsets[8] = {-mapStep - 1, -mapStep, -mapStep + 1, -1, 1, mapStep - 1, mapStep, mapStep + 1};
+    while (!stack.empty()) {
+        uint8_t *m = stack.back();
+        stack.pop_back();
+        for (int32_t k = 0; k < 8; ++k) {
+            uint8_t *q = m + offsets[k];
+            if (q >= lo && q < hi && *q == CANNY_CANDIDATE) {
+                *q = CANNY_EDGE;
+                stack.push_back(q);
+            }
+        }
+    }
+}
+
+template <typename Source>
+static void canny_stripe(
+    Source &source,
+    int32_t height,
+    int32_t width,
+    int32_t y0,
+    int32_t y1,
+    int32_t low,
+    int32_t high,
+    uint8_t *map,
+    std::vector<uint8_t *> &seams)
+{
+    const int32_t mapStep = width + 2;
+    // three gradient rows, magnitudes have a zero on both ends
+    std::vector<int32_t> mag(3 * mapStep, 0);
+    const int16_t *dx[3] = {nullptr, nullptr, nullptr};
+    const int16_t *dy[3] = {nullptr, nullptr, nullptr};
+    std::vector<uint8_t *> stack;
+    source.begin(std::max(y0 - 1, 0));
+    for (int32_t r = y0 - 1; r <= y1; ++r) {
+        const int32_t slot = (r + 3) % 3;
+        int32_t *m         = mag.data() + slot * mapStep + 1;
+        if (r >= 0 && r < height) {
+            source.row(r, &dx[slot], &dy[slot], m);
+        } else {
+            memset(m, 0, width * sizeof(int32_t));
+        }
+        const int32_t i = r - 1;
+        if (i >= y0) {
+            canny_nms_row(width, dx[(i + 3) % 3], dy[(i + 3) % 3], mag.data() + (i + 2) % 3 * mapStep + 1, mag.data() + (i + 3) % 3 * mapStep + 1, m, low, high, map + (i + 1) * mapStep + 1, stack);
+        }
+    }
+    canny_hysteresis(mapStep, map + (y0 + 1) * mapStep, map + (y1 + 1) * mapStep, stack);
+    // edges on the first and the last row may continue in the neighbouring stripes
+    const int32_t rows[2] = {y0, y1 - 1};
+    for (int32_t k = 0; k < (y1 - y0 > 1 ? 2 : 1); ++k) {
+        uint8_t *row = map + (rows[k] + 1) * mapStep + 1;
+        for (int32_t j = 0; j < width; ++j) {
+            if (row[j] == CANNY_EDGE) {
+                seams.push_back(row + j);
+            }
+        }
+    }
+}
+
+static void canny_thresholds(float lowThreshold, float highThreshold, bool L2gradient, int32_t *low, int32_t *high)
+{
+    double lo = lowThreshold, hi = highThreshold;
+    if (lo > hi) {
+        std::swap(lo, hi);
+    }
+    if (L2gradient) {
+        lo = std::min(32767.0, lo);
+        hi = std::min(32767.0, hi);
+        lo = lo > 0 ? lo * lo : lo;
+        hi = hi > 0 ? hi * hi : hi;
+    }
+    *low  = (int32_t)floor(lo);
+    *high = (int32_t)floor(hi);
+}
+
+template <typename Source, typename MakeSource>
+static void canny_run(
+    int32_t height,
+    int32_t width,
+    int32_t low,
+    int32_t high,
+    MakeSource make_source,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const int32_t mapStep = width + 2;
+    const int32_t stripes = (height + CANNY_STRIPE_ROWS - 1) / CANNY_STRIPE_ROWS;
+    std::vector<uint8_t> map((height + 2) * mapStep);
+    memset(map.data(), CANNY_NONE, mapStep);
+    memset(map.data() + (height + 1) * mapStep, CANNY_NONE, mapStep);
+    std::vector<std::vector<uint8_t *>> seams(stripes);
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        const int32_t y0 = s * CANNY_STRIPE_ROWS;
+        const int32_t y1 = std::min(height, y0 + CANNY_STRIPE_ROWS);
+        Source source    = make_source();
+        canny_stripe(source, height, width, y0, y1, low, high, map.data(), seams[s]);
+    }
+    // seam edges are grown over the whole map, the frame of CANNY_NONE keeps them inside
+    std::vector<uint8_t *> stack;
+    for (int32_t s = 0; s < stripes; ++s) {
+        stack.insert(stack.end(), seams[s].begin(), seams[s].end());
+    }
+    canny_hysteresis(mapStep, map.data(), map.data() + map.size(), stack);
+#pragma omp parallel for
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *m = map.data() + (i + 1) * mapStep + 1;
+        uint8_t *dst     = outData + i * outWidthStride;
+        int32_t j        = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i v_m = _mm_loadu_si128((const __m128i *)(m + j));
+            _mm_storeu_si128((__m128i *)(dst + j), _mm_cmpeq_epi8(v_m, _mm_set1_epi8(CANNY_EDGE)));
+        }
+        for (; j < width; ++j) {
+            dst[j] = m[j] == CANNY_EDGE ? 255 : 0;
+        }
+    }
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode Canny(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float lowThreshold,
+    float highThreshold,
+    int32_t apertureSize,
+    bool L2gradient)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (apertureSize != 3) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    int32_t low, high;
+    canny_thresholds(lowThreshold, highThreshold, L2gradient, &low, &high);
+    auto make_source = [=]() {
+        return CannySobelSource<channels>(height, width, inWidthStride, inData, L2gradient);
+    };
+    canny_run<CannySobelSource<channels>>(height, width, low, high, make_source, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode Canny(
+    int32_t height,
+    int32_t width,
+    int32_t dxWidthStride,
+    const int16_t *dx,
+    int32_t dyWidthStride,
+    const int16_t *dy,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float lowThreshold,
+    float highThreshold,
+    bool L2gradient)
+{
+    if (nullptr == dx || nullptr == dy || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || dxWidthStride < width || dyWidthStride < width || outWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    int32_t low, high;
+    canny_thresholds(lowThreshold, highThreshold, L2gradient, &low, &high);
+    auto make_source = [=]() {
+        return CannyDerivSource(width, dxWidthStride, dx, dyWidthStride, dy, L2gradient);
+    };
+    canny_run<CannyDerivSource>(height, width, low, high, make_source, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode Canny<uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float lowThreshold,
+    float highThreshold,
+    int32_t apertureSize,
+    bool L2gradient);
+
+template ::ppl::common::RetCode Canny<uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float lowThreshold,
+    float highThreshold,
+    int32_t apertureSize,
+    bool L2gradient);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/canny.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+
+template<typename T, int32_t nc>
+void CannyTest(int32_t height, int32_t width, float low, float high, bool L2gradient) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst_ref(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat dst_opencv(height, width, CV_8UC1, dst_ref.get());
+    // blur the noise a little so that edges run across the stripes
+    cv::GaussianBlur(src_opencv, src_opencv, cv::Size(5, 5), 0);
+    cv::Canny(src_opencv, dst_opencv, low, high, 3, L2gradient);
+
+    auto rst = ppl::cv::x86::Canny<T, nc>(height, width, width * nc, src.get(), width, dst.get(), low, high, 3, L2gradient);
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    checkResult<uint8_t, 1>(dst.get(), dst_ref.get(), height, width, width, width, 1.01f);
+}
+
+void CannyDerivTest(int32_t height, int32_t width, float low, float high, bool L2gradient) {
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst_ref(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    cv::Mat src_opencv(height, width, CV_8UC1, src.get());
+    cv::Mat dst_opencv(height, width, CV_8UC1, dst_ref.get());
+    cv::Mat dx_opencv, dy_opencv;
+    cv::GaussianBlur(src_opencv, src_opencv, cv::Size(5, 5), 0);
+    cv::Sobel(src_opencv, dx_opencv, CV_16S, 1, 0, 5);
+    cv::Sobel(src_opencv, dy_opencv, CV_16S, 0, 1, 5);
+    cv::Canny(dx_opencv, dy_opencv, dst_opencv, low, high, L2gradient);
+
+    auto rst = ppl::cv::x86::Canny(height, width, dx_opencv.step / sizeof(int16_t), (const int16_t *)dx_opencv.data,
+                                   dy_opencv.step / sizeof(int16_t), (const int16_t *)dy_opencv.data, width, dst.get(), low, high, L2gradient);
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    checkResult<uint8_t, 1>(dst.get(), dst_ref.get(), height, width, width, width, 1.01f);
+}
+
+#define R(name, dtype, nc, L2gradient) \
+    TEST(name, x86) \
+    { \
+        CannyTest<dtype, nc>(240, 320, 10.0f, 30.0f, L2gradient); \
+        CannyTest<dtype, nc>(481, 643, 30.0f, 10.0f, L2gradient); \
+        CannyTest<dtype, nc>(1080, 1920, 20.0f, 60.0f, L2gradient); \
+        CannyTest<dtype, nc>(3, 5, 10.0f, 30.0f, L2gradient); \
+    } \
+
+R(CANNY_U8_C1_L1, uint8_t, 1, false);
+R(CANNY_U8_C3_L1, uint8_t, 3, false);
+R(CANNY_U8_C1_L2, uint8_t, 1, true);
+R(CANNY_U8_C3_L2, uint8_t, 3, true);
+
+TEST(CANNY_DERIV_L1, x86)
+{
+    CannyDerivTest(240, 320, 100.0f, 300.0f, false);
+    CannyDerivTest(1080, 1920, 200.0f, 600.0f, false);
+}
+
+TEST(CANNY_DERIV_L2, x86)
+{
+    CannyDerivTest(240, 320, 100.0f, 300.0f, true);
+    CannyDerivTest(1080, 1920, 200.0f, 600.0f, true);
+}
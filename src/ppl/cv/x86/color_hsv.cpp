@@ -0,0 +1,674 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/color_intrin.hpp"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+#include <float.h>
+#include <cmath>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define HSV_SHIFT 12
+
+// round((255 << HSV_SHIFT) / i) and round((180 << HSV_SHIFT) / (6 * i)), the same
+// reciprocals OpenCV uses, so saturation and hue need no per-pixel division.
+static const int32_t hsv_div_table[256] = {
+    0, 1044480, 522240, 348160, 261120, 208896, 174080, 149211, 130560, 116053, 104448, 94953, 87040, 80345, 74606, 69632,
+    65280, 61440, 58027, 54973, 52224, 49737, 47476, 45412, 43520, 41779, 40172, 38684, 37303, 36017, 34816, 33693,
+    32640, 31651, 30720, 29842, 29013, 28229, 27486, 26782, 26112, 25475, 24869, 24290, 23738, 23211, 22706, 22223,
+    21760, 21316, 20890, 20480, 20086, 19707, 19342, 18991, 18651, 18324, 18008, 17703, 17408, 17123, 16846, 16579,
+    16320, 16069, 15825, 15589, 15360, 15137, 14921, 14711, 14507, 14308, 14115, 13926, 13743, 13565, 13391, 13221,
+    13056, 12895, 12738, 12584, 12434, 12288, 12145, 12006, 11869, 11736, 11605, 11478, 11353, 11231, 11111, 10995,
+    10880, 10768, 10658, 10550, 10445, 10341, 10240, 10141, 10043, 9947, 9854, 9761, 9671, 9582, 9495, 9410,
+    9326, 9243, 9162, 9082, 9004, 8927, 8852, 8777, 8704, 8632, 8561, 8492, 8423, 8356, 8290, 8224,
+    8160, 8097, 8034, 7973, 7913, 7853, 7795, 7737, 7680, 7624, 7569, 7514, 7461, 7408, 7355, 7304,
+    7253, 7203, 7154, 7105, 7057, 7010, 6963, 6917, 6872, 6827, 6782, 6739, 6695, 6653, 6611, 6569,
+    6528, 6487, 6447, 6408, 6369, 6330, 6292, 6254, 6217, 6180, 6144, 6108, 6073, 6037, 6003, 5968,
+    5935, 5901, 5868, 5835, 5803, 5771, 5739, 5708, 5677, 5646, 5615, 5585, 5556, 5526, 5497, 5468,
+    5440, 5412, 5384, 5356, 5329, 5302, 5275, 5249, 5222, 5196, 5171, 5145, 5120, 5095, 5070, 5046,
+    5022, 4998, 4974, 4950, 4927, 4904, 4881, 4858, 4836, 4813, 4791, 4769, 4748, 4726, 4705, 4684,
+    4663, 4642, 4622, 4601, 4581, 4561, 4541, 4522, 4502, 4483, 4464, 4445, 4426, 4407, 4389, 4370,
+    4352, 4334, 4316, 4298, 4281, 4263, 4246, 4229, 4212, 4195, 4178, 4161, 4145, 4128, 4112, 4096
+};
+
+static const int32_t hsv_div_table180[256] = {
+    0, 122880, 61440, 40960, 30720, 24576, 20480, 17554, 15360, 13653, 12288, 11171, 10240, 9452, 8777, 8192,
+    7680, 7228, 6827, 6467, 6144, 5851, 5585, 5343, 5120, 4915, 4726, 4551, 4389, 4237, 4096, 3964,
+    3840, 3724, 3614, 3511, 3413, 3321, 3234, 3151, 3072, 2997, 2926, 2858, 2793, 2731, 2671, 2614,
+    2560, 2508, 2458, 2409, 2363, 2318, 2276, 2234, 2194, 2156, 2119, 2083, 2048, 2014, 1982, 1950,
+    1920, 1890, 1862, 1834, 1807, 1781, 1755, 1731, 1707, 1683, 1661, 1638, 1617, 1596, 1575, 1555,
+    1536, 1517, 1499, 1480, 1463, 1446, 1429, 1412, 1396, 1381, 1365, 1350, 1336, 1321, 1307, 1293,
+    1280, 1267, 1254, 1241, 1229, 1217, 1205, 1193, 1182, 1170, 1159, 1148, 1138, 1127, 1117, 1107,
+    1097, 1087, 1078, 1069, 1059, 1050, 1041, 1033, 1024, 1016, 1007, 999, 991, 983, 975, 968,
+    960, 953, 945, 938, 931, 924, 917, 910, 904, 897, 890, 884, 878, 871, 865, 859,
+    853, 847, 842, 836, 830, 825, 819, 814, 808, 803, 798, 793, 788, 783, 778, 773,
+    768, 763, 759, 754, 749, 745, 740, 736, 731, 727, 723, 719, 714, 710, 706, 702,
+    698, 694, 690, 686, 683, 679, 675, 671, 668, 664, 661, 657, 654, 650, 647, 643,
+    640, 637, 633, 630, 627, 624, 621, 617, 614, 611, 608, 605, 602, 599, 597, 594,
+    591, 588, 585, 582, 580, 577, 574, 572, 569, 566, 564, 561, 559, 556, 554, 551,
+    549, 546, 544, 541, 539, 537, 534, 532, 530, 527, 525, 523, 521, 518, 516, 514,
+    512, 510, 508, 506, 504, 502, 500, 497, 495, 493, 492, 490, 488, 486, 484, 482
+};
+
+// 1 / x refined by one Newton-Raphson step, about 22 correct bits
+static inline __m128 v_rcp_nr(__m128 x)
+{
+    __m128 r = _mm_rcp_ps(x);
+    return _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(2.0f), _mm_mul_ps(x, r)));
+}
+
+static inline void bgr2hsv_u8_pixel(int32_t b, int32_t g, int32_t r, uint8_t *dst)
+{
+    int32_t v    = std::max(std::max(b, g), r);
+    int32_t diff = v - std::min(std::min(b, g), r);
+    int32_t vr   = v == r ? -1 : 0;
+    int32_t vg   = v == g ? -1 : 0;
+    int32_t s    = (diff * hsv_div_table[v] + (1 << (HSV_SHIFT - 1))) >> HSV_SHIFT;
+    int32_t h    = (vr & (g - b)) + (~vr & ((vg & (b - r + 2 * diff)) + ((~vg) & (r - g + 4 * diff))));
+    h            = (h * hsv_div_table180[diff] + (1 << (HSV_SHIFT - 1))) >> HSV_SHIFT;
+    h += h < 0 ? 180 : 0;
+    dst[0] = h;
+    dst[1] = s;
+    dst[2] = v;
+}
+
+// 16 pixels, integer only, bit-exact with the scalar code above
+static inline void bgr2hsv_u8_vec(__m128i vb, __m128i vg, __m128i vr, __m128i &vh, __m128i &vs, __m128i &vv)
+{
+    vv            = _mm_max_epu8(_mm_max_epu8(vb, vg), vr);
+    __m128i vdiff = _mm_sub_epi8(vv, _mm_min_epu8(_mm_min_epu8(vb, vg), vr));
+
+    uint8_t v_buf[16], diff_buf[16];
+    _mm_storeu_si128((__m128i *)v_buf, vv);
+    _mm_storeu_si128((__m128i *)diff_buf, vdiff);
+
+    __m128i b[4], g[4], r[4], v[4], diff[4], h[4], s[4];
+    v_expand_u8_s32(vb, b);
+    v_expand_u8_s32(vg, g);
+    v_expand_u8_s32(vr, r);
+    v_expand_u8_s32(vv, v);
+    v_expand_u8_s32(vdiff, diff);
+
+    const __m128i v_half = _mm_set1_epi32(1 << (HSV_SHIFT - 1));
+    const __m128i v_180  = _mm_set1_epi32(180);
+    for (int32_t k = 0; k < 4; ++k) {
+        const uint8_t *pv = v_buf + 4 * k;
+        const uint8_t *pd = diff_buf + 4 * k;
+        __m128i sdiv      = _mm_setr_epi32(hsv_div_table[pv[0]], hsv_div_table[pv[1]], hsv_div_table[pv[2]], hsv_div_table[pv[3]]);
+        __m128i hdiv      = _mm_setr_epi32(hsv_div_table180[pd[0]], hsv_div_table180[pd[1]], hsv_div_table180[pd[2]], hsv_div_table180[pd[3]]);
+        s[k]              = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(diff[k], sdiv), v_half), HSV_SHIFT);
+
+        __m128i mask_r  = _mm_cmpeq_epi32(v[k], r[k]);
+        __m128i mask_g  = _mm_cmpeq_epi32(v[k], g[k]);
+        __m128i diff2   = _mm_add_epi32(diff[k], diff[k]);
+        __m128i h_r     = _mm_sub_epi32(g[k], b[k]);
+        __m128i h_g     = _mm_add_epi32(_mm_sub_epi32(b[k], r[k]), diff2);
+        __m128i h_b     = _mm_add_epi32(_mm_sub_epi32(r[k], g[k]), _mm_add_epi32(diff2, diff2));
+        __m128i hh      = _mm_blendv_epi8(_mm_blendv_epi8(h_b, h_g, mask_g), h_r, mask_r);
+        hh              = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(hh, hdiv), v_half), HSV_SHIFT);
+        h[k]            = _mm_add_epi32(hh, _mm_and_si128(_mm_cmplt_epi32(hh, _mm_setzero_si128()), v_180));
+    }
+    vh = v_pack_s32_u8(h);
+    vs = v_pack_s32_u8(s);
+}
+
+template <int32_t ncSrc, int32_t bIdx>
+static void bgr2hsv_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i b, g, r, h, s, v;
+            load_bgr_u8<ncSrc, bIdx>(src + j * ncSrc, b, g, r);
+            bgr2hsv_u8_vec(b, g, r, h, s, v);
+            v_store_interleave(dst + j * 3, h, s, v);
+        }
+        for (; j < width; ++j) {
+            const uint8_t *p = src + j * ncSrc;
+            bgr2hsv_u8_pixel(p[bIdx], p[1], p[bIdx ^ 2], dst + j * 3);
+        }
+    }
+}
+
+static inline void bgr2hsv_f32_pixel(float b, float g, float r, float *dst)
+{
+    float v    = std::max(std::max(b, g), r);
+    float diff = v - std::min(std::min(b, g), r);
+    float s    = diff / (std::fabs(v) + FLT_EPSILON);
+    float rdiff = 60.0f / (diff + FLT_EPSILON);
+    float h;
+    if (v == r) {
+        h = (g - b) * rdiff;
+    } else if (v == g) {
+        h = (b - r) * rdiff + 120.0f;
+    } else {
+        h = (r - g) * rdiff + 240.0f;
+    }
+    if (h < 0.0f) {
+        h += 360.0f;
+    }
+    dst[0] = h;
+    dst[1] = s;
+    dst[2] = v;
+}
+
+static inline void bgr2hsv_f32_vec(__m128 b, __m128 g, __m128 r, __m128 &h, __m128 &s, __m128 &v)
+{
+    const __m128 v_eps      = _mm_set1_ps(FLT_EPSILON);
+    const __m128 v_abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    v                       = _mm_max_ps(_mm_max_ps(b, g), r);
+    __m128 diff             = _mm_sub_ps(v, _mm_min_ps(_mm_min_ps(b, g), r));
+    s                       = _mm_mul_ps(diff, v_rcp_nr(_mm_add_ps(_mm_and_ps(v, v_abs_mask), v_eps)));
+    __m128 rdiff            = _mm_mul_ps(_mm_set1_ps(60.0f), v_rcp_nr(_mm_add_ps(diff, v_eps)));
+
+    __m128 mask_r = _mm_cmpeq_ps(v, r);
+    __m128 mask_g = _mm_cmpeq_ps(v, g);
+    __m128 hnum   = _mm_blendv_ps(_mm_blendv_ps(_mm_sub_ps(r, g), _mm_sub_ps(b, r), mask_g), _mm_sub_ps(g, b), mask_r);
+    __m128 hoff   = _mm_blendv_ps(_mm_blendv_ps(_mm_set1_ps(240.0f), _mm_set1_ps(120.0f), mask_g), _mm_setzero_ps(), mask_r);
+    h             = _mm_add_ps(_mm_mul_ps(hnum, rdiff), hoff);
+    h             = _mm_add_ps(h, _mm_and_ps(_mm_cmplt_ps(h, _mm_setzero_ps()), _mm_set1_ps(360.0f)));
+}
+
+template <int32_t ncSrc, int32_t bIdx>
+static void bgr2hsv_f32(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    for (int32_t i = 0; i < height; ++i) {
+        const float *src = inData + i * inWidthStride;
+        float *dst       = outData + i * outWidthStride;
+        int32_t j        = 0;
+        for (; j <= width - 4; j += 4) {
+            __m128 b, g, r, h, s, v;
+            load_bgr_f32<ncSrc, bIdx>(src + j * ncSrc, b, g, r);
+            bgr2hsv_f32_vec(b, g, r, h, s, v);
+            v_store_interleave(dst + j * 3, h, s, v);
+        }
+        for (; j < width; ++j) {
+            const float *p = src + j * ncSrc;
+            bgr2hsv_f32_pixel(p[bIdx], p[1], p[bIdx ^ 2], dst + j * 3);
+        }
+    }
+}
+
+static inline void hsv2bgr_pixel(float h, float s, float v, float hscale, float *b, float *g, float *r)
+{
+    static const int32_t sector_data[][3] = {{1, 3, 0}, {1, 0, 2}, {3, 0, 1}, {0, 2, 1}, {0, 1, 3}, {2, 1, 0}};
+    h *= hscale;
+    float fsector = std::floor(h);
+    h -= fsector;
+    fsector -= std::floor(fsector * (1.0f / 6.0f)) * 6.0f;
+    int32_t sector = static_cast<int32_t>(fsector);
+    if (static_cast<uint32_t>(sector) >= 6u) {
+        sector = 0;
+        h      = 0.0f;
+    }
+    float tab[4];
+    tab[0] = v;
+    tab[1] = v * (1.0f - s);
+    tab[2] = v * (1.0f - s * h);
+    tab[3] = v * (1.0f - s * (1.0f - h));
+    *b     = tab[sector_data[sector][0]];
+    *g     = tab[sector_data[sector][1]];
+    *r     = tab[sector_data[sector][2]];
+}
+
+// branchless sector selection, the same arithmetic as hsv2bgr_pixel
+static inline void hsv2bgr_vec(__m128 h, __m128 s, __m128 v, __m128 hscale, __m128 &b, __m128 &g, __m128 &r)
+{
+    const __m128 v_one = _mm_set1_ps(1.0f);
+    const __m128 v_six = _mm_set1_ps(6.0f);
+    h                  = _mm_mul_ps(h, hscale);
+    __m128 sector      = _mm_floor_ps(h);
+    h                  = _mm_sub_ps(h, sector);
+    sector             = _mm_sub_ps(sector, _mm_mul_ps(_mm_floor_ps(_mm_mul_ps(sector, _mm_set1_ps(1.0f / 6.0f))), v_six));
+    __m128 invalid     = _mm_or_ps(_mm_cmplt_ps(sector, _mm_setzero_ps()), _mm_cmpge_ps(sector, v_six));
+    sector             = _mm_andnot_ps(invalid, sector);
+    h                  = _mm_andnot_ps(invalid, h);
+
+    __m128 tab0 = v;
+    __m128 tab1 = _mm_mul_ps(v, _mm_sub_ps(v_one, s));
+    __m128 tab2 = _mm_mul_ps(v, _mm_sub_ps(v_one, _mm_mul_ps(s, h)));
+    __m128 tab3 = _mm_mul_ps(v, _mm_sub_ps(v_one, _mm_mul_ps(s, _mm_sub_ps(v_one, h))));
+
+    __m128 m1 = _mm_cmpeq_ps(sector, _mm_set1_ps(1.0f));
+    __m128 m2 = _mm_cmpeq_ps(sector, _mm_set1_ps(2.0f));
+    __m128 m3 = _mm_cmpeq_ps(sector, _mm_set1_ps(3.0f));
+    __m128 m4 = _mm_cmpeq_ps(sector, _mm_set1_ps(4.0f));
+    __m128 m5 = _mm_cmpeq_ps(sector, _mm_set1_ps(5.0f));
+
+    b = _mm_blendv_ps(tab1, tab3, m2);
+    b = _mm_blendv_ps(b, tab0, _mm_or_ps(m3, m4));
+    b = _mm_blendv_ps(b, tab2, m5);
+    g = _mm_blendv_ps(tab3, tab0, _mm_or_ps(m1, m2));
+    g = _mm_blendv_ps(g, tab2, m3);
+    g = _mm_blendv_ps(g, tab1, _mm_or_ps(m4, m5));
+    r = _mm_blendv_ps(tab0, tab2, m1);
+    r = _mm_blendv_ps(r, tab1, _mm_or_ps(m2, m3));
+    r = _mm_blendv_ps(r, tab3, m4);
+}
+
+template <int32_t ncDst, int32_t bIdx>
+static void hsv2bgr_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const float hscale        = 6.0f / 180.0f;
+    const __m128 v_hscale     = _mm_set1_ps(hscale);
+    const __m128 v_1_255      = _mm_set1_ps(1.0f / 255.0f);
+    const __m128 v_255        = _mm_set1_ps(255.0f);
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i vh, vs, vv;
+            v_load_deinterleave(src + j * 3, vh, vs, vv);
+            __m128i h[4], s[4], v[4], b[4], g[4], r[4];
+            v_expand_u8_s32(vh, h);
+            v_expand_u8_s32(vs, s);
+            v_expand_u8_s32(vv, v);
+            for (int32_t k = 0; k < 4; ++k) {
+                __m128 fb, fg, fr;
+                hsv2bgr_vec(_mm_cvtepi32_ps(h[k]),
+                            _mm_mul_ps(_mm_cvtepi32_ps(s[k]), v_1_255),
+                            _mm_mul_ps(_mm_cvtepi32_ps(v[k]), v_1_255),
+                            v_hscale, fb, fg, fr);
+                b[k] = _mm_cvtps_epi32(_mm_mul_ps(fb, v_255));
+                g[k] = _mm_cvtps_epi32(_mm_mul_ps(fg, v_255));
+                r[k] = _mm_cvtps_epi32(_mm_mul_ps(fr, v_255));
+            }
+            store_bgr_u8<ncDst, bIdx>(dst + j * ncDst, v_pack_s32_u8(b), v_pack_s32_u8(g), v_pack_s32_u8(r));
+        }
+        for (; j < width; ++j) {
+            const uint8_t *p = src + j * 3;
+            uint8_t *q       = dst + j * ncDst;
+            float b, g, r;
+            hsv2bgr_pixel(p[0], p[1] * (1.0f / 255.0f), p[2] * (1.0f / 255.0f), hscale, &b, &g, &r);
+            q[bIdx]     = sat_cast_u8(_mm_cvtss_si32(_mm_set_ss(b * 255.0f)));
+            q[1]        = sat_cast_u8(_mm_cvtss_si32(_mm_set_ss(g * 255.0f)));
+            q[bIdx ^ 2] = sat_cast_u8(_mm_cvtss_si32(_mm_set_ss(r * 255.0f)));
+            if (ncDst == 4) {
+                q[3] = 255;
+            }
+        }
+    }
+}
+
+template <int32_t ncDst, int32_t bIdx>
+static void hsv2bgr_f32(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    const float hscale    = 6.0f / 360.0f;
+    const __m128 v_hscale = _mm_set1_ps(hscale);
+    for (int32_t i = 0; i < height; ++i) {
+        const float *src = inData + i * inWidthStride;
+        float *dst       = outData + i * outWidthStride;
+        int32_t j        = 0;
+        for (; j <= width - 4; j += 4) {
+            __m128 h, s, v, b, g, r;
+            v_load_deinterleave(src + j * 3, h, s, v);
+            hsv2bgr_vec(h, s, v, v_hscale, b, g, r);
+            store_bgr_f32<ncDst, bIdx>(dst + j * ncDst, b, g, r);
+        }
+        for (; j < width; ++j) {
+            const float *p = src + j * 3;
+            float *q       = dst + j * ncDst;
+            hsv2bgr_pixel(p[0], p[1], p[2], hscale, q + bIdx, q + 1, q + (bIdx ^ 2));
+            if (ncDst == 4) {
+                q[3] = 1.0f;
+            }
+        }
+    }
+}
+
+template <>
+::ppl::common::RetCode BGR2HSV<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2hsv_f32<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode BGR2HSV<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2hsv_u8<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGB2HSV<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2hsv_f32<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGB2HSV<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2hsv_u8<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode BGRA2HSV<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2hsv_f32<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode BGRA2HSV<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2hsv_u8<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGBA2HSV<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2hsv_f32<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGBA2HSV<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2hsv_u8<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode HSV2BGR<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    hsv2bgr_f32<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode HSV2BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    hsv2bgr_u8<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode HSV2RGB<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    hsv2bgr_f32<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode HSV2RGB<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    hsv2bgr_u8<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode HSV2BGRA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    hsv2bgr_f32<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode HSV2BGRA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    hsv2bgr_u8<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode HSV2RGBA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    hsv2bgr_f32<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode HSV2RGBA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    hsv2bgr_u8<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
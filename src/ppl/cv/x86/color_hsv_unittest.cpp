@@ -0,0 +1,160 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+enum Color2HSVMode {BGR2HSV_MODE, RGB2HSV_MODE};
+template<typename T, int32_t nc, Color2HSVMode mode>
+void Color2HSVTest(int32_t height, int32_t width, float diff) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * 3]);
+    std::unique_ptr<T[]> dst(new T[width * height * 3]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 3), dst_ref.get());
+    if (nc == 3) {
+        if (mode == BGR2HSV_MODE) {
+            ppl::cv::x86::BGR2HSV<T>(height, width, width * nc, src.get(), width * 3, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_BGR2HSV);
+        }
+        if (mode == RGB2HSV_MODE) {
+            ppl::cv::x86::RGB2HSV<T>(height, width, width * nc, src.get(), width * 3, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_RGB2HSV);
+        }
+    } else if (nc == 4) {
+        cv::Mat bgrMat;
+        if (mode == BGR2HSV_MODE) {
+            ppl::cv::x86::BGRA2HSV<T>(height, width, width * nc, src.get(), width * 3, dst.get());
+            cv::cvtColor(srcMat, bgrMat, cv::COLOR_BGRA2BGR);
+            cv::cvtColor(bgrMat, dstMat, cv::COLOR_BGR2HSV);
+        }
+        if (mode == RGB2HSV_MODE) {
+            ppl::cv::x86::RGBA2HSV<T>(height, width, width * nc, src.get(), width * 3, dst.get());
+            cv::cvtColor(srcMat, bgrMat, cv::COLOR_RGBA2RGB);
+            cv::cvtColor(bgrMat, dstMat, cv::COLOR_RGB2HSV);
+        }
+    }
+    checkResult<T, 3>(dst.get(), dst_ref.get(), height, width, width * 3, width * 3, diff);
+}
+
+enum HSV2ColorMode {HSV2BGR_MODE, HSV2RGB_MODE};
+template<typename T, int32_t nc, HSV2ColorMode mode>
+void HSV2ColorTest(int32_t height, int32_t width, float diff) {
+    std::unique_ptr<T[]> bgr(new T[width * height * 3]);
+    std::unique_ptr<T[]> src(new T[width * height * 3]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(bgr.get(), width * height * 3, 0, 255);
+    cv::Mat bgrMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 3), bgr.get());
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 3), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
+    // build valid HSV input, hue ranges differ between uint8_t and float
+    cv::cvtColor(bgrMat, srcMat, cv::COLOR_BGR2HSV);
+    if (nc == 3) {
+        if (mode == HSV2BGR_MODE) {
+            ppl::cv::x86::HSV2BGR<T>(height, width, width * 3, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_HSV2BGR);
+        }
+        if (mode == HSV2RGB_MODE) {
+            ppl::cv::x86::HSV2RGB<T>(height, width, width * 3, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_HSV2RGB);
+        }
+    } else if (nc == 4) {
+        cv::Mat tmpMat;
+        if (mode == HSV2BGR_MODE) {
+            ppl::cv::x86::HSV2BGRA<T>(height, width, width * 3, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, tmpMat, cv::COLOR_HSV2BGR);
+            cv::cvtColor(tmpMat, dstMat, cv::COLOR_BGR2BGRA);
+        }
+        if (mode == HSV2RGB_MODE) {
+            ppl::cv::x86::HSV2RGBA<T>(height, width, width * 3, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, tmpMat, cv::COLOR_HSV2RGB);
+            cv::cvtColor(tmpMat, dstMat, cv::COLOR_RGB2RGBA);
+        }
+    }
+    checkResult<T, nc>(dst.get(), dst_ref.get(), height, width, width * nc, width * nc, diff);
+}
+
+// uint8_t BGR2HSV uses the fixed-point tables of OpenCV, so any difference fails
+TEST(BGR2HSV_UINT8, x86)
+{
+    Color2HSVTest<uint8_t, 3, BGR2HSV_MODE>(640, 720, 0.01f);
+    Color2HSVTest<uint8_t, 3, BGR2HSV_MODE>(719, 1081, 0.01f);
+    Color2HSVTest<uint8_t, 4, BGR2HSV_MODE>(640, 720, 0.01f);
+    Color2HSVTest<uint8_t, 4, BGR2HSV_MODE>(719, 1081, 0.01f);
+}
+
+TEST(RGB2HSV_UINT8, x86)
+{
+    Color2HSVTest<uint8_t, 3, RGB2HSV_MODE>(640, 720, 0.01f);
+    Color2HSVTest<uint8_t, 3, RGB2HSV_MODE>(719, 1081, 0.01f);
+    Color2HSVTest<uint8_t, 4, RGB2HSV_MODE>(640, 720, 0.01f);
+    Color2HSVTest<uint8_t, 4, RGB2HSV_MODE>(719, 1081, 0.01f);
+}
+
+TEST(BGR2HSV_FP32, x86)
+{
+    Color2HSVTest<float, 3, BGR2HSV_MODE>(640, 720, 1e-3f);
+    Color2HSVTest<float, 3, BGR2HSV_MODE>(719, 1081, 1e-3f);
+    Color2HSVTest<float, 4, BGR2HSV_MODE>(640, 720, 1e-3f);
+    Color2HSVTest<float, 4, BGR2HSV_MODE>(719, 1081, 1e-3f);
+}
+
+TEST(RGB2HSV_FP32, x86)
+{
+    Color2HSVTest<float, 3, RGB2HSV_MODE>(640, 720, 1e-3f);
+    Color2HSVTest<float, 3, RGB2HSV_MODE>(719, 1081, 1e-3f);
+    Color2HSVTest<float, 4, RGB2HSV_MODE>(640, 720, 1e-3f);
+    Color2HSVTest<float, 4, RGB2HSV_MODE>(719, 1081, 1e-3f);
+}
+
+// uint8_t HSV2BGR rounds the float result, newer OpenCV versions may differ by 1
+TEST(HSV2BGR_UINT8, x86)
+{
+    HSV2ColorTest<uint8_t, 3, HSV2BGR_MODE>(640, 720, 1.01f);
+    HSV2ColorTest<uint8_t, 3, HSV2BGR_MODE>(719, 1081, 1.01f);
+    HSV2ColorTest<uint8_t, 4, HSV2BGR_MODE>(640, 720, 1.01f);
+    HSV2ColorTest<uint8_t, 4, HSV2BGR_MODE>(719, 1081, 1.01f);
+}
+
+TEST(HSV2RGB_UINT8, x86)
+{
+    HSV2ColorTest<uint8_t, 3, HSV2RGB_MODE>(640, 720, 1.01f);
+    HSV2ColorTest<uint8_t, 3, HSV2RGB_MODE>(719, 1081, 1.01f);
+    HSV2ColorTest<uint8_t, 4, HSV2RGB_MODE>(640, 720, 1.01f);
+    HSV2ColorTest<uint8_t, 4, HSV2RGB_MODE>(719, 1081, 1.01f);
+}
+
+TEST(HSV2BGR_FP32, x86)
+{
+    HSV2ColorTest<float, 3, HSV2BGR_MODE>(640, 720, 1e-3f);
+    HSV2ColorTest<float, 3, HSV2BGR_MODE>(719, 1081, 1e-3f);
+    HSV2ColorTest<float, 4, HSV2BGR_MODE>(640, 720, 1e-3f);
+    HSV2ColorTest<float, 4, HSV2BGR_MODE>(719, 1081, 1e-3f);
+}
+
+TEST(HSV2RGB_FP32, x86)
+{
+    HSV2ColorTest<float, 3, HSV2RGB_MODE>(640, 720, 1e-3f);
+    HSV2ColorTest<float, 3, HSV2RGB_MODE>(719, 1081, 1e-3f);
+    HSV2ColorTest<float, 4, HSV2RGB_MODE>(640, 720, 1e-3f);
+    HSV2ColorTest<float, 4, HSV2RGB_MODE>(719, 1081, 1e-3f);
+}
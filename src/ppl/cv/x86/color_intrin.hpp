@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PPL_CV_X86_COLOR_INTRIN_H_
+#define PPL_CV_X86_COLOR_INTRIN_H_
+
+#include "ppl/cv/x86/intrinutils.hpp"
+#include <stdint.h>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// packed BGR(A)/RGB(A) <-> planar b, g, r helpers shared by the color conversions,
+// bIdx is 0 for BGR order and 2 for RGB order, alpha is dropped on load and set
+// to the maximum value on store.
+template <int32_t nc, int32_t bIdx>
+inline void load_bgr_u8(const uint8_t *src, __m128i &b, __m128i &g, __m128i &r)
+{
+    __m128i c0, c1, c2, c3;
+    if (nc == 3) {
+        v_load_deinterleave(src, c0, c1, c2);
+    } else {
+        v_load_deinterleave(src, c0, c1, c2, c3);
+    }
+    b = bIdx == 0 ? c0 : c2;
+    g = c1;
+    r = bIdx == 0 ? c2 : c0;
+}
+
+template <int32_t nc, int32_t bIdx>
+inline void load_bgr_f32(const float *src, __m128 &b, __m128 &g, __m128 &r)
+{
+    __m128 c0, c1, c2, c3;
+    if (nc == 3) {
+        v_load_deinterleave(src, c0, c1, c2);
+    } else {
+        v_load_deinterleave(src, c0, c1, c2, c3);
+    }
+    b = bIdx == 0 ? c0 : c2;
+    g = c1;
+    r = bIdx == 0 ? c2 : c0;
+}
+
+template <int32_t nc, int32_t bIdx>
+inline void store_bgr_u8(uint8_t *dst, __m128i b, __m128i g, __m128i r)
+{
+    __m128i c0 = bIdx == 0 ? b : r;
+    __m128i c2 = bIdx == 0 ? r : b;
+    if (nc == 3) {
+        v_store_interleave(dst, c0, g, c2);
+    } else {
+        v_store_interleave(dst, c0, g, c2, _mm_set1_epi8(-1));
+    }
+}
+
+template <int32_t nc, int32_t bIdx>
+inline void store_bgr_f32(float *dst, __m128 b, __m128 g, __m128 r)
+{
+    __m128 c0 = bIdx == 0 ? b : r;
+    __m128 c2 = bIdx == 0 ? r : b;
+    if (nc == 3) {
+        v_store_interleave(dst, c0, g, c2);
+    } else {
+        v_store_interleave(dst, c0, g, c2, _mm_set1_ps(1.0f));
+    }
+}
+
+inline void v_expand_u8_s32(__m128i x, __m128i *out)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i lo   = _mm_unpacklo_epi8(x, zero);
+    __m128i hi   = _mm_unpackhi_epi8(x, zero);
+    out[0]       = _mm_unpacklo_epi16(lo, zero);
+    out[1]       = _mm_unpackhi_epi16(lo, zero);
+    out[2]       = _mm_unpacklo_epi16(hi, zero);
+    out[3]       = _mm_unpackhi_epi16(hi, zero);
+}
+
+inline __m128i v_pack_s32_u8(const __m128i *in)
+{
+    return _mm_packus_epi16(_mm_packs_epi32(in[0], in[1]), _mm_packs_epi32(in[2], in[3]));
+}
+
+
+} //! namespace x86
+} //! namespace cv
+} //! namespace ppl
+
+#endif //! PPL_CV_X86_COLOR_INTRIN_H_
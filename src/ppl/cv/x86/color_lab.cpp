@@ -0,0 +1,757 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/color_intrin.hpp"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+#include <cmath>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define LAB_GAMMA_SHIFT     3
+#define LAB_SHIFT           12
+#define LAB_SHIFT2          (LAB_SHIFT + LAB_GAMMA_SHIFT)
+#define LAB_CBRT_TAB_SIZE_B ((255 << LAB_GAMMA_SHIFT) + 1)
+#define LAB_TAB_SIZE        2048
+
+// sRGB -> XYZ (D65) rows divided by the white point, in B, G, R order
+static const float lab_bgr2xyz_f[9] = {
+    0.180423f / 0.950456f, 0.357580f / 0.950456f, 0.412453f / 0.950456f,
+    0.072169f, 0.715160f, 0.212671f,
+    0.950227f / 1.088754f, 0.119193f / 1.088754f, 0.019334f / 1.088754f};
+// the same matrix in Q12, the coefficients of every row sum up to 4096
+static const int16_t lab_bgr2xyz_b[9] = {
+    778, 1541, 1777,
+    296, 2929, 871,
+    3575, 448, 73};
+// XYZ -> sRGB (D65) multiplied by the white point, B, G, R output rows
+static const float lab_xyz2bgr_f[9] = {
+    0.052891f, -0.204043f, 1.151152f,
+    -0.921235f, 1.875991f, 0.045244f,
+    3.079933f, -1.537150f, -0.542782f};
+
+static inline float lab_srgb_gamma(float x)
+{
+    return x <= 0.04045f ? x * (1.0f / 12.92f) : (float)std::pow((x + 0.055) * (1.0 / 1.055), 2.4);
+}
+
+static inline float lab_srgb_inv_gamma(float x)
+{
+    return x <= 0.0031308f ? x * 12.92f : (float)(std::pow((double)x, 1.0 / 2.4) * 1.055 - 0.055);
+}
+
+static inline float lab_cbrt(float x)
+{
+    return x < 0.008856f ? x * 7.787f + 0.13793103448275862f : std::cbrt(x);
+}
+
+// Tables are built on first use and shared afterwards. The uint8_t ones follow
+// OpenCV's integer pipeline. The float ones hold {f(i / N), f((i + 1) / N) - f(i / N)}
+// pairs so that one 64-bit load per lane feeds a linear interpolation over [0, 1].
+struct LabTables {
+    uint16_t srgb_gamma_b[256];
+    uint16_t cbrt_b[LAB_CBRT_TAB_SIZE_B];
+    float srgb_gamma_f[LAB_TAB_SIZE * 2];
+    float srgb_inv_gamma_f[LAB_TAB_SIZE * 2];
+    float cbrt_f[LAB_TAB_SIZE * 2];
+
+    LabTables()
+    {
+        for (int32_t i = 0; i < 256; ++i) {
+            float x         = i * (1.0f / 255.0f);
+            srgb_gamma_b[i] = sat_cast_u16(255.0f * (1 << LAB_GAMMA_SHIFT) * lab_srgb_gamma(x));
+        }
+        for (int32_t i = 0; i < LAB_CBRT_TAB_SIZE_B; ++i) {
+            float x   = i * (1.0f / (255.0f * (1 << LAB_GAMMA_SHIFT)));
+            cbrt_b[i] = sat_cast_u16((1 << LAB_SHIFT2) * lab_cbrt(x));
+        }
+        build(srgb_gamma_f, lab_srgb_gamma);
+        build(srgb_inv_gamma_f, lab_srgb_inv_gamma);
+        build(cbrt_f, lab_cbrt);
+    }
+
+    static uint16_t sat_cast_u16(float x)
+    {
+        int32_t v = static_cast<int32_t>(std::lrint(x));
+        return static_cast<uint16_t>(std::min(std::max(v, 0), 65535));
+    }
+
+    static void build(float *tab, float (*f)(float))
+    {
+        float y0 = f(0.0f);
+        for (int32_t i = 0; i < LAB_TAB_SIZE; ++i) {
+            float y1       = f((i + 1) * (1.0f / LAB_TAB_SIZE));
+            tab[i * 2]     = y0;
+            tab[i * 2 + 1] = y1 - y0;
+            y0             = y1;
+        }
+    }
+};
+
+static const LabTables &lab_tables()
+{
+    static const LabTables tables;
+    return tables;
+}
+
+static inline float lab_interp(const float *tab, float x)
+{
+    x         = std::min(std::max(x, 0.0f), 1.0f) * LAB_TAB_SIZE;
+    int32_t i = std::min(static_cast<int32_t>(x), LAB_TAB_SIZE - 1);
+    x -= i;
+    return tab[i * 2] + tab[i * 2 + 1] * x;
+}
+
+static inline __m128 v_lab_interp(const float *tab, __m128 x)
+{
+    x         = _mm_mul_ps(_mm_min_ps(_mm_max_ps(x, _mm_setzero_ps()), _mm_set1_ps(1.0f)), _mm_set1_ps((float)LAB_TAB_SIZE));
+    __m128i i = _mm_min_epi32(_mm_cvttps_epi32(x), _mm_set1_epi32(LAB_TAB_SIZE - 1));
+    x         = _mm_sub_ps(x, _mm_cvtepi32_ps(i));
+    i         = _mm_add_epi32(i, i);
+    __m128 p0  = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)(tab + _mm_cvtsi128_si32(i))));
+    __m128 p1  = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)(tab + _mm_extract_epi32(i, 1))));
+    __m128 p2  = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)(tab + _mm_extract_epi32(i, 2))));
+    __m128 p3  = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)(tab + _mm_extract_epi32(i, 3))));
+    __m128 t01 = _mm_unpacklo_ps(p0, p1);
+    __m128 t23 = _mm_unpacklo_ps(p2, p3);
+    return _mm_add_ps(_mm_movelh_ps(t01, t23), _mm_mul_ps(_mm_movehl_ps(t23, t01), x));
+}
+
+// the interpolated cube root is refined by one Newton step, its error is
+// amplified by 500 in a, a table alone would need to be far larger
+static inline float lab_cbrt_f(const LabTables &tabs, float x)
+{
+    if (x < 0.008856f) {
+        return x * 7.787f + 0.13793103448275862f;
+    }
+    float y = lab_interp(tabs.cbrt_f, x);
+    return (y + y + std::min(x, 1.0f) / (y * y)) * (1.0f / 3.0f);
+}
+
+static inline __m128 v_lab_cbrt(const LabTables &tabs, __m128 x)
+{
+    __m128 y    = v_lab_interp(tabs.cbrt_f, x);
+    __m128 r    = _mm_rcp_ps(_mm_mul_ps(y, y));
+    r           = _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(2.0f), _mm_mul_ps(_mm_mul_ps(y, y), r)));
+    __m128 xc   = _mm_min_ps(x, _mm_set1_ps(1.0f));
+    __m128 ynr  = _mm_mul_ps(_mm_add_ps(_mm_add_ps(y, y), _mm_mul_ps(xc, r)), _mm_set1_ps(1.0f / 3.0f));
+    __m128 ylin = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(7.787f)), _mm_set1_ps(0.13793103448275862f));
+    return _mm_blendv_ps(ynr, ylin, _mm_cmplt_ps(x, _mm_set1_ps(0.008856f)));
+}
+
+static inline __m128i v_lab_lookup(const uint16_t *tab, __m128i idx)
+{
+    return _mm_setr_epi32(tab[_mm_cvtsi128_si32(idx)], tab[_mm_extract_epi32(idx, 1)], tab[_mm_extract_epi32(idx, 2)], tab[_mm_extract_epi32(idx, 3)]);
+}
+
+/************************************ BGR -> Lab ************************************/
+
+#define LAB_L_SCALE ((116 * 255 + 50) / 100)
+#define LAB_L_SHIFT (-((16 * 255 * (1 << LAB_SHIFT2) + 50) / 100))
+
+static inline void bgr2lab_u8_pixel(const LabTables &tabs, int32_t b, int32_t g, int32_t r, uint8_t *dst)
+{
+    const int16_t *c = lab_bgr2xyz_b;
+    b                = tabs.srgb_gamma_b[b];
+    g                = tabs.srgb_gamma_b[g];
+    r                = tabs.srgb_gamma_b[r];
+    int32_t fx       = tabs.cbrt_b[(b * c[0] + g * c[1] + r * c[2] + (1 << (LAB_SHIFT - 1))) >> LAB_SHIFT];
+    int32_t fy       = tabs.cbrt_b[(b * c[3] + g * c[4] + r * c[5] + (1 << (LAB_SHIFT - 1))) >> LAB_SHIFT];
+    int32_t fz       = tabs.cbrt_b[(b * c[6] + g * c[7] + r * c[8] + (1 << (LAB_SHIFT - 1))) >> LAB_SHIFT];
+    int32_t l        = (LAB_L_SCALE * fy + LAB_L_SHIFT + (1 << (LAB_SHIFT2 - 1))) >> LAB_SHIFT2;
+    int32_t a        = (500 * (fx - fy) + (128 << LAB_SHIFT2) + (1 << (LAB_SHIFT2 - 1))) >> LAB_SHIFT2;
+    int32_t bb       = (200 * (fy - fz) + (128 << LAB_SHIFT2) + (1 << (LAB_SHIFT2 - 1))) >> LAB_SHIFT2;
+    dst[0]           = sat_cast_u8(l);
+    dst[1]           = sat_cast_u8(a);
+    dst[2]           = sat_cast_u8(bb);
+}
+
+// one row of the Q12 matrix, (b, g) and (r, 1) word pairs go through pmaddwd
+static inline __m128i v_lab_dot_q12(__m128i bg, __m128i r1, const int16_t *c)
+{
+    __m128i c_bg = _mm_set1_epi32((uint16_t)c[0] | ((int32_t)c[1] << 16));
+    __m128i c_r1 = _mm_set1_epi32((uint16_t)c[2] | ((1 << (LAB_SHIFT - 1)) << 16));
+    return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(bg, c_bg), _mm_madd_epi16(r1, c_r1)), LAB_SHIFT);
+}
+
+static inline void bgr2lab_u8_vec(const LabTables &tabs, __m128i vb, __m128i vg, __m128i vr, __m128i &vl, __m128i &va, __m128i &vbb)
+{
+    uint8_t b_buf[16], g_buf[16], r_buf[16];
+    _mm_storeu_si128((__m128i *)b_buf, vb);
+    _mm_storeu_si128((__m128i *)g_buf, vg);
+    _mm_storeu_si128((__m128i *)r_buf, vr);
+
+    const uint16_t *gamma    = tabs.srgb_gamma_b;
+    const __m128i v_one      = _mm_set1_epi16(1);
+    const __m128i v_l_scale  = _mm_set1_epi32(LAB_L_SCALE);
+    const __m128i v_l_shift  = _mm_set1_epi32(LAB_L_SHIFT + (1 << (LAB_SHIFT2 - 1)));
+    const __m128i v_ab_shift = _mm_set1_epi32((128 << LAB_SHIFT2) + (1 << (LAB_SHIFT2 - 1)));
+    const __m128i v_500      = _mm_set1_epi32(500);
+    const __m128i v_200      = _mm_set1_epi32(200);
+    __m128i l[4], a[4], bb[4];
+    for (int32_t h = 0; h < 2; ++h) {
+        const uint8_t *pb = b_buf + h * 8;
+        const uint8_t *pg = g_buf + h * 8;
+        const uint8_t *pr = r_buf + h * 8;
+        __m128i b         = _mm_setr_epi16(gamma[pb[0]], gamma[pb[1]], gamma[pb[2]], gamma[pb[3]], gamma[pb[4]], gamma[pb[5]], gamma[pb[6]], gamma[pb[7]]);
+        __m128i g         = _mm_setr_epi16(gamma[pg[0]], gamma[pg[1]], gamma[pg[2]], gamma[pg[3]], gamma[pg[4]], gamma[pg[5]], gamma[pg[6]], gamma[pg[7]]);
+        __m128i r         = _mm_setr_epi16(gamma[pr[0]], gamma[pr[1]], gamma[pr[2]], gamma[pr[3]], gamma[pr[4]], gamma[pr[5]], gamma[pr[6]], gamma[pr[7]]);
+        __m128i bg[2]     = {_mm_unpacklo_epi16(b, g), _mm_unpackhi_epi16(b, g)};
+        __m128i r1[2]     = {_mm_unpacklo_epi16(r, v_one), _mm_unpackhi_epi16(r, v_one)};
+        for (int32_t k = 0; k < 2; ++k) {
+            __m128i fx = v_lab_lookup(tabs.cbrt_b, v_lab_dot_q12(bg[k], r1[k], lab_bgr2xyz_b));
+            __m128i fy = v_lab_lookup(tabs.cbrt_b, v_lab_dot_q12(bg[k], r1[k], lab_bgr2xyz_b + 3));
+            __m128i fz = v_lab_lookup(tabs.cbrt_b, v_lab_dot_q12(bg[k], r1[k], lab_bgr2xyz_b + 6));
+            int32_t n  = h * 2 + k;
+            l[n]       = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(fy, v_l_scale), v_l_shift), LAB_SHIFT2);
+            a[n]       = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(_mm_sub_epi32(fx, fy), v_500), v_ab_shift), LAB_SHIFT2);
+            bb[n]      = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(_mm_sub_epi32(fy, fz), v_200), v_ab_shift), LAB_SHIFT2);
+        }
+    }
+    vl  = v_pack_s32_u8(l);
+    va  = v_pack_s32_u8(a);
+    vbb = v_pack_s32_u8(bb);
+}
+
+template <int32_t ncSrc, int32_t bIdx>
+static void bgr2lab_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const LabTables &tabs = lab_tables();
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i b, g, r, l, a, bb;
+            load_bgr_u8<ncSrc, bIdx>(src + j * ncSrc, b, g, r);
+            bgr2lab_u8_vec(tabs, b, g, r, l, a, bb);
+            v_store_interleave(dst + j * 3, l, a, bb);
+        }
+        for (; j < width; ++j) {
+            const uint8_t *p = src + j * ncSrc;
+            bgr2lab_u8_pixel(tabs, p[bIdx], p[1], p[bIdx ^ 2], dst + j * 3);
+        }
+    }
+}
+
+static inline void bgr2lab_f32_pixel(const LabTables &tabs, float b, float g, float r, float *dst)
+{
+    const float *c = lab_bgr2xyz_f;
+    b              = lab_interp(tabs.srgb_gamma_f, b);
+    g              = lab_interp(tabs.srgb_gamma_f, g);
+    r              = lab_interp(tabs.srgb_gamma_f, r);
+    float fx       = lab_cbrt_f(tabs, b * c[0] + g * c[1] + r * c[2]);
+    float fy       = lab_cbrt_f(tabs, b * c[3] + g * c[4] + r * c[5]);
+    float fz       = lab_cbrt_f(tabs, b * c[6] + g * c[7] + r * c[8]);
+    dst[0]         = 116.0f * fy - 16.0f;
+    dst[1]         = 500.0f * (fx - fy);
+    dst[2]         = 200.0f * (fy - fz);
+}
+
+static inline __m128 v_lab_dot(__m128 b, __m128 g, __m128 r, const float *c)
+{
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(b, _mm_set1_ps(c[0])), _mm_mul_ps(g, _mm_set1_ps(c[1]))), _mm_mul_ps(r, _mm_set1_ps(c[2])));
+}
+
+template <int32_t ncSrc, int32_t bIdx>
+static void bgr2lab_f32(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    const LabTables &tabs = lab_tables();
+    for (int32_t i = 0; i < height; ++i) {
+        const float *src = inData + i * inWidthStride;
+        float *dst       = outData + i * outWidthStride;
+        int32_t j        = 0;
+        for (; j <= width - 4; j += 4) {
+            __m128 b, g, r;
+            load_bgr_f32<ncSrc, bIdx>(src + j * ncSrc, b, g, r);
+            b         = v_lab_interp(tabs.srgb_gamma_f, b);
+            g         = v_lab_interp(tabs.srgb_gamma_f, g);
+            r         = v_lab_interp(tabs.srgb_gamma_f, r);
+            __m128 fx = v_lab_cbrt(tabs, v_lab_dot(b, g, r, lab_bgr2xyz_f));
+            __m128 fy = v_lab_cbrt(tabs, v_lab_dot(b, g, r, lab_bgr2xyz_f + 3));
+            __m128 fz = v_lab_cbrt(tabs, v_lab_dot(b, g, r, lab_bgr2xyz_f + 6));
+            __m128 l  = _mm_sub_ps(_mm_mul_ps(fy, _mm_set1_ps(116.0f)), _mm_set1_ps(16.0f));
+            __m128 a  = _mm_mul_ps(_mm_sub_ps(fx, fy), _mm_set1_ps(500.0f));
+            __m128 bb = _mm_mul_ps(_mm_sub_ps(fy, fz), _mm_set1_ps(200.0f));
+            v_store_interleave(dst + j * 3, l, a, bb);
+        }
+        for (; j < width; ++j) {
+            const float *p = src + j * ncSrc;
+            bgr2lab_f32_pixel(tabs, p[bIdx], p[1], p[bIdx ^ 2], dst + j * 3);
+        }
+    }
+}
+
+/************************************ Lab -> BGR ************************************/
+
+#define LAB_16_116    0.137931034f
+#define LAB_L_THRESH  7.9996248f
+#define LAB_F_THRESH  0.206892706f
+
+static inline void lab2bgr_f32_pixel(const LabTables &tabs, float l, float a, float b, float *bo, float *go, float *ro)
+{
+    float y, fy;
+    if (l <= LAB_L_THRESH) {
+        y  = l * (1.0f / 903.3f);
+        fy = 7.787f * y + LAB_16_116;
+    } else {
+        fy = (l + 16.0f) * (1.0f / 116.0f);
+        y  = fy * fy * fy;
+    }
+    float fx = a * (1.0f / 500.0f) + fy;
+    float fz = fy - b * (1.0f / 200.0f);
+    float x  = fx <= LAB_F_THRESH ? (fx - LAB_16_116) * (1.0f / 7.787f) : fx * fx * fx;
+    float z  = fz <= LAB_F_THRESH ? (fz - LAB_16_116) * (1.0f / 7.787f) : fz * fz * fz;
+
+    const float *c = lab_xyz2bgr_f;
+    *bo            = lab_interp(tabs.srgb_inv_gamma_f, x * c[0] + y * c[1] + z * c[2]);
+    *go            = lab_interp(tabs.srgb_inv_gamma_f, x * c[3] + y * c[4] + z * c[5]);
+    *ro            = lab_interp(tabs.srgb_inv_gamma_f, x * c[6] + y * c[7] + z * c[8]);
+}
+
+static inline __m128 v_lab_finv(__m128 f)
+{
+    __m128 lin  = _mm_mul_ps(_mm_sub_ps(f, _mm_set1_ps(LAB_16_116)), _mm_set1_ps(1.0f / 7.787f));
+    __m128 cube = _mm_mul_ps(_mm_mul_ps(f, f), f);
+    return _mm_blendv_ps(cube, lin, _mm_cmple_ps(f, _mm_set1_ps(LAB_F_THRESH)));
+}
+
+static inline void lab2bgr_f32_vec(const LabTables &tabs, __m128 l, __m128 a, __m128 b, __m128 &bo, __m128 &go, __m128 &ro)
+{
+    __m128 y_lo  = _mm_mul_ps(l, _mm_set1_ps(1.0f / 903.3f));
+    __m128 fy_lo = _mm_add_ps(_mm_mul_ps(y_lo, _mm_set1_ps(7.787f)), _mm_set1_ps(LAB_16_116));
+    __m128 fy_hi = _mm_mul_ps(_mm_add_ps(l, _mm_set1_ps(16.0f)), _mm_set1_ps(1.0f / 116.0f));
+    __m128 y_hi  = _mm_mul_ps(_mm_mul_ps(fy_hi, fy_hi), fy_hi);
+    __m128 mask  = _mm_cmple_ps(l, _mm_set1_ps(LAB_L_THRESH));
+    __m128 y     = _mm_blendv_ps(y_hi, y_lo, mask);
+    __m128 fy    = _mm_blendv_ps(fy_hi, fy_lo, mask);
+    __m128 x     = v_lab_finv(_mm_add_ps(_mm_mul_ps(a, _mm_set1_ps(1.0f / 500.0f)), fy));
+    __m128 z     = v_lab_finv(_mm_sub_ps(fy, _mm_mul_ps(b, _mm_set1_ps(1.0f / 200.0f))));
+    bo           = v_lab_interp(tabs.srgb_inv_gamma_f, v_lab_dot(x, y, z, lab_xyz2bgr_f));
+    go           = v_lab_interp(tabs.srgb_inv_gamma_f, v_lab_dot(x, y, z, lab_xyz2bgr_f + 3));
+    ro           = v_lab_interp(tabs.srgb_inv_gamma_f, v_lab_dot(x, y, z, lab_xyz2bgr_f + 6));
+}
+
+template <int32_t ncDst, int32_t bIdx>
+static void lab2bgr_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const LabTables &tabs  = lab_tables();
+    const __m128 v_l_scale = _mm_set1_ps(100.0f / 255.0f);
+    const __m128 v_128     = _mm_set1_ps(128.0f);
+    const __m128 v_255     = _mm_set1_ps(255.0f);
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i vl, va, vb;
+            v_load_deinterleave(src + j * 3, vl, va, vb);
+            __m128i l[4], a[4], b[4], bo[4], go[4], ro[4];
+            v_expand_u8_s32(vl, l);
+            v_expand_u8_s32(va, a);
+            v_expand_u8_s32(vb, b);
+            for (int32_t k = 0; k < 4; ++k) {
+                __m128 fb, fg, fr;
+                lab2bgr_f32_vec(tabs,
+                                _mm_mul_ps(_mm_cvtepi32_ps(l[k]), v_l_scale),
+                                _mm_sub_ps(_mm_cvtepi32_ps(a[k]), v_128),
+                                _mm_sub_ps(_mm_cvtepi32_ps(b[k]), v_128),
+                                fb, fg, fr);
+                bo[k] = _mm_cvtps_epi32(_mm_mul_ps(fb, v_255));
+                go[k] = _mm_cvtps_epi32(_mm_mul_ps(fg, v_255));
+                ro[k] = _mm_cvtps_epi32(_mm_mul_ps(fr, v_255));
+            }
+            store_bgr_u8<ncDst, bIdx>(dst + j * ncDst, v_pack_s32_u8(bo), v_pack_s32_u8(go), v_pack_s32_u8(ro));
+        }
+        for (; j < width; ++j) {
+            const uint8_t *p = src + j * 3;
+            uint8_t *q       = dst + j * ncDst;
+            float b, g, r;
+            lab2bgr_f32_pixel(tabs, p[0] * (100.0f / 255.0f), p[1] - 128.0f, p[2] - 128.0f, &b, &g, &r);
+            q[bIdx]     = sat_cast_u8(_mm_cvtss_si32(_mm_set_ss(b * 255.0f)));
+            q[1]        = sat_cast_u8(_mm_cvtss_si32(_mm_set_ss(g * 255.0f)));
+            q[bIdx ^ 2] = sat_cast_u8(_mm_cvtss_si32(_mm_set_ss(r * 255.0f)));
+            if (ncDst == 4) {
+                q[3] = 255;
+            }
+        }
+    }
+}
+
+template <int32_t ncDst, int32_t bIdx>
+static void lab2bgr_f32(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    const LabTables &tabs = lab_tables();
+    for (int32_t i = 0; i < height; ++i) {
+        const float *src = inData + i * inWidthStride;
+        float *dst       = outData + i * outWidthStride;
+        int32_t j        = 0;
+        for (; j <= width - 4; j += 4) {
+            __m128 l, a, b, bo, go, ro;
+            v_load_deinterleave(src + j * 3, l, a, b);
+            lab2bgr_f32_vec(tabs, l, a, b, bo, go, ro);
+            store_bgr_f32<ncDst, bIdx>(dst + j * ncDst, bo, go, ro);
+        }
+        for (; j < width; ++j) {
+            const float *p = src + j * 3;
+            float *q       = dst + j * ncDst;
+            lab2bgr_f32_pixel(tabs, p[0], p[1], p[2], q + bIdx, q + 1, q + (bIdx ^ 2));
+            if (ncDst == 4) {
+                q[3] = 1.0f;
+            }
+        }
+    }
+}
+
+template <>
+::ppl::common::RetCode BGR2LAB<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2lab_f32<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode BGR2LAB<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2lab_u8<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGB2LAB<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2lab_f32<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGB2LAB<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2lab_u8<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode BGRA2LAB<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2lab_f32<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode BGRA2LAB<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2lab_u8<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGBA2LAB<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2lab_f32<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGBA2LAB<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2lab_u8<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode LAB2BGR<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    lab2bgr_f32<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode LAB2BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    lab2bgr_u8<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode LAB2RGB<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    lab2bgr_f32<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode LAB2RGB<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    lab2bgr_u8<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode LAB2BGRA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    lab2bgr_f32<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode LAB2BGRA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    lab2bgr_u8<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode LAB2RGBA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    lab2bgr_f32<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode LAB2RGBA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    lab2bgr_u8<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
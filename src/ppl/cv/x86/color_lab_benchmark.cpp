@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/debug.h"
+
+namespace {
+
+template<typename T>
+void BM_BGR2LAB_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * 3]);
+    std::unique_ptr<T[]> dst(new T[width * height * 3]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * 3, 0, sizeof(T) == 1 ? 255 : 1);
+    for (auto _ : state) {
+        ppl::cv::x86::BGR2LAB<T>(height, width, width * 3, src.get(), width * 3, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template<typename T>
+void BM_LAB2BGR_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> bgr(new T[width * height * 3]);
+    std::unique_ptr<T[]> src(new T[width * height * 3]);
+    std::unique_ptr<T[]> dst(new T[width * height * 3]);
+    ppl::cv::debug::randomFill<T>(bgr.get(), width * height * 3, 0, sizeof(T) == 1 ? 255 : 1);
+    ppl::cv::x86::BGR2LAB<T>(height, width, width * 3, bgr.get(), width * 3, src.get());
+    for (auto _ : state) {
+        ppl::cv::x86::LAB2BGR<T>(height, width, width * 3, src.get(), width * 3, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_BGR2LAB_ppl_x86, float)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_BGR2LAB_ppl_x86, uint8_t)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_LAB2BGR_ppl_x86, float)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_LAB2BGR_ppl_x86, uint8_t)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<typename T>
+void BM_BGR2LAB_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * 3]);
+    std::unique_ptr<T[]> dst(new T[width * height * 3]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * 3, 0, sizeof(T) == 1 ? 255 : 1);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 3), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 3), dst.get());
+    for (auto _ : state) {
+        cv::cvtColor(srcMat, dstMat, cv::COLOR_BGR2Lab);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template<typename T>
+void BM_LAB2BGR_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> bgr(new T[width * height * 3]);
+    std::unique_ptr<T[]> dst(new T[width * height * 3]);
+    ppl::cv::debug::randomFill<T>(bgr.get(), width * height * 3, 0, sizeof(T) == 1 ? 255 : 1);
+    cv::Mat bgrMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 3), bgr.get());
+    cv::Mat srcMat;
+    cv::cvtColor(bgrMat, srcMat, cv::COLOR_BGR2Lab);
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 3), dst.get());
+    for (auto _ : state) {
+        cv::cvtColor(srcMat, dstMat, cv::COLOR_Lab2BGR);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_BGR2LAB_opencv_x86, float)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_BGR2LAB_opencv_x86, uint8_t)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_LAB2BGR_opencv_x86, float)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_LAB2BGR_opencv_x86, uint8_t)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
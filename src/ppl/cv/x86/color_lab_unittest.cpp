@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+enum Color2LABMode {BGR2LAB_MODE, RGB2LAB_MODE};
+template<typename T, int32_t nc, Color2LABMode mode>
+void Color2LABTest(int32_t height, int32_t width, float diff) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * 3]);
+    std::unique_ptr<T[]> dst(new T[width * height * 3]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, sizeof(T) == 1 ? 255 : 1);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 3), dst_ref.get());
+    if (nc == 3) {
+        if (mode == BGR2LAB_MODE) {
+            ppl::cv::x86::BGR2LAB<T>(height, width, width * nc, src.get(), width * 3, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_BGR2Lab);
+        }
+        if (mode == RGB2LAB_MODE) {
+            ppl::cv::x86::RGB2LAB<T>(height, width, width * nc, src.get(), width * 3, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_RGB2Lab);
+        }
+    } else if (nc == 4) {
+        cv::Mat bgrMat;
+        if (mode == BGR2LAB_MODE) {
+            ppl::cv::x86::BGRA2LAB<T>(height, width, width * nc, src.get(), width * 3, dst.get());
+            cv::cvtColor(srcMat, bgrMat, cv::COLOR_BGRA2BGR);
+            cv::cvtColor(bgrMat, dstMat, cv::COLOR_BGR2Lab);
+        }
+        if (mode == RGB2LAB_MODE) {
+            ppl::cv::x86::RGBA2LAB<T>(height, width, width * nc, src.get(), width * 3, dst.get());
+            cv::cvtColor(srcMat, bgrMat, cv::COLOR_RGBA2RGB);
+            cv::cvtColor(bgrMat, dstMat, cv::COLOR_RGB2Lab);
+        }
+    }
+    checkResult<T, 3>(dst.get(), dst_ref.get(), height, width, width * 3, width * 3, diff);
+}
+
+enum LAB2ColorMode {LAB2BGR_MODE, LAB2RGB_MODE};
+template<typename T, int32_t nc, LAB2ColorMode mode>
+void LAB2ColorTest(int32_t height, int32_t width, float diff) {
+    std::unique_ptr<T[]> bgr(new T[width * height * 3]);
+    std::unique_ptr<T[]> src(new T[width * height * 3]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(bgr.get(), width * height * 3, 0, sizeof(T) == 1 ? 255 : 1);
+    cv::Mat bgrMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 3), bgr.get());
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 3), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
+    // build valid Lab input, float BGR is expected in [0, 1]
+    cv::cvtColor(bgrMat, srcMat, cv::COLOR_BGR2Lab);
+    if (nc == 3) {
+        if (mode == LAB2BGR_MODE) {
+            ppl::cv::x86::LAB2BGR<T>(height, width, width * 3, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_Lab2BGR);
+        }
+        if (mode == LAB2RGB_MODE) {
+            ppl::cv::x86::LAB2RGB<T>(height, width, width * 3, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_Lab2RGB);
+        }
+    } else if (nc == 4) {
+        cv::Mat tmpMat;
+        if (mode == LAB2BGR_MODE) {
+            ppl::cv::x86::LAB2BGRA<T>(height, width, width * 3, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, tmpMat, cv::COLOR_Lab2BGR);
+            cv::cvtColor(tmpMat, dstMat, cv::COLOR_BGR2BGRA);
+        }
+        if (mode == LAB2RGB_MODE) {
+            ppl::cv::x86::LAB2RGBA<T>(height, width, width * 3, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, tmpMat, cv::COLOR_Lab2RGB);
+            cv::cvtColor(tmpMat, dstMat, cv::COLOR_RGB2RGBA);
+        }
+    }
+    checkResult<T, nc>(dst.get(), dst_ref.get(), height, width, width * nc, width * nc, diff);
+}
+
+TEST(BGR2LAB_UINT8, x86)
+{
+    Color2LABTest<uint8_t, 3, BGR2LAB_MODE>(640, 720, 1.01f);
+    Color2LABTest<uint8_t, 3, BGR2LAB_MODE>(719, 1081, 1.01f);
+    Color2LABTest<uint8_t, 4, BGR2LAB_MODE>(640, 720, 1.01f);
+    Color2LABTest<uint8_t, 4, BGR2LAB_MODE>(719, 1081, 1.01f);
+}
+
+TEST(RGB2LAB_UINT8, x86)
+{
+    Color2LABTest<uint8_t, 3, RGB2LAB_MODE>(640, 720, 1.01f);
+    Color2LABTest<uint8_t, 3, RGB2LAB_MODE>(719, 1081, 1.01f);
+    Color2LABTest<uint8_t, 4, RGB2LAB_MODE>(640, 720, 1.01f);
+    Color2LABTest<uint8_t, 4, RGB2LAB_MODE>(719, 1081, 1.01f);
+}
+
+TEST(BGR2LAB_FP32, x86)
+{
+    Color2LABTest<float, 3, BGR2LAB_MODE>(640, 720, 2e-2f);
+    Color2LABTest<float, 3, BGR2LAB_MODE>(719, 1081, 2e-2f);
+    Color2LABTest<float, 4, BGR2LAB_MODE>(640, 720, 2e-2f);
+    Color2LABTest<float, 4, BGR2LAB_MODE>(719, 1081, 2e-2f);
+}
+
+TEST(RGB2LAB_FP32, x86)
+{
+    Color2LABTest<float, 3, RGB2LAB_MODE>(640, 720, 2e-2f);
+    Color2LABTest<float, 3, RGB2LAB_MODE>(719, 1081, 2e-2f);
+    Color2LABTest<float, 4, RGB2LAB_MODE>(640, 720, 2e-2f);
+    Color2LABTest<float, 4, RGB2LAB_MODE>(719, 1081, 2e-2f);
+}
+
+TEST(LAB2BGR_UINT8, x86)
+{
+    LAB2ColorTest<uint8_t, 3, LAB2BGR_MODE>(640, 720, 1.01f);
+    LAB2ColorTest<uint8_t, 3, LAB2BGR_MODE>(719, 1081, 1.01f);
+    LAB2ColorTest<uint8_t, 4, LAB2BGR_MODE>(640, 720, 1.01f);
+    LAB2ColorTest<uint8_t, 4, LAB2BGR_MODE>(719, 1081, 1.01f);
+}
+
+TEST(LAB2RGB_UINT8, x86)
+{
+    LAB2ColorTest<uint8_t, 3, LAB2RGB_MODE>(640, 720, 1.01f);
+    LAB2ColorTest<uint8_t, 3, LAB2RGB_MODE>(719, 1081, 1.01f);
+    LAB2ColorTest<uint8_t, 4, LAB2RGB_MODE>(640, 720, 1.01f);
+    LAB2ColorTest<uint8_t, 4, LAB2RGB_MODE>(719, 1081, 1.01f);
+}
+
+TEST(LAB2BGR_FP32, x86)
+{
+    LAB2ColorTest<float, 3, LAB2BGR_MODE>(640, 720, 1e-2f);
+    LAB2ColorTest<float, 3, LAB2BGR_MODE>(719, 1081, 1e-2f);
+    LAB2ColorTest<float, 4, LAB2BGR_MODE>(640, 720, 1e-2f);
+    LAB2ColorTest<float, 4, LAB2BGR_MODE>(719, 1081, 1e-2f);
+}
+
+TEST(LAB2RGB_FP32, x86)
+{
+    LAB2ColorTest<float, 3, LAB2RGB_MODE>(640, 720, 1e-2f);
+    LAB2ColorTest<float, 3, LAB2RGB_MODE>(719, 1081, 1e-2f);
+    LAB2ColorTest<float, 4, LAB2RGB_MODE>(640, 720, 1e-2f);
+    LAB2ColorTest<float, 4, LAB2RGB_MODE>(719, 1081, 1e-2f);
+}
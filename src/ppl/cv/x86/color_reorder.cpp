@@ -0,0 +1,498 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/intrinutils.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// Channel reorders are pure shuffles. Each block is loaded completely before it
+// is stored, so the same-size swaps (BGR<->RGB, BGRA<->RGBA) also work in place.
+
+template <int32_t ncSrc, int32_t ncDst, bool swap, typename T>
+static inline void reorder_pixel(const T *src, T *dst, T alpha)
+{
+    T c0 = src[0], c1 = src[1], c2 = src[2];
+    T c3 = ncSrc == 4 ? src[3] : alpha;
+    dst[0] = swap ? c2 : c0;
+    dst[1] = c1;
+    dst[2] = swap ? c0 : c2;
+    if (ncDst == 4) {
+        dst[3] = c3;
+    }
+}
+
+// 3 -> 3 swap on 48-byte blocks, pixels straddle the 16-byte registers so every
+// output register gathers from its neighbours as well
+static void bgr2rgb_u8_row(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    const __m128i m00 = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, -1);
+    const __m128i m01 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1);
+    const __m128i m10 = _mm_setr_epi8(-1, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i m11 = _mm_setr_epi8(0, -1, 4, 3, 2, 7, 6, 5, 10, 9, 8, 13, 12, 11, -1, 15);
+    const __m128i m12 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1);
+    const __m128i m21 = _mm_setr_epi8(14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i m22 = _mm_setr_epi8(-1, 3, 2, 1, 6, 5, 4, 9, 8, 7, 12, 11, 10, 15, 14, 13);
+    int32_t j         = 0;
+    for (; j <= width - 16; j += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(src + j * 3));
+        __m128i b = _mm_loadu_si128((const __m128i *)(src + j * 3 + 16));
+        __m128i c = _mm_loadu_si128((const __m128i *)(src + j * 3 + 32));
+        __m128i o0 = _mm_or_si128(_mm_shuffle_epi8(a, m00), _mm_shuffle_epi8(b, m01));
+        __m128i o1 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, m10), _mm_shuffle_epi8(b, m11)), _mm_shuffle_epi8(c, m12));
+        __m128i o2 = _mm_or_si128(_mm_shuffle_epi8(b, m21), _mm_shuffle_epi8(c, m22));
+        _mm_storeu_si128((__m128i *)(dst + j * 3), o0);
+        _mm_storeu_si128((__m128i *)(dst + j * 3 + 16), o1);
+        _mm_storeu_si128((__m128i *)(dst + j * 3 + 32), o2);
+    }
+    for (; j < width; ++j) {
+        reorder_pixel<3, 3, true, uint8_t>(src + j * 3, dst + j * 3, 255);
+    }
+}
+
+template <bool swap>
+static void bgra2bgra_u8_row(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    const __m128i m = swap ? _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15)
+                           : _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    int32_t j       = 0;
+    for (; j <= width - 8; j += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(src + j * 4));
+        __m128i b = _mm_loadu_si128((const __m128i *)(src + j * 4 + 16));
+        _mm_storeu_si128((__m128i *)(dst + j * 4), _mm_shuffle_epi8(a, m));
+        _mm_storeu_si128((__m128i *)(dst + j * 4 + 16), _mm_shuffle_epi8(b, m));
+    }
+    for (; j < width; ++j) {
+        reorder_pixel<4, 4, swap, uint8_t>(src + j * 4, dst + j * 4, 255);
+    }
+}
+
+// 48 bytes in, 64 bytes out, palignr splits the input into four 12-byte pieces
+template <bool swap>
+static void bgr2bgra_u8_row(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    const __m128i m = swap ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+                           : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha = _mm_set1_epi32(0xff000000);
+    int32_t j           = 0;
+    for (; j <= width - 16; j += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(src + j * 3));
+        __m128i b = _mm_loadu_si128((const __m128i *)(src + j * 3 + 16));
+        __m128i c = _mm_loadu_si128((const __m128i *)(src + j * 3 + 32));
+        _mm_storeu_si128((__m128i *)(dst + j * 4), _mm_or_si128(_mm_shuffle_epi8(a, m), alpha));
+        _mm_storeu_si128((__m128i *)(dst + j * 4 + 16), _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(b, a, 12), m), alpha));
+        _mm_storeu_si128((__m128i *)(dst + j * 4 + 32), _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(c, b, 8), m), alpha));
+        _mm_storeu_si128((__m128i *)(dst + j * 4 + 48), _mm_or_si128(_mm_shuffle_epi8(_mm_srli_si128(c, 4), m), alpha));
+    }
+    for (; j < width; ++j) {
+        reorder_pixel<3, 4, swap, uint8_t>(src + j * 3, dst + j * 4, 255);
+    }
+}
+
+// 64 bytes in, 48 bytes out, each register drops alpha into its low 12 bytes
+template <bool swap>
+static void bgra2bgr_u8_row(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    const __m128i m = swap ? _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+                           : _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    int32_t j       = 0;
+    for (; j <= width - 16; j += 16) {
+        __m128i p0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src + j * 4)), m);
+        __m128i p1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src + j * 4 + 16)), m);
+        __m128i p2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src + j * 4 + 32)), m);
+        __m128i p3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src + j * 4 + 48)), m);
+        _mm_storeu_si128((__m128i *)(dst + j * 3), _mm_or_si128(p0, _mm_slli_si128(p1, 12)));
+        _mm_storeu_si128((__m128i *)(dst + j * 3 + 16), _mm_or_si128(_mm_srli_si128(p1, 4), _mm_slli_si128(p2, 8)));
+        _mm_storeu_si128((__m128i *)(dst + j * 3 + 32), _mm_or_si128(_mm_srli_si128(p2, 8), _mm_slli_si128(p3, 4)));
+    }
+    for (; j < width; ++j) {
+        reorder_pixel<4, 3, swap, uint8_t>(src + j * 4, dst + j * 3, 255);
+    }
+}
+
+template <int32_t ncSrc, int32_t ncDst, bool swap>
+static void reorder_f32_row(const float *src, float *dst, int32_t width)
+{
+    const __m128 alpha = _mm_set1_ps(1.0f);
+    int32_t j          = 0;
+    for (; j <= width - 4; j += 4) {
+        __m128 c0, c1, c2, c3 = alpha;
+        if (ncSrc == 3) {
+            v_load_deinterleave(src + j * 3, c0, c1, c2);
+        } else {
+            v_load_deinterleave(src + j * 4, c0, c1, c2, c3);
+        }
+        if (ncDst == 3) {
+            v_store_interleave(dst + j * 3, swap ? c2 : c0, c1, swap ? c0 : c2);
+        } else {
+            v_store_interleave(dst + j * 4, swap ? c2 : c0, c1, swap ? c0 : c2, c3);
+        }
+    }
+    for (; j < width; ++j) {
+        reorder_pixel<ncSrc, ncDst, swap, float>(src + j * ncSrc, dst + j * ncDst, 1.0f);
+    }
+}
+
+template <int32_t ncSrc, int32_t ncDst, bool swap>
+static void reorder_u8_row(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    if (ncSrc == 3 && ncDst == 3) {
+        bgr2rgb_u8_row(src, dst, width);
+    } else if (ncSrc == 4 && ncDst == 4) {
+        bgra2bgra_u8_row<swap>(src, dst, width);
+    } else if (ncSrc == 3) {
+        bgr2bgra_u8_row<swap>(src, dst, width);
+    } else {
+        bgra2bgr_u8_row<swap>(src, dst, width);
+    }
+}
+
+template <int32_t ncSrc, int32_t ncDst, bool swap, typename T>
+static ::ppl::common::RetCode reorder(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride < width * ncSrc || outWidthStride < width * ncDst) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    // in place only makes sense when the pixel size is unchanged
+    if ((const void *)inData == (const void *)outData && (ncSrc != ncDst || inWidthStride != outWidthStride)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bool use_fma = sizeof(T) == 1 && ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    for (int32_t i = 0; i < height; ++i) {
+        const T *src = inData + i * inWidthStride;
+        T *dst       = outData + i * outWidthStride;
+        if (sizeof(T) == 1) {
+            if (use_fma) {
+                fma::reorder_u8_row<ncSrc, ncDst, swap>((const uint8_t *)src, (uint8_t *)dst, width);
+            } else {
+                reorder_u8_row<ncSrc, ncDst, swap>((const uint8_t *)src, (uint8_t *)dst, width);
+            }
+        } else {
+            reorder_f32_row<ncSrc, ncDst, swap>((const float *)src, (float *)dst, width);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode BGR2BGRA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<3, 4, false, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGR2BGRA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<3, 4, false, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGB2RGBA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<3, 4, false, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGB2RGBA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<3, 4, false, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGRA2BGR<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<4, 3, false, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGRA2BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<4, 3, false, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGBA2RGB<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<4, 3, false, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGBA2RGB<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<4, 3, false, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGR2RGBA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<3, 4, true, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGR2RGBA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<3, 4, true, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGB2BGRA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<3, 4, true, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGB2BGRA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<3, 4, true, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGBA2BGR<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<4, 3, true, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGBA2BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<4, 3, true, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGRA2RGB<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<4, 3, true, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGRA2RGB<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<4, 3, true, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGR2RGB<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<3, 3, true, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGR2RGB<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<3, 3, true, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGB2BGR<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<3, 3, true, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGB2BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<3, 3, true, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGRA2RGBA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<4, 4, true, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode BGRA2RGBA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<4, 4, true, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGBA2BGRA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    return reorder<4, 4, true, float>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+template <>
+::ppl::common::RetCode RGBA2BGRA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    return reorder<4, 4, true, uint8_t>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+}
+}
+} // namespace ppl::cv::x86
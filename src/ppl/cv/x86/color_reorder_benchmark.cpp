@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/debug.h"
+#include <cstring>
+
+namespace {
+
+enum ReorderMode {BGR2RGB_MODE, BGR2BGRA_MODE, BGRA2BGR_MODE, BGRA2RGBA_MODE};
+
+template<typename T, ReorderMode mode>
+void BM_Reorder_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t ncSrc = (mode == BGR2RGB_MODE || mode == BGR2BGRA_MODE) ? 3 : 4;
+    int32_t ncDst = (mode == BGR2RGB_MODE || mode == BGRA2BGR_MODE) ? 3 : 4;
+    std::unique_ptr<T[]> src(new T[width * height * ncSrc]);
+    std::unique_ptr<T[]> dst(new T[width * height * ncDst]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * ncSrc, 0, 255);
+    for (auto _ : state) {
+        if (mode == BGR2RGB_MODE) {
+            ppl::cv::x86::BGR2RGB<T>(height, width, width * ncSrc, src.get(), width * ncDst, dst.get());
+        } else if (mode == BGR2BGRA_MODE) {
+            ppl::cv::x86::BGR2BGRA<T>(height, width, width * ncSrc, src.get(), width * ncDst, dst.get());
+        } else if (mode == BGRA2BGR_MODE) {
+            ppl::cv::x86::BGRA2BGR<T>(height, width, width * ncSrc, src.get(), width * ncDst, dst.get());
+        } else {
+            ppl::cv::x86::BGRA2RGBA<T>(height, width, width * ncSrc, src.get(), width * ncDst, dst.get());
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * width * height * (ncSrc + ncDst) * sizeof(T));
+}
+
+template<typename T, ReorderMode mode>
+void BM_ReorderInplace_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t nc = mode == BGR2RGB_MODE ? 3 : 4;
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    for (auto _ : state) {
+        if (mode == BGR2RGB_MODE) {
+            ppl::cv::x86::BGR2RGB<T>(height, width, width * nc, src.get(), width * nc, src.get());
+        } else {
+            ppl::cv::x86::BGRA2RGBA<T>(height, width, width * nc, src.get(), width * nc, src.get());
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * width * height * nc * 2 * sizeof(T));
+}
+
+// the bandwidth ceiling, copies as many bytes as the largest of the conversions above
+template<typename T, int32_t nc>
+void BM_Memcpy_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    for (auto _ : state) {
+        memcpy(dst.get(), src.get(), width * height * nc * sizeof(T));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * width * height * nc * 2 * sizeof(T));
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_Memcpy_x86, uint8_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Memcpy_x86, uint8_t, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Reorder_ppl_x86, uint8_t, BGR2RGB_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Reorder_ppl_x86, uint8_t, BGR2BGRA_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Reorder_ppl_x86, uint8_t, BGRA2BGR_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Reorder_ppl_x86, uint8_t, BGRA2RGBA_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ReorderInplace_ppl_x86, uint8_t, BGR2RGB_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ReorderInplace_ppl_x86, uint8_t, BGRA2RGBA_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Memcpy_x86, float, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Reorder_ppl_x86, float, BGR2RGB_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Reorder_ppl_x86, float, BGR2BGRA_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<typename T, ReorderMode mode>
+void BM_Reorder_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t ncSrc = (mode == BGR2RGB_MODE || mode == BGR2BGRA_MODE) ? 3 : 4;
+    int32_t ncDst = (mode == BGR2RGB_MODE || mode == BGRA2BGR_MODE) ? 3 : 4;
+    int32_t code = mode == BGR2RGB_MODE ? cv::COLOR_BGR2RGB : (mode == BGR2BGRA_MODE ? cv::COLOR_BGR2BGRA : (mode == BGRA2BGR_MODE ? cv::COLOR_BGRA2BGR : cv::COLOR_BGRA2RGBA));
+    std::unique_ptr<T[]> src(new T[width * height * ncSrc]);
+    std::unique_ptr<T[]> dst(new T[width * height * ncDst]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * ncSrc, 0, 255);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, ncSrc), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, ncDst), dst.get());
+    for (auto _ : state) {
+        cv::cvtColor(srcMat, dstMat, code);
+    }
+    state.SetBytesProcessed(state.iterations() * width * height * (ncSrc + ncDst) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(BM_Reorder_opencv_x86, uint8_t, BGR2RGB_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Reorder_opencv_x86, uint8_t, BGR2BGRA_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Reorder_opencv_x86, uint8_t, BGRA2BGR_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Reorder_opencv_x86, uint8_t, BGRA2RGBA_MODE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <cstring>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+template<typename T, int32_t ncSrc, int32_t ncDst>
+using ReorderFunc = ::ppl::common::RetCode (*)(int32_t, int32_t, int32_t, const T*, int32_t, T*);
+
+template<typename T, int32_t ncSrc, int32_t ncDst>
+void ReorderTest(int32_t height, int32_t width, ReorderFunc<T, ncSrc, ncDst> func, int32_t code) {
+    std::unique_ptr<T[]> src(new T[width * height * ncSrc]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * ncDst]);
+    std::unique_ptr<T[]> dst(new T[width * height * ncDst]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * ncSrc, 0, 255);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, ncSrc), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, ncDst), dst_ref.get());
+    func(height, width, width * ncSrc, src.get(), width * ncDst, dst.get());
+    cv::cvtColor(srcMat, dstMat, code);
+    checkResult<T, ncDst>(dst.get(), dst_ref.get(), height, width, width * ncDst, width * ncDst, 1e-6f);
+    if (ncSrc == ncDst) {
+        func(height, width, width * ncSrc, src.get(), width * ncSrc, src.get());
+        checkResult<T, ncDst>(src.get(), dst_ref.get(), height, width, width * ncDst, width * ncDst, 1e-6f);
+    }
+}
+
+#define REORDER_TEST(name, ncSrc, ncDst, code)                                              \
+    TEST(name##_UINT8, x86)                                                                 \
+    {                                                                                       \
+        ReorderTest<uint8_t, ncSrc, ncDst>(640, 720, ppl::cv::x86::name<uint8_t>, code);    \
+        ReorderTest<uint8_t, ncSrc, ncDst>(719, 1081, ppl::cv::x86::name<uint8_t>, code);   \
+    }                                                                                       \
+    TEST(name##_FP32, x86)                                                                  \
+    {                                                                                       \
+        ReorderTest<float, ncSrc, ncDst>(640, 720, ppl::cv::x86::name<float>, code);        \
+        ReorderTest<float, ncSrc, ncDst>(719, 1081, ppl::cv::x86::name<float>, code);       \
+    }
+
+REORDER_TEST(BGR2BGRA, 3, 4, cv::COLOR_BGR2BGRA)
+REORDER_TEST(RGB2RGBA, 3, 4, cv::COLOR_RGB2RGBA)
+REORDER_TEST(BGRA2BGR, 4, 3, cv::COLOR_BGRA2BGR)
+REORDER_TEST(RGBA2RGB, 4, 3, cv::COLOR_RGBA2RGB)
+REORDER_TEST(BGR2RGBA, 3, 4, cv::COLOR_BGR2RGBA)
+REORDER_TEST(RGB2BGRA, 3, 4, cv::COLOR_RGB2BGRA)
+REORDER_TEST(RGBA2BGR, 4, 3, cv::COLOR_RGBA2BGR)
+REORDER_TEST(BGRA2RGB, 4, 3, cv::COLOR_BGRA2RGB)
+REORDER_TEST(BGR2RGB, 3, 3, cv::COLOR_BGR2RGB)
+REORDER_TEST(RGB2BGR, 3, 3, cv::COLOR_RGB2BGR)
+REORDER_TEST(BGRA2RGBA, 4, 4, cv::COLOR_BGRA2RGBA)
+REORDER_TEST(RGBA2BGRA, 4, 4, cv::COLOR_RGBA2BGRA)
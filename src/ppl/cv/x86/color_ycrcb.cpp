@@ -0,0 +1,609 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/cvtcolor.h"
+#include "ppl/cv/x86/color_intrin.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// BT.601 full range, Q14 like OpenCV
+#define YCRCB_SHIFT  14
+#define YCRCB_HALF   (1 << (YCRCB_SHIFT - 1))
+#define YCRCB_DELTA  (128 << YCRCB_SHIFT)
+#define C_R2Y        4899
+#define C_G2Y        9617
+#define C_B2Y        1868
+#define C_CR         11682
+#define C_CB         9241
+#define C_CR2R       22987
+#define C_CB2B       29049
+#define C_CR2G       -11698
+#define C_CB2G       -5636
+
+#define CF_R2Y       0.299f
+#define CF_G2Y       0.587f
+#define CF_B2Y       0.114f
+#define CF_CR        0.713f
+#define CF_CB        0.564f
+#define CF_CR2R      1.403f
+#define CF_CB2B      1.773f
+#define CF_CR2G      -0.714f
+#define CF_CB2G      -0.344f
+#define YCRCB_DELTA_F 0.5f
+
+static inline __m128i v_pair_coeff(int32_t c0, int32_t c1)
+{
+    return _mm_set1_epi32((int32_t)(((uint32_t)(uint16_t)c1 << 16) | (uint16_t)c0));
+}
+
+static inline void bgr2ycrcb_u8_pixel(int32_t b, int32_t g, int32_t r, uint8_t *dst)
+{
+    int32_t y  = (r * C_R2Y + g * C_G2Y + b * C_B2Y + YCRCB_HALF) >> YCRCB_SHIFT;
+    int32_t cr = ((r - y) * C_CR + YCRCB_DELTA + YCRCB_HALF) >> YCRCB_SHIFT;
+    int32_t cb = ((b - y) * C_CB + YCRCB_DELTA + YCRCB_HALF) >> YCRCB_SHIFT;
+    dst[0]     = sat_cast_u8(y);
+    dst[1]     = sat_cast_u8(cr);
+    dst[2]     = sat_cast_u8(cb);
+}
+
+// 8 pixels as 16-bit lanes. Every product goes through pmaddwd with the rounding
+// and the 128 offset folded into a (x, k) * (c, 8192) pair.
+static inline void bgr2ycrcb_u8_half(__m128i b, __m128i g, __m128i r, __m128i &y, __m128i &cr, __m128i &cb)
+{
+    const __m128i c_rg   = v_pair_coeff(C_R2Y, C_G2Y);
+    const __m128i c_b1   = v_pair_coeff(C_B2Y, YCRCB_HALF);
+    const __m128i c_cr   = v_pair_coeff(C_CR, YCRCB_HALF);
+    const __m128i c_cb   = v_pair_coeff(C_CB, YCRCB_HALF);
+    const __m128i v_one  = _mm_set1_epi16(1);
+    const __m128i v_257  = _mm_set1_epi16(257);
+    __m128i rg_lo        = _mm_unpacklo_epi16(r, g);
+    __m128i rg_hi        = _mm_unpackhi_epi16(r, g);
+    __m128i b1_lo        = _mm_unpacklo_epi16(b, v_one);
+    __m128i b1_hi        = _mm_unpackhi_epi16(b, v_one);
+    __m128i y_lo         = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(rg_lo, c_rg), _mm_madd_epi16(b1_lo, c_b1)), YCRCB_SHIFT);
+    __m128i y_hi         = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(rg_hi, c_rg), _mm_madd_epi16(b1_hi, c_b1)), YCRCB_SHIFT);
+    y                    = _mm_packs_epi32(y_lo, y_hi);
+    __m128i ry           = _mm_sub_epi16(r, y);
+    __m128i by           = _mm_sub_epi16(b, y);
+    // 257 * 8192 == YCRCB_DELTA + YCRCB_HALF
+    __m128i cr_lo        = _mm_srai_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(ry, v_257), c_cr), YCRCB_SHIFT);
+    __m128i cr_hi        = _mm_srai_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(ry, v_257), c_cr), YCRCB_SHIFT);
+    __m128i cb_lo        = _mm_srai_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(by, v_257), c_cb), YCRCB_SHIFT);
+    __m128i cb_hi        = _mm_srai_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(by, v_257), c_cb), YCRCB_SHIFT);
+    cr                   = _mm_packs_epi32(cr_lo, cr_hi);
+    cb                   = _mm_packs_epi32(cb_lo, cb_hi);
+}
+
+template <int32_t ncSrc, int32_t bIdx>
+static void bgr2ycrcb_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const __m128i zero = _mm_setzero_si128();
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i b, g, r, y0, y1, cr0, cr1, cb0, cb1;
+            load_bgr_u8<ncSrc, bIdx>(src + j * ncSrc, b, g, r);
+            bgr2ycrcb_u8_half(_mm_unpacklo_epi8(b, zero), _mm_unpacklo_epi8(g, zero), _mm_unpacklo_epi8(r, zero), y0, cr0, cb0);
+            bgr2ycrcb_u8_half(_mm_unpackhi_epi8(b, zero), _mm_unpackhi_epi8(g, zero), _mm_unpackhi_epi8(r, zero), y1, cr1, cb1);
+            v_store_interleave(dst + j * 3, _mm_packus_epi16(y0, y1), _mm_packus_epi16(cr0, cr1), _mm_packus_epi16(cb0, cb1));
+        }
+        for (; j < width; ++j) {
+            const uint8_t *p = src + j * ncSrc;
+            bgr2ycrcb_u8_pixel(p[bIdx], p[1], p[bIdx ^ 2], dst + j * 3);
+        }
+    }
+}
+
+template <int32_t ncSrc, int32_t bIdx>
+static void bgr2ycrcb_f32(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    const __m128 v_r2y   = _mm_set1_ps(CF_R2Y);
+    const __m128 v_g2y   = _mm_set1_ps(CF_G2Y);
+    const __m128 v_b2y   = _mm_set1_ps(CF_B2Y);
+    const __m128 v_cr    = _mm_set1_ps(CF_CR);
+    const __m128 v_cb    = _mm_set1_ps(CF_CB);
+    const __m128 v_delta = _mm_set1_ps(YCRCB_DELTA_F);
+    for (int32_t i = 0; i < height; ++i) {
+        const float *src = inData + i * inWidthStride;
+        float *dst       = outData + i * outWidthStride;
+        int32_t j        = 0;
+        for (; j <= width - 4; j += 4) {
+            __m128 b, g, r;
+            load_bgr_f32<ncSrc, bIdx>(src + j * ncSrc, b, g, r);
+            __m128 y  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, v_r2y), _mm_mul_ps(g, v_g2y)), _mm_mul_ps(b, v_b2y));
+            __m128 cr = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(r, y), v_cr), v_delta);
+            __m128 cb = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(b, y), v_cb), v_delta);
+            v_store_interleave(dst + j * 3, y, cr, cb);
+        }
+        for (; j < width; ++j) {
+            const float *p = src + j * ncSrc;
+            float b = p[bIdx], g = p[1], r = p[bIdx ^ 2];
+            float y    = r * CF_R2Y + g * CF_G2Y + b * CF_B2Y;
+            dst[j * 3 + 0] = y;
+            dst[j * 3 + 1] = (r - y) * CF_CR + YCRCB_DELTA_F;
+            dst[j * 3 + 2] = (b - y) * CF_CB + YCRCB_DELTA_F;
+        }
+    }
+}
+
+static inline void ycrcb2bgr_u8_pixel(int32_t y, int32_t cr, int32_t cb, uint8_t *b, uint8_t *g, uint8_t *r)
+{
+    cr -= 128;
+    cb -= 128;
+    *b = sat_cast_u8(y + ((cb * C_CB2B + YCRCB_HALF) >> YCRCB_SHIFT));
+    *g = sat_cast_u8(y + ((cr * C_CR2G + cb * C_CB2G + YCRCB_HALF) >> YCRCB_SHIFT));
+    *r = sat_cast_u8(y + ((cr * C_CR2R + YCRCB_HALF) >> YCRCB_SHIFT));
+}
+
+// 8 pixels as 16-bit lanes, cr and cb are already centered
+static inline void ycrcb2bgr_u8_half(__m128i y, __m128i cr, __m128i cb, __m128i &b, __m128i &g, __m128i &r)
+{
+    const __m128i c_cb1  = v_pair_coeff(C_CB2B, YCRCB_HALF);
+    const __m128i c_cr1  = v_pair_coeff(C_CR2R, YCRCB_HALF);
+    const __m128i c_crcb = v_pair_coeff(C_CR2G, C_CB2G);
+    const __m128i v_half = _mm_set1_epi32(YCRCB_HALF);
+    const __m128i v_one  = _mm_set1_epi16(1);
+    __m128i crcb_lo      = _mm_unpacklo_epi16(cr, cb);
+    __m128i crcb_hi      = _mm_unpackhi_epi16(cr, cb);
+    __m128i db_lo        = _mm_srai_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(cb, v_one), c_cb1), YCRCB_SHIFT);
+    __m128i db_hi        = _mm_srai_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(cb, v_one), c_cb1), YCRCB_SHIFT);
+    __m128i dr_lo        = _mm_srai_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(cr, v_one), c_cr1), YCRCB_SHIFT);
+    __m128i dr_hi        = _mm_srai_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(cr, v_one), c_cr1), YCRCB_SHIFT);
+    __m128i dg_lo        = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(crcb_lo, c_crcb), v_half), YCRCB_SHIFT);
+    __m128i dg_hi        = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(crcb_hi, c_crcb), v_half), YCRCB_SHIFT);
+    b                    = _mm_add_epi16(y, _mm_packs_epi32(db_lo, db_hi));
+    g                    = _mm_add_epi16(y, _mm_packs_epi32(dg_lo, dg_hi));
+    r                    = _mm_add_epi16(y, _mm_packs_epi32(dr_lo, dr_hi));
+}
+
+template <int32_t ncDst, int32_t bIdx>
+static void ycrcb2bgr_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i v_128 = _mm_set1_epi16(128);
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i y, cr, cb, b0, b1, g0, g1, r0, r1;
+            v_load_deinterleave(src + j * 3, y, cr, cb);
+            ycrcb2bgr_u8_half(_mm_unpacklo_epi8(y, zero), _mm_sub_epi16(_mm_unpacklo_epi8(cr, zero), v_128), _mm_sub_epi16(_mm_unpacklo_epi8(cb, zero), v_128), b0, g0, r0);
+            ycrcb2bgr_u8_half(_mm_unpackhi_epi8(y, zero), _mm_sub_epi16(_mm_unpackhi_epi8(cr, zero), v_128), _mm_sub_epi16(_mm_unpackhi_epi8(cb, zero), v_128), b1, g1, r1);
+            store_bgr_u8<ncDst, bIdx>(dst + j * ncDst, _mm_packus_epi16(b0, b1), _mm_packus_epi16(g0, g1), _mm_packus_epi16(r0, r1));
+        }
+        for (; j < width; ++j) {
+            const uint8_t *p = src + j * 3;
+            uint8_t *q       = dst + j * ncDst;
+            ycrcb2bgr_u8_pixel(p[0], p[1], p[2], q + bIdx, q + 1, q + (bIdx ^ 2));
+            if (ncDst == 4) {
+                q[3] = 255;
+            }
+        }
+    }
+}
+
+template <int32_t ncDst, int32_t bIdx>
+static void ycrcb2bgr_f32(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    const __m128 v_cr2r  = _mm_set1_ps(CF_CR2R);
+    const __m128 v_cb2b  = _mm_set1_ps(CF_CB2B);
+    const __m128 v_cr2g  = _mm_set1_ps(CF_CR2G);
+    const __m128 v_cb2g  = _mm_set1_ps(CF_CB2G);
+    const __m128 v_delta = _mm_set1_ps(YCRCB_DELTA_F);
+    for (int32_t i = 0; i < height; ++i) {
+        const float *src = inData + i * inWidthStride;
+        float *dst       = outData + i * outWidthStride;
+        int32_t j        = 0;
+        for (; j <= width - 4; j += 4) {
+            __m128 y, cr, cb;
+            v_load_deinterleave(src + j * 3, y, cr, cb);
+            cr       = _mm_sub_ps(cr, v_delta);
+            cb       = _mm_sub_ps(cb, v_delta);
+            __m128 b = _mm_add_ps(y, _mm_mul_ps(cb, v_cb2b));
+            __m128 g = _mm_add_ps(y, _mm_add_ps(_mm_mul_ps(cr, v_cr2g), _mm_mul_ps(cb, v_cb2g)));
+            __m128 r = _mm_add_ps(y, _mm_mul_ps(cr, v_cr2r));
+            store_bgr_f32<ncDst, bIdx>(dst + j * ncDst, b, g, r);
+        }
+        for (; j < width; ++j) {
+            const float *p = src + j * 3;
+            float *q       = dst + j * ncDst;
+            float y = p[0], cr = p[1] - YCRCB_DELTA_F, cb = p[2] - YCRCB_DELTA_F;
+            q[bIdx]     = y + cb * CF_CB2B;
+            q[1]        = y + cr * CF_CR2G + cb * CF_CB2G;
+            q[bIdx ^ 2] = y + cr * CF_CR2R;
+            if (ncDst == 4) {
+                q[3] = 1.0f;
+            }
+        }
+    }
+}
+
+template <>
+::ppl::common::RetCode BGR2YCrCb<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2ycrcb_f32<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode BGR2YCrCb<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::bgr2ycrcb_u8<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        bgr2ycrcb_u8<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGB2YCrCb<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2ycrcb_f32<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGB2YCrCb<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::bgr2ycrcb_u8<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        bgr2ycrcb_u8<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode BGRA2YCrCb<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2ycrcb_f32<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode BGRA2YCrCb<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::bgr2ycrcb_u8<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        bgr2ycrcb_u8<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGBA2YCrCb<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    bgr2ycrcb_f32<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode RGBA2YCrCb<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::bgr2ycrcb_u8<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        bgr2ycrcb_u8<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode YCrCb2BGR<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    ycrcb2bgr_f32<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode YCrCb2BGR<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::ycrcb2bgr_u8<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        ycrcb2bgr_u8<3, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode YCrCb2RGB<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    ycrcb2bgr_f32<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode YCrCb2RGB<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::ycrcb2bgr_u8<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        ycrcb2bgr_u8<3, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode YCrCb2BGRA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    ycrcb2bgr_f32<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode YCrCb2BGRA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::ycrcb2bgr_u8<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        ycrcb2bgr_u8<4, 0>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode YCrCb2RGBA<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    ycrcb2bgr_f32<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode YCrCb2RGBA<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (width <= 0 || height <= 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::ycrcb2bgr_u8<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        ycrcb2bgr_u8<4, 2>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
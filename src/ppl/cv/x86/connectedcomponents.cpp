@@ -0,0 +1,540 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/connectedcomponents.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <limits.h>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// rows labelled independently by one task, even so that the 2x2 blocks never straddle two stripes
+#define CC_STRIPE 64
+
+struct CCStat {
+    int32_t left;
+    int32_t top;
+    int32_t right;
+    int32_t bottom;
+    int32_t area;
+    int64_t sumx;
+    int64_t sumy;
+};
+
+static const CCStat cc_stat_empty = {INT_MAX, INT_MAX, -1, -1, 0, 0, 0};
+
+// adds the pixels [x0, x1) of row y
+static inline void cc_stat_add_run(CCStat &s, int32_t x0, int32_t x1, int32_t y)
+{
+    s.left   = std::min(s.left, x0);
+    s.right  = std::max(s.right, x1 - 1);
+    s.top    = std::min(s.top, y);
+    s.bottom = std::max(s.bottom, y);
+    s.area += x1 - x0;
+    s.sumx += (int64_t)(x0 + x1 - 1) * (x1 - x0) / 2;
+    s.sumy += (int64_t)y * (x1 - x0);
+}
+
+static inline void cc_stat_merge(CCStat &s, const CCStat &t)
+{
+    s.left   = std::min(s.left, t.left);
+    s.right  = std::max(s.right, t.right);
+    s.top    = std::min(s.top, t.top);
+    s.bottom = std::max(s.bottom, t.bottom);
+    s.area += t.area;
+    s.sumx += t.sumx;
+    s.sumy += t.sumy;
+}
+
+// first index from x on in [x, width) where the pixel is no longer (foreground ? non-zero : zero)
+static inline int32_t cc_run_end(const uint8_t *s, int32_t x, int32_t width, bool foreground)
+{
+    const __m128i v_zero = _mm_setzero_si128();
+    const int32_t flip   = foreground ? 0 : 0xffff;
+    for (; x + 16 <= width; x += 16) {
+        int32_t m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(s + x)), v_zero)) ^ flip;
+        if (m) {
+            return x + __builtin_ctz(m);
+        }
+    }
+    for (; x < width && (s[x] != 0) == foreground; ++x) {
+    }
+    return x;
+}
+
+// union-find on the provisional labels, the parent of a label is never larger than the label itself
+static inline int32_t cc_find_root(const int32_t *P, int32_t i)
+{
+    while (P[i] < i) {
+        i = P[i];
+    }
+    return i;
+}
+
+static inline void cc_set_root(int32_t *P, int32_t i, int32_t root)
+{
+    while (P[i] < i) {
+        int32_t j = P[i];
+        P[i]      = root;
+        i         = j;
+    }
+    P[i] = root;
+}
+
+static inline int32_t cc_merge(int32_t *P, int32_t i, int32_t j)
+{
+    int32_t root = cc_find_root(P, i);
+    if (i != j) {
+        int32_t root_j = cc_find_root(P, j);
+        root           = std::min(root, root_j);
+        cc_set_root(P, j, root);
+    }
+    cc_set_root(P, i, root);
+    return root;
+}
+
+static inline int32_t cc_join(int32_t *P, int32_t label, int32_t other)
+{
+    return label ? cc_merge(P, label, other) : other;
+}
+
+// 8-connectivity scan of the rows [r0, r1) with 2x2 blocks, the pixels of a block are always connected
+// and the block is connected to its neighbours P (top left), Q (top), R (top right) and S (left)
+// through the pixels next to each other. The provisional label is kept at the top left pixel of every
+// block, 0 for the empty ones, returns one past the last label used.
+static int32_t cc_scan_blocks(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    const uint8_t *zeros,
+    int32_t outWidthStride,
+    int32_t *labels,
+    int32_t r0,
+    int32_t r1,
+    int32_t base,
+    int32_t *P)
+{
+    int32_t next = base;
+    for (int32_t r = r0; r < r1; r += 2) {
+        const uint8_t *s0 = inData + r * inWidthStride;
+        const uint8_t *s1 = r + 1 < height ? s0 + inWidthStride : zeros;
+        const uint8_t *u  = r > r0 ? s0 - inWidthStride : zeros;
+        int32_t *l0       = labels + r * outWidthStride;
+        const int32_t *lu = r > r0 ? l0 - 2 * outWidthStride : l0;
+        for (int32_t c = 0; c < width; c += 2) {
+            if (c + 16 <= width) {
+                __m128i v = _mm_or_si128(_mm_loadu_si128((const __m128i *)(s0 + c)), _mm_loadu_si128((const __m128i *)(s1 + c)));
+                if (_mm_testz_si128(v, v)) {
+                    for (int32_t k = 0; k < 16; k += 4) {
+                        _mm_storeu_si128((__m128i *)(l0 + c + k), _mm_setzero_si128());
+                    }
+                    c += 14;
+                    continue;
+                }
+            }
+            const bool right = c + 1 < width;
+            const uint8_t a  = s0[c];
+            const uint8_t b  = right ? s0[c + 1] : 0;
+            const uint8_t e  = s1[c];
+            const uint8_t f  = right ? s1[c + 1] : 0;
+            if (!(a | b | e | f)) {
+                l0[c] = 0;
+                continue;
+            }
+            // pixels of the row above from column c - 1 to c + 2 and of the block on the left
+            const uint8_t ul = c > 0 ? u[c - 1] : 0;
+            const uint8_t u0 = u[c];
+            const uint8_t u1 = right ? u[c + 1] : 0;
+            const uint8_t ur = c + 2 < width ? u[c + 2] : 0;
+            const uint8_t sa = c > 0 ? s0[c - 1] : 0;
+            const uint8_t se = c > 0 ? s1[c - 1] : 0;
+            // neighbours already joined through pixels next to each other in the rows above are skipped
+            int32_t label = 0;
+            if ((a | b) && (u0 | u1)) {
+                label = lu[c];
+                if (a && ul && !u0) {
+                    label = cc_merge(P, label, lu[c - 2]);
+                }
+                if (b && ur && !u1) {
+                    label = cc_merge(P, label, lu[c + 2]);
+                }
+                if ((a | e) && (sa | se) && !(sa && u0)) {
+                    label = cc_merge(P, label, l0[c - 2]);
+                }
+            } else {
+                if (a && ul) {
+                    label = lu[c - 2];
+                }
+                if (b && ur) {
+                    label = cc_join(P, label, lu[c + 2]);
+                }
+                if ((a | e) && (sa | se) && !(a && ul && sa)) {
+                    label = cc_join(P, label, l0[c - 2]);
+                }
+            }
+            if (!label) {
+                P[next] = next;
+                label   = next++;
+            }
+            l0[c] = label;
+        }
+    }
+    return next;
+}
+
+// joins the blocks of the first row of a stripe with the ones of the last block row of the stripe above
+static void cc_merge_blocks(
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    int32_t *labels,
+    int32_t rb,
+    int32_t *P)
+{
+    const uint8_t *s0 = inData + rb * inWidthStride;
+    const uint8_t *u  = s0 - inWidthStride;
+    const int32_t *l0 = labels + rb * outWidthStride;
+    const int32_t *lu = l0 - 2 * outWidthStride;
+    for (int32_t c = cc_run_end(s0, 0, width, false) & ~1; c < width; c += 2) {
+        const bool right = c + 1 < width;
+        const uint8_t a  = s0[c];
+        const uint8_t b  = right ? s0[c + 1] : 0;
+        if (!(a | b)) {
+            int32_t x = cc_run_end(s0, c, width, false);
+            if (x >= width) {
+                break;
+            }
+            c = (x & ~1) - 2;
+            continue;
+        }
+        int32_t label = l0[c];
+        if (u[c] | (right ? u[c + 1] : 0)) {
+            label = cc_merge(P, label, lu[c]);
+        }
+        if (a && c > 0 && u[c - 1]) {
+            label = cc_merge(P, label, lu[c - 2]);
+        }
+        if (b && c + 2 < width && u[c + 2]) {
+            cc_merge(P, label, lu[c + 2]);
+        }
+    }
+}
+
+// 4-connectivity scan of the rows [r0, r1) run by run, a run takes the labels of the runs above that
+// overlap it, every pixel keeps the provisional label of its run or 0, returns one past the last label used.
+static int32_t cc_scan_runs(
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    int32_t *labels,
+    int32_t r0,
+    int32_t r1,
+    int32_t base,
+    int32_t *P)
+{
+    int32_t next = base;
+    for (int32_t r = r0; r < r1; ++r) {
+        const uint8_t *s0 = inData + r * inWidthStride;
+        const uint8_t *u  = r > r0 ? s0 - inWidthStride : nullptr;
+        int32_t *l0       = labels + r * outWidthStride;
+        const int32_t *lu = r > r0 ? l0 - outWidthStride : l0;
+        for (int32_t x = 0; x < width;) {
+            int32_t e = cc_run_end(s0, x, width, false);
+            std::fill(l0 + x, l0 + e, 0);
+            if (e >= width) {
+                break;
+            }
+            x             = e;
+            e             = cc_run_end(s0, x, width, true);
+            int32_t label = 0;
+            for (int32_t c = x; u && c < e;) {
+                if (u[c]) {
+                    label = cc_join(P, label, lu[c]);
+                    c     = cc_run_end(u, c, e, true);
+                } else {
+                    c = cc_run_end(u, c, e, false);
+                }
+            }
+            if (!label) {
+                P[next] = next;
+                label   = next++;
+            }
+            std::fill(l0 + x, l0 + e, label);
+            x = e;
+        }
+    }
+    return next;
+}
+
+// joins the runs of the first row of a stripe with the ones of the last row of the stripe above
+static void cc_merge_runs(
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    int32_t *labels,
+    int32_t rb,
+    int32_t *P)
+{
+    const uint8_t *s0 = inData + rb * inWidthStride;
+    const uint8_t *u  = s0 - inWidthStride;
+    const int32_t *l0 = labels + rb * outWidthStride;
+    const int32_t *lu = l0 - outWidthStride;
+    for (int32_t x = cc_run_end(s0, 0, width, false); x < width;) {
+        int32_t e = cc_run_end(s0, x, width, true);
+        for (int32_t c = x; c < e;) {
+            if (u[c]) {
+                cc_merge(P, l0[x], lu[c]);
+                c = cc_run_end(u, c, e, true);
+            } else {
+                c = cc_run_end(u, c, e, false);
+            }
+        }
+        x = cc_run_end(s0, e, width, false);
+    }
+}
+
+// second pass over the rows [r0, r1): writes the final label of every pixel and gathers the statistics
+// of the provisional labels of the stripe. A run of foreground pixels in a row always belongs to one
+// component, it is labelled from the provisional label of its first pixel (or of its first block).
+template <int32_t connectivity, bool with_stats>
+static void cc_relabel(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    int32_t *labels,
+    int32_t r0,
+    int32_t r1,
+    int32_t base,
+    const int32_t *P,
+    CCStat *stat,
+    CCStat *background)
+{
+    const int32_t step = connectivity == 8 ? 2 : 1;
+    const int32_t mask = connectivity == 8 ? ~1 : ~0;
+    for (int32_t r = r0; r < r1; r += step) {
+        const int32_t *src = labels + r * outWidthStride;
+        // the bottom row of a block row first, the block labels are kept in the top one
+        for (int32_t y = std::min(r + step, height) - 1; y >= r; --y) {
+            const uint8_t *s = inData + y * inWidthStride;
+            int32_t *d       = labels + y * outWidthStride;
+            if (!with_stats) {
+                // pixel by pixel without branches, short runs of noisy masks would be mispredicted
+                int32_t x = 0;
+                for (; x + 16 <= width; x += 16) {
+                    __m128i v = _mm_loadu_si128((const __m128i *)(s + x));
+                    if (_mm_testz_si128(v, v)) {
+                        for (int32_t k = 0; k < 16; k += 4) {
+                            _mm_storeu_si128((__m128i *)(d + x + k), _mm_setzero_si128());
+                        }
+                        continue;
+                    }
+                    for (int32_t k = x; k < x + 16; k += 2) {
+                        int32_t l0 = P[src[k & mask]];
+                        int32_t l1 = P[src[(k + 1) & mask]];
+                        d[k]       = s[k] ? l0 : 0;
+                        d[k + 1]   = s[k + 1] ? l1 : 0;
+                    }
+                }
+                for (; x < width; x += 2) {
+                    int32_t l0 = P[src[x & mask]];
+                    int32_t l1 = x + 1 < width ? P[src[(x + 1) & mask]] : 0;
+                    d[x]       = s[x] ? l0 : 0;
+                    if (x + 1 < width) {
+                        d[x + 1] = s[x + 1] ? l1 : 0;
+                    }
+                }
+                continue;
+            }
+            for (int32_t x = 0; x < width;) {
+                // the block label of the next run may sit on the last background pixel, read it first
+                int32_t e     = cc_run_end(s, x, width, false);
+                int32_t label = e < width ? src[e & mask] : 0;
+                if (e > x) {
+                    std::fill(d + x, d + e, 0);
+                    if (with_stats) {
+                        cc_stat_add_run(*background, x, e, y);
+                    }
+                }
+                if (e >= width) {
+                    break;
+                }
+                x = e;
+                e = cc_run_end(s, x, width, true);
+                std::fill(d + x, d + e, P[label]);
+                if (with_stats) {
+                    cc_stat_add_run(stat[label - base], x, e, y);
+                }
+                x = e;
+            }
+        }
+    }
+}
+
+template <bool with_stats>
+static ::ppl::common::RetCode connected_components(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    int32_t *outLabels,
+    int32_t *stats,
+    double *centroids,
+    int32_t *numLabels,
+    int32_t connectivity)
+{
+    if (nullptr == inData || nullptr == outLabels || nullptr == numLabels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (with_stats && (nullptr == stats || nullptr == centroids)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width || outWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (connectivity != 4 && connectivity != 8) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int32_t stripes = (height + CC_STRIPE - 1) / CC_STRIPE;
+    // a row pair (8-connectivity) or a row (4-connectivity) starts at most (width + 1) / 2 labels,
+    // the labels of a stripe come after all the ones the rows above it may use
+    const int32_t row_labels = (width + 1) / 2;
+    const int32_t row_shift  = connectivity == 8 ? 1 : 0;
+    std::vector<int32_t> P((((height + row_shift) >> row_shift) * row_labels) + 1);
+    std::vector<int32_t> base(stripes), next(stripes);
+    std::vector<uint8_t> zeros(width + 16, 0);
+
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        const int32_t r0 = s * CC_STRIPE;
+        const int32_t r1 = std::min(r0 + CC_STRIPE, height);
+        base[s]          = (r0 >> row_shift) * row_labels + 1;
+        if (connectivity == 8) {
+            next[s] = cc_scan_blocks(height, width, inWidthStride, inData, zeros.data(), outWidthStride, outLabels, r0, r1, base[s], P.data());
+        } else {
+            next[s] = cc_scan_runs(width, inWidthStride, inData, outWidthStride, outLabels, r0, r1, base[s], P.data());
+        }
+    }
+    for (int32_t s = 1; s < stripes; ++s) {
+        if (connectivity == 8) {
+            cc_merge_blocks(width, inWidthStride, inData, outWidthStride, outLabels, s * CC_STRIPE, P.data());
+        } else {
+            cc_merge_runs(width, inWidthStride, inData, outWidthStride, outLabels, s * CC_STRIPE, P.data());
+        }
+    }
+    // every root gets the next final label in the order of the provisional labels
+    int32_t count = 1;
+    P[0]          = 0;
+    for (int32_t s = 0; s < stripes; ++s) {
+        for (int32_t i = base[s]; i < next[s]; ++i) {
+            P[i] = P[i] < i ? P[P[i]] : count++;
+        }
+    }
+    *numLabels = count;
+
+    std::vector<int32_t> offset(stripes + 1, 0);
+    for (int32_t s = 0; s < stripes; ++s) {
+        offset[s + 1] = offset[s] + (with_stats ? next[s] - base[s] : 0);
+    }
+    std::vector<CCStat> local(offset[stripes], cc_stat_empty);
+    std::vector<CCStat> background(with_stats ? stripes : 0, cc_stat_empty);
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        const int32_t r0 = s * CC_STRIPE;
+        const int32_t r1 = std::min(r0 + CC_STRIPE, height);
+        CCStat *stat     = with_stats ? local.data() + offset[s] : nullptr;
+        CCStat *bg       = with_stats ? background.data() + s : nullptr;
+        if (connectivity == 8) {
+            cc_relabel<8, with_stats>(height, width, inWidthStride, inData, outWidthStride, outLabels, r0, r1, base[s], P.data(), stat, bg);
+        } else {
+            cc_relabel<4, with_stats>(height, width, inWidthStride, inData, outWidthStride, outLabels, r0, r1, base[s], P.data(), stat, bg);
+        }
+    }
+    if (!with_stats) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    std::vector<CCStat> total(count, cc_stat_empty);
+    for (int32_t s = 0; s < stripes; ++s) {
+        cc_stat_merge(total[0], background[s]);
+        for (int32_t i = base[s]; i < next[s]; ++i) {
+            cc_stat_merge(total[P[i]], local[offset[s] + i - base[s]]);
+        }
+    }
+    for (int32_t l = 0; l < count; ++l) {
+        const CCStat &t = total[l];
+        int32_t *row    = stats + l * CC_STAT_MAX;
+        if (t.area == 0) {
+            row[CC_STAT_LEFT] = row[CC_STAT_TOP] = row[CC_STAT_WIDTH] = row[CC_STAT_HEIGHT] = row[CC_STAT_AREA] = 0;
+            centroids[2 * l] = centroids[2 * l + 1] = std::numeric_limits<double>::quiet_NaN();
+            continue;
+        }
+        row[CC_STAT_LEFT]    = t.left;
+        row[CC_STAT_TOP]     = t.top;
+        row[CC_STAT_WIDTH]   = t.right - t.left + 1;
+        row[CC_STAT_HEIGHT]  = t.bottom - t.top + 1;
+        row[CC_STAT_AREA]    = t.area;
+        centroids[2 * l]     = (double)t.sumx / t.area;
+        centroids[2 * l + 1] = (double)t.sumy / t.area;
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode ConnectedComponents(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    int32_t *outLabels,
+    int32_t *numLabels,
+    int32_t connectivity)
+{
+    return connected_components<false>(height, width, inWidthStride, inData, outWidthStride, outLabels, nullptr, nullptr, numLabels, connectivity);
+}
+
+::ppl::common::RetCode ConnectedComponentsWithStats(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    int32_t *outLabels,
+    int32_t *stats,
+    double *centroids,
+    int32_t *numLabels,
+    int32_t connectivity)
+{
+    return connected_components<true>(height, width, inWidthStride, inData, outWidthStride, outLabels, stats, centroids, numLabels, connectivity);
+}
+
+}
+}
+} // namespace ppl::cv::x86
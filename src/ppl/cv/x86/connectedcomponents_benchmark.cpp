@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/connectedcomponents.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <string.h>
+
+namespace {
+
+// a mask of filled discs, the usual input of a blob analysis
+void FillBlobs(int32_t height, int32_t width, uint8_t *mask) {
+    std::unique_ptr<int32_t[]> seeds(new int32_t[3 * 2048]);
+    ppl::cv::debug::randomFill<int32_t>(seeds.get(), 3 * 2048, 0, 1 << 20);
+    memset(mask, 0, height * width);
+    for (int32_t k = 0; k < 2048; ++k) {
+        int32_t cx = seeds.get()[3 * k] % width;
+        int32_t cy = seeds.get()[3 * k + 1] % height;
+        int32_t r  = seeds.get()[3 * k + 2] % 20 + 2;
+        for (int32_t y = std::max(0, cy - r); y < std::min(height, cy + r); ++y) {
+            for (int32_t x = std::max(0, cx - r); x < std::min(width, cx + r); ++x) {
+                if ((x - cx) * (x - cx) + (y - cy) * (y - cy) < r * r) {
+                    mask[y * width + x] = 255;
+                }
+            }
+        }
+    }
+}
+
+template<int32_t connectivity, bool with_stats>
+void BM_ConnectedComponents_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<int32_t[]> labels(new int32_t[width * height]);
+    const int32_t max_labels = (height * width + 1) / 2 + 1;
+    std::vector<int32_t> stats(max_labels * ppl::cv::CC_STAT_MAX);
+    std::vector<double> centroids(max_labels * 2);
+    FillBlobs(height, width, src.get());
+    int32_t num = 0;
+    for (auto _ : state) {
+        if (with_stats) {
+            ppl::cv::x86::ConnectedComponentsWithStats(height, width, width, src.get(), width, labels.get(), stats.data(), centroids.data(), &num, connectivity);
+        } else {
+            ppl::cv::x86::ConnectedComponents(height, width, width, src.get(), width, labels.get(), &num, connectivity);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_ppl_x86, connectivity4, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_ppl_x86, connectivity8, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_ppl_x86, connectivity4, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_ppl_x86, connectivity8, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<int32_t connectivity, bool with_stats>
+void BM_ConnectedComponents_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    FillBlobs(height, width, src.get());
+    cv::Mat src_opencv(height, width, CV_8UC1, src.get());
+    cv::Mat labels_opencv, stats_opencv, centroids_opencv;
+    for (auto _ : state) {
+        if (with_stats) {
+            cv::connectedComponentsWithStats(src_opencv, labels_opencv, stats_opencv, centroids_opencv, connectivity, CV_32S);
+        } else {
+            cv::connectedComponents(src_opencv, labels_opencv, connectivity, CV_32S);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_opencv_x86, connectivity4, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_opencv_x86, connectivity8, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_opencv_x86, connectivity4, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_opencv_x86, connectivity8, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/connectedcomponents.h"
+#include "ppl/cv/debug.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+// the numbering may differ from the one of OpenCV, labels are compared through a one to one mapping
+void ConnectedComponentsTest(int32_t height, int32_t width, int32_t connectivity, int32_t percent) {
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<int32_t[]> labels(new int32_t[width * height]);
+    std::unique_ptr<int32_t[]> labels_stats(new int32_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    for (int32_t i = 0; i < width * height; ++i) {
+        src.get()[i] = src.get()[i] < percent * 255 / 100 ? 255 : 0;
+    }
+    cv::Mat src_opencv(height, width, CV_8UC1, src.get());
+    cv::Mat labels_opencv, stats_opencv, centroids_opencv;
+    int32_t num_opencv = cv::connectedComponentsWithStats(src_opencv, labels_opencv, stats_opencv, centroids_opencv, connectivity, CV_32S);
+
+    const int32_t max_labels = (height * width + 1) / 2 + 1;
+    std::vector<int32_t> stats(max_labels * ppl::cv::CC_STAT_MAX);
+    std::vector<double> centroids(max_labels * 2);
+    int32_t num = 0, num_stats = 0;
+    auto rst = ppl::cv::x86::ConnectedComponents(height, width, width, src.get(), width, labels.get(), &num, connectivity);
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    rst = ppl::cv::x86::ConnectedComponentsWithStats(height, width, width, src.get(), width, labels_stats.get(), stats.data(), centroids.data(), &num_stats, connectivity);
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    ASSERT_EQ(num, num_opencv);
+    ASSERT_EQ(num_stats, num_opencv);
+
+    std::vector<int32_t> to_opencv(num, -1), from_opencv(num, -1);
+    for (int32_t i = 0; i < height; ++i) {
+        for (int32_t j = 0; j < width; ++j) {
+            int32_t l    = labels.get()[i * width + j];
+            int32_t l_cv = labels_opencv.at<int32_t>(i, j);
+            ASSERT_EQ(labels_stats.get()[i * width + j], l);
+            ASSERT_TRUE(l >= 0 && l < num);
+            if (to_opencv[l] < 0) {
+                ASSERT_LT(from_opencv[l_cv], 0);
+                to_opencv[l]      = l_cv;
+                from_opencv[l_cv] = l;
+            }
+            ASSERT_EQ(to_opencv[l], l_cv);
+        }
+    }
+    for (int32_t l = 0; l < num; ++l) {
+        int32_t l_cv = to_opencv[l];
+        if (l_cv < 0) {
+            continue;
+        }
+        for (int32_t k = 0; k < ppl::cv::CC_STAT_MAX; ++k) {
+            EXPECT_EQ(stats[l * ppl::cv::CC_STAT_MAX + k], stats_opencv.at<int32_t>(l_cv, k));
+        }
+        EXPECT_NEAR(centroids[l * 2], centroids_opencv.at<double>(l_cv, 0), 1e-9);
+        EXPECT_NEAR(centroids[l * 2 + 1], centroids_opencv.at<double>(l_cv, 1), 1e-9);
+    }
+}
+
+#define R(name, connectivity) \
+    TEST(name, x86) \
+    { \
+        ConnectedComponentsTest(240, 320, connectivity, 10); \
+        ConnectedComponentsTest(481, 643, connectivity, 50); \
+        ConnectedComponentsTest(1080, 1920, connectivity, 45); \
+        ConnectedComponentsTest(1080, 1920, connectivity, 70); \
+        ConnectedComponentsTest(3, 5, connectivity, 50); \
+    } \
+
+R(CONNECTEDCOMPONENTS_4, 4);
+R(CONNECTEDCOMPONENTS_8, 8);
@@ -0,0 +1,335 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/distancetransform.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <string.h>
+#include <math.h>
+#include <limits.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// chamfer distances are kept in Q16 fixed point, the same as cv::distanceTransform
+#define DIST_SHIFT     16
+#define DIST_INIT      ((uint32_t)INT_MAX)
+#define DIST_MAX       ((uint32_t)(INT_MAX >> 2))
+// columns per lane group of the exact transform
+#define DIST_COL_BLOCK 16
+// squared distance of a column without any zero pixel
+#define DIST_INF       1e15f
+
+static inline __m128i v_dist_add(const uint32_t *p, __m128i v_d)
+{
+    return _mm_add_epi32(_mm_loadu_si128((const __m128i *)p), v_d);
+}
+
+// terms of the mask that come from the row next to the current one (r1) and, for the 5x5 mask,
+// the row after it (r2), hv, diag and knight are the costs of the three kinds of moves
+template <int32_t border>
+static inline __m128i chamfer_rows_v(const uint32_t *r1, const uint32_t *r2, __m128i v_base, __m128i v_hv, __m128i v_diag, __m128i v_knight)
+{
+    __m128i v = _mm_min_epu32(v_base, v_dist_add(r1, v_hv));
+    v         = _mm_min_epu32(v, _mm_min_epu32(v_dist_add(r1 - 1, v_diag), v_dist_add(r1 + 1, v_diag)));
+    if (border == 2) {
+        v = _mm_min_epu32(v, _mm_min_epu32(v_dist_add(r1 - 2, v_knight), v_dist_add(r1 + 2, v_knight)));
+        v = _mm_min_epu32(v, _mm_min_epu32(v_dist_add(r2 - 1, v_knight), v_dist_add(r2 + 1, v_knight)));
+    }
+    return v;
+}
+
+template <int32_t border>
+static inline uint32_t chamfer_rows(const uint32_t *r1, const uint32_t *r2, uint32_t base, uint32_t hv, uint32_t diag, uint32_t knight)
+{
+    uint32_t t = std::min(base, r1[0] + hv);
+    t          = std::min(t, std::min(r1[-1] + diag, r1[1] + diag));
+    if (border == 2) {
+        t = std::min(t, std::min(r1[-2] + knight, r1[2] + knight));
+        t = std::min(t, std::min(r2[-1] + knight, r2[1] + knight));
+    }
+    return t;
+}
+
+// two-pass chamfer transform with a 3x3 (border 1) or 5x5 (border 2) mask. Every pass first takes the terms
+// of the already finished rows for the whole row, then runs the minimum along the row.
+template <int32_t border>
+static void distance_chamfer(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    const float *metrics)
+{
+    const uint32_t hv     = (uint32_t)lrint(metrics[0] * (1 << DIST_SHIFT));
+    const uint32_t diag   = (uint32_t)lrint(metrics[1] * (1 << DIST_SHIFT));
+    const uint32_t knight = border == 2 ? (uint32_t)lrint(metrics[2] * (1 << DIST_SHIFT)) : 0;
+    const float scale     = 1.f / (1 << DIST_SHIFT);
+    const int32_t step    = width + 2 * border;
+    const __m128i v_hv    = _mm_set1_epi32(hv);
+    const __m128i v_diag  = _mm_set1_epi32(diag);
+    const __m128i v_kn    = _mm_set1_epi32(knight);
+    const __m128i v_init  = _mm_set1_epi32(DIST_INIT);
+    const __m128i v_max   = _mm_set1_epi32(DIST_MAX);
+    const __m128 v_scale  = _mm_set1_ps(scale);
+    std::vector<uint32_t> temp((height + 2 * border) * step, DIST_INIT);
+
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *s = inData + i * inWidthStride;
+        uint32_t *tmp    = temp.data() + (i + border) * step + border;
+        int32_t j        = 0;
+        for (; j <= width - 4; j += 4) {
+            int32_t pixels;
+            memcpy(&pixels, s + j, sizeof(pixels));
+            __m128i v_zero = _mm_cmpeq_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(pixels)), _mm_setzero_si128());
+            __m128i v      = chamfer_rows_v<border>(tmp + j - step, tmp + j - border * step, v_init, v_hv, v_diag, v_kn);
+            _mm_storeu_si128((__m128i *)(tmp + j), _mm_andnot_si128(v_zero, v));
+        }
+        for (; j < width; ++j) {
+            tmp[j] = s[j] ? chamfer_rows<border>(tmp + j - step, tmp + j - border * step, DIST_INIT, hv, diag, knight) : 0;
+        }
+        for (j = 0; j < width; ++j) {
+            tmp[j] = std::min(tmp[j], tmp[j - 1] + hv);
+        }
+    }
+
+    for (int32_t i = height - 1; i >= 0; --i) {
+        float *d      = outData + i * outWidthStride;
+        uint32_t *tmp = temp.data() + (i + border) * step + border;
+        int32_t j     = 0;
+        for (; j <= width - 4; j += 4) {
+            __m128i v = chamfer_rows_v<border>(tmp + j + step, tmp + j + border * step, _mm_loadu_si128((const __m128i *)(tmp + j)), v_hv, v_diag, v_kn);
+            _mm_storeu_si128((__m128i *)(tmp + j), v);
+        }
+        for (; j < width; ++j) {
+            tmp[j] = chamfer_rows<border>(tmp + j + step, tmp + j + border * step, tmp[j], hv, diag, knight);
+        }
+        for (j = width - 1; j >= 0; --j) {
+            tmp[j] = std::min(tmp[j], tmp[j + 1] + hv);
+        }
+        for (j = 0; j <= width - 4; j += 4) {
+            __m128i v = _mm_min_epu32(_mm_loadu_si128((const __m128i *)(tmp + j)), v_max);
+            _mm_storeu_ps(d + j, _mm_mul_ps(_mm_cvtepi32_ps(v), v_scale));
+        }
+        for (; j < width; ++j) {
+            d[j] = (float)std::min(tmp[j], DIST_MAX) * scale;
+        }
+    }
+}
+
+// stage 1 of the exact transform: squared distance to the nearest zero pixel of the same column,
+// DIST_COL_BLOCK columns at a time with one lane per column
+static void distance_exact_columns(
+    int32_t height,
+    int32_t x0,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t *below)
+{
+    const __m128i v_one  = _mm_set1_epi32(1);
+    const __m128i v_rows = _mm_set1_epi32(height);
+    const __m128 v_inf   = _mm_set1_ps(DIST_INF);
+    // distance to the nearest zero at or below every row, a column without one counts from row height
+    __m128i v_dist[4];
+    for (int32_t k = 0; k < 4; ++k) {
+        v_dist[k] = _mm_set1_epi32(height - 1);
+    }
+    for (int32_t i = height - 1; i >= 0; --i) {
+        __m128i v_s = _mm_loadu_si128((const __m128i *)(inData + i * inWidthStride + x0));
+        __m128i v_z = _mm_cmpeq_epi8(v_s, _mm_setzero_si128());
+        __m128i v_zk[4];
+        v_zk[0] = _mm_cvtepi8_epi32(v_z);
+        v_zk[1] = _mm_cvtepi8_epi32(_mm_srli_si128(v_z, 4));
+        v_zk[2] = _mm_cvtepi8_epi32(_mm_srli_si128(v_z, 8));
+        v_zk[3] = _mm_cvtepi8_epi32(_mm_srli_si128(v_z, 12));
+        for (int32_t k = 0; k < 4; ++k) {
+            v_dist[k] = _mm_andnot_si128(v_zk[k], _mm_add_epi32(v_dist[k], v_one));
+            _mm_storeu_si128((__m128i *)(below + i * DIST_COL_BLOCK + 4 * k), v_dist[k]);
+        }
+    }
+    for (int32_t k = 0; k < 4; ++k) {
+        v_dist[k] = _mm_set1_epi32(height - 1);
+    }
+    for (int32_t i = 0; i < height; ++i) {
+        float *d = outData + i * outWidthStride + x0;
+        for (int32_t k = 0; k < 4; ++k) {
+            v_dist[k]   = _mm_min_epi32(_mm_add_epi32(v_dist[k], v_one), _mm_loadu_si128((const __m128i *)(below + i * DIST_COL_BLOCK + 4 * k)));
+            __m128 v_sq = _mm_cvtepi32_ps(_mm_mullo_epi32(v_dist[k], v_dist[k]));
+            __m128 v_in = _mm_castsi128_ps(_mm_cmplt_epi32(v_dist[k], v_rows));
+            _mm_storeu_ps(d + 4 * k, _mm_or_ps(_mm_and_ps(v_in, v_sq), _mm_andnot_ps(v_in, v_inf)));
+        }
+    }
+}
+
+static void distance_exact_column(
+    int32_t height,
+    int32_t x,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t *below)
+{
+    int32_t dist = height - 1;
+    for (int32_t i = height - 1; i >= 0; --i) {
+        dist     = inData[i * inWidthStride + x] ? dist + 1 : 0;
+        below[i] = dist;
+    }
+    dist = height - 1;
+    for (int32_t i = 0; i < height; ++i) {
+        dist                              = std::min(dist + 1, below[i]);
+        outData[i * outWidthStride + x] = dist < height ? (float)(dist * dist) : DIST_INF;
+    }
+}
+
+// stage 2 of the exact transform: lower envelope of the parabolas of one row, d holds the squared
+// column distances and receives the distances
+static void distance_exact_row(
+    int32_t width,
+    const float *sqr_tab,
+    const float *inv_tab,
+    float *f,
+    float *z,
+    int32_t *v,
+    float *d)
+{
+    v[0] = 0;
+    z[0] = -DIST_INF;
+    z[1] = DIST_INF;
+    f[0] = d[0];
+    for (int32_t q = 1, k = 0; q < width; ++q) {
+        const float fq = d[q];
+        f[q]           = fq;
+        for (;; --k) {
+            const int32_t p = v[k];
+            const float s   = (fq + sqr_tab[q] - d[p] - sqr_tab[p]) * inv_tab[q - p];
+            if (s > z[k]) {
+                ++k;
+                v[k]     = q;
+                z[k]     = s;
+                z[k + 1] = DIST_INF;
+                break;
+            }
+        }
+    }
+    for (int32_t q = 0, k = 0; q < width; ++q) {
+        while (z[k + 1] < q) {
+            ++k;
+        }
+        const int32_t p = v[k];
+        d[q]            = sqrtf(sqr_tab[abs(q - p)] + f[p]);
+    }
+}
+
+static void distance_exact(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData)
+{
+    const int32_t blocks = width / DIST_COL_BLOCK;
+#pragma omp parallel for
+    for (int32_t b = 0; b <= blocks; ++b) {
+        std::vector<int32_t> below(height * DIST_COL_BLOCK);
+        if (b < blocks) {
+            distance_exact_columns(height, b * DIST_COL_BLOCK, inWidthStride, inData, outWidthStride, outData, below.data());
+        } else {
+            for (int32_t x = blocks * DIST_COL_BLOCK; x < width; ++x) {
+                distance_exact_column(height, x, inWidthStride, inData, outWidthStride, outData, below.data());
+            }
+        }
+    }
+
+    std::vector<float> sqr_tab(width), inv_tab(width);
+    sqr_tab[0] = inv_tab[0] = 0.f;
+    for (int32_t i = 1; i < width; ++i) {
+        inv_tab[i] = (float)(0.5 / i);
+        sqr_tab[i] = (float)(i * i);
+    }
+#pragma omp parallel for
+    for (int32_t i = 0; i < height; ++i) {
+        std::vector<float> f(width), z(width + 1);
+        std::vector<int32_t> v(width);
+        distance_exact_row(width, sqr_tab.data(), inv_tab.data(), f.data(), z.data(), v.data(), outData + i * outWidthStride);
+    }
+}
+
+::ppl::common::RetCode DistanceTransform(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    DistTypes distanceType,
+    DistanceTransformMasks maskSize)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width || outWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (maskSize != DIST_MASK_3 && maskSize != DIST_MASK_5 && maskSize != DIST_MASK_PRECISE) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    // the metrics of cv::distanceTransform, L1 and C are exact with the 3x3 mask
+    float metrics[3];
+    if (distanceType == DIST_C) {
+        metrics[0] = 1.f;
+        metrics[1] = 1.f;
+        maskSize   = DIST_MASK_3;
+    } else if (distanceType == DIST_L1) {
+        metrics[0] = 1.f;
+        metrics[1] = 2.f;
+        maskSize   = DIST_MASK_3;
+    } else if (distanceType == DIST_L2) {
+        if (maskSize == DIST_MASK_3) {
+            metrics[0] = 0.955f;
+            metrics[1] = 1.3693f;
+        } else {
+            metrics[0] = 1.f;
+            metrics[1] = 1.4f;
+            metrics[2] = 2.1969f;
+        }
+    } else {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    if (maskSize == DIST_MASK_PRECISE) {
+        distance_exact(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else if (maskSize == DIST_MASK_3) {
+        distance_chamfer<1>(height, width, inWidthStride, inData, outWidthStride, outData, metrics);
+    } else {
+        distance_chamfer<2>(height, width, inWidthStride, inData, outWidthStride, outData, metrics);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/distancetransform.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+
+namespace {
+
+template<ppl::cv::DistTypes distanceType, ppl::cv::DistanceTransformMasks maskSize>
+void BM_DistanceTransform_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<float[]> dst(new float[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    for (int32_t i = 0; i < width * height; ++i) {
+        src.get()[i] = src.get()[i] < 3 ? 0 : 255;
+    }
+    for (auto _ : state) {
+        ppl::cv::x86::DistanceTransform(height, width, width, src.get(), width, dst.get(), distanceType, maskSize);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_DistanceTransform_ppl_x86, ppl::cv::DIST_L1, ppl::cv::DIST_MASK_3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DistanceTransform_ppl_x86, ppl::cv::DIST_L2, ppl::cv::DIST_MASK_3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DistanceTransform_ppl_x86, ppl::cv::DIST_L2, ppl::cv::DIST_MASK_5)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DistanceTransform_ppl_x86, ppl::cv::DIST_L2, ppl::cv::DIST_MASK_PRECISE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<int32_t distanceType, int32_t maskSize>
+void BM_DistanceTransform_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<float[]> dst(new float[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    for (int32_t i = 0; i < width * height; ++i) {
+        src.get()[i] = src.get()[i] < 3 ? 0 : 255;
+    }
+    cv::Mat src_opencv(height, width, CV_8UC1, src.get());
+    cv::Mat dst_opencv(height, width, CV_32FC1, dst.get());
+    for (auto _ : state) {
+        cv::distanceTransform(src_opencv, dst_opencv, distanceType, maskSize, CV_32F);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_DistanceTransform_opencv_x86, cv::DIST_L1, cv::DIST_MASK_3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DistanceTransform_opencv_x86, cv::DIST_L2, cv::DIST_MASK_3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DistanceTransform_opencv_x86, cv::DIST_L2, cv::DIST_MASK_5)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DistanceTransform_opencv_x86, cv::DIST_L2, cv::DIST_MASK_PRECISE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/distancetransform.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+
+void DistanceTransformTest(int32_t height, int32_t width, ppl::cv::DistTypes distanceType, ppl::cv::DistanceTransformMasks maskSize, float diff) {
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<float[]> dst(new float[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    // keep about one pixel in a hundred as background
+    for (int32_t i = 0; i < width * height; ++i) {
+        src.get()[i] = src.get()[i] < 3 ? 0 : 255;
+    }
+    cv::Mat src_opencv(height, width, CV_8UC1, src.get());
+    cv::Mat dst_opencv;
+    cv::distanceTransform(src_opencv, dst_opencv, (int)distanceType, (int)maskSize, CV_32F);
+
+    auto rst = ppl::cv::x86::DistanceTransform(height, width, width, src.get(), width, dst.get(), distanceType, maskSize);
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    checkResult<float, 1>(dst.get(), (const float *)dst_opencv.data, height, width, width, dst_opencv.step / sizeof(float), diff);
+}
+
+#define R(name, distanceType, maskSize, diff) \
+    TEST(name, x86) \
+    { \
+        DistanceTransformTest(240, 320, distanceType, maskSize, diff); \
+        DistanceTransformTest(481, 643, distanceType, maskSize, diff); \
+        DistanceTransformTest(1080, 1920, distanceType, maskSize, diff); \
+        DistanceTransformTest(3, 5, distanceType, maskSize, diff); \
+    } \
+
+R(DISTANCETRANSFORM_L1_MASK3, ppl::cv::DIST_L1, ppl::cv::DIST_MASK_3, 1e-4f);
+R(DISTANCETRANSFORM_C_MASK3, ppl::cv::DIST_C, ppl::cv::DIST_MASK_3, 1e-4f);
+R(DISTANCETRANSFORM_L2_MASK3, ppl::cv::DIST_L2, ppl::cv::DIST_MASK_3, 1e-4f);
+R(DISTANCETRANSFORM_L2_MASK5, ppl::cv::DIST_L2, ppl::cv::DIST_MASK_5, 1e-4f);
+R(DISTANCETRANSFORM_L2_PRECISE, ppl::cv::DIST_L2, ppl::cv::DIST_MASK_PRECISE, 1e-4f);
@@ -0,0 +1,419 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/dwt.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// rows per task of the row pass
+#define DWT_STRIPE_ROWS 16
+// columns per task of the column pass, the few rows of a tile being worked on stay in L1
+#define DWT_TILE_COLS   128
+
+static const float dwt_haar_k = 0.707106781186547524f; // 1 / sqrt(2)
+
+// DB2 lifting, with e and o the even and odd samples
+//   d1[n] = o[n] - p * e[n]                        predict
+//   s1[n] = e[n] + u0 * d1[n] + u1 * d1[n + 1]     update
+//   d2[n] = d1[n + 1] + s1[n]                      second predict
+//   a[n]  = ka * s1[n], d[n] = kd * d2[n]          scaling
+// which is the periodic filter bank documented in dwt.h, d1[n / 2] wraps around to d1[0].
+// The second predict step is folded into the scaling.
+static const float dwt_db2_p   = 1.732050807568877294f; // sqrt(3)
+static const float dwt_db2_u0  = 0.433012701892219323f; // sqrt(3) / 4
+static const float dwt_db2_u1  = -0.066987298107780677f; // (sqrt(3) - 2) / 4
+static const float dwt_db2_ka  = 1.931851652578136574f; // (sqrt(3) + 1) / sqrt(2)
+static const float dwt_db2_kd  = -0.517638090205041525f; // -(sqrt(3) - 1) / sqrt(2)
+static const float dwt_db2_ika = 0.517638090205041525f; // 1 / ka
+static const float dwt_db2_ikd = -1.931851652578136574f; // 1 / kd
+
+// a = (e + o) / sqrt(2), d = (e - o) / sqrt(2)
+static void dwt_haar_forward(const float *e, const float *o, int32_t n, float *a, float *d)
+{
+    const __m128 v_k = _mm_set1_ps(dwt_haar_k);
+    int32_t i        = 0;
+    for (; i <= n - 4; i += 4) {
+        __m128 v_e = _mm_loadu_ps(e + i);
+        __m128 v_o = _mm_loadu_ps(o + i);
+        _mm_storeu_ps(a + i, _mm_mul_ps(_mm_add_ps(v_e, v_o), v_k));
+        _mm_storeu_ps(d + i, _mm_mul_ps(_mm_sub_ps(v_e, v_o), v_k));
+    }
+    for (; i < n; ++i) {
+        float ve = e[i], vo = o[i];
+        a[i]     = (ve + vo) * dwt_haar_k;
+        d[i]     = (ve - vo) * dwt_haar_k;
+    }
+}
+
+// d1 = o - p * e
+static void dwt_db2_predict(const float *e, const float *o, int32_t n, float *d1)
+{
+    const __m128 v_p = _mm_set1_ps(dwt_db2_p);
+    int32_t i        = 0;
+    for (; i <= n - 4; i += 4) {
+        _mm_storeu_ps(d1 + i, _mm_sub_ps(_mm_loadu_ps(o + i), _mm_mul_ps(_mm_loadu_ps(e + i), v_p)));
+    }
+    for (; i < n; ++i) {
+        d1[i] = o[i] - e[i] * dwt_db2_p;
+    }
+}
+
+// the update step, then the second predict step folded into the scaling, d1n holds d1[n + 1]
+static void dwt_db2_update(const float *e, const float *d1, const float *d1n, int32_t n, float *a, float *d)
+{
+    const __m128 v_u0 = _mm_set1_ps(dwt_db2_u0);
+    const __m128 v_u1 = _mm_set1_ps(dwt_db2_u1);
+    const __m128 v_ka = _mm_set1_ps(dwt_db2_ka);
+    const __m128 v_kd = _mm_set1_ps(dwt_db2_kd);
+    int32_t i         = 0;
+    for (; i <= n - 4; i += 4) {
+        __m128 v_d1n = _mm_loadu_ps(d1n + i);
+        __m128 v_s1  = _mm_add_ps(_mm_loadu_ps(e + i), _mm_mul_ps(_mm_loadu_ps(d1 + i), v_u0));
+        v_s1         = _mm_add_ps(v_s1, _mm_mul_ps(v_d1n, v_u1));
+        _mm_storeu_ps(a + i, _mm_mul_ps(v_s1, v_ka));
+        _mm_storeu_ps(d + i, _mm_mul_ps(_mm_add_ps(v_s1, v_d1n), v_kd));
+    }
+    for (; i < n; ++i) {
+        float s1 = e[i] + d1[i] * dwt_db2_u0 + d1n[i] * dwt_db2_u1;
+        a[i]     = s1 * dwt_db2_ka;
+        d[i]     = (s1 + d1n[i]) * dwt_db2_kd;
+    }
+}
+
+// undoes the scaling and the second predict step, s1 = a / ka and d1n = d / kd - s1, which is d1[n + 1]
+static void dwt_db2_unscale(const float *a, const float *d, int32_t n, float *s1, float *d1n)
+{
+    const __m128 v_ika = _mm_set1_ps(dwt_db2_ika);
+    const __m128 v_ikd = _mm_set1_ps(dwt_db2_ikd);
+    int32_t i          = 0;
+    for (; i <= n - 4; i += 4) {
+        __m128 v_s1 = _mm_mul_ps(_mm_loadu_ps(a + i), v_ika);
+        _mm_storeu_ps(s1 + i, v_s1);
+        _mm_storeu_ps(d1n + i, _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(d + i), v_ikd), v_s1));
+    }
+    for (; i < n; ++i) {
+        float vs = a[i] * dwt_db2_ika;
+        s1[i]    = vs;
+        d1n[i]   = d[i] * dwt_db2_ikd - vs;
+    }
+}
+
+// undoes the update and the first predict step, e may alias s1
+static void dwt_db2_restore(const float *s1, const float *d1, const float *d1n, int32_t n, float *e, float *o)
+{
+    const __m128 v_p  = _mm_set1_ps(dwt_db2_p);
+    const __m128 v_u0 = _mm_set1_ps(dwt_db2_u0);
+    const __m128 v_u1 = _mm_set1_ps(dwt_db2_u1);
+    int32_t i         = 0;
+    for (; i <= n - 4; i += 4) {
+        __m128 v_d1 = _mm_loadu_ps(d1 + i);
+        __m128 v_e  = _mm_sub_ps(_mm_loadu_ps(s1 + i), _mm_mul_ps(v_d1, v_u0));
+        v_e         = _mm_sub_ps(v_e, _mm_mul_ps(_mm_loadu_ps(d1n + i), v_u1));
+        _mm_storeu_ps(e + i, v_e);
+        _mm_storeu_ps(o + i, _mm_add_ps(v_d1, _mm_mul_ps(v_e, v_p)));
+    }
+    for (; i < n; ++i) {
+        float vd = d1[i];
+        float ve = s1[i] - vd * dwt_db2_u0 - d1n[i] * dwt_db2_u1;
+        e[i]     = ve;
+        o[i]     = vd + ve * dwt_db2_p;
+    }
+}
+
+static void dwt_split(const float *src, int32_t half, float *e, float *o)
+{
+    int32_t i = 0;
+    for (; i <= half - 4; i += 4) {
+        __m128 v0 = _mm_loadu_ps(src + 2 * i);
+        __m128 v1 = _mm_loadu_ps(src + 2 * i + 4);
+        _mm_storeu_ps(e + i, _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(o + i, _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    for (; i < half; ++i) {
+        e[i] = src[2 * i];
+        o[i] = src[2 * i + 1];
+    }
+}
+
+static void dwt_merge(const float *e, const float *o, int32_t half, float *dst)
+{
+    int32_t i = 0;
+    for (; i <= half - 4; i += 4) {
+        __m128 v_e = _mm_loadu_ps(e + i);
+        __m128 v_o = _mm_loadu_ps(o + i);
+        _mm_storeu_ps(dst + 2 * i, _mm_unpacklo_ps(v_e, v_o));
+        _mm_storeu_ps(dst + 2 * i + 4, _mm_unpackhi_ps(v_e, v_o));
+    }
+    for (; i < half; ++i) {
+        dst[2 * i]     = e[i];
+        dst[2 * i + 1] = o[i];
+    }
+}
+
+// transforms the rows [y0, y1) of a rows x cols block, approximation to the left half and detail to the right half
+static void dwt_rows_forward(
+    int32_t y0,
+    int32_t y1,
+    int32_t cols,
+    int32_t srcStride,
+    const float *src,
+    int32_t dstStride,
+    float *dst,
+    bool db2)
+{
+    const int32_t half = cols / 2;
+    std::vector<float> buffer(3 * half + 1);
+    float *e  = buffer.data();
+    float *o  = e + half;
+    float *d1 = o + half;
+    for (int32_t y = y0; y < y1; ++y) {
+        const float *s = src + y * srcStride;
+        float *d       = dst + y * dstStride;
+        dwt_split(s, half, e, o);
+        if (db2) {
+            dwt_db2_predict(e, o, half, d1);
+            d1[half] = d1[0];
+            dwt_db2_update(e, d1, d1 + 1, half, d, d + half);
+        } else {
+            dwt_haar_forward(e, o, half, d, d + half);
+        }
+    }
+}
+
+static void dwt_rows_inverse(
+    int32_t y0,
+    int32_t y1,
+    int32_t cols,
+    int32_t srcStride,
+    const float *src,
+    int32_t dstStride,
+    float *dst,
+    bool db2)
+{
+    const int32_t half = cols / 2;
+    std::vector<float> buffer(3 * half + 1);
+    float *e  = buffer.data();
+    float *o  = e + half;
+    float *d1 = o + half;
+    for (int32_t y = y0; y < y1; ++y) {
+        const float *s = src + y * srcStride;
+        float *d       = dst + y * dstStride;
+        if (db2) {
+            dwt_db2_unscale(s, s + half, half, e, d1 + 1);
+            d1[0] = d1[half];
+            dwt_db2_restore(e, d1, d1 + 1, half, e, o);
+        } else {
+            // the Haar butterfly is its own inverse
+            dwt_haar_forward(s, s + half, half, e, o);
+        }
+        dwt_merge(e, o, half, d);
+    }
+}
+
+// transforms the columns [x0, x1) of a rows x cols block, approximation to the top half and detail to the
+// bottom half. The lifting steps run on whole tile rows while streaming down the tile once.
+static void dwt_cols_forward(
+    int32_t x0,
+    int32_t x1,
+    int32_t rows,
+    int32_t srcStride,
+    const float *src,
+    int32_t dstStride,
+    float *dst,
+    bool db2)
+{
+    const int32_t half = rows / 2;
+    const int32_t n    = x1 - x0;
+    src += x0;
+    dst += x0;
+    if (!db2) {
+        for (int32_t i = 0; i < half; ++i) {
+            dwt_haar_forward(src + 2 * i * srcStride, src + (2 * i + 1) * srcStride, n, dst + i * dstStride, dst + (half + i) * dstStride);
+        }
+        return;
+    }
+    std::vector<float> buffer(3 * n);
+    float *first = buffer.data();
+    float *bufA  = first + n;
+    float *bufB  = bufA + n;
+    dwt_db2_predict(src, src + srcStride, n, first);
+    float *cur = first;
+    for (int32_t i = 0; i < half; ++i) {
+        float *next = first;
+        if (i + 1 < half) {
+            next = cur == bufA ? bufB : bufA;
+            dwt_db2_predict(src + (2 * i + 2) * srcStride, src + (2 * i + 3) * srcStride, n, next);
+        }
+        dwt_db2_update(src + 2 * i * srcStride, cur, next, n, dst + i * dstStride, dst + (half + i) * dstStride);
+        cur = next;
+    }
+}
+
+static void dwt_cols_inverse(
+    int32_t x0,
+    int32_t x1,
+    int32_t rows,
+    int32_t srcStride,
+    const float *src,
+    int32_t dstStride,
+    float *dst,
+    bool db2)
+{
+    const int32_t half = rows / 2;
+    const int32_t n    = x1 - x0;
+    src += x0;
+    dst += x0;
+    if (!db2) {
+        for (int32_t i = 0; i < half; ++i) {
+            dwt_haar_forward(src + i * srcStride, src + (half + i) * srcStride, n, dst + 2 * i * dstStride, dst + (2 * i + 1) * dstStride);
+        }
+        return;
+    }
+    std::vector<float> buffer(4 * n);
+    float *s1    = buffer.data();
+    float *first = s1 + n;
+    float *bufA  = first + n;
+    float *bufB  = bufA + n;
+    // d1[0] comes from the last pair of rows
+    dwt_db2_unscale(src + (half - 1) * srcStride, src + (2 * half - 1) * srcStride, n, s1, first);
+    float *cur = first;
+    for (int32_t i = 0; i < half; ++i) {
+        float *next = cur == bufA ? bufB : bufA;
+        dwt_db2_unscale(src + i * srcStride, src + (half + i) * srcStride, n, s1, next);
+        dwt_db2_restore(s1, cur, next, n, dst + 2 * i * dstStride, dst + (2 * i + 1) * dstStride);
+        cur = next;
+    }
+}
+
+static bool dwt_check(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    const float *outData,
+    int32_t levels,
+    WaveletFamily family)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return false;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width || outWidthStride < width) {
+        return false;
+    }
+    if (levels < 1 || levels > 30) {
+        return false;
+    }
+    const int32_t block = 1 << levels;
+    if (height % block != 0 || width % block != 0) {
+        return false;
+    }
+    return family == WAVELET_HAAR || family == WAVELET_DB1 || family == WAVELET_DB2;
+}
+
+::ppl::common::RetCode DWT(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t levels,
+    WaveletFamily family)
+{
+    if (!dwt_check(height, width, inWidthStride, inData, outWidthStride, outData, levels, family)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const bool db2 = family == WAVELET_DB2;
+    float *tmp     = (float *)ppl::common::AlignedAlloc((uint64_t)height * width * sizeof(float), 64);
+    for (int32_t l = 0; l < levels; ++l) {
+        const int32_t rows      = height >> l;
+        const int32_t cols      = width >> l;
+        const float *src        = l == 0 ? inData : outData;
+        const int32_t srcStride = l == 0 ? inWidthStride : outWidthStride;
+        const int32_t stripes   = (rows + DWT_STRIPE_ROWS - 1) / DWT_STRIPE_ROWS;
+#pragma omp parallel for
+        for (int32_t s = 0; s < stripes; ++s) {
+            const int32_t y0 = s * DWT_STRIPE_ROWS;
+            const int32_t y1 = std::min(rows, y0 + DWT_STRIPE_ROWS);
+            dwt_rows_forward(y0, y1, cols, srcStride, src, width, tmp, db2);
+        }
+        const int32_t tiles = (cols + DWT_TILE_COLS - 1) / DWT_TILE_COLS;
+#pragma omp parallel for
+        for (int32_t t = 0; t < tiles; ++t) {
+            const int32_t x0 = t * DWT_TILE_COLS;
+            const int32_t x1 = std::min(cols, x0 + DWT_TILE_COLS);
+            dwt_cols_forward(x0, x1, rows, width, tmp, outWidthStride, outData, db2);
+        }
+    }
+    ppl::common::AlignedFree(tmp);
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode IDWT(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t levels,
+    WaveletFamily family)
+{
+    if (!dwt_check(height, width, inWidthStride, inData, outWidthStride, outData, levels, family)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const bool db2 = family == WAVELET_DB2;
+    if (inData != outData) {
+        for (int32_t i = 0; i < height; ++i) {
+            memcpy(outData + i * outWidthStride, inData + i * inWidthStride, width * sizeof(float));
+        }
+    }
+    float *tmp = (float *)ppl::common::AlignedAlloc((uint64_t)height * width * sizeof(float), 64);
+    for (int32_t l = levels - 1; l >= 0; --l) {
+        const int32_t rows  = height >> l;
+        const int32_t cols  = width >> l;
+        const int32_t tiles = (cols + DWT_TILE_COLS - 1) / DWT_TILE_COLS;
+#pragma omp parallel for
+        for (int32_t t = 0; t < tiles; ++t) {
+            const int32_t x0 = t * DWT_TILE_COLS;
+            const int32_t x1 = std::min(cols, x0 + DWT_TILE_COLS);
+            dwt_cols_inverse(x0, x1, rows, outWidthStride, outData, width, tmp, db2);
+        }
+        const int32_t stripes = (rows + DWT_STRIPE_ROWS - 1) / DWT_STRIPE_ROWS;
+#pragma omp parallel for
+        for (int32_t s = 0; s < stripes; ++s) {
+            const int32_t y0 = s * DWT_STRIPE_ROWS;
+            const int32_t y1 = std::min(rows, y0 + DWT_STRIPE_ROWS);
+            dwt_rows_inverse(y0, y1, cols, width, tmp, outWidthStride, outData, db2);
+        }
+    }
+    ppl::common::AlignedFree(tmp);
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
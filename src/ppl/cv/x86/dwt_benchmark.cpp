@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include "ppl/cv/x86/dwt.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+
+namespace {
+
+template<ppl::cv::WaveletFamily family, int32_t levels>
+void BM_DWT_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<float[]> src(new float[width * height]);
+    std::unique_ptr<float[]> dst(new float[width * height]);
+    ppl::cv::debug::randomFill<float>(src.get(), width * height, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::DWT(height, width, width, src.get(), width, dst.get(), levels, family);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template<ppl::cv::WaveletFamily family, int32_t levels>
+void BM_IDWT_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<float[]> src(new float[width * height]);
+    std::unique_ptr<float[]> dst(new float[width * height]);
+    ppl::cv::debug::randomFill<float>(src.get(), width * height, 0, 255);
+    for (auto _ : state) {
+        ppl::cv::x86::IDWT(height, width, width, src.get(), width, dst.get(), levels, family);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_DWT_ppl_x86, ppl::cv::WAVELET_HAAR, 1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DWT_ppl_x86, ppl::cv::WAVELET_HAAR, 3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DWT_ppl_x86, ppl::cv::WAVELET_DB2, 1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DWT_ppl_x86, ppl::cv::WAVELET_DB2, 3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_IDWT_ppl_x86, ppl::cv::WAVELET_HAAR, 3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_IDWT_ppl_x86, ppl::cv::WAVELET_DB2, 3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+} // namespace
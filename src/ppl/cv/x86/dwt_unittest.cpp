@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/dwt.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <memory>
+#include <vector>
+
+// one level of the periodic filter bank on n samples, approximation first and detail second
+static void DWTReference1D(double *x, int32_t n, int32_t step, ppl::cv::WaveletFamily family) {
+    const double r2 = sqrt(2.0);
+    const double r3 = sqrt(3.0);
+    std::vector<double> h;
+    if (family == ppl::cv::WAVELET_DB2) {
+        h = {(1 + r3) / (4 * r2), (3 + r3) / (4 * r2), (3 - r3) / (4 * r2), (1 - r3) / (4 * r2)};
+    } else {
+        h = {1 / r2, 1 / r2};
+    }
+    const int32_t taps = h.size();
+    std::vector<double> y(n);
+    for (int32_t i = 0; i < n / 2; ++i) {
+        double a = 0, d = 0;
+        for (int32_t k = 0; k < taps; ++k) {
+            double v = x[((2 * i + k) % n) * step];
+            a += h[k] * v;
+            d += (k % 2 ? -1 : 1) * h[taps - 1 - k] * v;
+        }
+        y[i]         = a;
+        y[n / 2 + i] = d;
+    }
+    for (int32_t i = 0; i < n; ++i) {
+        x[i * step] = y[i];
+    }
+}
+
+void DWTTest(int32_t height, int32_t width, int32_t levels, ppl::cv::WaveletFamily family, float diff) {
+    std::unique_ptr<float[]> src(new float[width * height]);
+    std::unique_ptr<float[]> dst(new float[width * height]);
+    std::unique_ptr<float[]> rec(new float[width * height]);
+    std::unique_ptr<float[]> ref(new float[width * height]);
+    ppl::cv::debug::randomFill<float>(src.get(), width * height, 0, 255);
+    std::vector<double> coeffs(src.get(), src.get() + width * height);
+    for (int32_t l = 0; l < levels; ++l) {
+        for (int32_t i = 0; i < height >> l; ++i) {
+            DWTReference1D(coeffs.data() + i * width, width >> l, 1, family);
+        }
+        for (int32_t j = 0; j < width >> l; ++j) {
+            DWTReference1D(coeffs.data() + j, height >> l, width, family);
+        }
+    }
+    for (int32_t i = 0; i < width * height; ++i) {
+        ref.get()[i] = coeffs[i];
+    }
+
+    auto rst = ppl::cv::x86::DWT(height, width, width, src.get(), width, dst.get(), levels, family);
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    checkResult<float, 1>(dst.get(), ref.get(), height, width, width, width, diff);
+    rst = ppl::cv::x86::IDWT(height, width, width, dst.get(), width, rec.get(), levels, family);
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    checkResult<float, 1>(rec.get(), src.get(), height, width, width, width, diff);
+}
+
+#define R(name, levels, family, diff) \
+    TEST(name, x86) \
+    { \
+        DWTTest(240, 320, levels, family, diff); \
+        DWTTest(480, 648, levels, family, diff); \
+        DWTTest(1080, 1920, levels, family, diff); \
+        DWTTest(8, 24, levels, family, diff); \
+    } \
+
+R(DWT_HAAR_L1, 1, ppl::cv::WAVELET_HAAR, 1e-2f);
+R(DWT_HAAR_L3, 3, ppl::cv::WAVELET_HAAR, 1e-2f);
+R(DWT_DB1_L2, 2, ppl::cv::WAVELET_DB1, 1e-2f);
+R(DWT_DB2_L1, 1, ppl::cv::WAVELET_DB2, 1e-2f);
+R(DWT_DB2_L3, 3, ppl::cv::WAVELET_DB2, 1e-2f);
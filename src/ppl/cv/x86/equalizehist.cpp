@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/equalizehist.h"
+#include "ppl/cv/x86/calchist.h"
+#include "ppl/cv/x86/lut.h"
+#include "ppl/cv/types.h"
+#include <string.h>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+template <>
+::ppl::common::RetCode EqualizeHist<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width || outWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    int32_t hist[256];
+    CalcHist<uint8_t, 1>(height, width, inWidthStride, inData, hist);
+
+    const int32_t total = height * width;
+    int32_t i           = 0;
+    while (hist[i] == 0) {
+        ++i;
+    }
+    uint8_t lut[256];
+    if (hist[i] == total) {
+        memset(lut, i, sizeof(lut));
+    } else {
+        // same float scale and round-to-nearest-even as cv::equalizeHist
+        float scale = 255.f / (total - hist[i]);
+        int32_t sum = 0;
+        memset(lut, 0, sizeof(lut));
+        for (++i; i < 256; ++i) {
+            sum += hist[i];
+            int32_t v = _mm_cvtss_si32(_mm_set_ss(sum * scale));
+            lut[i]    = v > 255 ? 255 : (v < 0 ? 0 : v);
+        }
+    }
+    return LUT<uint8_t, 1>(height, width, inWidthStride, inData, outWidthStride, outData, lut);
+}
+
+}
+}
+} // namespace ppl::cv::x86
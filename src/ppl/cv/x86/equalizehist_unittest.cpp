@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/equalizehist.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <cstring>
+
+template<typename T, bool inplace>
+void EqualizeHistTest(int32_t height, int32_t width, T minValue, T maxValue) {
+    std::unique_ptr<T[]> src(new T[width * height]);
+    std::unique_ptr<T[]> dst(new T[width * height]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height, minValue, maxValue);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 1), src.get());
+    cv::Mat dst_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 1), dst_ref.get());
+    cv::equalizeHist(src_opencv, dst_opencv);
+
+    if (inplace) {
+        memcpy(dst.get(), src.get(), width * height * sizeof(T));
+        ppl::cv::x86::EqualizeHist<T>(height, width, width, dst.get(), width, dst.get());
+    } else {
+        ppl::cv::x86::EqualizeHist<T>(height, width, width, src.get(), width, dst.get());
+    }
+    checkResult<T, 1>(dst.get(), dst_ref.get(), height, width, width, width, 0.01f);
+}
+
+#define R(name, dtype, inplace, minValue, maxValue) \
+    TEST(name, x86) \
+    { \
+        EqualizeHistTest<dtype, inplace>(240, 320, minValue, maxValue); \
+        EqualizeHistTest<dtype, inplace>(241, 321, minValue, maxValue); \
+        EqualizeHistTest<dtype, inplace>(1080, 1920, minValue, maxValue); \
+    } \
+
+R(equalizehist_u8c1_x86, uint8_t, false, 0, 255);
+R(equalizehist_u8c1_lowcontrast_x86, uint8_t, false, 60, 90);
+R(equalizehist_u8c1_constant_x86, uint8_t, false, 77, 77);
+R(equalizehist_u8c1_inplace_x86, uint8_t, true, 20, 200);
@@ -0,0 +1,436 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/estimateaffine.h"
+#include "ppl/cv/x86/get_affine_transform.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+#define RANSAC_HYPOTHESIS_CHUNK    64
+#define RANSAC_MAX_SAMPLE_ATTEMPTS 1000
+#define RANSAC_REFINE_ITERS        3
+
+// the point pairs in structure of arrays layout, so that four pairs are scored per SSE register
+struct PointPairs {
+    int32_t count;
+    float *x;
+    float *y;
+    float *u;
+    float *v;
+};
+
+// the multiply-with-carry generator of cv::RNG with a constant seed, so that RANSAC is repeatable
+struct SampleRng {
+    uint64_t state;
+    SampleRng() : state(0xffffffffffffffffULL) {}
+    int32_t uniform(int32_t n)
+    {
+        state = (uint64_t)(uint32_t)state * 4164903690U + (uint32_t)(state >> 32);
+        return (int32_t)((uint32_t)state % (uint32_t)n);
+    }
+};
+
+// number of pairs whose dst point is within sqrt(thresh2) of the transformed src point, mask is optional
+static int32_t CountInliers(
+    const PointPairs &pts,
+    const double *m,
+    float thresh2,
+    uint8_t *mask)
+{
+    const float m00 = (float)m[0], m01 = (float)m[1], m02 = (float)m[2];
+    const float m10 = (float)m[3], m11 = (float)m[4], m12 = (float)m[5];
+    __m128 vm00 = _mm_set1_ps(m00), vm01 = _mm_set1_ps(m01), vm02 = _mm_set1_ps(m02);
+    __m128 vm10 = _mm_set1_ps(m10), vm11 = _mm_set1_ps(m11), vm12 = _mm_set1_ps(m12);
+    __m128 vthresh2 = _mm_set1_ps(thresh2);
+    __m128i vcount  = _mm_setzero_si128();
+    int32_t i = 0;
+    for (; i <= pts.count - 4; i += 4) {
+        __m128 x  = _mm_loadu_ps(pts.x + i);
+        __m128 y  = _mm_loadu_ps(pts.y + i);
+        __m128 ex = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vm00, x), _mm_mul_ps(vm01, y)), vm02);
+        __m128 ey = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vm10, x), _mm_mul_ps(vm11, y)), vm12);
+        ex        = _mm_sub_ps(ex, _mm_loadu_ps(pts.u + i));
+        ey        = _mm_sub_ps(ey, _mm_loadu_ps(pts.v + i));
+        __m128 in = _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)), vthresh2);
+        // the lanes of the compare are -1 for the inliers
+        vcount = _mm_sub_epi32(vcount, _mm_castps_si128(in));
+        if (mask != nullptr) {
+            int32_t bits = _mm_movemask_ps(in);
+            mask[i + 0]  = bits & 1;
+            mask[i + 1]  = (bits >> 1) & 1;
+            mask[i + 2]  = (bits >> 2) & 1;
+            mask[i + 3]  = (bits >> 3) & 1;
+        }
+    }
+    int32_t lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, vcount);
+    int32_t count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < pts.count; ++i) {
+        float ex = m00 * pts.x[i] + m01 * pts.y[i] + m02 - pts.u[i];
+        float ey = m10 * pts.x[i] + m11 * pts.y[i] + m12 - pts.v[i];
+        bool in  = ex * ex + ey * ey <= thresh2;
+        count += in;
+        if (mask != nullptr) {
+            mask[i] = in;
+        }
+    }
+    return count;
+}
+
+// means and centered second moments of the pairs selected by mask (all of them when mask is nullptr)
+struct PairMoments {
+    int32_t count;
+    double mx, my, mu, mv;
+    double sxx, sxy, syy;
+    double sxu, syu, sxv, syv;
+};
+
+static void ComputeMoments(
+    const PointPairs &pts,
+    const uint8_t *mask,
+    PairMoments *mo)
+{
+    int32_t count = 0;
+    double mx = 0, my = 0, mu = 0, mv = 0;
+    for (int32_t i = 0; i < pts.count; ++i) {
+        if (mask == nullptr || mask[i]) {
+            mx += pts.x[i];
+            my += pts.y[i];
+            mu += pts.u[i];
+            mv += pts.v[i];
+            count++;
+        }
+    }
+    memset(mo, 0, sizeof(PairMoments));
+    mo->count = count;
+    if (count == 0) {
+        return;
+    }
+    mo->mx = mx / count;
+    mo->my = my / count;
+    mo->mu = mu / count;
+    mo->mv = mv / count;
+    for (int32_t i = 0; i < pts.count; ++i) {
+        if (mask == nullptr || mask[i]) {
+            double x = pts.x[i] - mo->mx, y = pts.y[i] - mo->my;
+            double u = pts.u[i] - mo->mu, v = pts.v[i] - mo->mv;
+            mo->sxx += x * x;
+            mo->sxy += x * y;
+            mo->syy += y * y;
+            mo->sxu += x * u;
+            mo->syu += y * u;
+            mo->sxv += x * v;
+            mo->syv += y * v;
+        }
+    }
+}
+
+// least squares affine transform, the normal equations of the centered points are a 2x2 system
+static bool FitAffine(
+    const PointPairs &pts,
+    const uint8_t *mask,
+    double *m)
+{
+    PairMoments mo;
+    ComputeMoments(pts, mask, &mo);
+    double det = mo.sxx * mo.syy - mo.sxy * mo.sxy;
+    // the src points are collinear
+    if (mo.count < 3 || det <= FLT_EPSILON * mo.sxx * mo.syy) {
+        return false;
+    }
+    double inv_det = 1.0 / det;
+    m[0]           = (mo.sxu * mo.syy - mo.syu * mo.sxy) * inv_det;
+    m[1]           = (mo.syu * mo.sxx - mo.sxu * mo.sxy) * inv_det;
+    m[3]           = (mo.sxv * mo.syy - mo.syv * mo.sxy) * inv_det;
+    m[4]           = (mo.syv * mo.sxx - mo.sxv * mo.sxy) * inv_det;
+    m[2]           = mo.mu - m[0] * mo.mx - m[1] * mo.my;
+    m[5]           = mo.mv - m[3] * mo.mx - m[4] * mo.my;
+    return true;
+}
+
+// least squares similarity transform, the closed-form Umeyama solution reduces to
+// a = (sxu + syv) / (sxx + syy) and b = (sxv - syu) / (sxx + syy) in 2D
+static bool FitSimilarity(
+    const PointPairs &pts,
+    const uint8_t *mask,
+    double *m)
+{
+    PairMoments mo;
+    ComputeMoments(pts, mask, &mo);
+    double s = mo.sxx + mo.syy;
+    // the src points coincide up to the float precision of their coordinates
+    if (mo.count < 2 || s <= FLT_EPSILON * FLT_EPSILON * (mo.mx * mo.mx + mo.my * mo.my) * mo.count) {
+        return false;
+    }
+    double a = (mo.sxu + mo.syv) / s;
+    double b = (mo.sxv - mo.syu) / s;
+    m[0]     = a;
+    m[1]     = -b;
+    m[2]     = mo.mu - a * mo.mx + b * mo.my;
+    m[3]     = b;
+    m[4]     = a;
+    m[5]     = mo.mv - b * mo.mx - a * mo.my;
+    return true;
+}
+
+static bool Collinear(
+    const double *p)
+{
+    double dx1 = p[2] - p[0], dy1 = p[3] - p[1];
+    double dx2 = p[4] - p[0], dy2 = p[5] - p[1];
+    return fabs(dx2 * dy1 - dy2 * dx1) <= FLT_EPSILON * (fabs(dx1) + fabs(dy1) + fabs(dx2) + fabs(dy2));
+}
+
+static bool Coincident(
+    const double *p)
+{
+    double dx = p[2] - p[0], dy = p[3] - p[1];
+    return dx * dx + dy * dy <= FLT_EPSILON;
+}
+
+// draws model_points distinct pairs that are not degenerate, in the point layout of GetAffineTransform
+static bool DrawSample(
+    const PointPairs &pts,
+    int32_t model_points,
+    SampleRng &rng,
+    double *src,
+    double *dst)
+{
+    for (int32_t attempt = 0; attempt < RANSAC_MAX_SAMPLE_ATTEMPTS; ++attempt) {
+        int32_t idx[3];
+        bool distinct = true;
+        for (int32_t k = 0; k < model_points; ++k) {
+            idx[k] = rng.uniform(pts.count);
+            for (int32_t j = 0; j < k; ++j) {
+                distinct &= idx[j] != idx[k];
+            }
+        }
+        if (!distinct) {
+            continue;
+        }
+        for (int32_t k = 0; k < model_points; ++k) {
+            src[k * 2 + 0] = pts.x[idx[k]];
+            src[k * 2 + 1] = pts.y[idx[k]];
+            dst[k * 2 + 0] = pts.u[idx[k]];
+            dst[k * 2 + 1] = pts.v[idx[k]];
+        }
+        if (model_points == 3 ? !Collinear(src) && !Collinear(dst) : !Coincident(src) && !Coincident(dst)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// the number of iterations needed to draw an outlier free sample with the given confidence, as cv::RANSACUpdateNumIters
+static int32_t RansacUpdateNumIters(
+    double confidence,
+    double outlier_ratio,
+    int32_t model_points,
+    int32_t max_iters)
+{
+    double num   = std::max(1.0 - confidence, DBL_MIN);
+    double denom = 1.0 - pow(1.0 - outlier_ratio, model_points);
+    if (denom < DBL_MIN) {
+        return 0;
+    }
+    num   = log(num);
+    denom = log(denom);
+    return denom >= 0 || -num >= max_iters * (-denom) ? max_iters : (int32_t)lround(num / denom);
+}
+
+static bool Ransac(
+    const PointPairs &pts,
+    bool partial,
+    double thresh,
+    int32_t maxIters,
+    double confidence,
+    double *model,
+    uint8_t *mask,
+    uint8_t *tmp_mask)
+{
+    const int32_t model_points = partial ? 2 : 3;
+    const float thresh2        = (float)(thresh * thresh);
+    SampleRng rng;
+    double hyp_src[6 * RANSAC_HYPOTHESIS_CHUNK];
+    double hyp_dst[6 * RANSAC_HYPOTHESIS_CHUNK];
+    double hyp[6 * RANSAC_HYPOTHESIS_CHUNK];
+    int32_t best_count = 0;
+    int32_t niters     = maxIters;
+    for (int32_t iter = 0; iter < niters;) {
+        const int32_t count = std::min(RANSAC_HYPOTHESIS_CHUNK, niters - iter);
+        int32_t drawn       = 0;
+        while (drawn < count && DrawSample(pts, model_points, rng, hyp_src + drawn * 6, hyp_dst + drawn * 6)) {
+            drawn++;
+        }
+        if (partial) {
+            for (int32_t h = 0; h < drawn; ++h) {
+                const double *s = hyp_src + h * 6, *d = hyp_dst + h * 6;
+                double dx = s[2] - s[0], dy = s[3] - s[1];
+                double du = d[2] - d[0], dv = d[3] - d[1];
+                double inv_s = 1.0 / (dx * dx + dy * dy);
+                double a = (dx * du + dy * dv) * inv_s, b = (dx * dv - dy * du) * inv_s;
+                double *m = hyp + h * 6;
+                m[0]      = a;
+                m[1]      = -b;
+                m[2]      = d[0] - a * s[0] + b * s[1];
+                m[3]      = b;
+                m[4]      = a;
+                m[5]      = d[1] - b * s[0] - a * s[1];
+            }
+        } else if (drawn > 0) {
+            // the triples that still turn out singular are left as zero matrices and skipped below
+            GetAffineTransform(drawn, hyp_src, hyp_dst, hyp, nullptr);
+        }
+        for (int32_t h = 0; h < drawn && iter < niters; ++h, ++iter) {
+            const double *m = hyp + h * 6;
+            if (m[0] == 0 && m[1] == 0 && m[3] == 0 && m[4] == 0) {
+                continue;
+            }
+            int32_t inliers = CountInliers(pts, m, thresh2, nullptr);
+            if (inliers > best_count) {
+                best_count = inliers;
+                memcpy(model, m, 6 * sizeof(double));
+                niters = RansacUpdateNumIters(confidence, (double)(pts.count - inliers) / pts.count, model_points, niters);
+            }
+        }
+        // every remaining sample is degenerate
+        if (drawn < count) {
+            break;
+        }
+    }
+    if (best_count < model_points) {
+        return false;
+    }
+
+    // refit the best hypothesis on its inliers as long as that does not lose any
+    CountInliers(pts, model, thresh2, mask);
+    for (int32_t r = 0; r < RANSAC_REFINE_ITERS; ++r) {
+        double refined[6];
+        if (!(partial ? FitSimilarity(pts, mask, refined) : FitAffine(pts, mask, refined))) {
+            break;
+        }
+        int32_t inliers = CountInliers(pts, refined, thresh2, tmp_mask);
+        if (inliers < best_count) {
+            break;
+        }
+        memcpy(model, refined, 6 * sizeof(double));
+        memcpy(mask, tmp_mask, pts.count);
+        if (inliers == best_count) {
+            break;
+        }
+        best_count = inliers;
+    }
+    return true;
+}
+
+static ::ppl::common::RetCode EstimateTransform2D(
+    bool partial,
+    int32_t num_points,
+    const float *src_points,
+    const float *dst_points,
+    double *affineMatrix,
+    uint8_t *inliers,
+    EstimateMethod method,
+    double ransacReprojThreshold,
+    int32_t maxIters,
+    double confidence)
+{
+    if (num_points < (partial ? 2 : 3) || nullptr == src_points || nullptr == dst_points || nullptr == affineMatrix) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (method != ESTIMATE_LEAST_SQUARES && method != ESTIMATE_RANSAC) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (method == ESTIMATE_RANSAC && (!(ransacReprojThreshold > 0) || maxIters <= 0 || !(confidence >= 0 && confidence <= 1))) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int32_t stride = (num_points + 15) & ~15;
+    float *buffer = (float *)ppl::common::AlignedAlloc(stride * (4 * sizeof(float) + 2), 64);
+    PointPairs pts;
+    pts.count = num_points;
+    pts.x     = buffer;
+    pts.y     = buffer + stride;
+    pts.u     = buffer + stride * 2;
+    pts.v     = buffer + stride * 3;
+    for (int32_t i = 0; i < num_points; ++i) {
+        pts.x[i] = src_points[i * 2 + 0];
+        pts.y[i] = src_points[i * 2 + 1];
+        pts.u[i] = dst_points[i * 2 + 0];
+        pts.v[i] = dst_points[i * 2 + 1];
+    }
+    uint8_t *mask     = (uint8_t *)(buffer + stride * 4);
+    uint8_t *tmp_mask = mask + stride;
+
+    bool found;
+    if (method == ESTIMATE_LEAST_SQUARES) {
+        found = partial ? FitSimilarity(pts, nullptr, affineMatrix) : FitAffine(pts, nullptr, affineMatrix);
+        memset(mask, 1, num_points);
+    } else {
+        found = Ransac(pts, partial, ransacReprojThreshold, maxIters, confidence, affineMatrix, mask, tmp_mask);
+    }
+    if (!found) {
+        memset(affineMatrix, 0, 6 * sizeof(double));
+        memset(mask, 0, num_points);
+    }
+    if (inliers != nullptr) {
+        memcpy(inliers, mask, num_points);
+    }
+    ppl::common::AlignedFree(buffer);
+    return found ? ppl::common::RC_SUCCESS : ppl::common::RC_INVALID_VALUE;
+}
+
+::ppl::common::RetCode EstimateAffine2D(
+    int32_t num_points,
+    const float *src_points,
+    const float *dst_points,
+    double *affineMatrix,
+    uint8_t *inliers,
+    EstimateMethod method,
+    double ransacReprojThreshold,
+    int32_t maxIters,
+    double confidence)
+{
+    return EstimateTransform2D(false, num_points, src_points, dst_points, affineMatrix, inliers, method, ransacReprojThreshold, maxIters, confidence);
+}
+
+::ppl::common::RetCode EstimateAffinePartial2D(
+    int32_t num_points,
+    const float *src_points,
+    const float *dst_points,
+    double *affineMatrix,
+    uint8_t *inliers,
+    EstimateMethod method,
+    double ransacReprojThreshold,
+    int32_t maxIters,
+    double confidence)
+{
+    return EstimateTransform2D(true, num_points, src_points, dst_points, affineMatrix, inliers, method, ransacReprojThreshold, maxIters, confidence);
+}
+
+}
+}
+} // namespace ppl::cv::x86
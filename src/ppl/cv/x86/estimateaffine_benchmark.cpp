@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <opencv2/core.hpp>
+#include "ppl/cv/x86/estimateaffine.h"
+#include "ppl/cv/debug.h"
+#include <math.h>
+#include <memory>
+#include <vector>
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+#include <opencv2/calib3d.hpp>
+#endif //! PPLCV_BENCHMARK_OPENCV
+
+namespace {
+
+// a rotation with scale and shift, with 30 percent of the pairs moved far away
+void GeneratePairs(int32_t num_points, float *src, float *dst) {
+    std::unique_ptr<float[]> noise(new float[num_points * 3]);
+    ppl::cv::debug::randomFill<float>(src, num_points * 2, 0, 640);
+    ppl::cv::debug::randomFill<float>(noise.get(), num_points * 3, 0, 1);
+    const double a = 1.3 * cos(0.3), b = 1.3 * sin(0.3);
+    for (int32_t i = 0; i < num_points; ++i) {
+        float x = src[i * 2], y = src[i * 2 + 1];
+        float *n = noise.get() + i * 3;
+        float outlier = n[2] < 0.3f ? 50.0f : 0.0f;
+        dst[i * 2]     = a * x - b * y + 40 + n[0] - 0.5f + outlier;
+        dst[i * 2 + 1] = b * x + a * y - 17 + n[1] - 0.5f - outlier;
+    }
+}
+
+template<bool partial, ppl::cv::EstimateMethod method>
+void BM_EstimateAffine_ppl_x86(benchmark::State &state) {
+    int32_t num_points = state.range(0);
+    std::unique_ptr<float[]> src(new float[num_points * 2]);
+    std::unique_ptr<float[]> dst(new float[num_points * 2]);
+    std::unique_ptr<uint8_t[]> inliers(new uint8_t[num_points]);
+    GeneratePairs(num_points, src.get(), dst.get());
+    double affine[6];
+    for (auto _ : state) {
+        if (partial) {
+            ppl::cv::x86::EstimateAffinePartial2D(num_points, src.get(), dst.get(), affine, inliers.get(), method);
+        } else {
+            ppl::cv::x86::EstimateAffine2D(num_points, src.get(), dst.get(), affine, inliers.get(), method);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_EstimateAffine_ppl_x86, false, ppl::cv::ESTIMATE_LEAST_SQUARES)->Args({5})->Args({68});
+BENCHMARK_TEMPLATE(BM_EstimateAffine_ppl_x86, true, ppl::cv::ESTIMATE_LEAST_SQUARES)->Args({5})->Args({68});
+BENCHMARK_TEMPLATE(BM_EstimateAffine_ppl_x86, false, ppl::cv::ESTIMATE_RANSAC)->Args({68})->Args({500});
+BENCHMARK_TEMPLATE(BM_EstimateAffine_ppl_x86, true, ppl::cv::ESTIMATE_RANSAC)->Args({68})->Args({500});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<bool partial>
+void BM_EstimateAffine_opencv_x86(benchmark::State &state) {
+    int32_t num_points = state.range(0);
+    std::vector<cv::Point2f> src(num_points), dst(num_points);
+    GeneratePairs(num_points, (float *)src.data(), (float *)dst.data());
+    std::vector<uchar> inliers;
+    for (auto _ : state) {
+        if (partial) {
+            cv::estimateAffinePartial2D(src, dst, inliers, cv::RANSAC);
+        } else {
+            cv::estimateAffine2D(src, dst, inliers, cv::RANSAC);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_EstimateAffine_opencv_x86, false)->Args({68})->Args({500});
+BENCHMARK_TEMPLATE(BM_EstimateAffine_opencv_x86, true)->Args({68})->Args({500});
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
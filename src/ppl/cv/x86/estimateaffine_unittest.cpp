@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/core.hpp>
+#include "ppl/cv/x86/estimateaffine.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <string.h>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+// least squares reference of the pairs selected by mask, solved by cv::solve on the stacked 2N equations
+static void EstimateReference(int32_t num_points, const float *src, const float *dst, const std::vector<uint8_t> &mask, bool partial, double *mat)
+{
+    int32_t unknowns = partial ? 4 : 6;
+    cv::Mat A = cv::Mat::zeros(num_points * 2, unknowns, CV_64F);
+    cv::Mat b = cv::Mat::zeros(num_points * 2, 1, CV_64F);
+    for (int32_t i = 0; i < num_points; ++i) {
+        if (!mask[i]) {
+            continue;
+        }
+        double x = src[i * 2], y = src[i * 2 + 1];
+        double *r0 = A.ptr<double>(i * 2), *r1 = A.ptr<double>(i * 2 + 1);
+        if (partial) {
+            // unknowns a, b, tx, ty of [a -b tx; b a ty]
+            r0[0] = x; r0[1] = -y; r0[2] = 1;
+            r1[0] = y; r1[1] = x;  r1[3] = 1;
+        } else {
+            r0[0] = x; r0[1] = y; r0[2] = 1;
+            r1[3] = x; r1[4] = y; r1[5] = 1;
+        }
+        b.at<double>(i * 2)     = dst[i * 2];
+        b.at<double>(i * 2 + 1) = dst[i * 2 + 1];
+    }
+    cv::Mat p;
+    cv::solve(A, b, p, cv::DECOMP_SVD);
+    const double *q = p.ptr<double>();
+    if (partial) {
+        double ref[6] = {q[0], -q[1], q[2], q[1], q[0], q[3]};
+        memcpy(mat, ref, sizeof(ref));
+    } else {
+        memcpy(mat, q, 6 * sizeof(double));
+    }
+}
+
+void EstimateAffineTest(int32_t num_points, bool partial, ppl::cv::EstimateMethod method, float outlier_ratio)
+{
+    std::unique_ptr<float[]> src(new float[num_points * 2]);
+    std::unique_ptr<float[]> dst(new float[num_points * 2]);
+    std::unique_ptr<float[]> noise(new float[num_points * 3]);
+    std::unique_ptr<uint8_t[]> inliers(new uint8_t[num_points]);
+    std::vector<uint8_t> truth(num_points);
+    ppl::cv::debug::randomFill<float>(src.get(), num_points * 2, 0, 640);
+    ppl::cv::debug::randomFill<float>(noise.get(), num_points * 3, 0, 1);
+    double angle = 0.3, scale = partial ? 1.3 : 1.0;
+    double mat[6] = {scale * cos(angle), -scale * sin(angle), 40, scale * sin(angle), scale * cos(angle), -17};
+    if (!partial) {
+        mat[1] += 0.2;
+        mat[4] -= 0.1;
+    }
+    for (int32_t i = 0; i < num_points; ++i) {
+        float x = src.get()[i * 2], y = src.get()[i * 2 + 1];
+        float *n = noise.get() + i * 3;
+        // inliers get 0.1 pixel of noise, little enough that no minimal sample misses one at a 3 pixel threshold
+        dst.get()[i * 2]     = mat[0] * x + mat[1] * y + mat[2] + (n[0] - 0.5f) * 0.2f;
+        dst.get()[i * 2 + 1] = mat[3] * x + mat[4] * y + mat[5] + (n[1] - 0.5f) * 0.2f;
+        // outliers are moved far beyond the reprojection threshold
+        truth[i] = n[2] >= outlier_ratio;
+        if (!truth[i]) {
+            dst.get()[i * 2] += 30 + 100 * n[0];
+            dst.get()[i * 2 + 1] -= 30 + 100 * n[1];
+        }
+    }
+
+    double affine[6];
+    ppl::common::RetCode rst;
+    if (partial) {
+        rst = ppl::cv::x86::EstimateAffinePartial2D(num_points, src.get(), dst.get(), affine, inliers.get(), method, 3.0);
+    } else {
+        rst = ppl::cv::x86::EstimateAffine2D(num_points, src.get(), dst.get(), affine, inliers.get(), method, 3.0);
+    }
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    if (method == ppl::cv::ESTIMATE_LEAST_SQUARES) {
+        std::fill(truth.begin(), truth.end(), 1);
+    }
+    for (int32_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(inliers.get()[i], truth[i]);
+    }
+    double ref[6];
+    EstimateReference(num_points, src.get(), dst.get(), truth, partial, ref);
+    for (int32_t i = 0; i < 6; ++i) {
+        // translations are about 640 times the size of the linear part
+        EXPECT_LT(fabs(affine[i] - ref[i]), i % 3 == 2 ? 1e-3 : 1e-5);
+    }
+}
+
+#define R(name, partial, method, outlier_ratio) \
+    TEST(name, x86) \
+    { \
+        EstimateAffineTest(partial ? 2 : 3, partial, method, 0.0f); \
+        EstimateAffineTest(5, partial, method, 0.0f); \
+        EstimateAffineTest(68, partial, method, outlier_ratio); \
+        EstimateAffineTest(500, partial, method, outlier_ratio); \
+    } \
+
+R(ESTIMATE_AFFINE_LS, false, ppl::cv::ESTIMATE_LEAST_SQUARES, 0.0f);
+R(ESTIMATE_AFFINE_RANSAC, false, ppl::cv::ESTIMATE_RANSAC, 0.4f);
+R(ESTIMATE_AFFINE_PARTIAL_LS, true, ppl::cv::ESTIMATE_LEAST_SQUARES, 0.0f);
+R(ESTIMATE_AFFINE_PARTIAL_RANSAC, true, ppl::cv::ESTIMATE_RANSAC, 0.4f);
+
+TEST(ESTIMATE_AFFINE_DEGENERATE, x86)
+{
+    // collinear src points have no affine transform, but a similarity transform
+    float src[8] = {0, 0, 1, 1, 2, 2, 3, 3};
+    float dst[8] = {1, 0, 2, 1, 3, 2, 4, 3};
+    double affine[6];
+    uint8_t inliers[4];
+    EXPECT_EQ(ppl::cv::x86::EstimateAffine2D(4, src, dst, affine, inliers, ppl::cv::ESTIMATE_LEAST_SQUARES), ppl::common::RC_INVALID_VALUE);
+    EXPECT_EQ(ppl::cv::x86::EstimateAffine2D(4, src, dst, affine, inliers, ppl::cv::ESTIMATE_RANSAC), ppl::common::RC_INVALID_VALUE);
+    for (int32_t i = 0; i < 6; ++i) {
+        EXPECT_EQ(affine[i], 0.0);
+    }
+    for (int32_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(inliers[i], 0);
+    }
+    EXPECT_EQ(ppl::cv::x86::EstimateAffinePartial2D(4, src, dst, affine, inliers, ppl::cv::ESTIMATE_RANSAC), ppl::common::RC_SUCCESS);
+    double ref[6] = {1, 0, 1, 0, 1, 0};
+    for (int32_t i = 0; i < 6; ++i) {
+        EXPECT_LT(fabs(affine[i] - ref[i]), 1e-6);
+    }
+}
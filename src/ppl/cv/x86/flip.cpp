@@ -156,8 +156,17 @@ namespace x86 {
         case 3:
             for (int32_t i = 0; i < height; ++i) {
                 for (int32_t j = 0; j < width; ++j) {
-                    __m128 right0 = _mm_loadu_ps(src + (height - i - 1) * inWidthStride + (width - j - 1) * channels);
-                    _mm_storeu_ps(dst + i * outWidthStride + j * channels, right0);
+                    const float *right = src + (height - i - 1) * inWidthStride + (width - j - 1) * channels;
+                    float *left        = dst + i * outWidthStride + j * channels;
+                    // a 4-float move also reads the pixel after right and writes the pixel after left,
+                    // both stay inside the rows except for the first and the last pixel
+                    if (j > 0 && j < width - 1) {
+                        _mm_storeu_ps(left, _mm_loadu_ps(right));
+                    } else {
+                        left[0] = right[0];
+                        left[1] = right[1];
+                        left[2] = right[2];
+                    }
                 }
             }
             break;
@@ -252,8 +261,7 @@ namespace x86 {
         case 4: {
             for (int32_t i = 0; i < height; ++i) {
                 for (int32_t j = 0; j < width; ++j) {
-                    uint32_t left                                                              = ((uint32_t *)src)[i * inWidthStride / sizeof(uint32_t) + j];
-                    ((uint32_t *)dst)[i * outWidthStride / sizeof(uint32_t) + (width - j - 1)] = left;
+                    memcpy(dst + i * outWidthStride + (width - j - 1) * channels, src + i * inWidthStride + j * channels, channels);
                 }
             }
             break;
@@ -335,18 +343,19 @@ namespace x86 {
                     _mm_storeu_ps((float *)(dst + (height - 1 - i) * outWidthStride + (width - j - 4) * channels), up_left);
                 }
                 for (; j < width; ++j) {
-                    uint32_t up_left                                                                          = ((uint32_t *)src)[i * inWidthStride / sizeof(uint32_t) + j];
-                    ((uint32_t *)dst)[(height - i - 1) * outWidthStride / sizeof(uint32_t) + (width - j - 1)] = up_left;
+                    memcpy(dst + (height - i - 1) * outWidthStride + (width - j - 1) * channels, src + i * inWidthStride + j * channels, channels);
                 }
             }
             break;
         }
         case 3: {
-            __m128i v_index = _mm_setr_epi8(12, 13, 14, 9, 10, 11, 6, 7, 8, 3, 4, 5, 0, 1, 2, -1);
+            // the 16 bytes end at the last byte of the 5 pixels read and the 16th byte written is the
+            // pixel after them, so both stay inside the rows while 6 pixels are left
+            __m128i v_index = _mm_setr_epi8(13, 14, 15, 10, 11, 12, 7, 8, 9, 4, 5, 6, 1, 2, 3, -1);
             for (int32_t i = 0; i < height; ++i) {
                 int32_t j = 0;
-                for (; j <= width - 5; j += 5) {
-                    __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + (height - i - 1) * inWidthStride + (width - j - 5) * channels));
+                for (; j <= width - 6; j += 5) {
+                    __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + (height - i - 1) * inWidthStride + (width - j - 5) * channels - 1));
                     right         = _mm_shuffle_epi8(right, v_index);
                     _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * outWidthStride + j * channels), right);
                 }
@@ -0,0 +1,193 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include <stdint.h>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+static inline uint8_t threshold_mask(bool cond, uint8_t imaxval, int32_t thresholdType)
+{
+    return (cond ^ (thresholdType == THRESH_BINARY_INV)) ? imaxval : 0;
+}
+
+// packs 4 x 8 int32 compare masks of 32 consecutive pixels into 32 bytes
+static inline __m256i pack_mask_32x8(__m256i m0, __m256i m1, __m256i m2, __m256i m3)
+{
+    __m256i v_dst = _mm256_packs_epi16(_mm256_packs_epi32(m0, m1), _mm256_packs_epi32(m2, m3));
+    return _mm256_permutevar8x32_epi32(v_dst, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+void adaptivethreshold_colsum_update_fma(
+    int32_t width,
+    const uint8_t *add_row,
+    const uint8_t *sub_row,
+    int32_t *colsum)
+{
+    int32_t x = 0;
+    for (; x <= width - 16; x += 16) {
+        __m256i v_diff = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(add_row + x))),
+                                          _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(sub_row + x))));
+        __m256i *p     = (__m256i *)(colsum + x);
+        _mm256_storeu_si256(p + 0, _mm256_add_epi32(_mm256_loadu_si256(p + 0), _mm256_cvtepi16_epi32(_mm256_castsi256_si128(v_diff))));
+        _mm256_storeu_si256(p + 1, _mm256_add_epi32(_mm256_loadu_si256(p + 1), _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v_diff, 1))));
+    }
+    for (; x < width; ++x) {
+        colsum[x] += add_row[x] - sub_row[x];
+    }
+}
+
+// area * u > 2 * sum in int64 for 8 lanes of int32 u and uint32 sum, as int32 masks
+static inline __m256i mean_compare_epi64(__m256i v_u, __m256i v_sum, __m256i v_area)
+{
+    __m256i v_lhs0 = _mm256_mul_epi32(v_u, v_area);
+    __m256i v_lhs1 = _mm256_mul_epi32(_mm256_srli_epi64(v_u, 32), v_area);
+    __m256i v_rhs0 = _mm256_slli_epi64(_mm256_and_si256(v_sum, _mm256_set1_epi64x(0xFFFFFFFFLL)), 1);
+    __m256i v_rhs1 = _mm256_slli_epi64(_mm256_srli_epi64(v_sum, 32), 1);
+    __m256i v_gt0  = _mm256_cmpgt_epi64(v_lhs0, v_rhs0);
+    __m256i v_gt1  = _mm256_cmpgt_epi64(v_lhs1, v_rhs1);
+    return _mm256_blend_epi32(v_gt0, v_gt1, 0xAA);
+}
+
+void adaptivethreshold_mean_row_fma(
+    int32_t width,
+    int32_t ksize,
+    const uint32_t *prefix,
+    const uint8_t *src,
+    int32_t idelta,
+    uint8_t imaxval,
+    int32_t thresholdType,
+    uint8_t *dst)
+{
+    const int32_t area = ksize * ksize;
+    const int32_t bias = 2 * idelta - 1;
+    __m256i v_area     = _mm256_set1_epi32(area);
+    __m256i v_bias     = _mm256_set1_epi32(bias);
+    __m256i v_maxval   = _mm256_set1_epi8(static_cast<char>(imaxval));
+    int32_t x          = 0;
+    for (; x <= width - 32; x += 32) {
+        __m256i v_mask[4];
+        for (int32_t k = 0; k < 4; ++k) {
+            int32_t xk    = x + 8 * k;
+            __m256i v_sum = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i *)(prefix + xk + ksize)),
+                                             _mm256_loadu_si256((const __m256i *)(prefix + xk)));
+            __m256i v_src = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(src + xk)));
+            __m256i v_u   = _mm256_add_epi32(_mm256_slli_epi32(v_src, 1), v_bias);
+            v_mask[k]     = mean_compare_epi64(v_u, v_sum, v_area);
+        }
+        __m256i v_dst = pack_mask_32x8(v_mask[0], v_mask[1], v_mask[2], v_mask[3]);
+        if (thresholdType == THRESH_BINARY) {
+            v_dst = _mm256_and_si256(v_dst, v_maxval);
+        } else {
+            v_dst = _mm256_andnot_si256(v_dst, v_maxval);
+        }
+        _mm256_storeu_si256((__m256i *)(dst + x), v_dst);
+    }
+    for (; x < width; ++x) {
+        uint32_t sum = prefix[x + ksize] - prefix[x];
+        dst[x]       = threshold_mask((int64_t)area * (2 * src[x] + bias) > 2 * (int64_t)sum, imaxval, thresholdType);
+    }
+}
+
+void adaptivethreshold_gaussian_row_fma(
+    int32_t width,
+    int32_t ksize,
+    const float *kernel,
+    const float *src,
+    float *dst)
+{
+    const int32_t radius = ksize / 2;
+    int32_t x            = 0;
+    for (; x <= width - 8; x += 8) {
+        __m256 v_acc = _mm256_mul_ps(_mm256_set1_ps(kernel[radius]), _mm256_loadu_ps(src + x + radius));
+        for (int32_t k = 0; k < radius; ++k) {
+            __m256 v_pair = _mm256_add_ps(_mm256_loadu_ps(src + x + k), _mm256_loadu_ps(src + x + ksize - 1 - k));
+            v_acc         = _mm256_fmadd_ps(_mm256_set1_ps(kernel[k]), v_pair, v_acc);
+        }
+        _mm256_storeu_ps(dst + x, v_acc);
+    }
+    for (; x < width; ++x) {
+        float acc = kernel[radius] * src[x + radius];
+        for (int32_t k = 0; k < radius; ++k) {
+            acc += kernel[k] * (src[x + k] + src[x + ksize - 1 - k]);
+        }
+        dst[x] = acc;
+    }
+}
+
+void adaptivethreshold_gaussian_col_fma(
+    int32_t width,
+    int32_t ksize,
+    const float *kernel,
+    const float **rows,
+    const uint8_t *src,
+    int32_t idelta,
+    uint8_t imaxval,
+    int32_t thresholdType,
+    uint8_t *dst)
+{
+    const int32_t radius = ksize / 2;
+    __m256i v_idelta     = _mm256_set1_epi32(idelta);
+    __m256i v_maxval     = _mm256_set1_epi8(static_cast<char>(imaxval));
+    int32_t x            = 0;
+    for (; x <= width - 32; x += 32) {
+        __m256 v_acc[4];
+        __m256 v_center = _mm256_set1_ps(kernel[radius]);
+        for (int32_t i = 0; i < 4; ++i) {
+            v_acc[i] = _mm256_mul_ps(v_center, _mm256_loadu_ps(rows[radius] + x + 8 * i));
+        }
+        for (int32_t k = 0; k < radius; ++k) {
+            __m256 v_coeff   = _mm256_set1_ps(kernel[k]);
+            const float *r0 = rows[k] + x;
+            const float *r1 = rows[ksize - 1 - k] + x;
+            for (int32_t i = 0; i < 4; ++i) {
+                __m256 v_pair = _mm256_add_ps(_mm256_loadu_ps(r0 + 8 * i), _mm256_loadu_ps(r1 + 8 * i));
+                v_acc[i]      = _mm256_fmadd_ps(v_coeff, v_pair, v_acc[i]);
+            }
+        }
+        __m256i v_mask[4];
+        for (int32_t i = 0; i < 4; ++i) {
+            __m256i v_src = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(src + x + 8 * i)));
+            v_mask[i]     = _mm256_cmpgt_epi32(_mm256_add_epi32(v_src, v_idelta), _mm256_cvtps_epi32(v_acc[i]));
+        }
+        __m256i v_dst = pack_mask_32x8(v_mask[0], v_mask[1], v_mask[2], v_mask[3]);
+        if (thresholdType == THRESH_BINARY) {
+            v_dst = _mm256_and_si256(v_dst, v_maxval);
+        } else {
+            v_dst = _mm256_andnot_si256(v_dst, v_maxval);
+        }
+        _mm256_storeu_si256((__m256i *)(dst + x), v_dst);
+    }
+    for (; x < width; ++x) {
+        float acc = kernel[radius] * rows[radius][x];
+        for (int32_t k = 0; k < radius; ++k) {
+            acc += kernel[k] * (rows[k][x] + rows[ksize - 1 - k][x]);
+        }
+        int32_t mean = _mm_cvtss_si32(_mm_set_ss(acc));
+        dst[x]       = threshold_mask(src[x] + idelta > mean, imaxval, thresholdType);
+    }
+}
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/x86/color_intrin.hpp"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include <immintrin.h>
+#include <algorithm>
+
+#define CY_coeff  1220542
+#define CUB_coeff 2116026
+#define CUG_coeff -409993
+#define CVG_coeff -852492
+#define CVR_coeff 1673527
+#define SHIFT     20
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+template <int32_t dstcn, bool isUYVY>
+void yuv422_2_bgr(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const int8_t yo = isUYVY ? 1 : 0;
+    const int8_t uo = isUYVY ? 0 : 1;
+    const int8_t vo = isUYVY ? 2 : 3;
+    // per 128-bit lane, pixels 0..3 and 4..7 of the lane as 32-bit values
+    __m256i my[2], mu[2], mv[2];
+    for (int32_t k = 0; k < 2; ++k) {
+        const int8_t o = k * 8;
+        my[k]          = _mm256_setr_epi8(o + yo, -1, -1, -1, o + yo + 2, -1, -1, -1, o + yo + 4, -1, -1, -1, o + yo + 6, -1, -1, -1,
+                                 o + yo, -1, -1, -1, o + yo + 2, -1, -1, -1, o + yo + 4, -1, -1, -1, o + yo + 6, -1, -1, -1);
+        mu[k]          = _mm256_setr_epi8(o + uo, -1, -1, -1, o + uo, -1, -1, -1, o + uo + 4, -1, -1, -1, o + uo + 4, -1, -1, -1,
+                                 o + uo, -1, -1, -1, o + uo, -1, -1, -1, o + uo + 4, -1, -1, -1, o + uo + 4, -1, -1, -1);
+        mv[k]          = _mm256_setr_epi8(o + vo, -1, -1, -1, o + vo, -1, -1, -1, o + vo + 4, -1, -1, -1, o + vo + 4, -1, -1, -1,
+                                 o + vo, -1, -1, -1, o + vo, -1, -1, -1, o + vo + 4, -1, -1, -1, o + vo + 4, -1, -1, -1);
+    }
+    const __m256i v_cy   = _mm256_set1_epi32(CY_coeff);
+    const __m256i v_cub  = _mm256_set1_epi32(CUB_coeff);
+    const __m256i v_cug  = _mm256_set1_epi32(CUG_coeff);
+    const __m256i v_cvg  = _mm256_set1_epi32(CVG_coeff);
+    const __m256i v_cvr  = _mm256_set1_epi32(CVR_coeff);
+    const __m256i v_16   = _mm256_set1_epi32(16);
+    const __m256i v_128  = _mm256_set1_epi32(128);
+    const __m256i v_half = _mm256_set1_epi32(1 << (SHIFT - 1));
+    const __m256i zero   = _mm256_setzero_si256();
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 16; j += 16) {
+            __m256i s = _mm256_loadu_si256((const __m256i *)(src + j * 2));
+            __m256i b[2], g[2], r[2];
+            for (int32_t k = 0; k < 2; ++k) {
+                __m256i y   = _mm256_mullo_epi32(_mm256_max_epi32(_mm256_sub_epi32(_mm256_shuffle_epi8(s, my[k]), v_16), zero), v_cy);
+                __m256i u   = _mm256_sub_epi32(_mm256_shuffle_epi8(s, mu[k]), v_128);
+                __m256i v   = _mm256_sub_epi32(_mm256_shuffle_epi8(s, mv[k]), v_128);
+                __m256i buv = _mm256_add_epi32(v_half, _mm256_mullo_epi32(u, v_cub));
+                __m256i guv = _mm256_add_epi32(v_half, _mm256_add_epi32(_mm256_mullo_epi32(v, v_cvg), _mm256_mullo_epi32(u, v_cug)));
+                __m256i ruv = _mm256_add_epi32(v_half, _mm256_mullo_epi32(v, v_cvr));
+                b[k]        = _mm256_srai_epi32(_mm256_add_epi32(y, buv), SHIFT);
+                g[k]        = _mm256_srai_epi32(_mm256_add_epi32(y, guv), SHIFT);
+                r[k]        = _mm256_srai_epi32(_mm256_add_epi32(y, ruv), SHIFT);
+            }
+            // lanes hold pixels {0..3, 8..11} and {4..7, 12..15}, packing per lane puts them back in order
+            __m256i bb = _mm256_packs_epi32(b[0], b[1]);
+            __m256i gg = _mm256_packs_epi32(g[0], g[1]);
+            __m256i rr = _mm256_packs_epi32(r[0], r[1]);
+            bb         = _mm256_permute4x64_epi64(_mm256_packus_epi16(bb, bb), 0x08);
+            gg         = _mm256_permute4x64_epi64(_mm256_packus_epi16(gg, gg), 0x08);
+            rr         = _mm256_permute4x64_epi64(_mm256_packus_epi16(rr, rr), 0x08);
+            store_bgr_u8<dstcn, 0>(dst + j * dstcn, _mm256_castsi256_si128(bb), _mm256_castsi256_si128(gg), _mm256_castsi256_si128(rr));
+        }
+        for (; j < width; j += 2) {
+            const uint8_t *p = src + j * 2;
+            uint8_t *q       = dst + j * dstcn;
+            const int32_t u  = int32_t(p[uo]) - 128;
+            const int32_t v  = int32_t(p[vo]) - 128;
+            int32_t ruv      = (1 << (SHIFT - 1)) + CVR_coeff * v;
+            int32_t guv      = (1 << (SHIFT - 1)) + CVG_coeff * v + CUG_coeff * u;
+            int32_t buv      = (1 << (SHIFT - 1)) + CUB_coeff * u;
+            for (int32_t k = 0; k < 2 && j + k < width; ++k) {
+                int32_t y          = std::max(0, int32_t(p[yo + k * 2]) - 16) * CY_coeff;
+                q[k * dstcn + 0]   = sat_cast_u8((y + buv) >> SHIFT);
+                q[k * dstcn + 1]   = sat_cast_u8((y + guv) >> SHIFT);
+                q[k * dstcn + 2]   = sat_cast_u8((y + ruv) >> SHIFT);
+                if (dstcn == 4) {
+                    q[k * dstcn + 3] = 255;
+                }
+            }
+        }
+    }
+}
+
+template void yuv422_2_bgr<3, true>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void yuv422_2_bgr<3, false>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void yuv422_2_bgr<4, true>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void yuv422_2_bgr<4, false>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -0,0 +1,198 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+template <int32_t ncSrc, int32_t ncDst, bool swap>
+static inline void reorder_pixel(const uint8_t *src, uint8_t *dst)
+{
+    uint8_t c0 = src[0], c1 = src[1], c2 = src[2];
+    uint8_t c3 = ncSrc == 4 ? src[3] : 255;
+    dst[0]     = swap ? c2 : c0;
+    dst[1]     = c1;
+    dst[2]     = swap ? c0 : c2;
+    if (ncDst == 4) {
+        dst[3] = c3;
+    }
+}
+
+static inline __m256i v_mask2(__m128i lo, __m128i hi)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+// 96-byte blocks. Output lane k takes bytes from input lanes k - 1, k and k + 1,
+// the neighbours are brought in with vperm2i128, the masks repeat every 3 lanes.
+static void bgr2rgb_row(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    const __m128i none = _mm_set1_epi8(-1);
+    const __m128i m00  = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, -1);
+    const __m128i m01  = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1);
+    const __m128i m10  = _mm_setr_epi8(-1, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i m11  = _mm_setr_epi8(0, -1, 4, 3, 2, 7, 6, 5, 10, 9, 8, 13, 12, 11, -1, 15);
+    const __m128i m12  = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1);
+    const __m128i m21  = _mm_setr_epi8(14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i m22  = _mm_setr_epi8(-1, 3, 2, 1, 6, 5, 4, 9, 8, 7, 12, 11, 10, 15, 14, 13);
+
+    const __m256i ma0 = v_mask2(m00, m11), ma1 = v_mask2(m01, m10), ma2 = v_mask2(none, m12);
+    const __m256i mb0 = v_mask2(m22, m00), mb1 = v_mask2(m21, m01);
+    const __m256i mc0 = v_mask2(m11, m22), mc1 = v_mask2(m10, m21), mc2 = v_mask2(m12, none);
+    int32_t j = 0;
+    for (; j <= width - 32; j += 32) {
+        __m256i a  = _mm256_loadu_si256((const __m256i *)(src + j * 3));
+        __m256i b  = _mm256_loadu_si256((const __m256i *)(src + j * 3 + 32));
+        __m256i c  = _mm256_loadu_si256((const __m256i *)(src + j * 3 + 64));
+        __m256i oa = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, ma0),
+                                                     _mm256_shuffle_epi8(_mm256_permute2x128_si256(a, a, 0x01), ma1)),
+                                     _mm256_shuffle_epi8(_mm256_permute2x128_si256(a, b, 0x20), ma2));
+        __m256i ob = _mm256_or_si256(_mm256_shuffle_epi8(b, mb0),
+                                     _mm256_shuffle_epi8(_mm256_permute2x128_si256(a, c, 0x21), mb1));
+        __m256i oc = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(c, mc0),
+                                                     _mm256_shuffle_epi8(_mm256_permute2x128_si256(b, c, 0x21), mc1)),
+                                     _mm256_shuffle_epi8(_mm256_permute2x128_si256(c, c, 0x01), mc2));
+        _mm256_storeu_si256((__m256i *)(dst + j * 3), oa);
+        _mm256_storeu_si256((__m256i *)(dst + j * 3 + 32), ob);
+        _mm256_storeu_si256((__m256i *)(dst + j * 3 + 64), oc);
+    }
+    for (; j < width; ++j) {
+        reorder_pixel<3, 3, true>(src + j * 3, dst + j * 3);
+    }
+}
+
+template <bool swap>
+static void bgra2bgra_row(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    const __m256i m = swap ? _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                              2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15)
+                           : _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                              0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    int32_t j = 0;
+    for (; j <= width - 16; j += 16) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(src + j * 4));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(src + j * 4 + 32));
+        _mm256_storeu_si256((__m256i *)(dst + j * 4), _mm256_shuffle_epi8(a, m));
+        _mm256_storeu_si256((__m256i *)(dst + j * 4 + 32), _mm256_shuffle_epi8(b, m));
+    }
+    for (; j < width; ++j) {
+        reorder_pixel<4, 4, swap>(src + j * 4, dst + j * 4);
+    }
+}
+
+// 48 bytes in, 64 bytes out. vpermd moves bytes 12..27 of a 32-byte load into the
+// high lane so that each lane holds four whole pixels before the in-lane pshufb.
+template <bool swap>
+static void bgr2bgra_row(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    const __m256i m = swap ? _mm256_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1,
+                                              2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+                           : _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+                                              0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i idx   = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+    const __m256i alpha = _mm256_set1_epi32(0xff000000);
+    int32_t j           = 0;
+    // the second load reads 8 bytes past the 48 converted ones
+    for (; j <= width - 19; j += 16) {
+        __m256i a = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)(src + j * 3)), idx);
+        __m256i b = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)(src + j * 3 + 24)), idx);
+        _mm256_storeu_si256((__m256i *)(dst + j * 4), _mm256_or_si256(_mm256_shuffle_epi8(a, m), alpha));
+        _mm256_storeu_si256((__m256i *)(dst + j * 4 + 32), _mm256_or_si256(_mm256_shuffle_epi8(b, m), alpha));
+    }
+    for (; j < width; ++j) {
+        reorder_pixel<3, 4, swap>(src + j * 3, dst + j * 4);
+    }
+}
+
+// 64 bytes in, 48 bytes out, the in-lane pshufb leaves 12 bytes per lane and
+// vpermd packs the 24 valid bytes of both registers together
+template <bool swap>
+static void bgra2bgr_row(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    const __m256i m = swap ? _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                              2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+                           : _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+                                              0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    const __m256i idx_a = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    const __m256i idx_b = _mm256_setr_epi32(2, 4, 5, 6, 7, 7, 0, 1);
+    int32_t j           = 0;
+    for (; j <= width - 16; j += 16) {
+        __m256i a = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(src + j * 4)), m);
+        __m256i b = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(src + j * 4 + 32)), m);
+        a         = _mm256_permutevar8x32_epi32(a, idx_a);
+        b         = _mm256_permutevar8x32_epi32(b, idx_b);
+        _mm256_storeu_si256((__m256i *)(dst + j * 3), _mm256_blend_epi32(a, b, 0xc0));
+        _mm_storeu_si128((__m128i *)(dst + j * 3 + 32), _mm256_castsi256_si128(b));
+    }
+    for (; j < width; ++j) {
+        reorder_pixel<4, 3, swap>(src + j * 4, dst + j * 3);
+    }
+}
+
+template <int32_t ncSrc, int32_t ncDst, bool swap>
+void reorder_u8_row(const uint8_t *src, uint8_t *dst, int32_t width)
+{
+    if (ncSrc == 3 && ncDst == 3) {
+        bgr2rgb_row(src, dst, width);
+    } else if (ncSrc == 4 && ncDst == 4) {
+        bgra2bgra_row<swap>(src, dst, width);
+    } else if (ncSrc == 3) {
+        bgr2bgra_row<swap>(src, dst, width);
+    } else {
+        bgra2bgr_row<swap>(src, dst, width);
+    }
+}
+
+template void reorder_u8_row<3, 4, false>(
+    const uint8_t *src,
+    uint8_t *dst,
+    int32_t width);
+
+template void reorder_u8_row<3, 4, true>(
+    const uint8_t *src,
+    uint8_t *dst,
+    int32_t width);
+
+template void reorder_u8_row<4, 3, false>(
+    const uint8_t *src,
+    uint8_t *dst,
+    int32_t width);
+
+template void reorder_u8_row<4, 3, true>(
+    const uint8_t *src,
+    uint8_t *dst,
+    int32_t width);
+
+template void reorder_u8_row<3, 3, true>(
+    const uint8_t *src,
+    uint8_t *dst,
+    int32_t width);
+
+template void reorder_u8_row<4, 4, true>(
+    const uint8_t *src,
+    uint8_t *dst,
+    int32_t width);
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -0,0 +1,245 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/x86/fma/intrinutils_fma.hpp"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include <immintrin.h>
+
+// BT.601 full range, Q14 like OpenCV, same as the SSE path
+#define YCRCB_SHIFT 14
+#define YCRCB_HALF  (1 << (YCRCB_SHIFT - 1))
+#define YCRCB_DELTA (128 << YCRCB_SHIFT)
+#define C_R2Y       4899
+#define C_G2Y       9617
+#define C_B2Y       1868
+#define C_CR        11682
+#define C_CB        9241
+#define C_CR2R      22987
+#define C_CB2B      29049
+#define C_CR2G      -11698
+#define C_CB2G      -5636
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+static inline __m256i v_pair_coeff(int32_t c0, int32_t c1)
+{
+    return _mm256_set1_epi32((int32_t)(((uint32_t)(uint16_t)c1 << 16) | (uint16_t)c0));
+}
+
+// 16 pixels as 16-bit lanes, the unpacks work per 128-bit lane and the packs
+// put every lane back in the same order
+static inline void bgr2ycrcb_u8_half(__m256i b, __m256i g, __m256i r, __m256i &y, __m256i &cr, __m256i &cb)
+{
+    const __m256i c_rg  = v_pair_coeff(C_R2Y, C_G2Y);
+    const __m256i c_b1  = v_pair_coeff(C_B2Y, YCRCB_HALF);
+    const __m256i c_cr  = v_pair_coeff(C_CR, YCRCB_HALF);
+    const __m256i c_cb  = v_pair_coeff(C_CB, YCRCB_HALF);
+    const __m256i v_one = _mm256_set1_epi16(1);
+    const __m256i v_257 = _mm256_set1_epi16(257);
+    __m256i rg_lo       = _mm256_unpacklo_epi16(r, g);
+    __m256i rg_hi       = _mm256_unpackhi_epi16(r, g);
+    __m256i b1_lo       = _mm256_unpacklo_epi16(b, v_one);
+    __m256i b1_hi       = _mm256_unpackhi_epi16(b, v_one);
+    __m256i y_lo        = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(rg_lo, c_rg), _mm256_madd_epi16(b1_lo, c_b1)), YCRCB_SHIFT);
+    __m256i y_hi        = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(rg_hi, c_rg), _mm256_madd_epi16(b1_hi, c_b1)), YCRCB_SHIFT);
+    y                   = _mm256_packs_epi32(y_lo, y_hi);
+    __m256i ry          = _mm256_sub_epi16(r, y);
+    __m256i by          = _mm256_sub_epi16(b, y);
+    // 257 * 8192 == YCRCB_DELTA + YCRCB_HALF
+    __m256i cr_lo       = _mm256_srai_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(ry, v_257), c_cr), YCRCB_SHIFT);
+    __m256i cr_hi       = _mm256_srai_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(ry, v_257), c_cr), YCRCB_SHIFT);
+    __m256i cb_lo       = _mm256_srai_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(by, v_257), c_cb), YCRCB_SHIFT);
+    __m256i cb_hi       = _mm256_srai_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(by, v_257), c_cb), YCRCB_SHIFT);
+    cr                  = _mm256_packs_epi32(cr_lo, cr_hi);
+    cb                  = _mm256_packs_epi32(cb_lo, cb_hi);
+}
+
+template <int32_t ncSrc, int32_t bIdx>
+void bgr2ycrcb_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 32; j += 32) {
+            __m256i c0, c1, c2, c3, y0, y1, cr0, cr1, cb0, cb1;
+            if (ncSrc == 3) {
+                v_load_deinterleave(src + j * 3, c0, c1, c2);
+            } else {
+                v_load_deinterleave(src + j * 4, c0, c1, c2, c3);
+            }
+            __m256i b = bIdx == 0 ? c0 : c2;
+            __m256i r = bIdx == 0 ? c2 : c0;
+            bgr2ycrcb_u8_half(_mm256_unpacklo_epi8(b, zero), _mm256_unpacklo_epi8(c1, zero), _mm256_unpacklo_epi8(r, zero), y0, cr0, cb0);
+            bgr2ycrcb_u8_half(_mm256_unpackhi_epi8(b, zero), _mm256_unpackhi_epi8(c1, zero), _mm256_unpackhi_epi8(r, zero), y1, cr1, cb1);
+            v_store_interleave(dst + j * 3, _mm256_packus_epi16(y0, y1), _mm256_packus_epi16(cr0, cr1), _mm256_packus_epi16(cb0, cb1));
+        }
+        for (; j < width; ++j) {
+            const uint8_t *p = src + j * ncSrc;
+            int32_t b = p[bIdx], g = p[1], r = p[bIdx ^ 2];
+            int32_t y        = (r * C_R2Y + g * C_G2Y + b * C_B2Y + YCRCB_HALF) >> YCRCB_SHIFT;
+            dst[j * 3 + 0]   = sat_cast_u8(y);
+            dst[j * 3 + 1]   = sat_cast_u8(((r - y) * C_CR + YCRCB_DELTA + YCRCB_HALF) >> YCRCB_SHIFT);
+            dst[j * 3 + 2]   = sat_cast_u8(((b - y) * C_CB + YCRCB_DELTA + YCRCB_HALF) >> YCRCB_SHIFT);
+        }
+    }
+}
+
+// 16 pixels as 16-bit lanes, cr and cb are already centered
+static inline void ycrcb2bgr_u8_half(__m256i y, __m256i cr, __m256i cb, __m256i &b, __m256i &g, __m256i &r)
+{
+    const __m256i c_cb1  = v_pair_coeff(C_CB2B, YCRCB_HALF);
+    const __m256i c_cr1  = v_pair_coeff(C_CR2R, YCRCB_HALF);
+    const __m256i c_crcb = v_pair_coeff(C_CR2G, C_CB2G);
+    const __m256i v_half = _mm256_set1_epi32(YCRCB_HALF);
+    const __m256i v_one  = _mm256_set1_epi16(1);
+    __m256i crcb_lo      = _mm256_unpacklo_epi16(cr, cb);
+    __m256i crcb_hi      = _mm256_unpackhi_epi16(cr, cb);
+    __m256i db_lo        = _mm256_srai_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(cb, v_one), c_cb1), YCRCB_SHIFT);
+    __m256i db_hi        = _mm256_srai_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(cb, v_one), c_cb1), YCRCB_SHIFT);
+    __m256i dr_lo        = _mm256_srai_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(cr, v_one), c_cr1), YCRCB_SHIFT);
+    __m256i dr_hi        = _mm256_srai_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(cr, v_one), c_cr1), YCRCB_SHIFT);
+    __m256i dg_lo        = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(crcb_lo, c_crcb), v_half), YCRCB_SHIFT);
+    __m256i dg_hi        = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(crcb_hi, c_crcb), v_half), YCRCB_SHIFT);
+    b                    = _mm256_add_epi16(y, _mm256_packs_epi32(db_lo, db_hi));
+    g                    = _mm256_add_epi16(y, _mm256_packs_epi32(dg_lo, dg_hi));
+    r                    = _mm256_add_epi16(y, _mm256_packs_epi32(dr_lo, dr_hi));
+}
+
+template <int32_t ncDst, int32_t bIdx>
+void ycrcb2bgr_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const __m256i zero  = _mm256_setzero_si256();
+    const __m256i v_128 = _mm256_set1_epi16(128);
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 32; j += 32) {
+            __m256i y, cr, cb, b0, b1, g0, g1, r0, r1;
+            v_load_deinterleave(src + j * 3, y, cr, cb);
+            ycrcb2bgr_u8_half(_mm256_unpacklo_epi8(y, zero), _mm256_sub_epi16(_mm256_unpacklo_epi8(cr, zero), v_128), _mm256_sub_epi16(_mm256_unpacklo_epi8(cb, zero), v_128), b0, g0, r0);
+            ycrcb2bgr_u8_half(_mm256_unpackhi_epi8(y, zero), _mm256_sub_epi16(_mm256_unpackhi_epi8(cr, zero), v_128), _mm256_sub_epi16(_mm256_unpackhi_epi8(cb, zero), v_128), b1, g1, r1);
+            __m256i b = _mm256_packus_epi16(b0, b1);
+            __m256i g = _mm256_packus_epi16(g0, g1);
+            __m256i r = _mm256_packus_epi16(r0, r1);
+            if (ncDst == 3) {
+                v_store_interleave(dst + j * 3, bIdx == 0 ? b : r, g, bIdx == 0 ? r : b);
+            } else {
+                v_store_interleave(dst + j * 4, bIdx == 0 ? b : r, g, bIdx == 0 ? r : b, _mm256_set1_epi8(-1));
+            }
+        }
+        for (; j < width; ++j) {
+            const uint8_t *p = src + j * 3;
+            uint8_t *q       = dst + j * ncDst;
+            int32_t y = p[0], cr = p[1] - 128, cb = p[2] - 128;
+            q[bIdx]          = sat_cast_u8(y + ((cb * C_CB2B + YCRCB_HALF) >> YCRCB_SHIFT));
+            q[1]             = sat_cast_u8(y + ((cr * C_CR2G + cb * C_CB2G + YCRCB_HALF) >> YCRCB_SHIFT));
+            q[bIdx ^ 2]      = sat_cast_u8(y + ((cr * C_CR2R + YCRCB_HALF) >> YCRCB_SHIFT));
+            if (ncDst == 4) {
+                q[3] = 255;
+            }
+        }
+    }
+}
+
+template void bgr2ycrcb_u8<3, 0>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void bgr2ycrcb_u8<3, 2>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void bgr2ycrcb_u8<4, 0>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void bgr2ycrcb_u8<4, 2>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ycrcb2bgr_u8<3, 0>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ycrcb2bgr_u8<3, 2>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ycrcb2bgr_u8<4, 0>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ycrcb2bgr_u8<4, 2>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -207,5 +207,289 @@ template <typename T, int nc>
     int outWidthStride,
     T **out);
 
+template <typename T, int nc>
+::ppl::common::RetCode mergeSOA2AOS(
+    int height,
+    int width,
+    int inWidthStride,
+    const T **in,
+    int outWidthStride,
+    T *out);
+
+template <int nc>
+::ppl::common::RetCode mergeSOA2AOSConvertTo(
+    int height,
+    int width,
+    int inWidthStride,
+    const float **in,
+    float scale,
+    int outWidthStride,
+    uint8_t *out);
+
+void transpose_32bit_fma(
+    int32_t height,
+    int32_t width,
+    const uint8_t *src,
+    int32_t srcStep,
+    uint8_t *dst,
+    int32_t dstStep);
+
+template <int32_t dstcn, bool isUYVY>
+void yuv422_2_bgr(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template <int32_t ncSrc, int32_t bIdx>
+void bgr2ycrcb_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template <int32_t ncDst, int32_t bIdx>
+void ycrcb2bgr_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template <int32_t ncSrc, int32_t ncDst, bool swap>
+void reorder_u8_row(
+    const uint8_t *src,
+    uint8_t *dst,
+    int32_t width);
+
+void lut_u8_fma(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const uint8_t *lut);
+
+template <int32_t channels>
+void lut_gather_u8_fma(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const int32_t *lut);
+
+template <int32_t channels>
+void lut_gather_f32_fma(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    const float *lut);
+
+template <int32_t channels, BorderType border_type>
+void remap_linear_u8_fma(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData);
+
+template <BorderType border_type>
+void remap_linear_f32c1_fma(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    float border_value,
+    float *outData);
+
+// rows whose taps are all inside the image, see remap_linear_row_inner
+template <int32_t channels>
+void remap_linear_u8_inner_fma(
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t *outData);
+
+void remap_linear_f32c1_inner_fma(
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    float *outData);
+
+void remap_nearest_4byte_inner_fma(
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    uint8_t *outData);
+
+// one row of nearest remap for 4-byte pixels (uint8_t x 4 or float x 1), inWidthStride is in bytes
+template <BorderType border_type>
+void remap_nearest_4byte_fma(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    int32_t border_pixel,
+    uint8_t *outData);
+
+// source coordinates of output row y in the packed remap layout, span receives the first and
+// one past the last pixel of the row inside [0, maxX] x [0, maxY], or 0 and 0 when that run has gaps
+template <bool linear>
+void warpperspective_coords_fma(
+    const double *M,
+    int32_t y,
+    int32_t width,
+    int32_t maxX,
+    int32_t maxY,
+    int16_t *mapXY,
+    uint16_t *mapFrac,
+    int32_t *span);
+
+// one row of a 3x3 or 5x5 median on padded rows, see median_sortnet_row
+template <int32_t ksize>
+int32_t median_sortnet_row_fma(
+    const uint8_t *const *rows,
+    int32_t length,
+    int32_t channels,
+    uint8_t *dst);
+
+void adaptivethreshold_colsum_update_fma(
+    int32_t width,
+    const uint8_t *add_row,
+    const uint8_t *sub_row,
+    int32_t *colsum);
+
+void adaptivethreshold_mean_row_fma(
+    int32_t width,
+    int32_t ksize,
+    const uint32_t *prefix,
+    const uint8_t *src,
+    int32_t idelta,
+    uint8_t imaxval,
+    int32_t thresholdType,
+    uint8_t *dst);
+
+void adaptivethreshold_gaussian_row_fma(
+    int32_t width,
+    int32_t ksize,
+    const float *kernel,
+    const float *src,
+    float *dst);
+
+void adaptivethreshold_gaussian_col_fma(
+    int32_t width,
+    int32_t ksize,
+    const float *kernel,
+    const float **rows,
+    const uint8_t *src,
+    int32_t idelta,
+    uint8_t imaxval,
+    int32_t thresholdType,
+    uint8_t *dst);
+
+void threshold_u8_fma(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t thresh,
+    uint8_t maxval,
+    int32_t thresholdType);
+
+void threshold_f32_fma(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float thresh,
+    float maxval,
+    int32_t thresholdType);
+
+template <typename T>
+double norm_row_fma(
+    int32_t length,
+    const T *src,
+    const uint8_t *mask,
+    int32_t normType);
+
+template <typename T>
+void minmax_row_fma(
+    int32_t length,
+    const T *src,
+    const uint8_t *mask,
+    double *minVal,
+    double *maxVal);
+
+template <typename T>
+void normalize_row_fma(
+    int32_t length,
+    const T *src,
+    const uint8_t *mask,
+    float scale,
+    float shift,
+    float *dst);
+
+// updates the minimum and the maximum of each channel with a row, elements outside mask are skipped
+template <typename T>
+void minmax_channels_row_fma(
+    int32_t length,
+    int32_t channels,
+    const T *src,
+    const uint8_t *mask,
+    double *minVal,
+    double *maxVal);
+
+// adds the sums of the elements of each channel of a row, and of their squares when sqsum is not nullptr
+template <typename T>
+void sum_channels_row_fma(
+    int32_t length,
+    int32_t channels,
+    const T *src,
+    const uint8_t *mask,
+    double *sum,
+    double *sqsum);
+
+// inverts (rhs is nullptr) or solves a batch of small matrices 8 floats or 4 doubles at a time, see small_linalg_batch
+template <typename T, int32_t n>
+int32_t small_linalg_batch_fma(
+    int32_t batch,
+    const T *src,
+    const T *rhs,
+    T *dst,
+    bool cholesky_method,
+    T lu_eps,
+    T chol_eps,
+    uint8_t *valid,
+    bool *any_singular);
+
 }}}} // namespace ppl::cv::x86::fma
 #endif //! PPL_CV_X86_INTERNAL_FMA_H_
@@ -109,6 +109,81 @@ inline void v_load_deinterleave(const float *ptr, __m256 &a, __m256 &b, __m256 &
     d = (__m256)a0;
 }
 
+
+inline void v_store_interleave(uint8_t *ptr, const __m256i &a, const __m256i &b, const __m256i &c)
+{
+    const __m256i sh_a0 = _mm256_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5);
+    const __m256i sh_a1 = _mm256_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1);
+    const __m256i sh_a2 = _mm256_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1);
+    const __m256i sh_b0 = _mm256_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1);
+    const __m256i sh_b1 = _mm256_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10);
+    const __m256i sh_b2 = _mm256_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1);
+    const __m256i sh_c0 = _mm256_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1);
+    const __m256i sh_c1 = _mm256_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, -1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1);
+    const __m256i sh_c2 = _mm256_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, 10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15);
+
+    // each lane interleaves its own 16 pixels, lane 0 gives bytes 0..47 and lane 1 gives bytes 48..95
+    __m256i v0 = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, sh_a0), _mm256_shuffle_epi8(b, sh_b0)), _mm256_shuffle_epi8(c, sh_c0));
+    __m256i v1 = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, sh_a1), _mm256_shuffle_epi8(b, sh_b1)), _mm256_shuffle_epi8(c, sh_c1));
+    __m256i v2 = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, sh_a2), _mm256_shuffle_epi8(b, sh_b2)), _mm256_shuffle_epi8(c, sh_c2));
+
+    _mm256_storeu_si256((__m256i *)ptr, _mm256_permute2x128_si256(v0, v1, 0 + 2 * 16));
+    _mm256_storeu_si256((__m256i *)(ptr + 32), _mm256_permute2x128_si256(v2, v0, 0 + 3 * 16));
+    _mm256_storeu_si256((__m256i *)(ptr + 64), _mm256_permute2x128_si256(v1, v2, 1 + 3 * 16));
+}
+
+inline void v_store_interleave(uint8_t *ptr, const __m256i &a, const __m256i &b, const __m256i &c, const __m256i &d)
+{
+    __m256i ab_lo = _mm256_unpacklo_epi8(a, b);
+    __m256i ab_hi = _mm256_unpackhi_epi8(a, b);
+    __m256i cd_lo = _mm256_unpacklo_epi8(c, d);
+    __m256i cd_hi = _mm256_unpackhi_epi8(c, d);
+
+    __m256i p0 = _mm256_unpacklo_epi16(ab_lo, cd_lo); // pixels 0..3 | 16..19
+    __m256i p1 = _mm256_unpackhi_epi16(ab_lo, cd_lo); // pixels 4..7 | 20..23
+    __m256i p2 = _mm256_unpacklo_epi16(ab_hi, cd_hi); // pixels 8..11 | 24..27
+    __m256i p3 = _mm256_unpackhi_epi16(ab_hi, cd_hi); // pixels 12..15 | 28..31
+
+    _mm256_storeu_si256((__m256i *)ptr, _mm256_permute2x128_si256(p0, p1, 0 + 2 * 16));
+    _mm256_storeu_si256((__m256i *)(ptr + 32), _mm256_permute2x128_si256(p2, p3, 0 + 2 * 16));
+    _mm256_storeu_si256((__m256i *)(ptr + 64), _mm256_permute2x128_si256(p0, p1, 1 + 3 * 16));
+    _mm256_storeu_si256((__m256i *)(ptr + 96), _mm256_permute2x128_si256(p2, p3, 1 + 3 * 16));
+}
+
+inline void v_store_interleave(float *ptr, const __m256 &a, const __m256 &b, const __m256 &c)
+{
+    __m256 ab = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 bc = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 ca = _mm256_shuffle_ps(c, a, _MM_SHUFFLE(3, 1, 2, 0));
+
+    // each lane holds 12 consecutive outputs of its 4 pixels, spread over three registers
+    __m256 v0 = _mm256_shuffle_ps(ab, ca, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 v1 = _mm256_shuffle_ps(bc, ab, _MM_SHUFFLE(3, 1, 2, 0));
+    __m256 v2 = _mm256_shuffle_ps(ca, bc, _MM_SHUFFLE(3, 1, 3, 1));
+
+    _mm256_storeu_ps(ptr, _mm256_permute2f128_ps(v0, v1, 0 + 2 * 16));
+    _mm256_storeu_ps(ptr + 8, _mm256_permute2f128_ps(v2, v0, 0 + 3 * 16));
+    _mm256_storeu_ps(ptr + 16, _mm256_permute2f128_ps(v1, v2, 1 + 3 * 16));
+}
+
+inline void v_store_interleave(float *ptr, const __m256 &a, const __m256 &b, const __m256 &c, const __m256 &d)
+{
+    __m256d ab_lo = _mm256_castps_pd(_mm256_unpacklo_ps(a, b));
+    __m256d ab_hi = _mm256_castps_pd(_mm256_unpackhi_ps(a, b));
+    __m256d cd_lo = _mm256_castps_pd(_mm256_unpacklo_ps(c, d));
+    __m256d cd_hi = _mm256_castps_pd(_mm256_unpackhi_ps(c, d));
+
+    __m256 p0 = _mm256_castpd_ps(_mm256_unpacklo_pd(ab_lo, cd_lo)); // pixel 0 | 4
+    __m256 p1 = _mm256_castpd_ps(_mm256_unpackhi_pd(ab_lo, cd_lo)); // pixel 1 | 5
+    __m256 p2 = _mm256_castpd_ps(_mm256_unpacklo_pd(ab_hi, cd_hi)); // pixel 2 | 6
+    __m256 p3 = _mm256_castpd_ps(_mm256_unpackhi_pd(ab_hi, cd_hi)); // pixel 3 | 7
+
+    _mm256_storeu_ps(ptr, _mm256_permute2f128_ps(p0, p1, 0 + 2 * 16));
+    _mm256_storeu_ps(ptr + 8, _mm256_permute2f128_ps(p2, p3, 0 + 2 * 16));
+    _mm256_storeu_ps(ptr + 16, _mm256_permute2f128_ps(p0, p1, 1 + 3 * 16));
+    _mm256_storeu_ps(ptr + 24, _mm256_permute2f128_ps(p2, p3, 1 + 3 * 16));
+}
+
 }
 }
 }
@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/x86/invert.hpp"
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+template <typename T>
+struct LinalgOpsAVX;
+
+template <>
+struct LinalgOpsAVX<float> {
+    typedef float value_type;
+    typedef __m256 vec_type;
+    typedef __m256 mask_type;
+    enum { lanes = 8 };
+    static inline __m256 load(const float *p) { return _mm256_loadu_ps(p); }
+    static inline void store(float *p, __m256 v) { _mm256_storeu_ps(p, v); }
+    static inline __m256 set1(float v) { return _mm256_set1_ps(v); }
+    static inline __m256 add(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+    static inline __m256 sub(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+    static inline __m256 mul(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+    static inline __m256 div(__m256 a, __m256 b) { return _mm256_div_ps(a, b); }
+    static inline __m256 abs(__m256 a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static inline __m256 sqrt(__m256 a) { return _mm256_sqrt_ps(a); }
+    static inline __m256 cmpeq(__m256 a, __m256 b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    static inline __m256 cmplt(__m256 a, __m256 b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static inline __m256 cmpgt(__m256 a, __m256 b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static inline __m256 blend(__m256 a, __m256 b, __m256 m) { return _mm256_blendv_ps(a, b, m); }
+    static inline __m256 mask_or(__m256 a, __m256 b) { return _mm256_or_ps(a, b); }
+    static inline int32_t bits(__m256 m) { return _mm256_movemask_ps(m); }
+    typedef LinalgOpsAVX<double> wide_ops;
+    static inline void widen(__m256 v, __m256d *w)
+    {
+        w[0] = _mm256_cvtps_pd(_mm256_castps256_ps128(v));
+        w[1] = _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));
+    }
+    static inline __m256 narrow(const __m256d *w) { return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(w[0])), _mm256_cvtpd_ps(w[1]), 1); }
+};
+
+template <>
+struct LinalgOpsAVX<double> {
+    typedef double value_type;
+    typedef __m256d vec_type;
+    typedef __m256d mask_type;
+    enum { lanes = 4 };
+    static inline __m256d load(const double *p) { return _mm256_loadu_pd(p); }
+    static inline void store(double *p, __m256d v) { _mm256_storeu_pd(p, v); }
+    static inline __m256d set1(double v) { return _mm256_set1_pd(v); }
+    static inline __m256d add(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+    static inline __m256d sub(__m256d a, __m256d b) { return _mm256_sub_pd(a, b); }
+    static inline __m256d mul(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+    static inline __m256d div(__m256d a, __m256d b) { return _mm256_div_pd(a, b); }
+    static inline __m256d abs(__m256d a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static inline __m256d sqrt(__m256d a) { return _mm256_sqrt_pd(a); }
+    static inline __m256d cmpeq(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    static inline __m256d cmplt(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static inline __m256d cmpgt(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    static inline __m256d blend(__m256d a, __m256d b, __m256d m) { return _mm256_blendv_pd(a, b, m); }
+    static inline __m256d mask_or(__m256d a, __m256d b) { return _mm256_or_pd(a, b); }
+    static inline int32_t bits(__m256d m) { return _mm256_movemask_pd(m); }
+    typedef LinalgOpsAVX<double> wide_ops;
+    static inline void widen(__m256d v, __m256d *w) { w[0] = v; }
+    static inline __m256d narrow(const __m256d *w) { return w[0]; }
+};
+
+template <typename T, int32_t n>
+int32_t small_linalg_batch_fma(
+    int32_t batch,
+    const T *src,
+    const T *rhs,
+    T *dst,
+    bool cholesky_method,
+    T lu_eps,
+    T chol_eps,
+    uint8_t *valid,
+    bool *any_singular)
+{
+    return small_linalg_batch<LinalgOpsAVX<T>, n>(0, batch, src, rhs, dst, cholesky_method, lu_eps, chol_eps, valid, *any_singular);
+}
+
+template int32_t small_linalg_batch_fma<float, 2>(int32_t batch, const float *src, const float *rhs, float *dst, bool cholesky_method, float lu_eps, float chol_eps, uint8_t *valid, bool *any_singular);
+template int32_t small_linalg_batch_fma<float, 3>(int32_t batch, const float *src, const float *rhs, float *dst, bool cholesky_method, float lu_eps, float chol_eps, uint8_t *valid, bool *any_singular);
+template int32_t small_linalg_batch_fma<float, 6>(int32_t batch, const float *src, const float *rhs, float *dst, bool cholesky_method, float lu_eps, float chol_eps, uint8_t *valid, bool *any_singular);
+template int32_t small_linalg_batch_fma<double, 2>(int32_t batch, const double *src, const double *rhs, double *dst, bool cholesky_method, double lu_eps, double chol_eps, uint8_t *valid, bool *any_singular);
+template int32_t small_linalg_batch_fma<double, 3>(int32_t batch, const double *src, const double *rhs, double *dst, bool cholesky_method, double lu_eps, double chol_eps, uint8_t *valid, bool *any_singular);
+template int32_t small_linalg_batch_fma<double, 6>(int32_t batch, const double *src, const double *rhs, double *dst, bool cholesky_method, double lu_eps, double chol_eps, uint8_t *valid, bool *any_singular);
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -0,0 +1,208 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+// 256-entry byte lookup with vpshufb: table k holds lut[16k, 16k + 16) in both lanes. The index
+// drops by 16 for every table and is saturated with +0x70, so only the lanes whose index lies in
+// [0, 16) keep bit 7 clear and pick a value, all other lanes are zeroed by vpshufb.
+static inline __m256i v_lut_u8(__m256i v_idx, const __m256i *tables)
+{
+    const __m256i v_16   = _mm256_set1_epi8(16);
+    const __m256i v_0x70 = _mm256_set1_epi8(0x70);
+    __m256i v_dst        = _mm256_shuffle_epi8(tables[0], _mm256_adds_epu8(v_idx, v_0x70));
+    for (int32_t k = 1; k < 16; ++k) {
+        v_idx = _mm256_sub_epi8(v_idx, v_16);
+        v_dst = _mm256_or_si256(v_dst, _mm256_shuffle_epi8(tables[k], _mm256_adds_epu8(v_idx, v_0x70)));
+    }
+    return v_dst;
+}
+
+void lut_u8_fma(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const uint8_t *lut)
+{
+    __m256i tables[16];
+    for (int32_t k = 0; k < 16; ++k) {
+        tables[k] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(lut + k * 16)));
+    }
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 32; j += 32) {
+            _mm256_storeu_si256((__m256i *)(dst + j), v_lut_u8(_mm256_loadu_si256((const __m256i *)(src + j)), tables));
+        }
+        for (; j < width; ++j) {
+            dst[j] = lut[src[j]];
+        }
+    }
+}
+
+// channel c of element e starts at (e + c) % channels, every offset vector covers 8 elements
+template <int32_t channels>
+static inline void lut_channel_offsets(__m256i *offsets)
+{
+    for (int32_t p = 0; p < channels; ++p) {
+        int32_t o[8];
+        for (int32_t k = 0; k < 8; ++k) {
+            o[k] = (p + k) % channels;
+        }
+        offsets[p] = _mm256_loadu_si256((const __m256i *)o);
+    }
+}
+
+template <int32_t channels>
+static inline __m256i v_lut_index(const uint8_t *src, const __m256i &v_offset)
+{
+    __m256i v_idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)src));
+    if (channels == 1) {
+        return v_idx;
+    }
+    return _mm256_add_epi32(_mm256_mullo_epi32(v_idx, _mm256_set1_epi32(channels)), v_offset);
+}
+
+// per-channel tables are interleaved, lut[v * channels + c], the uint8_t values are widened to
+// int32_t so that every 8 elements are a single vpgatherdd
+template <int32_t channels>
+void lut_gather_u8_fma(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const int32_t *lut)
+{
+    __m256i offsets[channels];
+    lut_channel_offsets<channels>(offsets);
+    const __m256i v_perm = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    const int32_t length = width * channels;
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= length - 32; j += 32) {
+            __m256i v_dst[4];
+            for (int32_t k = 0; k < 4; ++k) {
+                v_dst[k] = _mm256_i32gather_epi32(lut, v_lut_index<channels>(src + j + k * 8, offsets[(j + k * 8) % channels]), 4);
+            }
+            __m256i v_pack = _mm256_packus_epi16(_mm256_packus_epi32(v_dst[0], v_dst[1]), _mm256_packus_epi32(v_dst[2], v_dst[3]));
+            _mm256_storeu_si256((__m256i *)(dst + j), _mm256_permutevar8x32_epi32(v_pack, v_perm));
+        }
+        for (; j < length; ++j) {
+            dst[j] = lut[src[j] * channels + j % channels];
+        }
+    }
+}
+
+template <int32_t channels>
+void lut_gather_f32_fma(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    const float *lut)
+{
+    __m256i offsets[channels];
+    lut_channel_offsets<channels>(offsets);
+    const int32_t length = width * channels;
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        float *dst         = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= length - 8; j += 8) {
+            _mm256_storeu_ps(dst + j, _mm256_i32gather_ps(lut, v_lut_index<channels>(src + j, offsets[j % channels]), 4));
+        }
+        for (; j < length; ++j) {
+            dst[j] = lut[src[j] * channels + j % channels];
+        }
+    }
+}
+
+template void lut_gather_u8_fma<1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const int32_t *lut);
+
+template void lut_gather_u8_fma<3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const int32_t *lut);
+
+template void lut_gather_u8_fma<4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const int32_t *lut);
+
+template void lut_gather_f32_fma<1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    const float *lut);
+
+template void lut_gather_f32_fma<3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    const float *lut);
+
+template void lut_gather_f32_fma<4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    const float *lut);
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -0,0 +1,188 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include <stdint.h>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+// bytes per block, a 16-bit lane adds two bytes per 96 bytes so 128 iterations sum to at most 65280
+#define MEAN_U8_BLOCK_SIZE 12288
+// floats per block, float lanes only ever hold the sum of one short block
+#define MEAN_F32_BLOCK_SIZE 480
+
+static inline __m256 load_mask_ps(const uint8_t *mask)
+{
+    return _mm256_castsi256_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)mask)));
+}
+
+static inline __m256i cvt_lo_epu16_epi32(__m256i v)
+{
+    return _mm256_cvtepu16_epi32(_mm256_castsi256_si128(v));
+}
+
+static inline __m256i cvt_hi_epu16_epi32(__m256i v)
+{
+    return _mm256_cvtepu16_epi32(_mm256_extracti128_si256(v, 1));
+}
+
+// the vectors of consecutive elements are added round robin into three accumulators, so every lane of
+// the accumulators belongs to a single channel
+template <>
+void sum_channels_row_fma<uint8_t>(
+    int32_t length,
+    int32_t channels,
+    const uint8_t *src,
+    const uint8_t *mask,
+    double *sum,
+    double *sqsum)
+{
+    const __m256i v_zero = _mm256_setzero_si256();
+    int32_t i            = 0;
+    for (int32_t block = 0; block <= length - 96; block += MEAN_U8_BLOCK_SIZE) {
+        int32_t end    = std::min(length, block + MEAN_U8_BLOCK_SIZE);
+        __m256i v_sum0 = v_zero, v_sum1 = v_zero, v_sum2 = v_zero;
+        __m256i v_sq0 = v_zero, v_sq1 = v_zero, v_sq2 = v_zero;
+        for (i = block; i <= end - 96; i += 96) {
+            __m256i v_src0 = _mm256_loadu_si256((const __m256i *)(src + i));
+            __m256i v_src1 = _mm256_loadu_si256((const __m256i *)(src + i + 32));
+            __m256i v_src2 = _mm256_loadu_si256((const __m256i *)(src + i + 64));
+            if (mask != nullptr) {
+                v_src0 = _mm256_and_si256(v_src0, _mm256_loadu_si256((const __m256i *)(mask + i)));
+                v_src1 = _mm256_and_si256(v_src1, _mm256_loadu_si256((const __m256i *)(mask + i + 32)));
+                v_src2 = _mm256_and_si256(v_src2, _mm256_loadu_si256((const __m256i *)(mask + i + 64)));
+            }
+            // the 16-bit vectors start at element 0, 16, 32, 48, 64 and 80
+            __m256i v_lo0 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v_src0));
+            __m256i v_hi0 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v_src0, 1));
+            __m256i v_lo1 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v_src1));
+            __m256i v_hi1 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v_src1, 1));
+            __m256i v_lo2 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v_src2));
+            __m256i v_hi2 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v_src2, 1));
+            v_sum0        = _mm256_add_epi16(v_sum0, _mm256_add_epi16(v_lo0, v_hi1));
+            v_sum1        = _mm256_add_epi16(v_sum1, _mm256_add_epi16(v_hi0, v_lo2));
+            v_sum2        = _mm256_add_epi16(v_sum2, _mm256_add_epi16(v_lo1, v_hi2));
+            if (sqsum != nullptr) {
+                // the squares fit in 16 bits and are widened to the 32-bit vectors of 8 elements each
+                v_lo0 = _mm256_mullo_epi16(v_lo0, v_lo0);
+                v_hi0 = _mm256_mullo_epi16(v_hi0, v_hi0);
+                v_lo1 = _mm256_mullo_epi16(v_lo1, v_lo1);
+                v_hi1 = _mm256_mullo_epi16(v_hi1, v_hi1);
+                v_lo2 = _mm256_mullo_epi16(v_lo2, v_lo2);
+                v_hi2 = _mm256_mullo_epi16(v_hi2, v_hi2);
+                v_sq0 = _mm256_add_epi32(v_sq0, _mm256_add_epi32(_mm256_add_epi32(cvt_lo_epu16_epi32(v_lo0), cvt_hi_epu16_epi32(v_hi0)),
+                                                                 _mm256_add_epi32(cvt_lo_epu16_epi32(v_hi1), cvt_hi_epu16_epi32(v_lo2))));
+                v_sq1 = _mm256_add_epi32(v_sq1, _mm256_add_epi32(_mm256_add_epi32(cvt_hi_epu16_epi32(v_lo0), cvt_lo_epu16_epi32(v_lo1)),
+                                                                 _mm256_add_epi32(cvt_hi_epu16_epi32(v_hi1), cvt_lo_epu16_epi32(v_hi2))));
+                v_sq2 = _mm256_add_epi32(v_sq2, _mm256_add_epi32(_mm256_add_epi32(cvt_lo_epu16_epi32(v_hi0), cvt_hi_epu16_epi32(v_lo1)),
+                                                                 _mm256_add_epi32(cvt_lo_epu16_epi32(v_lo2), cvt_hi_epu16_epi32(v_hi2))));
+            }
+        }
+        uint16_t buf_sum[48];
+        _mm256_storeu_si256((__m256i *)buf_sum, v_sum0);
+        _mm256_storeu_si256((__m256i *)(buf_sum + 16), v_sum1);
+        _mm256_storeu_si256((__m256i *)(buf_sum + 32), v_sum2);
+        for (int32_t j = 0; j < 48; ++j) {
+            sum[(block + j) % channels] += buf_sum[j];
+        }
+        if (sqsum != nullptr) {
+            uint32_t buf_sq[24];
+            _mm256_storeu_si256((__m256i *)buf_sq, v_sq0);
+            _mm256_storeu_si256((__m256i *)(buf_sq + 8), v_sq1);
+            _mm256_storeu_si256((__m256i *)(buf_sq + 16), v_sq2);
+            for (int32_t j = 0; j < 24; ++j) {
+                sqsum[(block + j) % channels] += buf_sq[j];
+            }
+        }
+    }
+    for (; i < length; ++i) {
+        int32_t v = src[i] & (mask != nullptr ? mask[i] : 0xff);
+        sum[i % channels] += v;
+        if (sqsum != nullptr) {
+            sqsum[i % channels] += v * v;
+        }
+    }
+}
+
+template <>
+void sum_channels_row_fma<float>(
+    int32_t length,
+    int32_t channels,
+    const float *src,
+    const uint8_t *mask,
+    double *sum,
+    double *sqsum)
+{
+    int32_t i = 0;
+    for (int32_t block = 0; block <= length - 24; block += MEAN_F32_BLOCK_SIZE) {
+        int32_t end   = std::min(length, block + MEAN_F32_BLOCK_SIZE);
+        __m256 v_sum0 = _mm256_setzero_ps(), v_sum1 = _mm256_setzero_ps(), v_sum2 = _mm256_setzero_ps();
+        __m256 v_sq0 = _mm256_setzero_ps(), v_sq1 = _mm256_setzero_ps(), v_sq2 = _mm256_setzero_ps();
+        for (i = block; i <= end - 24; i += 24) {
+            __m256 v_src0 = _mm256_loadu_ps(src + i);
+            __m256 v_src1 = _mm256_loadu_ps(src + i + 8);
+            __m256 v_src2 = _mm256_loadu_ps(src + i + 16);
+            if (mask != nullptr) {
+                v_src0 = _mm256_and_ps(v_src0, load_mask_ps(mask + i));
+                v_src1 = _mm256_and_ps(v_src1, load_mask_ps(mask + i + 8));
+                v_src2 = _mm256_and_ps(v_src2, load_mask_ps(mask + i + 16));
+            }
+            v_sum0 = _mm256_add_ps(v_sum0, v_src0);
+            v_sum1 = _mm256_add_ps(v_sum1, v_src1);
+            v_sum2 = _mm256_add_ps(v_sum2, v_src2);
+            if (sqsum != nullptr) {
+                v_sq0 = _mm256_fmadd_ps(v_src0, v_src0, v_sq0);
+                v_sq1 = _mm256_fmadd_ps(v_src1, v_src1, v_sq1);
+                v_sq2 = _mm256_fmadd_ps(v_src2, v_src2, v_sq2);
+            }
+        }
+        float buf[24];
+        _mm256_storeu_ps(buf, v_sum0);
+        _mm256_storeu_ps(buf + 8, v_sum1);
+        _mm256_storeu_ps(buf + 16, v_sum2);
+        for (int32_t j = 0; j < 24; ++j) {
+            sum[(block + j) % channels] += buf[j];
+        }
+        if (sqsum != nullptr) {
+            _mm256_storeu_ps(buf, v_sq0);
+            _mm256_storeu_ps(buf + 8, v_sq1);
+            _mm256_storeu_ps(buf + 16, v_sq2);
+            for (int32_t j = 0; j < 24; ++j) {
+                sqsum[(block + j) % channels] += buf[j];
+            }
+        }
+    }
+    for (; i < length; ++i) {
+        if (mask == nullptr || mask[i]) {
+            sum[i % channels] += src[i];
+            if (sqsum != nullptr) {
+                sqsum[i % channels] += static_cast<double>(src[i]) * src[i];
+            }
+        }
+    }
+}
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
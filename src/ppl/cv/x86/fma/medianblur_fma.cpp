@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/x86/medianblur.hpp"
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+struct MedianOpsU8x32 {
+    typedef __m256i vec_type;
+    enum { lanes = 32 };
+    static inline vec_type load(const uint8_t *p)
+    {
+        return _mm256_loadu_si256((const __m256i *)p);
+    }
+    static inline void store(uint8_t *p, vec_type v)
+    {
+        _mm256_storeu_si256((__m256i *)p, v);
+    }
+    static inline vec_type min(vec_type a, vec_type b)
+    {
+        return _mm256_min_epu8(a, b);
+    }
+    static inline vec_type max(vec_type a, vec_type b)
+    {
+        return _mm256_max_epu8(a, b);
+    }
+};
+
+template <int32_t ksize>
+int32_t median_sortnet_row_fma(
+    const uint8_t *const *rows,
+    int32_t length,
+    int32_t channels,
+    uint8_t *dst)
+{
+    return median_sortnet_row<MedianOpsU8x32, ksize>(rows, length, channels, dst);
+}
+
+template int32_t median_sortnet_row_fma<3>(
+    const uint8_t *const *rows,
+    int32_t length,
+    int32_t channels,
+    uint8_t *dst);
+
+template int32_t median_sortnet_row_fma<5>(
+    const uint8_t *const *rows,
+    int32_t length,
+    int32_t channels,
+    uint8_t *dst);
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
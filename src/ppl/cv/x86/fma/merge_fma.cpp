@@ -0,0 +1,246 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "intrinutils_fma.hpp"
+#include <stdint.h>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+// rounds to nearest-even like the vector path, then saturates to [0, 255]
+static inline uint8_t round_sat_u8(float value)
+{
+    int32_t v = _mm_cvtss_si32(_mm_set_ss(value));
+    return v > 255 ? 255 : (v < 0 ? 0 : v);
+}
+
+static inline __m256i convert_f32_u8(const float *src, __m256 scale_vec)
+{
+    const __m256i idx_vec = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    __m256i v0 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src), scale_vec));
+    __m256i v1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + 8), scale_vec));
+    __m256i v2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + 16), scale_vec));
+    __m256i v3 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + 24), scale_vec));
+    // packs work per lane, so the 4-byte groups come out as 0 2 4 6 1 3 5 7
+    __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(v0, v1), _mm256_packs_epi32(v2, v3));
+    return _mm256_permutevar8x32_epi32(packed, idx_vec);
+}
+
+template <>
+::ppl::common::RetCode mergeSOA2AOS<uint8_t, 3>(
+    int height,
+    int width,
+    int inWidthStride,
+    const uint8_t **in,
+    int outWidthStride,
+    uint8_t *out)
+{
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const uint8_t* src0_ptr = in[0] + h * inWidthStride;
+        const uint8_t* src1_ptr = in[1] + h * inWidthStride;
+        const uint8_t* src2_ptr = in[2] + h * inWidthStride;
+        uint8_t* dst_ptr = out + h * outWidthStride;
+        for (; w <= width - 32; w += 32) {
+            __m256i va = _mm256_loadu_si256((const __m256i*)(src0_ptr + w));
+            __m256i vb = _mm256_loadu_si256((const __m256i*)(src1_ptr + w));
+            __m256i vc = _mm256_loadu_si256((const __m256i*)(src2_ptr + w));
+            v_store_interleave(dst_ptr + w * 3, va, vb, vc);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 3 + 0] = src0_ptr[w];
+            dst_ptr[w * 3 + 1] = src1_ptr[w];
+            dst_ptr[w * 3 + 2] = src2_ptr[w];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode mergeSOA2AOS<uint8_t, 4>(
+    int height,
+    int width,
+    int inWidthStride,
+    const uint8_t **in,
+    int outWidthStride,
+    uint8_t *out)
+{
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const uint8_t* src0_ptr = in[0] + h * inWidthStride;
+        const uint8_t* src1_ptr = in[1] + h * inWidthStride;
+        const uint8_t* src2_ptr = in[2] + h * inWidthStride;
+        const uint8_t* src3_ptr = in[3] + h * inWidthStride;
+        uint8_t* dst_ptr = out + h * outWidthStride;
+        for (; w <= width - 32; w += 32) {
+            __m256i va = _mm256_loadu_si256((const __m256i*)(src0_ptr + w));
+            __m256i vb = _mm256_loadu_si256((const __m256i*)(src1_ptr + w));
+            __m256i vc = _mm256_loadu_si256((const __m256i*)(src2_ptr + w));
+            __m256i vd = _mm256_loadu_si256((const __m256i*)(src3_ptr + w));
+            v_store_interleave(dst_ptr + w * 4, va, vb, vc, vd);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 4 + 0] = src0_ptr[w];
+            dst_ptr[w * 4 + 1] = src1_ptr[w];
+            dst_ptr[w * 4 + 2] = src2_ptr[w];
+            dst_ptr[w * 4 + 3] = src3_ptr[w];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode mergeSOA2AOS<float, 3>(
+    int height,
+    int width,
+    int inWidthStride,
+    const float **in,
+    int outWidthStride,
+    float *out)
+{
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const float* src0_ptr = in[0] + h * inWidthStride;
+        const float* src1_ptr = in[1] + h * inWidthStride;
+        const float* src2_ptr = in[2] + h * inWidthStride;
+        float* dst_ptr = out + h * outWidthStride;
+        for (; w <= width - 8; w += 8) {
+            __m256 va = _mm256_loadu_ps(src0_ptr + w);
+            __m256 vb = _mm256_loadu_ps(src1_ptr + w);
+            __m256 vc = _mm256_loadu_ps(src2_ptr + w);
+            v_store_interleave(dst_ptr + w * 3, va, vb, vc);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 3 + 0] = src0_ptr[w];
+            dst_ptr[w * 3 + 1] = src1_ptr[w];
+            dst_ptr[w * 3 + 2] = src2_ptr[w];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode mergeSOA2AOS<float, 4>(
+    int height,
+    int width,
+    int inWidthStride,
+    const float **in,
+    int outWidthStride,
+    float *out)
+{
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const float* src0_ptr = in[0] + h * inWidthStride;
+        const float* src1_ptr = in[1] + h * inWidthStride;
+        const float* src2_ptr = in[2] + h * inWidthStride;
+        const float* src3_ptr = in[3] + h * inWidthStride;
+        float* dst_ptr = out + h * outWidthStride;
+        for (; w <= width - 8; w += 8) {
+            __m256 va = _mm256_loadu_ps(src0_ptr + w);
+            __m256 vb = _mm256_loadu_ps(src1_ptr + w);
+            __m256 vc = _mm256_loadu_ps(src2_ptr + w);
+            __m256 vd = _mm256_loadu_ps(src3_ptr + w);
+            v_store_interleave(dst_ptr + w * 4, va, vb, vc, vd);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 4 + 0] = src0_ptr[w];
+            dst_ptr[w * 4 + 1] = src1_ptr[w];
+            dst_ptr[w * 4 + 2] = src2_ptr[w];
+            dst_ptr[w * 4 + 3] = src3_ptr[w];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode mergeSOA2AOSConvertTo<3>(
+    int height,
+    int width,
+    int inWidthStride,
+    const float **in,
+    float scale,
+    int outWidthStride,
+    uint8_t *out)
+{
+    __m256 scale_vec = _mm256_set1_ps(scale);
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const float* src0_ptr = in[0] + h * inWidthStride;
+        const float* src1_ptr = in[1] + h * inWidthStride;
+        const float* src2_ptr = in[2] + h * inWidthStride;
+        uint8_t* dst_ptr = out + h * outWidthStride;
+        for (; w <= width - 32; w += 32) {
+            __m256i va = convert_f32_u8(src0_ptr + w, scale_vec);
+            __m256i vb = convert_f32_u8(src1_ptr + w, scale_vec);
+            __m256i vc = convert_f32_u8(src2_ptr + w, scale_vec);
+            v_store_interleave(dst_ptr + w * 3, va, vb, vc);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 3 + 0] = round_sat_u8(src0_ptr[w] * scale);
+            dst_ptr[w * 3 + 1] = round_sat_u8(src1_ptr[w] * scale);
+            dst_ptr[w * 3 + 2] = round_sat_u8(src2_ptr[w] * scale);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode mergeSOA2AOSConvertTo<4>(
+    int height,
+    int width,
+    int inWidthStride,
+    const float **in,
+    float scale,
+    int outWidthStride,
+    uint8_t *out)
+{
+    __m256 scale_vec = _mm256_set1_ps(scale);
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const float* src0_ptr = in[0] + h * inWidthStride;
+        const float* src1_ptr = in[1] + h * inWidthStride;
+        const float* src2_ptr = in[2] + h * inWidthStride;
+        const float* src3_ptr = in[3] + h * inWidthStride;
+        uint8_t* dst_ptr = out + h * outWidthStride;
+        for (; w <= width - 32; w += 32) {
+            __m256i va = convert_f32_u8(src0_ptr + w, scale_vec);
+            __m256i vb = convert_f32_u8(src1_ptr + w, scale_vec);
+            __m256i vc = convert_f32_u8(src2_ptr + w, scale_vec);
+            __m256i vd = convert_f32_u8(src3_ptr + w, scale_vec);
+            v_store_interleave(dst_ptr + w * 4, va, vb, vc, vd);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 4 + 0] = round_sat_u8(src0_ptr[w] * scale);
+            dst_ptr[w * 4 + 1] = round_sat_u8(src1_ptr[w] * scale);
+            dst_ptr[w * 4 + 2] = round_sat_u8(src2_ptr[w] * scale);
+            dst_ptr[w * 4 + 3] = round_sat_u8(src3_ptr[w] * scale);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include <float.h>
+#include <stdint.h>
+#include <cmath>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+static inline __m256 load_mask_ps(const uint8_t *mask)
+{
+    return _mm256_castsi256_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)mask)));
+}
+
+// three registers per iteration, so every lane of the three accumulators belongs to a single channel
+template <>
+void minmax_channels_row_fma<uint8_t>(
+    int32_t length,
+    int32_t channels,
+    const uint8_t *src,
+    const uint8_t *mask,
+    double *minVal,
+    double *maxVal)
+{
+    const __m256i v_ones = _mm256_set1_epi8(-1);
+    __m256i v_min0 = v_ones, v_min1 = v_ones, v_min2 = v_ones;
+    __m256i v_max0 = _mm256_setzero_si256(), v_max1 = v_max0, v_max2 = v_max0;
+    int32_t i = 0;
+    for (; i <= length - 96; i += 96) {
+        __m256i v_src0 = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i v_src1 = _mm256_loadu_si256((const __m256i *)(src + i + 32));
+        __m256i v_src2 = _mm256_loadu_si256((const __m256i *)(src + i + 64));
+        if (mask != nullptr) {
+            // unselected elements become 255 for min and 0 for max
+            __m256i v_msk0 = _mm256_loadu_si256((const __m256i *)(mask + i));
+            __m256i v_msk1 = _mm256_loadu_si256((const __m256i *)(mask + i + 32));
+            __m256i v_msk2 = _mm256_loadu_si256((const __m256i *)(mask + i + 64));
+            v_min0         = _mm256_min_epu8(v_min0, _mm256_or_si256(v_src0, _mm256_xor_si256(v_msk0, v_ones)));
+            v_min1         = _mm256_min_epu8(v_min1, _mm256_or_si256(v_src1, _mm256_xor_si256(v_msk1, v_ones)));
+            v_min2         = _mm256_min_epu8(v_min2, _mm256_or_si256(v_src2, _mm256_xor_si256(v_msk2, v_ones)));
+            v_max0         = _mm256_max_epu8(v_max0, _mm256_and_si256(v_src0, v_msk0));
+            v_max1         = _mm256_max_epu8(v_max1, _mm256_and_si256(v_src1, v_msk1));
+            v_max2         = _mm256_max_epu8(v_max2, _mm256_and_si256(v_src2, v_msk2));
+        } else {
+            v_min0 = _mm256_min_epu8(v_min0, v_src0);
+            v_min1 = _mm256_min_epu8(v_min1, v_src1);
+            v_min2 = _mm256_min_epu8(v_min2, v_src2);
+            v_max0 = _mm256_max_epu8(v_max0, v_src0);
+            v_max1 = _mm256_max_epu8(v_max1, v_src1);
+            v_max2 = _mm256_max_epu8(v_max2, v_src2);
+        }
+    }
+    if (i > 0) {
+        uint8_t buf_min[96], buf_max[96];
+        _mm256_storeu_si256((__m256i *)buf_min, v_min0);
+        _mm256_storeu_si256((__m256i *)(buf_min + 32), v_min1);
+        _mm256_storeu_si256((__m256i *)(buf_min + 64), v_min2);
+        _mm256_storeu_si256((__m256i *)buf_max, v_max0);
+        _mm256_storeu_si256((__m256i *)(buf_max + 32), v_max1);
+        _mm256_storeu_si256((__m256i *)(buf_max + 64), v_max2);
+        for (int32_t j = 0; j < 96; ++j) {
+            minVal[j % channels] = std::min<double>(minVal[j % channels], buf_min[j]);
+            maxVal[j % channels] = std::max<double>(maxVal[j % channels], buf_max[j]);
+        }
+    }
+    for (; i < length; ++i) {
+        if (mask == nullptr || mask[i]) {
+            minVal[i % channels] = std::min<double>(minVal[i % channels], src[i]);
+            maxVal[i % channels] = std::max<double>(maxVal[i % channels], src[i]);
+        }
+    }
+}
+
+template <>
+void minmax_channels_row_fma<float>(
+    int32_t length,
+    int32_t channels,
+    const float *src,
+    const uint8_t *mask,
+    double *minVal,
+    double *maxVal)
+{
+    const __m256 v_pos = _mm256_set1_ps(FLT_MAX);
+    const __m256 v_neg = _mm256_set1_ps(-FLT_MAX);
+    __m256 v_min0 = v_pos, v_min1 = v_pos, v_min2 = v_pos;
+    __m256 v_max0 = v_neg, v_max1 = v_neg, v_max2 = v_neg;
+    int32_t i     = 0;
+    for (; i <= length - 24; i += 24) {
+        __m256 v_src0 = _mm256_loadu_ps(src + i);
+        __m256 v_src1 = _mm256_loadu_ps(src + i + 8);
+        __m256 v_src2 = _mm256_loadu_ps(src + i + 16);
+        if (mask != nullptr) {
+            __m256 v_msk0 = load_mask_ps(mask + i);
+            __m256 v_msk1 = load_mask_ps(mask + i + 8);
+            __m256 v_msk2 = load_mask_ps(mask + i + 16);
+            // the source goes first, so NaN never replaces the accumulator
+            v_min0        = _mm256_min_ps(_mm256_blendv_ps(v_pos, v_src0, v_msk0), v_min0);
+            v_min1        = _mm256_min_ps(_mm256_blendv_ps(v_pos, v_src1, v_msk1), v_min1);
+            v_min2        = _mm256_min_ps(_mm256_blendv_ps(v_pos, v_src2, v_msk2), v_min2);
+            v_max0        = _mm256_max_ps(_mm256_blendv_ps(v_neg, v_src0, v_msk0), v_max0);
+            v_max1        = _mm256_max_ps(_mm256_blendv_ps(v_neg, v_src1, v_msk1), v_max1);
+            v_max2        = _mm256_max_ps(_mm256_blendv_ps(v_neg, v_src2, v_msk2), v_max2);
+        } else {
+            v_min0 = _mm256_min_ps(v_src0, v_min0);
+            v_min1 = _mm256_min_ps(v_src1, v_min1);
+            v_min2 = _mm256_min_ps(v_src2, v_min2);
+            v_max0 = _mm256_max_ps(v_src0, v_max0);
+            v_max1 = _mm256_max_ps(v_src1, v_max1);
+            v_max2 = _mm256_max_ps(v_src2, v_max2);
+        }
+    }
+    if (i > 0) {
+        float buf_min[24], buf_max[24];
+        _mm256_storeu_ps(buf_min, v_min0);
+        _mm256_storeu_ps(buf_min + 8, v_min1);
+        _mm256_storeu_ps(buf_min + 16, v_min2);
+        _mm256_storeu_ps(buf_max, v_max0);
+        _mm256_storeu_ps(buf_max + 8, v_max1);
+        _mm256_storeu_ps(buf_max + 16, v_max2);
+        for (int32_t j = 0; j < 24; ++j) {
+            minVal[j % channels] = std::min<double>(minVal[j % channels], buf_min[j]);
+            maxVal[j % channels] = std::max<double>(maxVal[j % channels], buf_max[j]);
+        }
+    }
+    for (; i < length; ++i) {
+        if ((mask == nullptr || mask[i]) && !std::isnan(src[i])) {
+            minVal[i % channels] = std::min<double>(minVal[i % channels], src[i]);
+            maxVal[i % channels] = std::max<double>(maxVal[i % channels], src[i]);
+        }
+    }
+}
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -0,0 +1,349 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include <string.h>
+#include <float.h>
+#include <stdint.h>
+#include <cmath>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+// elements per block whose partial sums are kept in 32-bit lanes before being flushed
+#define NORM_BLOCK_SIZE 4096
+
+static inline __m256 load_mask_ps(const uint8_t *mask)
+{
+    return _mm256_castsi256_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)mask)));
+}
+
+static inline double hsum_pd(__m256 v)
+{
+    __m256d v_sum  = _mm256_add_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(v)), _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    __m128d v_half = _mm_add_pd(_mm256_castpd256_pd128(v_sum), _mm256_extractf128_pd(v_sum, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(v_half, _mm_unpackhi_pd(v_half, v_half)));
+}
+
+template <>
+double norm_row_fma<uint8_t>(
+    int32_t length,
+    const uint8_t *src,
+    const uint8_t *mask,
+    int32_t normType)
+{
+    const __m256i v_zero = _mm256_setzero_si256();
+    const __m256i v_ones = _mm256_set1_epi8(-1);
+    if (normType == NORM_INF) {
+        __m256i v_max0 = v_zero, v_max1 = v_zero;
+        int32_t i      = 0;
+        for (; i <= length - 64; i += 64) {
+            __m256i v_src0 = _mm256_loadu_si256((const __m256i *)(src + i));
+            __m256i v_src1 = _mm256_loadu_si256((const __m256i *)(src + i + 32));
+            if (mask != nullptr) {
+                v_src0 = _mm256_and_si256(v_src0, _mm256_loadu_si256((const __m256i *)(mask + i)));
+                v_src1 = _mm256_and_si256(v_src1, _mm256_loadu_si256((const __m256i *)(mask + i + 32)));
+            }
+            v_max0 = _mm256_max_epu8(v_max0, v_src0);
+            v_max1 = _mm256_max_epu8(v_max1, v_src1);
+        }
+        v_max0    = _mm256_max_epu8(v_max0, v_max1);
+        __m128i v = _mm_max_epu8(_mm256_castsi256_si128(v_max0), _mm256_extracti128_si256(v_max0, 1));
+        v         = _mm_max_epu8(v, _mm_srli_si128(v, 8));
+        v         = _mm_max_epu8(v, _mm_srli_si128(v, 4));
+        v         = _mm_max_epu8(v, _mm_srli_si128(v, 2));
+        v         = _mm_max_epu8(v, _mm_srli_si128(v, 1));
+        uint8_t result = static_cast<uint8_t>(_mm_cvtsi128_si32(v));
+        for (; i < length; ++i) {
+            result = std::max<uint8_t>(result, src[i] & (mask != nullptr ? mask[i] : 0xff));
+        }
+        return result;
+    }
+    if (normType == NORM_L1) {
+        __m256i v_sum0 = v_zero, v_sum1 = v_zero;
+        int32_t i      = 0;
+        for (; i <= length - 64; i += 64) {
+            __m256i v_src0 = _mm256_loadu_si256((const __m256i *)(src + i));
+            __m256i v_src1 = _mm256_loadu_si256((const __m256i *)(src + i + 32));
+            if (mask != nullptr) {
+                v_src0 = _mm256_and_si256(v_src0, _mm256_loadu_si256((const __m256i *)(mask + i)));
+                v_src1 = _mm256_and_si256(v_src1, _mm256_loadu_si256((const __m256i *)(mask + i + 32)));
+            }
+            v_sum0 = _mm256_add_epi64(v_sum0, _mm256_sad_epu8(v_src0, v_zero));
+            v_sum1 = _mm256_add_epi64(v_sum1, _mm256_sad_epu8(v_src1, v_zero));
+        }
+        int64_t buf[4];
+        _mm256_storeu_si256((__m256i *)buf, _mm256_add_epi64(v_sum0, v_sum1));
+        int64_t result = buf[0] + buf[1] + buf[2] + buf[3];
+        for (; i < length; ++i) {
+            result += src[i] & (mask != nullptr ? mask[i] : 0xff);
+        }
+        return static_cast<double>(result);
+    }
+    int64_t result = 0;
+    for (int32_t block = 0; block < length; block += NORM_BLOCK_SIZE) {
+        int32_t end    = std::min(length, block + NORM_BLOCK_SIZE);
+        __m256i v_sum0 = v_zero, v_sum1 = v_zero;
+        int32_t i      = block;
+        for (; i <= end - 32; i += 32) {
+            __m256i v_src = _mm256_loadu_si256((const __m256i *)(src + i));
+            __m256i v_msk = mask != nullptr ? _mm256_loadu_si256((const __m256i *)(mask + i)) : v_ones;
+            v_src         = _mm256_and_si256(v_src, v_msk);
+            __m256i v_lo  = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v_src));
+            __m256i v_hi  = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v_src, 1));
+            v_sum0        = _mm256_add_epi32(v_sum0, _mm256_madd_epi16(v_lo, v_lo));
+            v_sum1        = _mm256_add_epi32(v_sum1, _mm256_madd_epi16(v_hi, v_hi));
+        }
+        int32_t buf[8];
+        _mm256_storeu_si256((__m256i *)buf, _mm256_add_epi32(v_sum0, v_sum1));
+        for (int32_t k = 0; k < 8; ++k) {
+            result += buf[k];
+        }
+        for (; i < end; ++i) {
+            int32_t v = src[i] & (mask != nullptr ? mask[i] : 0xff);
+            result += v * v;
+        }
+    }
+    return static_cast<double>(result);
+}
+
+template <>
+double norm_row_fma<float>(
+    int32_t length,
+    const float *src,
+    const uint8_t *mask,
+    int32_t normType)
+{
+    const __m256 v_abs  = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    if (normType == NORM_INF) {
+        __m256 v_max0 = _mm256_setzero_ps(), v_max1 = _mm256_setzero_ps();
+        int32_t i     = 0;
+        for (; i <= length - 16; i += 16) {
+            __m256 v_src0 = _mm256_and_ps(_mm256_loadu_ps(src + i), v_abs);
+            __m256 v_src1 = _mm256_and_ps(_mm256_loadu_ps(src + i + 8), v_abs);
+            if (mask != nullptr) {
+                v_src0 = _mm256_and_ps(v_src0, load_mask_ps(mask + i));
+                v_src1 = _mm256_and_ps(v_src1, load_mask_ps(mask + i + 8));
+            }
+            v_max0 = _mm256_max_ps(v_max0, v_src0);
+            v_max1 = _mm256_max_ps(v_max1, v_src1);
+        }
+        float buf[8];
+        _mm256_storeu_ps(buf, _mm256_max_ps(v_max0, v_max1));
+        float result = *std::max_element(buf, buf + 8);
+        for (; i < length; ++i) {
+            if (mask == nullptr || mask[i]) {
+                result = std::max(result, std::abs(src[i]));
+            }
+        }
+        return result;
+    }
+    // float lanes only ever hold the sum of one short block, block sums are added in double
+    const bool is_l1 = normType == NORM_L1;
+    double result    = 0;
+    for (int32_t block = 0; block < length; block += 512) {
+        int32_t end   = std::min(length, block + 512);
+        __m256 v_sum0 = _mm256_setzero_ps(), v_sum1 = _mm256_setzero_ps();
+        __m256 v_sum2 = _mm256_setzero_ps(), v_sum3 = _mm256_setzero_ps();
+        int32_t i     = block;
+        for (; i <= end - 32; i += 32) {
+            __m256 v_src0 = _mm256_loadu_ps(src + i);
+            __m256 v_src1 = _mm256_loadu_ps(src + i + 8);
+            __m256 v_src2 = _mm256_loadu_ps(src + i + 16);
+            __m256 v_src3 = _mm256_loadu_ps(src + i + 24);
+            if (mask != nullptr) {
+                v_src0 = _mm256_and_ps(v_src0, load_mask_ps(mask + i));
+                v_src1 = _mm256_and_ps(v_src1, load_mask_ps(mask + i + 8));
+                v_src2 = _mm256_and_ps(v_src2, load_mask_ps(mask + i + 16));
+                v_src3 = _mm256_and_ps(v_src3, load_mask_ps(mask + i + 24));
+            }
+            if (is_l1) {
+                v_sum0 = _mm256_add_ps(v_sum0, _mm256_and_ps(v_src0, v_abs));
+                v_sum1 = _mm256_add_ps(v_sum1, _mm256_and_ps(v_src1, v_abs));
+                v_sum2 = _mm256_add_ps(v_sum2, _mm256_and_ps(v_src2, v_abs));
+                v_sum3 = _mm256_add_ps(v_sum3, _mm256_and_ps(v_src3, v_abs));
+            } else {
+                v_sum0 = _mm256_fmadd_ps(v_src0, v_src0, v_sum0);
+                v_sum1 = _mm256_fmadd_ps(v_src1, v_src1, v_sum1);
+                v_sum2 = _mm256_fmadd_ps(v_src2, v_src2, v_sum2);
+                v_sum3 = _mm256_fmadd_ps(v_src3, v_src3, v_sum3);
+            }
+        }
+        result += hsum_pd(_mm256_add_ps(_mm256_add_ps(v_sum0, v_sum1), _mm256_add_ps(v_sum2, v_sum3)));
+        for (; i < end; ++i) {
+            if (mask == nullptr || mask[i]) {
+                result += is_l1 ? std::abs(src[i]) : static_cast<double>(src[i]) * src[i];
+            }
+        }
+    }
+    return result;
+}
+
+template <>
+void minmax_row_fma<uint8_t>(
+    int32_t length,
+    const uint8_t *src,
+    const uint8_t *mask,
+    double *minVal,
+    double *maxVal)
+{
+    const __m256i v_ones = _mm256_set1_epi8(-1);
+    __m256i v_min        = v_ones;
+    __m256i v_max        = _mm256_setzero_si256();
+    int32_t i            = 0;
+    for (; i <= length - 32; i += 32) {
+        __m256i v_src = _mm256_loadu_si256((const __m256i *)(src + i));
+        if (mask != nullptr) {
+            // unselected elements become 255 for min and 0 for max
+            __m256i v_msk = _mm256_loadu_si256((const __m256i *)(mask + i));
+            v_min         = _mm256_min_epu8(v_min, _mm256_or_si256(v_src, _mm256_xor_si256(v_msk, v_ones)));
+            v_max         = _mm256_max_epu8(v_max, _mm256_and_si256(v_src, v_msk));
+        } else {
+            v_min = _mm256_min_epu8(v_min, v_src);
+            v_max = _mm256_max_epu8(v_max, v_src);
+        }
+    }
+    __m128i v_min128 = _mm_min_epu8(_mm256_castsi256_si128(v_min), _mm256_extracti128_si256(v_min, 1));
+    __m128i v_max128 = _mm_max_epu8(_mm256_castsi256_si128(v_max), _mm256_extracti128_si256(v_max, 1));
+    v_min128 = _mm_min_epu8(v_min128, _mm_srli_si128(v_min128, 8));
+    v_max128 = _mm_max_epu8(v_max128, _mm_srli_si128(v_max128, 8));
+    v_min128 = _mm_min_epu8(v_min128, _mm_srli_si128(v_min128, 4));
+    v_max128 = _mm_max_epu8(v_max128, _mm_srli_si128(v_max128, 4));
+    v_min128 = _mm_min_epu8(v_min128, _mm_srli_si128(v_min128, 2));
+    v_max128 = _mm_max_epu8(v_max128, _mm_srli_si128(v_max128, 2));
+    v_min128 = _mm_min_epu8(v_min128, _mm_srli_si128(v_min128, 1));
+    v_max128 = _mm_max_epu8(v_max128, _mm_srli_si128(v_max128, 1));
+    int32_t min_value = _mm_cvtsi128_si32(v_min128) & 0xff;
+    int32_t max_value = _mm_cvtsi128_si32(v_max128) & 0xff;
+    for (; i < length; ++i) {
+        if (mask == nullptr || mask[i]) {
+            min_value = std::min<int32_t>(min_value, src[i]);
+            max_value = std::max<int32_t>(max_value, src[i]);
+        }
+    }
+    *minVal = std::min<double>(*minVal, min_value);
+    *maxVal = std::max<double>(*maxVal, max_value);
+}
+
+template <>
+void minmax_row_fma<float>(
+    int32_t length,
+    const float *src,
+    const uint8_t *mask,
+    double *minVal,
+    double *maxVal)
+{
+    const __m256 v_pos = _mm256_set1_ps(FLT_MAX);
+    const __m256 v_neg = _mm256_set1_ps(-FLT_MAX);
+    __m256 v_min0 = v_pos, v_min1 = v_pos;
+    __m256 v_max0 = v_neg, v_max1 = v_neg;
+    int32_t i     = 0;
+    for (; i <= length - 16; i += 16) {
+        __m256 v_src0 = _mm256_loadu_ps(src + i);
+        __m256 v_src1 = _mm256_loadu_ps(src + i + 8);
+        if (mask != nullptr) {
+            __m256 v_msk0 = load_mask_ps(mask + i);
+            __m256 v_msk1 = load_mask_ps(mask + i + 8);
+            v_min0        = _mm256_min_ps(v_min0, _mm256_blendv_ps(v_pos, v_src0, v_msk0));
+            v_min1        = _mm256_min_ps(v_min1, _mm256_blendv_ps(v_pos, v_src1, v_msk1));
+            v_max0        = _mm256_max_ps(v_max0, _mm256_blendv_ps(v_neg, v_src0, v_msk0));
+            v_max1        = _mm256_max_ps(v_max1, _mm256_blendv_ps(v_neg, v_src1, v_msk1));
+        } else {
+            v_min0 = _mm256_min_ps(v_min0, v_src0);
+            v_min1 = _mm256_min_ps(v_min1, v_src1);
+            v_max0 = _mm256_max_ps(v_max0, v_src0);
+            v_max1 = _mm256_max_ps(v_max1, v_src1);
+        }
+    }
+    float buf_min[8], buf_max[8];
+    _mm256_storeu_ps(buf_min, _mm256_min_ps(v_min0, v_min1));
+    _mm256_storeu_ps(buf_max, _mm256_max_ps(v_max0, v_max1));
+    float min_value = *std::min_element(buf_min, buf_min + 8);
+    float max_value = *std::max_element(buf_max, buf_max + 8);
+    for (; i < length; ++i) {
+        if (mask == nullptr || mask[i]) {
+            min_value = std::min(min_value, src[i]);
+            max_value = std::max(max_value, src[i]);
+        }
+    }
+    *minVal = std::min<double>(*minVal, min_value);
+    *maxVal = std::max<double>(*maxVal, max_value);
+}
+
+template <>
+void normalize_row_fma<uint8_t>(
+    int32_t length,
+    const uint8_t *src,
+    const uint8_t *mask,
+    float scale,
+    float shift,
+    float *dst)
+{
+    __m256 v_scale = _mm256_set1_ps(scale);
+    __m256 v_shift = _mm256_set1_ps(shift);
+    int32_t i      = 0;
+    for (; i <= length - 32; i += 32) {
+        for (int32_t k = 0; k < 32; k += 8) {
+            __m256i v_src = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(src + i + k)));
+            __m256 v_dst  = _mm256_fmadd_ps(_mm256_cvtepi32_ps(v_src), v_scale, v_shift);
+            if (mask != nullptr) {
+                v_dst = _mm256_and_ps(v_dst, load_mask_ps(mask + i + k));
+            }
+            _mm256_storeu_ps(dst + i + k, v_dst);
+        }
+    }
+    for (; i < length; ++i) {
+        dst[i] = (mask == nullptr || mask[i]) ? src[i] * scale + shift : 0.f;
+    }
+}
+
+template <>
+void normalize_row_fma<float>(
+    int32_t length,
+    const float *src,
+    const uint8_t *mask,
+    float scale,
+    float shift,
+    float *dst)
+{
+    __m256 v_scale = _mm256_set1_ps(scale);
+    __m256 v_shift = _mm256_set1_ps(shift);
+    int32_t i      = 0;
+    for (; i <= length - 16; i += 16) {
+        __m256 v_dst0 = _mm256_fmadd_ps(_mm256_loadu_ps(src + i), v_scale, v_shift);
+        __m256 v_dst1 = _mm256_fmadd_ps(_mm256_loadu_ps(src + i + 8), v_scale, v_shift);
+        if (mask != nullptr) {
+            v_dst0 = _mm256_and_ps(v_dst0, load_mask_ps(mask + i));
+            v_dst1 = _mm256_and_ps(v_dst1, load_mask_ps(mask + i + 8));
+        }
+        _mm256_storeu_ps(dst + i, v_dst0);
+        _mm256_storeu_ps(dst + i + 8, v_dst1);
+    }
+    for (; i < length; ++i) {
+        dst[i] = (mask == nullptr || mask[i]) ? src[i] * scale + shift : 0.f;
+    }
+}
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -0,0 +1,526 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/x86/remap.hpp"
+#include "ppl/cv/types.h"
+#include <string.h>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+static inline void v_load_map(const int16_t *mapXY, __m256i &v_sx, __m256i &v_sy)
+{
+    __m256i v_xy = _mm256_loadu_si256((const __m256i *)mapXY);
+    v_sx         = _mm256_srai_epi32(_mm256_slli_epi32(v_xy, 16), 16);
+    v_sy         = _mm256_srai_epi32(v_xy, 16);
+}
+
+// lanes whose coordinates fall outside [0, maxX] x [0, maxY]
+static inline __m256i v_outside(__m256i v_sx, __m256i v_sy, __m256i v_maxX, __m256i v_maxY)
+{
+    const __m256i v_zero = _mm256_setzero_si256();
+    __m256i v_x          = _mm256_or_si256(_mm256_cmpgt_epi32(v_zero, v_sx), _mm256_cmpgt_epi32(v_sx, v_maxX));
+    __m256i v_y          = _mm256_or_si256(_mm256_cmpgt_epi32(v_zero, v_sy), _mm256_cmpgt_epi32(v_sy, v_maxY));
+    return _mm256_or_si256(v_x, v_y);
+}
+
+// integer weights of the two taps of the top row and of the bottom row, packed as int16 pairs
+static inline void v_linear_weights(const uint16_t *mapFrac, __m256i &v_w01, __m256i &v_w23)
+{
+    const __m256i v_size = _mm256_set1_epi32(REMAP_INTER_TAB_SIZE);
+    __m256i v_frac       = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)mapFrac));
+    __m256i v_fx         = _mm256_and_si256(v_frac, _mm256_set1_epi32(REMAP_INTER_MASK));
+    __m256i v_fy         = _mm256_srli_epi32(v_frac, REMAP_INTER_BITS);
+    __m256i v_ix         = _mm256_sub_epi32(v_size, v_fx);
+    __m256i v_iy         = _mm256_sub_epi32(v_size, v_fy);
+    // the factors fit in the low 16 bits, so do the products
+    v_w01 = _mm256_or_si256(_mm256_mullo_epi16(v_ix, v_iy), _mm256_slli_epi32(_mm256_mullo_epi16(v_fx, v_iy), 16));
+    v_w23 = _mm256_or_si256(_mm256_mullo_epi16(v_ix, v_fy), _mm256_slli_epi32(_mm256_mullo_epi16(v_fx, v_fy), 16));
+}
+
+static inline __m256i v_linear_round(__m256i v_sum)
+{
+    return _mm256_srai_epi32(_mm256_add_epi32(v_sum, _mm256_set1_epi32(1 << (REMAP_WEIGHT_BITS - 1))), REMAP_WEIGHT_BITS);
+}
+
+// 8 pixels of the uint8_t linear remap, v_off holds the byte offsets of the top-left taps
+template <int32_t channels>
+static inline void remap_linear_u8_block(
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    __m256i v_off,
+    const uint16_t *mapFrac,
+    uint8_t *outData)
+{
+    const __m256i v_zero   = _mm256_setzero_si256();
+    const uint8_t *inData1 = inData + inWidthStride;
+    __m256i v_w01, v_w23;
+    v_linear_weights(mapFrac, v_w01, v_w23);
+
+    if (channels == 1) {
+        const __m256i v_pair = _mm256_setr_epi8(0, -1, 1, -1, 4, -1, 5, -1, 8, -1, 9, -1, 12, -1, 13, -1, 0, -1, 1, -1, 4, -1, 5, -1, 8, -1, 9, -1, 12, -1, 13, -1);
+        __m256i v_top        = _mm256_i32gather_epi32((const int *)inData, v_off, 1);
+        __m256i v_bottom     = _mm256_i32gather_epi32((const int *)inData1, v_off, 1);
+        __m256i v_sum        = _mm256_add_epi32(_mm256_madd_epi16(_mm256_shuffle_epi8(v_top, v_pair), v_w01),
+                                         _mm256_madd_epi16(_mm256_shuffle_epi8(v_bottom, v_pair), v_w23));
+        v_sum                = v_linear_round(v_sum);
+        v_sum                = _mm256_packus_epi16(_mm256_packs_epi32(v_sum, v_sum), v_zero);
+        _mm_storel_epi64((__m128i *)outData, _mm_unpacklo_epi32(_mm256_castsi256_si128(v_sum), _mm256_extracti128_si256(v_sum, 1)));
+        return;
+    }
+    // interleaves the channels of the left and the right tap of every 64-bit lane
+    const __m256i v_pair = channels == 4 ? _mm256_setr_epi8(0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15)
+                                         : _mm256_setr_epi8(0, 3, 1, 4, 2, 5, -1, -1, 8, 11, 9, 12, 10, 13, -1, -1, 0, 3, 1, 4, 2, 5, -1, -1, 8, 11, 9, 12, 10, 13, -1, -1);
+    __m256i v_res[2];
+    for (int32_t g = 0; g < 2; ++g) {
+        __m128i v_idx    = g == 0 ? _mm256_castsi256_si128(v_off) : _mm256_extracti128_si256(v_off, 1);
+        __m256i v_top    = _mm256_shuffle_epi8(_mm256_i32gather_epi64((const long long *)inData, v_idx, 1), v_pair);
+        __m256i v_bottom = _mm256_shuffle_epi8(_mm256_i32gather_epi64((const long long *)inData1, v_idx, 1), v_pair);
+        // the low half of every 128-bit lane holds pixels 4g and 4g + 2, the high half 4g + 1 and 4g + 3
+        __m256i v_sel_lo = _mm256_setr_epi32(4 * g, 4 * g, 4 * g, 4 * g, 4 * g + 2, 4 * g + 2, 4 * g + 2, 4 * g + 2);
+        __m256i v_sel_hi = _mm256_add_epi32(v_sel_lo, _mm256_set1_epi32(1));
+        __m256i v_lo     = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi8(v_top, v_zero), _mm256_permutevar8x32_epi32(v_w01, v_sel_lo)),
+                                        _mm256_madd_epi16(_mm256_unpacklo_epi8(v_bottom, v_zero), _mm256_permutevar8x32_epi32(v_w23, v_sel_lo)));
+        __m256i v_hi     = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi8(v_top, v_zero), _mm256_permutevar8x32_epi32(v_w01, v_sel_hi)),
+                                        _mm256_madd_epi16(_mm256_unpackhi_epi8(v_bottom, v_zero), _mm256_permutevar8x32_epi32(v_w23, v_sel_hi)));
+        v_res[g]         = _mm256_packs_epi32(v_linear_round(v_lo), v_linear_round(v_hi));
+    }
+    // 4-byte pixels 0 1 4 5 | 2 3 6 7 back to 0 .. 7
+    __m256i v_dst = _mm256_permute4x64_epi64(_mm256_packus_epi16(v_res[0], v_res[1]), _MM_SHUFFLE(3, 1, 2, 0));
+    if (channels == 4) {
+        _mm256_storeu_si256((__m256i *)outData, v_dst);
+    } else {
+        const __m128i v_pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+        __m128i v_dst0       = _mm_shuffle_epi8(_mm256_castsi256_si128(v_dst), v_pack);
+        __m128i v_dst1       = _mm_shuffle_epi8(_mm256_extracti128_si256(v_dst, 1), v_pack);
+        _mm_storeu_si128((__m128i *)outData, v_dst0);
+        _mm_storel_epi64((__m128i *)(outData + 12), v_dst1);
+        int32_t last = _mm_extract_epi32(v_dst1, 2);
+        memcpy(outData + 20, &last, sizeof(last));
+    }
+}
+
+static inline __m256i v_tap_offset(__m256i v_sx, __m256i v_sy, __m256i v_stride, int32_t channels)
+{
+    __m256i v_x = channels == 1 ? v_sx : (channels == 4 ? _mm256_slli_epi32(v_sx, 2) : _mm256_mullo_epi32(v_sx, _mm256_set1_epi32(channels)));
+    return _mm256_add_epi32(_mm256_mullo_epi32(v_sy, v_stride), v_x);
+}
+
+template <int32_t channels, BorderType border_type>
+void remap_linear_u8_fma(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData)
+{
+    // one 32-bit gather holds both taps of a row for 1 channel, one 64-bit gather for 3 and 4 channels,
+    // a block whose bottom gather would run past the last byte of the image takes the scalar path
+    const int32_t fetch    = channels == 1 ? 4 : 8;
+    const __m256i v_maxX   = _mm256_set1_epi32(inWidth - 2);
+    const __m256i v_maxY   = _mm256_set1_epi32(inHeight - 2);
+    const __m256i v_stride = _mm256_set1_epi32(inWidthStride);
+    const __m256i v_maxOff = _mm256_set1_epi32((inHeight - 2) * inWidthStride + inWidth * channels - fetch);
+
+    int32_t j = 0;
+    for (; j <= outWidth - 8; j += 8) {
+        __m256i v_sx, v_sy;
+        v_load_map(mapXY + j * 2, v_sx, v_sy);
+        __m256i v_bad = v_outside(v_sx, v_sy, v_maxX, v_maxY);
+        __m256i v_off = v_tap_offset(v_sx, v_sy, v_stride, channels);
+        v_bad         = _mm256_or_si256(v_bad, _mm256_cmpgt_epi32(v_off, v_maxOff));
+        if (_mm256_testz_si256(v_bad, v_bad)) {
+            remap_linear_u8_block<channels>(inWidthStride, inData, v_off, mapFrac + j, outData + j * channels);
+            continue;
+        }
+        for (int32_t k = j; k < j + 8; ++k) {
+            remap_linear_pixel<uint8_t, channels, border_type>(inHeight, inWidth, inWidthStride, inData, mapXY[2 * k], mapXY[2 * k + 1], mapFrac[k], border_value, outData + k * channels);
+        }
+    }
+    for (; j < outWidth; ++j) {
+        remap_linear_pixel<uint8_t, channels, border_type>(inHeight, inWidth, inWidthStride, inData, mapXY[2 * j], mapXY[2 * j + 1], mapFrac[j], border_value, outData + j * channels);
+    }
+}
+
+template <int32_t channels>
+void remap_linear_u8_inner_fma(
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t *outData)
+{
+    const __m256i v_stride = _mm256_set1_epi32(inWidthStride);
+    int32_t j              = 0;
+    for (; j <= outWidth - 8; j += 8) {
+        __m256i v_sx, v_sy;
+        v_load_map(mapXY + j * 2, v_sx, v_sy);
+        remap_linear_u8_block<channels>(inWidthStride, inData, v_tap_offset(v_sx, v_sy, v_stride, channels), mapFrac + j, outData + j * channels);
+    }
+    for (; j < outWidth; ++j) {
+        remap_linear_interior<uint8_t, channels>(inWidthStride, inData, mapXY[2 * j], mapXY[2 * j + 1], mapFrac[j], outData + j * channels);
+    }
+}
+
+static inline void remap_linear_f32c1_block(
+    int32_t inWidthStride,
+    const float *inData,
+    __m256i v_idx,
+    const uint16_t *mapFrac,
+    float *outData)
+{
+    const __m256 v_one   = _mm256_set1_ps(1.0f);
+    const __m256 v_scale = _mm256_set1_ps(1.0f / REMAP_INTER_TAB_SIZE);
+    const float *inData1 = inData + inWidthStride;
+    __m256i v_frac       = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)mapFrac));
+    __m256 v_fx          = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(v_frac, _mm256_set1_epi32(REMAP_INTER_MASK))), v_scale);
+    __m256 v_fy          = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(v_frac, REMAP_INTER_BITS)), v_scale);
+    __m256 v_ix          = _mm256_sub_ps(v_one, v_fx);
+    __m256 v_iy          = _mm256_sub_ps(v_one, v_fy);
+
+    __m256 v_sum = _mm256_mul_ps(_mm256_i32gather_ps(inData, v_idx, 4), _mm256_mul_ps(v_ix, v_iy));
+    v_sum        = _mm256_fmadd_ps(_mm256_i32gather_ps(inData + 1, v_idx, 4), _mm256_mul_ps(v_fx, v_iy), v_sum);
+    v_sum        = _mm256_fmadd_ps(_mm256_i32gather_ps(inData1, v_idx, 4), _mm256_mul_ps(v_ix, v_fy), v_sum);
+    v_sum        = _mm256_fmadd_ps(_mm256_i32gather_ps(inData1 + 1, v_idx, 4), _mm256_mul_ps(v_fx, v_fy), v_sum);
+    _mm256_storeu_ps(outData, v_sum);
+}
+
+template <BorderType border_type>
+void remap_linear_f32c1_fma(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    float border_value,
+    float *outData)
+{
+    const __m256i v_maxX   = _mm256_set1_epi32(inWidth - 2);
+    const __m256i v_maxY   = _mm256_set1_epi32(inHeight - 2);
+    const __m256i v_stride = _mm256_set1_epi32(inWidthStride);
+
+    int32_t j = 0;
+    for (; j <= outWidth - 8; j += 8) {
+        __m256i v_sx, v_sy;
+        v_load_map(mapXY + j * 2, v_sx, v_sy);
+        __m256i v_bad = v_outside(v_sx, v_sy, v_maxX, v_maxY);
+        if (_mm256_testz_si256(v_bad, v_bad)) {
+            remap_linear_f32c1_block(inWidthStride, inData, v_tap_offset(v_sx, v_sy, v_stride, 1), mapFrac + j, outData + j);
+            continue;
+        }
+        for (int32_t k = j; k < j + 8; ++k) {
+            remap_linear_pixel<float, 1, border_type>(inHeight, inWidth, inWidthStride, inData, mapXY[2 * k], mapXY[2 * k + 1], mapFrac[k], border_value, outData + k);
+        }
+    }
+    for (; j < outWidth; ++j) {
+        remap_linear_pixel<float, 1, border_type>(inHeight, inWidth, inWidthStride, inData, mapXY[2 * j], mapXY[2 * j + 1], mapFrac[j], border_value, outData + j);
+    }
+}
+
+void remap_linear_f32c1_inner_fma(
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    float *outData)
+{
+    const __m256i v_stride = _mm256_set1_epi32(inWidthStride);
+    int32_t j              = 0;
+    for (; j <= outWidth - 8; j += 8) {
+        __m256i v_sx, v_sy;
+        v_load_map(mapXY + j * 2, v_sx, v_sy);
+        remap_linear_f32c1_block(inWidthStride, inData, v_tap_offset(v_sx, v_sy, v_stride, 1), mapFrac + j, outData + j);
+    }
+    for (; j < outWidth; ++j) {
+        remap_linear_interior<float, 1>(inWidthStride, inData, mapXY[2 * j], mapXY[2 * j + 1], mapFrac[j], outData + j);
+    }
+}
+
+template <BorderType border_type>
+void remap_nearest_4byte_fma(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    int32_t border_pixel,
+    uint8_t *outData)
+{
+    const __m256i v_maxX   = _mm256_set1_epi32(inWidth - 1);
+    const __m256i v_maxY   = _mm256_set1_epi32(inHeight - 1);
+    const __m256i v_stride = _mm256_set1_epi32(inWidthStride);
+    const __m256i v_zero   = _mm256_setzero_si256();
+    const __m256i v_border = _mm256_set1_epi32(border_pixel);
+
+    int32_t j = 0;
+    for (; j <= outWidth - 8; j += 8) {
+        __m256i v_sx, v_sy;
+        v_load_map(mapXY + j * 2, v_sx, v_sy);
+        __m256i *dst = (__m256i *)(outData + j * 4);
+        if (border_type == BORDER_TYPE_REPLICATE) {
+            v_sx          = _mm256_min_epi32(_mm256_max_epi32(v_sx, v_zero), v_maxX);
+            v_sy          = _mm256_min_epi32(_mm256_max_epi32(v_sy, v_zero), v_maxY);
+            __m256i v_off = v_tap_offset(v_sx, v_sy, v_stride, 4);
+            _mm256_storeu_si256(dst, _mm256_i32gather_epi32((const int *)inData, v_off, 1));
+            continue;
+        }
+        __m256i v_in  = _mm256_andnot_si256(v_outside(v_sx, v_sy, v_maxX, v_maxY), _mm256_set1_epi32(-1));
+        __m256i v_off = v_tap_offset(v_sx, v_sy, v_stride, 4);
+        __m256i v_dst = _mm256_mask_i32gather_epi32(v_border, (const int *)inData, v_off, v_in, 1);
+        if (border_type == BORDER_TYPE_CONSTANT) {
+            _mm256_storeu_si256(dst, v_dst);
+        } else {
+            _mm256_maskstore_epi32((int *)dst, v_in, v_dst);
+        }
+    }
+    for (; j < outWidth; ++j) {
+        int32_t sx = mapXY[2 * j], sy = mapXY[2 * j + 1];
+        if (border_type == BORDER_TYPE_REPLICATE) {
+            sx = sx < 0 ? 0 : (sx >= inWidth ? inWidth - 1 : sx);
+            sy = sy < 0 ? 0 : (sy >= inHeight ? inHeight - 1 : sy);
+        }
+        if ((uint32_t)sx < (uint32_t)inWidth && (uint32_t)sy < (uint32_t)inHeight) {
+            memcpy(outData + j * 4, inData + sy * inWidthStride + sx * 4, 4);
+        } else if (border_type == BORDER_TYPE_CONSTANT) {
+            memcpy(outData + j * 4, &border_pixel, 4);
+        }
+    }
+}
+
+void remap_nearest_4byte_inner_fma(
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    uint8_t *outData)
+{
+    const __m256i v_stride = _mm256_set1_epi32(inWidthStride);
+    int32_t j              = 0;
+    for (; j <= outWidth - 8; j += 8) {
+        __m256i v_sx, v_sy;
+        v_load_map(mapXY + j * 2, v_sx, v_sy);
+        __m256i v_off = v_tap_offset(v_sx, v_sy, v_stride, 4);
+        _mm256_storeu_si256((__m256i *)(outData + j * 4), _mm256_i32gather_epi32((const int *)inData, v_off, 1));
+    }
+    for (; j < outWidth; ++j) {
+        memcpy(outData + j * 4, inData + mapXY[2 * j + 1] * inWidthStride + mapXY[2 * j] * 4, 4);
+    }
+}
+
+template void remap_linear_u8_fma<1, BORDER_TYPE_CONSTANT>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData);
+
+template void remap_linear_u8_fma<1, BORDER_TYPE_REPLICATE>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData);
+
+template void remap_linear_u8_fma<1, BORDER_TYPE_TRANSPARENT>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData);
+
+template void remap_linear_u8_fma<3, BORDER_TYPE_CONSTANT>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData);
+
+template void remap_linear_u8_fma<3, BORDER_TYPE_REPLICATE>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData);
+
+template void remap_linear_u8_fma<3, BORDER_TYPE_TRANSPARENT>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData);
+
+template void remap_linear_u8_fma<4, BORDER_TYPE_CONSTANT>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData);
+
+template void remap_linear_u8_fma<4, BORDER_TYPE_REPLICATE>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData);
+
+template void remap_linear_u8_fma<4, BORDER_TYPE_TRANSPARENT>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData);
+
+template void remap_linear_u8_inner_fma<1>(
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t *outData);
+
+template void remap_linear_u8_inner_fma<3>(
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t *outData);
+
+template void remap_linear_u8_inner_fma<4>(
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t *outData);
+
+template void remap_linear_f32c1_fma<BORDER_TYPE_CONSTANT>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    float border_value,
+    float *outData);
+
+template void remap_linear_f32c1_fma<BORDER_TYPE_REPLICATE>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    float border_value,
+    float *outData);
+
+template void remap_linear_f32c1_fma<BORDER_TYPE_TRANSPARENT>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    float border_value,
+    float *outData);
+
+template void remap_nearest_4byte_fma<BORDER_TYPE_CONSTANT>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    int32_t border_pixel,
+    uint8_t *outData);
+
+template void remap_nearest_4byte_fma<BORDER_TYPE_REPLICATE>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    int32_t border_pixel,
+    uint8_t *outData);
+
+template void remap_nearest_4byte_fma<BORDER_TYPE_TRANSPARENT>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    int32_t border_pixel,
+    uint8_t *outData);
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
@@ -0,0 +1,210 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include <stdint.h>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+template <int32_t type, typename T>
+static inline T threshold_scalar(T value, T thresh, T maxval)
+{
+    switch (type) {
+        case CV_THRESH_BINARY:
+            return value > thresh ? maxval : 0;
+        case CV_THRESH_BINARY_INV:
+            return value > thresh ? 0 : maxval;
+        case CV_THRESH_TRUNC:
+            return value > thresh ? thresh : value;
+        case CV_THRESH_TOZERO:
+            return value > thresh ? value : 0;
+        default:
+            return value > thresh ? 0 : value;
+    }
+}
+
+template <int32_t type>
+static inline __m256i threshold_vec_u8(__m256i v_src, __m256i v_thresh, __m256i v_thresh1, __m256i v_maxval)
+{
+    __m256i v_mask = _mm256_cmpeq_epi8(_mm256_max_epu8(v_src, v_thresh1), v_src);
+    switch (type) {
+        case CV_THRESH_BINARY:
+            return _mm256_and_si256(v_mask, v_maxval);
+        case CV_THRESH_BINARY_INV:
+            return _mm256_andnot_si256(v_mask, v_maxval);
+        case CV_THRESH_TRUNC:
+            return _mm256_min_epu8(v_src, v_thresh);
+        case CV_THRESH_TOZERO:
+            return _mm256_and_si256(v_mask, v_src);
+        default:
+            return _mm256_andnot_si256(v_mask, v_src);
+    }
+}
+
+template <int32_t type>
+static inline __m256 threshold_vec_f32(__m256 v_src, __m256 v_thresh, __m256 v_maxval)
+{
+    __m256 v_mask = _mm256_cmp_ps(v_src, v_thresh, _CMP_GT_OQ);
+    switch (type) {
+        case CV_THRESH_BINARY:
+            return _mm256_and_ps(v_mask, v_maxval);
+        case CV_THRESH_BINARY_INV:
+            return _mm256_andnot_ps(v_mask, v_maxval);
+        case CV_THRESH_TRUNC:
+            return _mm256_blendv_ps(v_src, v_thresh, v_mask);
+        case CV_THRESH_TOZERO:
+            return _mm256_and_ps(v_mask, v_src);
+        default:
+            return _mm256_andnot_ps(v_mask, v_src);
+    }
+}
+
+template <int32_t type>
+static void threshold_u8_kernel(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t thresh,
+    uint8_t maxval)
+{
+    __m256i v_thresh1 = _mm256_set1_epi8(static_cast<char>(thresh + 1));
+    __m256i v_thresh  = _mm256_set1_epi8(static_cast<char>(thresh));
+    __m256i v_maxval  = _mm256_set1_epi8(static_cast<char>(maxval));
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 64; j += 64) {
+            __m256i v_src0 = _mm256_loadu_si256((const __m256i *)(src + j));
+            __m256i v_src1 = _mm256_loadu_si256((const __m256i *)(src + j + 32));
+            _mm256_storeu_si256((__m256i *)(dst + j), threshold_vec_u8<type>(v_src0, v_thresh, v_thresh1, v_maxval));
+            _mm256_storeu_si256((__m256i *)(dst + j + 32), threshold_vec_u8<type>(v_src1, v_thresh, v_thresh1, v_maxval));
+        }
+        for (; j <= width - 32; j += 32) {
+            __m256i v_src = _mm256_loadu_si256((const __m256i *)(src + j));
+            _mm256_storeu_si256((__m256i *)(dst + j), threshold_vec_u8<type>(v_src, v_thresh, v_thresh1, v_maxval));
+        }
+        for (; j < width; ++j) {
+            dst[j] = threshold_scalar<type, uint8_t>(src[j], thresh, maxval);
+        }
+    }
+}
+
+template <int32_t type>
+static void threshold_f32_kernel(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float thresh,
+    float maxval)
+{
+    __m256 v_thresh = _mm256_set1_ps(thresh);
+    __m256 v_maxval = _mm256_set1_ps(maxval);
+    for (int32_t i = 0; i < height; ++i) {
+        const float *src = inData + i * inWidthStride;
+        float *dst       = outData + i * outWidthStride;
+        int32_t j        = 0;
+        for (; j <= width - 16; j += 16) {
+            __m256 v_src0 = _mm256_loadu_ps(src + j);
+            __m256 v_src1 = _mm256_loadu_ps(src + j + 8);
+            _mm256_storeu_ps(dst + j, threshold_vec_f32<type>(v_src0, v_thresh, v_maxval));
+            _mm256_storeu_ps(dst + j + 8, threshold_vec_f32<type>(v_src1, v_thresh, v_maxval));
+        }
+        for (; j <= width - 8; j += 8) {
+            _mm256_storeu_ps(dst + j, threshold_vec_f32<type>(_mm256_loadu_ps(src + j), v_thresh, v_maxval));
+        }
+        for (; j < width; ++j) {
+            dst[j] = threshold_scalar<type, float>(src[j], thresh, maxval);
+        }
+    }
+}
+
+void threshold_u8_fma(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t thresh,
+    uint8_t maxval,
+    int32_t thresholdType)
+{
+    switch (thresholdType) {
+        case CV_THRESH_BINARY:
+            threshold_u8_kernel<CV_THRESH_BINARY>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval);
+            break;
+        case CV_THRESH_BINARY_INV:
+            threshold_u8_kernel<CV_THRESH_BINARY_INV>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval);
+            break;
+        case CV_THRESH_TRUNC:
+            threshold_u8_kernel<CV_THRESH_TRUNC>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval);
+            break;
+        case CV_THRESH_TOZERO:
+            threshold_u8_kernel<CV_THRESH_TOZERO>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval);
+            break;
+        default:
+            threshold_u8_kernel<CV_THRESH_TOZERO_INV>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval);
+            break;
+    }
+}
+
+void threshold_f32_fma(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float thresh,
+    float maxval,
+    int32_t thresholdType)
+{
+    switch (thresholdType) {
+        case CV_THRESH_BINARY:
+            threshold_f32_kernel<CV_THRESH_BINARY>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval);
+            break;
+        case CV_THRESH_BINARY_INV:
+            threshold_f32_kernel<CV_THRESH_BINARY_INV>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval);
+            break;
+        case CV_THRESH_TRUNC:
+            threshold_f32_kernel<CV_THRESH_TRUNC>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval);
+            break;
+        case CV_THRESH_TOZERO:
+            threshold_f32_kernel<CV_THRESH_TOZERO>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval);
+            break;
+        default:
+            threshold_f32_kernel<CV_THRESH_TOZERO_INV>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval);
+            break;
+    }
+}
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
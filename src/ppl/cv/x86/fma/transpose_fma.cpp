@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+// 64x64 tiles of 4-byte pixels keep input plus output at 32KB
+#define TRANSPOSE_TILE_32BIT 64
+
+static inline void transpose_8x8_32bit(const uint8_t *src, int32_t srcStep, uint8_t *dst, int32_t dstStep)
+{
+    __m256 r0 = _mm256_loadu_ps((const float *)(src));
+    __m256 r1 = _mm256_loadu_ps((const float *)(src + srcStep));
+    __m256 r2 = _mm256_loadu_ps((const float *)(src + 2 * srcStep));
+    __m256 r3 = _mm256_loadu_ps((const float *)(src + 3 * srcStep));
+    __m256 r4 = _mm256_loadu_ps((const float *)(src + 4 * srcStep));
+    __m256 r5 = _mm256_loadu_ps((const float *)(src + 5 * srcStep));
+    __m256 r6 = _mm256_loadu_ps((const float *)(src + 6 * srcStep));
+    __m256 r7 = _mm256_loadu_ps((const float *)(src + 7 * srcStep));
+
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+    __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+    __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+    __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+    __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    _mm256_storeu_ps((float *)(dst), _mm256_permute2f128_ps(s0, s4, 0x20));
+    _mm256_storeu_ps((float *)(dst + dstStep), _mm256_permute2f128_ps(s1, s5, 0x20));
+    _mm256_storeu_ps((float *)(dst + 2 * dstStep), _mm256_permute2f128_ps(s2, s6, 0x20));
+    _mm256_storeu_ps((float *)(dst + 3 * dstStep), _mm256_permute2f128_ps(s3, s7, 0x20));
+    _mm256_storeu_ps((float *)(dst + 4 * dstStep), _mm256_permute2f128_ps(s0, s4, 0x31));
+    _mm256_storeu_ps((float *)(dst + 5 * dstStep), _mm256_permute2f128_ps(s1, s5, 0x31));
+    _mm256_storeu_ps((float *)(dst + 6 * dstStep), _mm256_permute2f128_ps(s2, s6, 0x31));
+    _mm256_storeu_ps((float *)(dst + 7 * dstStep), _mm256_permute2f128_ps(s3, s7, 0x31));
+}
+
+static inline void transpose_scalar_32bit(
+    int32_t i0,
+    int32_t i1,
+    int32_t j0,
+    int32_t j1,
+    const uint8_t *src,
+    int32_t srcStep,
+    uint8_t *dst,
+    int32_t dstStep)
+{
+    for (int32_t j = j0; j < j1; ++j) {
+        uint8_t *dst_row = dst + j * dstStep;
+        for (int32_t i = i0; i < i1; ++i) {
+            memcpy(dst_row + i * 4, src + i * srcStep + j * 4, 4);
+        }
+    }
+}
+
+void transpose_32bit_fma(
+    int32_t height,
+    int32_t width,
+    const uint8_t *src,
+    int32_t srcStep,
+    uint8_t *dst,
+    int32_t dstStep)
+{
+    const int32_t tile      = TRANSPOSE_TILE_32BIT;
+    const int32_t tile_rows = (height + tile - 1) / tile;
+#pragma omp parallel for
+    for (int32_t ti = 0; ti < tile_rows; ++ti) {
+        int32_t i0 = ti * tile;
+        int32_t i1 = std::min(i0 + tile, height);
+        for (int32_t j0 = 0; j0 < width; j0 += tile) {
+            int32_t j1 = std::min(j0 + tile, width);
+            int32_t i  = i0;
+            for (; i <= i1 - 8; i += 8) {
+                int32_t j = j0;
+                for (; j <= j1 - 8; j += 8) {
+                    transpose_8x8_32bit(src + i * srcStep + j * 4, srcStep, dst + j * dstStep + i * 4, dstStep);
+                }
+                transpose_scalar_32bit(i, i + 8, j, j1, src, srcStep, dst, dstStep);
+            }
+            transpose_scalar_32bit(i, i1, j0, j1, src, srcStep, dst, dstStep);
+        }
+    }
+}
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
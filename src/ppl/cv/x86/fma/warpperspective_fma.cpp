@@ -0,0 +1,159 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/x86/remap.hpp"
+#include "ppl/cv/types.h"
+#include <string.h>
+#include <limits.h>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+namespace fma {
+
+// rounded X / W and Y / W of 4 pixels, 1 / W comes from rcp and two Newton steps in double
+static inline void v_project(__m256d v_X, __m256d v_Y, __m256d v_W, __m256d v_scale, __m128i &v_x, __m128i &v_y)
+{
+    const __m256d v_two = _mm256_set1_pd(2.0);
+    const __m256d v_min = _mm256_set1_pd(INT_MIN);
+    const __m256d v_max = _mm256_set1_pd(INT_MAX);
+    __m256d v_r         = _mm256_cvtps_pd(_mm_rcp_ps(_mm256_cvtpd_ps(v_W)));
+    v_r                 = _mm256_mul_pd(v_r, _mm256_fnmadd_pd(v_W, v_r, v_two));
+    v_r                 = _mm256_mul_pd(v_r, _mm256_fnmadd_pd(v_W, v_r, v_two));
+    // W == 0 projects to the origin, the same as cv::warpPerspective
+    v_r = _mm256_and_pd(_mm256_mul_pd(v_r, v_scale), _mm256_cmp_pd(v_W, _mm256_setzero_pd(), _CMP_NEQ_OQ));
+    v_x = _mm256_cvtpd_epi32(_mm256_min_pd(_mm256_max_pd(_mm256_mul_pd(v_X, v_r), v_min), v_max));
+    v_y = _mm256_cvtpd_epi32(_mm256_min_pd(_mm256_max_pd(_mm256_mul_pd(v_Y, v_r), v_min), v_max));
+}
+
+template <bool linear>
+void warpperspective_coords_fma(
+    const double *M,
+    int32_t y,
+    int32_t width,
+    int32_t maxX,
+    int32_t maxY,
+    int16_t *mapXY,
+    uint16_t *mapFrac,
+    int32_t *span)
+{
+    const __m256d v_scale = _mm256_set1_pd(linear ? REMAP_INTER_TAB_SIZE : 1.0);
+    const __m256d v_seq   = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+    // X, Y and W of 4 consecutive pixels, stepped along the row by adds
+    __m256d v_X        = _mm256_fmadd_pd(_mm256_set1_pd(M[0]), v_seq, _mm256_set1_pd(M[1] * y + M[2]));
+    __m256d v_Y        = _mm256_fmadd_pd(_mm256_set1_pd(M[3]), v_seq, _mm256_set1_pd(M[4] * y + M[5]));
+    __m256d v_W        = _mm256_fmadd_pd(_mm256_set1_pd(M[6]), v_seq, _mm256_set1_pd(M[7] * y + M[8]));
+    const __m256d v_dX = _mm256_set1_pd(M[0] * 4);
+    const __m256d v_dY = _mm256_set1_pd(M[3] * 4);
+    const __m256d v_dW = _mm256_set1_pd(M[6] * 4);
+
+    const __m256i v_zero  = _mm256_setzero_si256();
+    const __m256i v_maxX  = _mm256_set1_epi32(maxX);
+    const __m256i v_maxY  = _mm256_set1_epi32(maxY);
+    const __m256i v_mask  = _mm256_set1_epi32(REMAP_INTER_MASK);
+    const __m256i v_s16lo = _mm256_set1_epi32(INT16_MIN);
+    const __m256i v_s16hi = _mm256_set1_epi32(INT16_MAX);
+    int32_t first = -1, last = -1, count = 0;
+    for (int32_t j = 0; j < width; j += 8) {
+        __m128i v_x0, v_y0, v_x1, v_y1;
+        v_project(v_X, v_Y, v_W, v_scale, v_x0, v_y0);
+        v_X = _mm256_add_pd(v_X, v_dX);
+        v_Y = _mm256_add_pd(v_Y, v_dY);
+        v_W = _mm256_add_pd(v_W, v_dW);
+        v_project(v_X, v_Y, v_W, v_scale, v_x1, v_y1);
+        v_X = _mm256_add_pd(v_X, v_dX);
+        v_Y = _mm256_add_pd(v_Y, v_dY);
+        v_W = _mm256_add_pd(v_W, v_dW);
+
+        __m256i v_x = _mm256_inserti128_si256(_mm256_castsi128_si256(v_x0), v_x1, 1);
+        __m256i v_y = _mm256_inserti128_si256(_mm256_castsi128_si256(v_y0), v_y1, 1);
+        uint16_t frac[8];
+        if (linear) {
+            __m256i v_frac = _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(v_y, v_mask), REMAP_INTER_BITS), _mm256_and_si256(v_x, v_mask));
+            _mm_storeu_si128((__m128i *)frac, _mm_packs_epi32(_mm256_castsi256_si128(v_frac), _mm256_extracti128_si256(v_frac, 1)));
+            v_x = _mm256_srai_epi32(v_x, REMAP_INTER_BITS);
+            v_y = _mm256_srai_epi32(v_y, REMAP_INTER_BITS);
+        }
+        __m256i v_out = _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi32(v_zero, v_x), _mm256_cmpgt_epi32(v_x, v_maxX)),
+                                        _mm256_or_si256(_mm256_cmpgt_epi32(v_zero, v_y), _mm256_cmpgt_epi32(v_y, v_maxY)));
+        v_x           = _mm256_min_epi32(_mm256_max_epi32(v_x, v_s16lo), v_s16hi);
+        v_y           = _mm256_min_epi32(_mm256_max_epi32(v_y, v_s16lo), v_s16hi);
+        __m256i v_xy  = _mm256_or_si256(_mm256_and_si256(v_x, _mm256_set1_epi32(0xffff)), _mm256_slli_epi32(v_y, 16));
+
+        const int32_t n = width - j < 8 ? width - j : 8;
+        int32_t inside  = ~_mm256_movemask_ps(_mm256_castsi256_ps(v_out)) & ((1 << n) - 1);
+        if (n == 8) {
+            _mm256_storeu_si256((__m256i *)(mapXY + j * 2), v_xy);
+            if (linear) {
+                memcpy(mapFrac + j, frac, sizeof(frac));
+            }
+        } else {
+            int32_t xy[8];
+            _mm256_storeu_si256((__m256i *)xy, v_xy);
+            memcpy(mapXY + j * 2, xy, n * sizeof(int32_t));
+            if (linear) {
+                memcpy(mapFrac + j, frac, n * sizeof(uint16_t));
+            }
+        }
+        if (inside == 0xff) {
+            first = first < 0 ? j : first;
+            last  = j + 7;
+            count += 8;
+        } else if (inside != 0) {
+            for (int32_t k = 0; k < n; ++k) {
+                if (inside & (1 << k)) {
+                    first = first < 0 ? j + k : first;
+                    last  = j + k;
+                    ++count;
+                }
+            }
+        }
+    }
+    span[0] = 0;
+    span[1] = 0;
+    if (count > 0 && count == last - first + 1) {
+        span[0] = first;
+        span[1] = last + 1;
+    }
+}
+
+template void warpperspective_coords_fma<true>(
+    const double *M,
+    int32_t y,
+    int32_t width,
+    int32_t maxX,
+    int32_t maxY,
+    int16_t *mapXY,
+    uint16_t *mapFrac,
+    int32_t *span);
+
+template void warpperspective_coords_fma<false>(
+    const double *M,
+    int32_t y,
+    int32_t width,
+    int32_t maxX,
+    int32_t maxY,
+    int16_t *mapXY,
+    uint16_t *mapFrac,
+    int32_t *span);
+
+}
+}
+}
+} // namespace ppl::cv::x86::fma
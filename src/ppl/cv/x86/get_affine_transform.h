@@ -18,6 +18,9 @@
 #ifndef __ST_HPC_PPL3_CV_X86_GET_AFFINE_TRANSFORM_H_
 #define __ST_HPC_PPL3_CV_X86_GET_AFFINE_TRANSFORM_H_
 
+#include "ppl/cv/types.h"
+#include "ppl/common/retcode.h"
+
 namespace ppl {
 namespace cv {
 namespace x86 {
@@ -28,7 +31,10 @@ namespace x86 {
 * @param dst_points               dst keypoints data, which has 3 points and each points has 2 double values (x, y)
 * @param mat                      transform matrix, 2x3 matrix. can be nullptr.
 * @param inverse_mat              transform matrix inversed, 2x3 matrix. can be nullptr.
+* @return RC_SUCCESS, or RC_INVALID_VALUE for bad arguments or when the src (or dst for inverse_mat) points are
+*         collinear, in which case that matrix is filled with zeros.
 * @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark This is the batch version below with a batch of 1.
 * <caption align="left">Requirements</caption>
 * <tr><td>x86 platforms supported<td> All
 * <tr><td>Header files<td> #include &lt;ppl/cv/x86/get_affine_transform.h&gt;
@@ -53,7 +59,51 @@ namespace x86 {
 * @endcode
 ***************************************************************************************************/
 
-void GetAffineTransform(
+::ppl::common::RetCode GetAffineTransform(
+    const double *src_points,
+    const double *dst_points,
+    double *mat,
+    double *inverse_mat);
+
+/**
+* @brief Calculates the affine transforms of a batch of point triples.
+* @param batch                    number of transforms
+* @param src_points               src keypoints data, 6 double values (x0, y0, x1, y1, x2, y2) per transform
+* @param dst_points               dst keypoints data, 6 double values (x0, y0, x1, y1, x2, y2) per transform
+* @param mat                      transform matrices, a 2x3 matrix per transform. can be nullptr.
+* @param inverse_mat              transform matrices inversed, a 2x3 matrix per transform. can be nullptr.
+* @return RC_SUCCESS, or RC_INVALID_VALUE for bad arguments or when the src (or dst for inverse_mat) points of
+*         any transform are collinear. mat is filled with zeros when the src points are collinear and inverse_mat
+*         when the dst points are, everything else is still computed.
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* @remark The 3x3 systems of a few dozen transforms at a time are inverted together with ppl::cv::x86::Invert,
+*         one transform per SIMD lane.
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/get_affine_transform.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/get_affine_transform.h>
+* int32_t main(int32_t argc, char** argv) {
+*     const int32_t batch = 1024;
+*     double* src_points = (double*)malloc(batch * 6 * sizeof(double));
+*     double* dst_points = (double*)malloc(batch * 6 * sizeof(double));
+*     double* mat = (double*)malloc(batch * 6 * sizeof(double));
+*
+*     ppl::cv::x86::GetAffineTransform(batch, src_points, dst_points, mat, nullptr);
+*
+*     free(src_points);
+*     free(dst_points);
+*     free(mat);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+
+::ppl::common::RetCode GetAffineTransform(
+    int32_t batch,
     const double *src_points,
     const double *dst_points,
     double *mat,
@@ -48,6 +48,22 @@ void BM_getAffineTransform_ppl_x86(benchmark::State &state) {
 
 BENCHMARK(BM_getAffineTransform_ppl_x86);
 
+void BM_getAffineTransformBatch_ppl_x86(benchmark::State &state) {
+    int32_t batch = state.range(0);
+    std::unique_ptr<double[]> src(new double[batch * 6]);
+    std::unique_ptr<double[]> dst(new double[batch * 6]);
+    std::unique_ptr<double[]> mat(new double[batch * 6]);
+    std::unique_ptr<double[]> inverse_mat(new double[batch * 6]);
+    ppl::cv::debug::randomFill<double>(src.get(), batch * 6, 0, 400);
+    ppl::cv::debug::randomFill<double>(dst.get(), batch * 6, 0, 400);
+    for (auto _ : state) {
+        ppl::cv::x86::GetAffineTransform(batch, src.get(), dst.get(), mat.get(), inverse_mat.get());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+
+BENCHMARK(BM_getAffineTransformBatch_ppl_x86)->Args({1024})->Args({4096});
+
 #ifdef PPLCV_BENCHMARK_OPENCV
 void BM_getAffineTransform_opencv_x86(benchmark::State &state) {
     cv::Point2f srcTri[3];
@@ -102,3 +102,47 @@ TEST(GetAffineTransform, x86)
         }
     }
 }
+
+TEST(GetAffineTransformBatch, x86)
+{
+    const int32_t batch = 101;
+    std::unique_ptr<double[]> src(new double[batch * 6]);
+    std::unique_ptr<double[]> dst(new double[batch * 6]);
+    std::unique_ptr<double[]> mat(new double[batch * 6]);
+    std::unique_ptr<double[]> inverse_mat(new double[batch * 6]);
+    for (int32_t i = 0; i < batch * 6; i++) {
+        src[i] = rand() % 400;
+        dst[i] = rand() % 400;
+    }
+    // collinear src points give a zero transform, the inverse from the dst points is still computed
+    for (int32_t i = 0; i < 6; i++) {
+        src[6 * 7 + i] = i / 2 * 10 + i % 2 * 20;
+    }
+    auto rst = ppl::cv::x86::GetAffineTransform(batch, src.get(), dst.get(), mat.get(), inverse_mat.get());
+    EXPECT_EQ(rst, ppl::common::RC_INVALID_VALUE);
+
+    double diff_THR = 1e-4;
+    for (int32_t b = 0; b < batch; b++) {
+        double ref_mat[6], ref_inv[6];
+        auto rc = ppl::cv::x86::GetAffineTransform(src.get() + b * 6, dst.get() + b * 6, ref_mat, ref_inv);
+        if (b == 7) {
+            for (int32_t i = 0; i < 6; i++) {
+                EXPECT_EQ(mat[b * 6 + i], 0);
+            }
+            const double *m = inverse_mat.get() + b * 6;
+            for (int32_t k = 0; k < 3; k++) {
+                double x = dst[b * 6 + k * 2 + 0], y = dst[b * 6 + k * 2 + 1];
+                CHECK_RESULT(src[b * 6 + k * 2 + 0], (x * m[0] + y * m[1] + m[2]));
+                CHECK_RESULT(src[b * 6 + k * 2 + 1], (x * m[3] + y * m[4] + m[5]));
+            }
+            continue;
+        }
+        if (rc != ppl::common::RC_SUCCESS) {
+            continue;
+        }
+        for (int32_t i = 0; i < 6; i++) {
+            CHECK_RESULT(ref_mat[i], mat[b * 6 + i]);
+            CHECK_RESULT(ref_inv[i], inverse_mat[b * 6 + i]);
+        }
+    }
+}
@@ -53,6 +53,26 @@ namespace x86 {
     return ppl::common::RC_SUCCESS;
 }
 
+::ppl::common::RetCode GetRotationMatrix2D(
+    int32_t batch,
+    const float* center_y,
+    const float* center_x,
+    const double* angle,
+    const double* scale,
+    double* out_data) {
+
+    if (batch <= 0 || nullptr == center_y || nullptr == center_x ||
+        nullptr == angle || nullptr == scale || nullptr == out_data) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    for (int32_t i = 0; i < batch; ++i) {
+        GetRotationMatrix2D(center_y[i], center_x[i], angle[i], scale[i], out_data + i * 6);
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
 } //! namespace x86
 } //! namespace cv
 } //! namespace ppl
@@ -59,6 +59,43 @@ namespace x86 {
     double scale,
     double* out_data);
 
+/**
+* @brief Calculates the affine matrices of a batch of 2D rotations.
+* @param batch                  number of rotations
+* @param center_y               Center y of each rotation in the source image.
+* @param center_x               Center x of each rotation in the source image.
+* @param angle                  Rotation angle of each rotation in degrees. Positive values mean counter-clockwise rotation.
+* @param scale                  Isotropic scale factor of each rotation.
+* @param out_data               transform matrices, a 2x3 matrix per rotation.
+* @warning All input parameters must be valid, or undefined behaviour may occur.
+* <caption align="left">Requirements</caption>
+* <tr><td>x86 platforms supported<td> All
+* <tr><td>Header files<td> #include &lt;ppl/cv/x86/get_rotation_matrix2d.h&gt;
+* <tr><td>Project<td> ppl.cv
+* @since ppl.cv-v1.0.0
+* ###Example
+* @code{.cpp}
+* #include <ppl/cv/x86/get_rotation_matrix2d.h>
+* int32_t main(int32_t argc, char** argv) {
+*     float center_y[2] = {0, 10};
+*     float center_x[2] = {0, 20};
+*     double angle[2] = {30, 45};
+*     double scale[2] = {1, 0.5};
+*     double out_data[12];
+*     ppl::cv::x86::GetRotationMatrix2D(2, center_y, center_x, angle, scale, out_data);
+*     return 0;
+* }
+* @endcode
+***************************************************************************************************/
+
+::ppl::common::RetCode GetRotationMatrix2D(
+    int32_t batch,
+    const float* center_y,
+    const float* center_x,
+    const double* angle,
+    const double* scale,
+    double* out_data);
+
 } //! namespace x86
 } //! namespace cv
 } //! namespace ppl
@@ -54,4 +54,23 @@ TEST(GetRotationMatrix2DTest, x86)
     GetRotationMatrix2DTest(320, 360, -30, 1.0);
     GetRotationMatrix2DTest(320, 360, -45, 1.0);
     GetRotationMatrix2DTest(320, 360, -90, 1.0);
-}
\ No newline at end of file
+}
+
+TEST(GetRotationMatrix2DBatchTest, x86)
+{
+    const int32_t batch = 6;
+    float center_y[batch] = {320, 320, 320, 0, 100, 240};
+    float center_x[batch] = {360, 360, 360, 0, 50, 180};
+    double angle[batch] = {45, 30, 90, -30, -45, -90};
+    double scale[batch] = {1.0, 0.5, 2.0, 1.0, 1.5, 1.0};
+    std::unique_ptr<double[]> dst(new double[batch * 6]);
+    auto rst = ppl::cv::x86::GetRotationMatrix2D(batch, center_y, center_x, angle, scale, dst.get());
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    float diff_THR = 1e-4;
+    for (int32_t i = 0; i < batch; i++) {
+        cv::Matx23d oMat = cv::getRotationMatrix2D(cv::Point2f(center_x[i], center_y[i]), angle[i], scale[i]);
+        for (int32_t j = 0; j < 6; j++) {
+            CHECK_RESULT(oMat(j / 3, j % 3), dst[i * 6 + j]);
+        }
+    }
+}
@@ -0,0 +1,763 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/inpaint.h"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// states of a pixel during the fast marching, the same as cv::inpaint
+#define INPAINT_KNOWN        0
+#define INPAINT_BAND         1
+#define INPAINT_INSIDE       2
+#define INPAINT_CHANGE       3
+// arrival time of a pixel the front has not reached
+#define INPAINT_FAR          1.0e6f
+// buckets of the front per unit of arrival time
+#define INPAINT_BUCKET_SCALE 16
+
+struct InpaintNode {
+    float T;
+    uint32_t seq;
+    int32_t i;
+    int32_t j;
+};
+
+struct InpaintLater {
+    bool operator()(const InpaintNode &a, const InpaintNode &b) const
+    {
+        if (a.T != b.T) {
+            return a.T > b.T;
+        }
+        return a.seq > b.seq;
+    }
+};
+
+// front of the fast marching. Arrival times are spread over buckets of 1 / INPAINT_BUCKET_SCALE and
+// only the pixels of one bucket are kept in a heap, a time earlier than the current bucket goes into
+// the current one, where it still leaves first. Equal times leave in the order they were pushed, like
+// the queue of cv::inpaint, so the order is exactly (time, push sequence).
+class InpaintQueue {
+public:
+    InpaintQueue()
+        : current(0)
+        , sequence(0) {}
+
+    void push(float T, int32_t i, int32_t j)
+    {
+        size_t b = std::max(current, (size_t)(T * INPAINT_BUCKET_SCALE));
+        if (b >= buckets.size()) {
+            buckets.resize(b + 1);
+        }
+        std::vector<InpaintNode> &q = buckets[b];
+        q.push_back(InpaintNode{T, sequence++, i, j});
+        std::push_heap(q.begin(), q.end(), InpaintLater());
+    }
+
+    // empties the queue and keeps the memory of the buckets for the next march
+    void reset()
+    {
+        for (size_t b = 0; b < buckets.size(); ++b) {
+            buckets[b].clear();
+        }
+        current  = 0;
+        sequence = 0;
+    }
+
+    bool pop(int32_t *i, int32_t *j)
+    {
+        while (current < buckets.size() && buckets[current].empty()) {
+            ++current;
+        }
+        if (current == buckets.size()) {
+            return false;
+        }
+        std::vector<InpaintNode> &q = buckets[current];
+        std::pop_heap(q.begin(), q.end(), InpaintLater());
+        *i = q.back().i;
+        *j = q.back().j;
+        q.pop_back();
+        return true;
+    }
+
+private:
+    std::vector<std::vector<InpaintNode>> buckets;
+    size_t current;
+    uint32_t sequence;
+};
+
+// flags and arrival times of the box around a cluster of the mask. Pixels are addressed like in cv::inpaint, which
+// puts a one pixel border around the image: (i, j) is the pixel (i - 1, j - 1) of the image.
+struct InpaintGrid {
+    int32_t y0;
+    int32_t x0;
+    int32_t rows;
+    int32_t cols;
+    std::vector<uint8_t> f;
+    std::vector<float> t;
+
+    int32_t at(int32_t i, int32_t j) const
+    {
+        return (i - y0) * cols + (j - x0);
+    }
+};
+
+static const int32_t inpaint_di[4] = {-1, 0, 1, 0};
+static const int32_t inpaint_dj[4] = {0, -1, 0, 1};
+
+static inline float inpaint_solve(const uint8_t *f, const float *t, int32_t p1, int32_t p2)
+{
+    double sol;
+    double a11 = t[p1];
+    double a22 = t[p2];
+    double m12 = std::min(a11, a22);
+    if (f[p1] != INPAINT_INSIDE) {
+        if (f[p2] != INPAINT_INSIDE) {
+            if (fabs(a11 - a22) >= 1.0) {
+                sol = 1 + m12;
+            } else {
+                sol = (a11 + a22 + sqrt((double)(2 - (a11 - a22) * (a11 - a22)))) * 0.5;
+            }
+        } else {
+            sol = 1 + a11;
+        }
+    } else if (f[p2] != INPAINT_INSIDE) {
+        sol = 1 + a22;
+    } else {
+        sol = 1 + m12;
+    }
+    return (float)sol;
+}
+
+// arrival time of the pixel p from its four neighbours
+static inline float inpaint_arrival(const uint8_t *f, const float *t, int32_t p, int32_t stride)
+{
+    float d0 = inpaint_solve(f, t, p - stride, p - 1);
+    float d1 = inpaint_solve(f, t, p + stride, p - 1);
+    float d2 = inpaint_solve(f, t, p - stride, p + 1);
+    float d3 = inpaint_solve(f, t, p + stride, p + 1);
+    return std::min(std::min(d0, d1), std::min(d2, d3));
+}
+
+// Telea only: arrival times outside the mask, marched from the band to inpaintRadius and stored negated
+static void inpaint_outside(
+    InpaintGrid &g,
+    int32_t height,
+    int32_t width,
+    uint8_t *f,
+    InpaintQueue &queue)
+{
+    float *t = g.t.data();
+    int32_t ii, jj;
+    while (queue.pop(&ii, &jj)) {
+        f[g.at(ii, jj)] = INPAINT_CHANGE;
+        for (int32_t q = 0; q < 4; ++q) {
+            int32_t i = ii + inpaint_di[q];
+            int32_t j = jj + inpaint_dj[q];
+            if (i <= 0 || j <= 0 || i > height || j > width) {
+                continue;
+            }
+            int32_t p = g.at(i, j);
+            if (f[p] == INPAINT_INSIDE) {
+                float dist = inpaint_arrival(f, t, p, g.cols);
+                t[p]       = dist;
+                f[p]       = INPAINT_BAND;
+                queue.push(dist, i, j);
+            }
+        }
+    }
+    for (int32_t p = 0; p < g.rows * g.cols; ++p) {
+        if (f[p] == INPAINT_CHANGE) {
+            t[p] = -t[p];
+        }
+    }
+}
+
+// the disc of radius range around a pixel in the order cv::inpaint visits it, with the distance weights
+struct InpaintDisc {
+    std::vector<int32_t> dk;
+    std::vector<int32_t> dl;
+    std::vector<int32_t> offset;
+    std::vector<float> dst;
+};
+
+// the image pixel of the neighbour (k, l) and the rows and columns cv::inpaint reads its gradient from,
+// including the shifts of the gradient on the first and the last row and column
+struct InpaintTaps {
+    const uint8_t *v;
+    const uint8_t *rm;
+    const uint8_t *rm1;
+    const uint8_t *rp;
+    const uint8_t *rp1;
+    int32_t lm;
+    int32_t lm1;
+    int32_t lp;
+    int32_t lp1;
+};
+
+template <int32_t channels>
+static inline void inpaint_taps(int32_t k, int32_t l, int32_t height, int32_t width, int32_t outWidthStride, const uint8_t *out, InpaintTaps &taps)
+{
+    int32_t km = std::min(k - 1 + (k == 1), height - 1);
+    int32_t kp = std::max(k - 1 - (k == height), 0);
+    int32_t lm = std::min(l - 1 + (l == 1), width - 1);
+    int32_t lp = std::max(l - 1 - (l == width), 0);
+    taps.v     = out + (k - 1) * outWidthStride + (l - 1) * channels;
+    taps.rm    = out + km * outWidthStride;
+    taps.rm1   = out + std::max(km - 1, 0) * outWidthStride;
+    taps.rp    = out + kp * outWidthStride;
+    taps.rp1   = out + std::min(kp + 1, height - 1) * outWidthStride;
+    taps.lm    = lm * channels;
+    taps.lm1   = std::max(lm - 1, 0) * channels;
+    taps.lp    = lp * channels;
+    taps.lp1   = std::min(lp + 1, width - 1) * channels;
+}
+
+// Telea's weighted first order estimate, the weights do not depend on the channel and are computed once
+template <int32_t channels>
+static inline void inpaint_telea_pixel(
+    const uint8_t *f,
+    const float *t,
+    int32_t stride,
+    int32_t p,
+    int32_t i,
+    int32_t j,
+    int32_t height,
+    int32_t width,
+    const InpaintDisc &disc,
+    int32_t outWidthStride,
+    uint8_t *out)
+{
+    float gtx, gty;
+    if (f[p + 1] != INPAINT_INSIDE) {
+        gtx = f[p - 1] != INPAINT_INSIDE ? (t[p + 1] - t[p - 1]) * 0.5f : t[p + 1] - t[p];
+    } else {
+        gtx = f[p - 1] != INPAINT_INSIDE ? t[p] - t[p - 1] : 0.f;
+    }
+    if (f[p + stride] != INPAINT_INSIDE) {
+        gty = f[p - stride] != INPAINT_INSIDE ? (t[p + stride] - t[p - stride]) * 0.5f : t[p + stride] - t[p];
+    } else {
+        gty = f[p - stride] != INPAINT_INSIDE ? t[p] - t[p - stride] : 0.f;
+    }
+
+    float Ia[channels], Jx[channels], Jy[channels];
+    float s = 1.0e-20f;
+    for (int32_t c = 0; c < channels; ++c) {
+        Ia[c] = Jx[c] = Jy[c] = 0.f;
+    }
+    const int32_t n = (int32_t)disc.dst.size();
+    for (int32_t m = 0; m < n; ++m) {
+        int32_t k = i + disc.dk[m];
+        int32_t l = j + disc.dl[m];
+        if ((uint32_t)(k - 1) >= (uint32_t)height || (uint32_t)(l - 1) >= (uint32_t)width) {
+            continue;
+        }
+        int32_t pk = p + disc.offset[m];
+        if (f[pk] == INPAINT_INSIDE) {
+            continue;
+        }
+        float rx  = (float)-disc.dl[m];
+        float ry  = (float)-disc.dk[m];
+        float lev = (float)(1. / (1 + fabs((double)(t[pk] - t[p]))));
+        float dir = rx * gtx + ry * gty;
+        if (fabs(dir) <= 0.01) {
+            dir = 0.000001f;
+        }
+        float w = (float)fabs(disc.dst[m] * lev * dir);
+
+        InpaintTaps q;
+        inpaint_taps<channels>(k, l, height, width, outWidthStride, out, q);
+        const bool fr = f[pk + 1] != INPAINT_INSIDE;
+        const bool fl = f[pk - 1] != INPAINT_INSIDE;
+        const bool fd = f[pk + stride] != INPAINT_INSIDE;
+        const bool fu = f[pk - stride] != INPAINT_INSIDE;
+        for (int32_t c = 0; c < channels; ++c) {
+            float gx, gy;
+            if (fr) {
+                gx = fl ? (float)(q.rm[q.lp1 + c] - q.rm[q.lm1 + c]) * 2.0f : (float)(q.rm[q.lp1 + c] - q.rm[q.lm + c]);
+            } else {
+                gx = fl ? (float)(q.rm[q.lp + c] - q.rm[q.lm1 + c]) : 0.f;
+            }
+            if (fd) {
+                gy = fu ? (float)(q.rp1[q.lm + c] - q.rm1[q.lm + c]) * 2.0f : (float)(q.rp1[q.lm + c] - q.rm[q.lm + c]);
+            } else {
+                gy = fu ? (float)(q.rp[q.lm + c] - q.rm1[q.lm + c]) : 0.f;
+            }
+            Ia[c] += w * (float)q.v[c];
+            Jx[c] -= w * (gx * rx);
+            Jy[c] -= w * (gy * ry);
+        }
+        s += w;
+    }
+    uint8_t *o = out + (i - 1) * outWidthStride + (j - 1) * channels;
+    for (int32_t c = 0; c < channels; ++c) {
+        float sat = Ia[c] / s + (Jx[c] + Jy[c]) / (sqrtf(Jx[c] * Jx[c] + Jy[c] * Jy[c]) + 1.0e-20f) + 0.5f;
+        o[c]      = sat_cast_u8(lrintf(sat));
+    }
+}
+
+// the Navier-Stokes flavoured estimate of cv::inpaint, weighted along the isophotes of every channel
+template <int32_t channels>
+static inline void inpaint_ns_pixel(
+    const uint8_t *f,
+    int32_t stride,
+    int32_t p,
+    int32_t i,
+    int32_t j,
+    int32_t height,
+    int32_t width,
+    const InpaintDisc &disc,
+    int32_t outWidthStride,
+    uint8_t *out)
+{
+    float Ia[channels], s[channels];
+    for (int32_t c = 0; c < channels; ++c) {
+        Ia[c] = 0.f;
+        s[c]  = 1.0e-20f;
+    }
+    const int32_t n = (int32_t)disc.dst.size();
+    for (int32_t m = 0; m < n; ++m) {
+        int32_t k = i + disc.dk[m];
+        int32_t l = j + disc.dl[m];
+        if ((uint32_t)(k - 1) >= (uint32_t)height || (uint32_t)(l - 1) >= (uint32_t)width) {
+            continue;
+        }
+        int32_t pk = p + disc.offset[m];
+        if (f[pk] == INPAINT_INSIDE) {
+            continue;
+        }
+        float rx  = (float)disc.dl[m];
+        float ry  = (float)disc.dk[m];
+        float len = rx * rx + ry * ry;
+
+        InpaintTaps q;
+        inpaint_taps<channels>(k, l, height, width, outWidthStride, out, q);
+        const bool fr = f[pk + 1] != INPAINT_INSIDE;
+        const bool fl = f[pk - 1] != INPAINT_INSIDE;
+        const bool fd = f[pk + stride] != INPAINT_INSIDE;
+        const bool fu = f[pk - stride] != INPAINT_INSIDE;
+        for (int32_t c = 0; c < channels; ++c) {
+            const int32_t vm = q.rm[q.lm + c];
+            float gx, gy;
+            if (fd) {
+                gx = fu ? (float)(abs(q.rp1[q.lm + c] - q.rp[q.lm + c]) + abs(q.rp[q.lm + c] - q.rm1[q.lm + c]))
+                        : (float)abs(q.rp1[q.lm + c] - q.rp[q.lm + c]) * 2.0f;
+            } else {
+                gx = fu ? (float)abs(q.rp[q.lm + c] - q.rm1[q.lm + c]) * 2.0f : 0.f;
+            }
+            if (fr) {
+                gy = fl ? (float)(abs(q.rm[q.lp1 + c] - vm) + abs(vm - q.rm[q.lm1 + c]))
+                        : (float)abs(q.rm[q.lp1 + c] - vm) * 2.0f;
+            } else {
+                gy = fl ? (float)abs(vm - q.rm[q.lm1 + c]) * 2.0f : 0.f;
+            }
+            gx        = -gx;
+            float dir = rx * gx + ry * gy;
+            if (fabs(dir) <= 0.01) {
+                dir = 0.000001f;
+            } else {
+                dir = fabsf(dir / sqrtf(len * (gx * gx + gy * gy)));
+            }
+            float w = disc.dst[m] * dir;
+            Ia[c] += w * (float)q.v[c];
+            s[c] += w;
+        }
+    }
+    uint8_t *o = out + (i - 1) * outWidthStride + (j - 1) * channels;
+    for (int32_t c = 0; c < channels; ++c) {
+        o[c] = sat_cast_u8(lrint((double)Ia[c] / s[c]));
+    }
+}
+
+// the disc and its weights are the same for every cluster, only the offsets follow the width of its box
+static void inpaint_disc(int32_t range, bool telea, InpaintDisc &disc)
+{
+    for (int32_t k = -range; k <= range; ++k) {
+        for (int32_t l = -range; l <= range; ++l) {
+            if ((k == 0 && l == 0) || k * k + l * l > range * range) {
+                continue;
+            }
+            float len = (float)(k * k + l * l);
+            disc.dk.push_back(k);
+            disc.dl.push_back(l);
+            disc.dst.push_back(telea ? (float)(1. / (len * sqrt((double)len))) : 1 / (len * len + 1));
+        }
+    }
+    disc.offset.resize(disc.dst.size());
+}
+
+template <int32_t channels, bool telea>
+static void inpaint_march(
+    InpaintGrid &g,
+    int32_t height,
+    int32_t width,
+    InpaintDisc &disc,
+    InpaintQueue &queue,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    uint8_t *f           = g.f.data();
+    float *t             = g.t.data();
+    const int32_t stride = g.cols;
+    for (size_t m = 0; m < disc.dst.size(); ++m) {
+        disc.offset[m] = disc.dk[m] * stride + disc.dl[m];
+    }
+
+    int32_t ii, jj;
+    while (queue.pop(&ii, &jj)) {
+        f[g.at(ii, jj)] = INPAINT_KNOWN;
+        for (int32_t q = 0; q < 4; ++q) {
+            int32_t i = ii + inpaint_di[q];
+            int32_t j = jj + inpaint_dj[q];
+            if (i <= 0 || j <= 0 || i > height || j > width) {
+                continue;
+            }
+            int32_t p = g.at(i, j);
+            if (f[p] != INPAINT_INSIDE) {
+                continue;
+            }
+            float dist = inpaint_arrival(f, t, p, stride);
+            t[p]       = dist;
+            if (telea) {
+                inpaint_telea_pixel<channels>(f, t, stride, p, i, j, height, width, disc, outWidthStride, outData);
+            } else {
+                inpaint_ns_pixel<channels>(f, stride, p, i, j, height, width, disc, outWidthStride, outData);
+            }
+            f[p] = INPAINT_BAND;
+            queue.push(dist, i, j);
+        }
+    }
+}
+
+// the non-zero pixels of the mask in a square cell, cells are (y / size, x / size) of the image and the
+// box holds the first and the last row and column of the pixels
+struct InpaintCell {
+    int32_t cy;
+    int32_t cx;
+    int32_t y0;
+    int32_t x0;
+    int32_t y1;
+    int32_t x1;
+};
+
+// the cells with non-zero pixels in row-major order, one pass over the mask that skips zero vectors
+static void inpaint_mask_cells(
+    int32_t height,
+    int32_t width,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t size,
+    std::vector<InpaintCell> &cells)
+{
+    std::vector<InpaintCell> row((width + size - 1) / size);
+    for (int32_t cy = 0; cy * size < height; ++cy) {
+        for (size_t cx = 0; cx < row.size(); ++cx) {
+            row[cx].y1 = -1;
+        }
+        for (int32_t y = cy * size; y < std::min((cy + 1) * size, height); ++y) {
+            const uint8_t *m = mask + y * maskWidthStride;
+            for (int32_t x = 0; x < width;) {
+                if (x + 16 <= width) {
+                    __m128i v = _mm_loadu_si128((const __m128i *)(m + x));
+                    if (_mm_testz_si128(v, v)) {
+                        x += 16;
+                        continue;
+                    }
+                }
+                for (int32_t end = std::min(x + 16, width); x < end; ++x) {
+                    if (!m[x]) {
+                        continue;
+                    }
+                    InpaintCell &c = row[x / size];
+                    if (c.y1 < 0) {
+                        c.y0 = y;
+                        c.x0 = c.x1 = x;
+                    }
+                    c.y1 = y;
+                    c.x0 = std::min(c.x0, x);
+                    c.x1 = std::max(c.x1, x);
+                }
+            }
+        }
+        for (size_t cx = 0; cx < row.size(); ++cx) {
+            if (row[cx].y1 >= 0) {
+                InpaintCell c = row[cx];
+                c.cy          = cy;
+                c.cx          = (int32_t)cx;
+                cells.push_back(c);
+            }
+        }
+    }
+}
+
+// union-find on the cells, the parent of a cell is never larger than the cell itself
+static inline int32_t inpaint_find_root(const int32_t *P, int32_t i)
+{
+    while (P[i] < i) {
+        i = P[i];
+    }
+    return i;
+}
+
+static inline void inpaint_merge(int32_t *P, int32_t i, int32_t j)
+{
+    int32_t ri = inpaint_find_root(P, i);
+    int32_t rj = inpaint_find_root(P, j);
+    P[std::max(ri, rj)] = std::min(ri, rj);
+}
+
+// groups the cells into clusters of 8-connected cells, cluster[k] is the first cell of the cluster of cell k
+static void inpaint_cluster_cells(const std::vector<InpaintCell> &cells, std::vector<int32_t> &cluster)
+{
+    const int32_t n = (int32_t)cells.size();
+    cluster.resize(n);
+    for (int32_t k = 0, up = 0; k < n; ++k) {
+        cluster[k] = k;
+        if (k > 0 && cells[k - 1].cy == cells[k].cy && cells[k - 1].cx == cells[k].cx - 1) {
+            inpaint_merge(cluster.data(), k - 1, k);
+        }
+        while (cells[up].cy < cells[k].cy - 1 || (cells[up].cy == cells[k].cy - 1 && cells[up].cx < cells[k].cx - 1)) {
+            ++up;
+        }
+        for (int32_t q = up; cells[q].cy == cells[k].cy - 1 && cells[q].cx <= cells[k].cx + 1; ++q) {
+            inpaint_merge(cluster.data(), q, k);
+        }
+    }
+    for (int32_t k = 0; k < n; ++k) {
+        cluster[k] = cluster[cluster[k]];
+    }
+}
+
+// flags, arrival times, masks and queues of a cluster, kept across the clusters of an image
+struct InpaintWork {
+    InpaintGrid g;
+    std::vector<uint8_t> inside;
+    std::vector<uint8_t> reach;
+    std::vector<uint8_t> around;
+    std::vector<uint8_t> column;
+    InpaintQueue queue;
+    InpaintQueue outer;
+};
+
+// inpaints the mask pixels of the cells first[0], first[1], ... in the box of the cluster
+template <int32_t channels>
+static void inpaint_cluster(
+    int32_t height,
+    int32_t width,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    const InpaintCell *const *first,
+    int32_t count,
+    int32_t range,
+    int32_t flags,
+    InpaintDisc &disc,
+    InpaintWork &w,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    int32_t box[4] = {height, width, -1, -1};
+    for (int32_t k = 0; k < count; ++k) {
+        box[0] = std::min(box[0], first[k]->y0);
+        box[1] = std::min(box[1], first[k]->x0);
+        box[2] = std::max(box[2], first[k]->y1);
+        box[3] = std::max(box[3], first[k]->x1);
+    }
+    const int32_t margin = range + 2;
+
+    // the box of the cluster in bordered coordinates, grown by the radius and the neighbours of its pixels
+    InpaintGrid &g   = w.g;
+    g.y0             = std::max(box[0] + 1 - margin, 0);
+    g.x0             = std::max(box[1] + 1 - margin, 0);
+    g.rows           = std::min(box[2] + 1 + margin, height + 1) + 1 - g.y0;
+    g.cols           = std::min(box[3] + 1 + margin, width + 1) + 1 - g.x0;
+    const int32_t n  = g.rows * g.cols;
+    // image pixels of the box away from its edges, the cluster and everything marched is among them
+    const int32_t i0 = std::max(g.y0 + 1, 1), i1 = std::min(g.y0 + g.rows - 2, height);
+    const int32_t j0 = std::max(g.x0 + 1, 1), j1 = std::min(g.x0 + g.cols - 2, width);
+    g.f.assign(n, INPAINT_KNOWN);
+    g.t.assign(n, INPAINT_FAR);
+    std::vector<uint8_t> &inside = w.inside;
+    inside.assign(n, 0);
+    for (int32_t k = 0; k < count; ++k) {
+        const InpaintCell &c = *first[k];
+        for (int32_t y = c.y0; y <= c.y1; ++y) {
+            const uint8_t *m = mask + y * maskWidthStride;
+            for (int32_t x = c.x0; x <= c.x1; ++x) {
+                inside[g.at(y + 1, x + 1)] = m[x] != 0;
+            }
+        }
+    }
+
+    // the band is the outer 4-neighbour ring of the mask, the front starts from it at time 0
+    InpaintQueue &queue = w.queue, &outer = w.outer;
+    queue.reset();
+    outer.reset();
+    for (int32_t i = i0; i <= i1; ++i) {
+        for (int32_t j = j0; j <= j1; ++j) {
+            int32_t p = g.at(i, j);
+            if (inside[p]) {
+                g.f[p] = INPAINT_INSIDE;
+            } else if (inside[p - g.cols] || inside[p + g.cols] || inside[p - 1] || inside[p + 1]) {
+                g.f[p] = INPAINT_BAND;
+                g.t[p] = 0.f;
+                queue.push(0.f, i, j);
+                if (flags == INPAINT_TELEA) {
+                    outer.push(0.f, i, j);
+                }
+            }
+        }
+    }
+
+    if (flags == INPAINT_TELEA) {
+        // pixels within range of the mask in both directions, the square cv::inpaint marches outside it
+        std::vector<uint8_t> &reach = w.reach, &around = w.around, &column = w.column;
+        reach.assign(n, 0);
+        around.assign(n, INPAINT_KNOWN);
+        column.resize(g.rows);
+        for (int32_t i = 0; i < g.rows; ++i) {
+            const uint8_t *in = inside.data() + i * g.cols;
+            uint8_t *d        = reach.data() + i * g.cols;
+            for (int32_t j = 0, last = -range - 1; j < g.cols; ++j) {
+                last = in[j] ? j : last;
+                d[j] = j - last <= range;
+            }
+            for (int32_t j = g.cols - 1, next = g.cols + range; j >= 0; --j) {
+                next = in[j] ? j : next;
+                d[j] |= next - j <= range;
+            }
+        }
+        for (int32_t j = j0 - g.x0; j <= j1 - g.x0; ++j) {
+            for (int32_t i = 0, last = -range - 1; i < g.rows; ++i) {
+                last      = reach[i * g.cols + j] ? i : last;
+                column[i] = i - last <= range;
+            }
+            for (int32_t i = g.rows - 1, next = g.rows + range; i >= 0; --i) {
+                next      = reach[i * g.cols + j] ? i : next;
+                int32_t p = i * g.cols + j;
+                if ((column[i] || next - i <= range) && i + g.y0 >= i0 && i + g.y0 <= i1 && g.f[p] == INPAINT_KNOWN) {
+                    around[p] = INPAINT_INSIDE;
+                }
+            }
+        }
+        inpaint_outside(g, height, width, around.data(), outer);
+        inpaint_march<channels, true>(g, height, width, disc, queue, outWidthStride, outData);
+    } else {
+        inpaint_march<channels, false>(g, height, width, disc, queue, outWidthStride, outData);
+    }
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode Inpaint(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t outWidthStride,
+    T *outData,
+    float inpaintRadius,
+    int32_t flags)
+{
+    if (nullptr == inData || nullptr == mask || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || maskWidthStride < width || outWidthStride < width * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (flags != INPAINT_NS && flags != INPAINT_TELEA) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inData != outData) {
+        for (int32_t i = 0; i < height; ++i) {
+            memcpy(outData + i * outWidthStride, inData + i * inWidthStride, width * channels * sizeof(T));
+        }
+    }
+    const int32_t range = std::min(std::max((int32_t)lrintf(inpaintRadius), 1), 100);
+
+    // A pixel is computed from the pixels within range + 1 of it and the march outside the mask stays within
+    // range of it, so mask pixels more than 2 * (range + 2) apart never see each other. Cells of that size
+    // that are not 8-connected are at least that far apart and their clusters are inpainted one by one, each
+    // in its own box, so nothing but the pass over the mask follows the size of the image.
+    std::vector<InpaintCell> cells;
+    inpaint_mask_cells(height, width, maskWidthStride, mask, 2 * (range + 2), cells);
+    if (cells.empty()) {
+        return ppl::common::RC_SUCCESS;
+    }
+    std::vector<int32_t> cluster;
+    inpaint_cluster_cells(cells, cluster);
+    // the cells of every cluster one after another, the clusters in the order of their first cell
+    std::vector<int32_t> start(cells.size() + 1, 0);
+    for (size_t k = 0; k < cells.size(); ++k) {
+        ++start[cluster[k] + 1];
+    }
+    for (size_t k = 0; k < cells.size(); ++k) {
+        start[k + 1] += start[k];
+    }
+    std::vector<const InpaintCell *> members(cells.size());
+    std::vector<int32_t> fill(start.begin(), start.end() - 1);
+    for (size_t k = 0; k < cells.size(); ++k) {
+        members[fill[cluster[k]]++] = &cells[k];
+    }
+
+    InpaintDisc disc;
+    inpaint_disc(range, flags == INPAINT_TELEA, disc);
+    InpaintWork work;
+    for (size_t k = 0; k < cells.size(); ++k) {
+        if (cluster[k] == (int32_t)k) {
+            inpaint_cluster<channels>(height, width, maskWidthStride, mask, members.data() + start[k], start[k + 1] - start[k], range, flags, disc, work, outWidthStride, (uint8_t *)outData);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode Inpaint<uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float inpaintRadius,
+    int32_t flags);
+
+template ::ppl::common::RetCode Inpaint<uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float inpaintRadius,
+    int32_t flags);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/photo.hpp>
+#include "ppl/cv/x86/inpaint.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <string.h>
+
+namespace {
+
+// a logo sized patch in the top right corner, the usual case for inpainting
+void FillLogoMask(int32_t height, int32_t width, uint8_t *mask) {
+    memset(mask, 0, width * height);
+    for (int32_t i = height / 16; i < height / 8; ++i) {
+        for (int32_t j = width * 7 / 8; j < width * 31 / 32; ++j) {
+            mask[i * width + j] = 255;
+        }
+    }
+}
+
+template<typename T, int32_t nc, int32_t flags>
+void BM_Inpaint_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    FillLogoMask(height, width, mask.get());
+    for (auto _ : state) {
+        ppl::cv::x86::Inpaint<T, nc>(height, width, width * nc, src.get(), width, mask.get(), width * nc, dst.get(), 3.0f, flags);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_Inpaint_ppl_x86, uint8_t, c1, ppl::cv::INPAINT_NS)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Inpaint_ppl_x86, uint8_t, c3, ppl::cv::INPAINT_NS)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Inpaint_ppl_x86, uint8_t, c1, ppl::cv::INPAINT_TELEA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Inpaint_ppl_x86, uint8_t, c3, ppl::cv::INPAINT_TELEA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<typename T, int32_t nc, int32_t flags>
+void BM_Inpaint_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    FillLogoMask(height, width, mask.get());
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat mask_opencv(height, width, CV_8UC1, mask.get());
+    cv::Mat dst_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst.get());
+    for (auto _ : state) {
+        cv::inpaint(src_opencv, mask_opencv, dst_opencv, 3.0, flags);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Inpaint_opencv_x86, uint8_t, c1, cv::INPAINT_NS)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Inpaint_opencv_x86, uint8_t, c3, cv::INPAINT_NS)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Inpaint_opencv_x86, uint8_t, c1, cv::INPAINT_TELEA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Inpaint_opencv_x86, uint8_t, c3, cv::INPAINT_TELEA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include <opencv2/photo.hpp>
+#include "ppl/cv/x86/inpaint.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <algorithm>
+
+enum InpaintMaskKind {
+    INPAINT_MASK_SCATTERED,
+    INPAINT_MASK_DENSE,
+    INPAINT_MASK_BLOB,
+    INPAINT_MASK_TOP,
+    INPAINT_MASK_BOTTOM,
+    INPAINT_MASK_LEFT,
+    INPAINT_MASK_RIGHT,
+};
+
+template<typename T, int32_t nc>
+void InpaintTest(int32_t height, int32_t width, float inpaintRadius, int32_t flags, InpaintMaskKind kind, float diff) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(mask.get(), width * height, 0, 255);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    // the estimate follows the image gradient, keep it smooth enough for the rounding to agree
+    cv::GaussianBlur(src_opencv, src_opencv, cv::Size(7, 7), 0);
+    cv::Mat mask_opencv(height, width, CV_8UC1, mask.get());
+    if (kind == INPAINT_MASK_DENSE) {
+        // about half of the pixels away from the border, the front is full of equal arrival times
+        int32_t margin = (int32_t)inpaintRadius + 2;
+        for (int32_t i = 0; i < height; ++i) {
+            for (int32_t j = 0; j < width; ++j) {
+                bool interior = i >= margin && i < height - margin && j >= margin && j < width - margin;
+                mask.get()[i * width + j] = interior && mask.get()[i * width + j] < 120 ? 255 : 0;
+            }
+        }
+    } else if (kind == INPAINT_MASK_SCATTERED) {
+        // a few scattered pixels and some scratches to fill
+        for (int32_t i = 0; i < width * height; ++i) {
+            mask.get()[i] = mask.get()[i] < 3 ? 255 : 0;
+        }
+        for (int32_t k = 0; k < 8; ++k) {
+            int32_t x = (k * 131 + 7) % width;
+            int32_t y = (k * 71 + 3) % height;
+            cv::rectangle(mask_opencv, cv::Rect(x, y, 2 + k * 3, 1 + k % 3), cv::Scalar(255), cv::FILLED);
+        }
+    } else {
+        // a filled disc in the middle or a 5 pixel band on one edge of the image
+        mask_opencv.setTo(cv::Scalar(0));
+        int32_t band = std::min(5, std::min(height, width));
+        if (kind == INPAINT_MASK_BLOB) {
+            cv::circle(mask_opencv, cv::Point(width / 2, height / 2), std::min(height, width) / 4, cv::Scalar(255), cv::FILLED);
+        } else if (kind == INPAINT_MASK_TOP) {
+            mask_opencv(cv::Rect(width / 8, 0, width - width / 4, band)).setTo(cv::Scalar(255));
+        } else if (kind == INPAINT_MASK_BOTTOM) {
+            mask_opencv(cv::Rect(width / 8, height - band, width - width / 4, band)).setTo(cv::Scalar(255));
+        } else if (kind == INPAINT_MASK_LEFT) {
+            mask_opencv(cv::Rect(0, height / 8, band, height - height / 4)).setTo(cv::Scalar(255));
+        } else {
+            mask_opencv(cv::Rect(width - band, height / 8, band, height - height / 4)).setTo(cv::Scalar(255));
+        }
+    }
+    cv::Mat dst_opencv;
+    cv::inpaint(src_opencv, mask_opencv, dst_opencv, inpaintRadius, flags);
+
+    auto rst = ppl::cv::x86::Inpaint<T, nc>(height, width, width * nc, src.get(), width, mask.get(), width * nc, dst.get(), inpaintRadius, flags);
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    checkResult<T, nc>(dst.get(), (const T *)dst_opencv.data, height, width, width * nc, dst_opencv.step / sizeof(T), diff);
+}
+
+#define R(name, T, nc, inpaintRadius, flags, diff) \
+    TEST(name, x86) \
+    { \
+        InpaintTest<T, nc>(240, 320, inpaintRadius, flags, INPAINT_MASK_SCATTERED, diff); \
+        InpaintTest<T, nc>(481, 643, inpaintRadius, flags, INPAINT_MASK_SCATTERED, diff); \
+        InpaintTest<T, nc>(3, 5, inpaintRadius, flags, INPAINT_MASK_SCATTERED, diff); \
+        InpaintTest<T, nc>(240, 320, inpaintRadius, flags, INPAINT_MASK_DENSE, diff); \
+        InpaintTest<T, nc>(481, 643, inpaintRadius, flags, INPAINT_MASK_DENSE, diff); \
+        InpaintTest<T, nc>(480, 640, inpaintRadius, flags, INPAINT_MASK_BLOB, diff); \
+        InpaintTest<T, nc>(240, 320, inpaintRadius, flags, INPAINT_MASK_TOP, diff); \
+        InpaintTest<T, nc>(240, 320, inpaintRadius, flags, INPAINT_MASK_BOTTOM, diff); \
+        InpaintTest<T, nc>(240, 320, inpaintRadius, flags, INPAINT_MASK_LEFT, diff); \
+        InpaintTest<T, nc>(240, 320, inpaintRadius, flags, INPAINT_MASK_RIGHT, diff); \
+    } \
+
+R(INPAINT_NS_UCHAR_C1, uint8_t, 1, 3.0f, ppl::cv::INPAINT_NS, 1.01f);
+R(INPAINT_NS_UCHAR_C3, uint8_t, 3, 3.0f, ppl::cv::INPAINT_NS, 1.01f);
+R(INPAINT_NS_RADIUS1_UCHAR_C1, uint8_t, 1, 1.0f, ppl::cv::INPAINT_NS, 1.01f);
+R(INPAINT_NS_RADIUS1_UCHAR_C3, uint8_t, 3, 1.0f, ppl::cv::INPAINT_NS, 1.01f);
+R(INPAINT_NS_RADIUS5_UCHAR_C3, uint8_t, 3, 5.0f, ppl::cv::INPAINT_NS, 1.01f);
+R(INPAINT_TELEA_UCHAR_C1, uint8_t, 1, 3.0f, ppl::cv::INPAINT_TELEA, 1.01f);
+R(INPAINT_TELEA_UCHAR_C3, uint8_t, 3, 3.0f, ppl::cv::INPAINT_TELEA, 1.01f);
+R(INPAINT_TELEA_RADIUS1_UCHAR_C1, uint8_t, 1, 1.0f, ppl::cv::INPAINT_TELEA, 1.01f);
+R(INPAINT_TELEA_RADIUS1_UCHAR_C3, uint8_t, 3, 1.0f, ppl::cv::INPAINT_TELEA, 1.01f);
+R(INPAINT_TELEA_RADIUS5_UCHAR_C3, uint8_t, 3, 5.0f, ppl::cv::INPAINT_TELEA, 1.01f);
@@ -0,0 +1,907 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/integral.h"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <string.h>
+#include <algorithm>
+#include <immintrin.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// rows per stripe, stripes are summed independently and fixed up with the carry of the stripes above
+#define INTEGRAL_STRIPE_ROWS 64
+
+// vector ops for one (source, accumulator) pair, load_src widens `lanes` source elements
+template <typename TSrc, typename TDst>
+struct IntegralVec;
+
+template <>
+struct IntegralVec<uint8_t, int32_t> {
+    typedef __m128i vec;
+    enum { lanes = 4 };
+    static inline vec load_src(const uint8_t *p)
+    {
+        int32_t v;
+        memcpy(&v, p, sizeof(v));
+        return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(v));
+    }
+    static inline vec load(const int32_t *p) { return _mm_loadu_si128((const __m128i *)p); }
+    static inline void store(int32_t *p, vec v) { _mm_storeu_si128((__m128i *)p, v); }
+    static inline vec zero() { return _mm_setzero_si128(); }
+    static inline vec add(vec a, vec b) { return _mm_add_epi32(a, b); }
+    static inline vec sub(vec a, vec b) { return _mm_sub_epi32(a, b); }
+    static inline vec mul(vec a, vec b) { return _mm_mullo_epi32(a, b); }
+    static inline vec scan(vec v)
+    {
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+        return _mm_add_epi32(v, _mm_slli_si128(v, 8));
+    }
+    static inline vec last(vec v) { return _mm_shuffle_epi32(v, 0xff); }
+    static inline int32_t first(vec v) { return _mm_cvtsi128_si32(v); }
+};
+
+template <typename TSrc>
+struct IntegralVecF32 {
+    typedef __m128 vec;
+    enum { lanes = 4 };
+    static inline vec load(const float *p) { return _mm_loadu_ps(p); }
+    static inline void store(float *p, vec v) { _mm_storeu_ps(p, v); }
+    static inline vec zero() { return _mm_setzero_ps(); }
+    static inline vec add(vec a, vec b) { return _mm_add_ps(a, b); }
+    static inline vec sub(vec a, vec b) { return _mm_sub_ps(a, b); }
+    static inline vec mul(vec a, vec b) { return _mm_mul_ps(a, b); }
+    static inline vec scan(vec v)
+    {
+        v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)));
+        return _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 8)));
+    }
+    static inline vec last(vec v) { return _mm_shuffle_ps(v, v, 0xff); }
+    static inline float first(vec v) { return _mm_cvtss_f32(v); }
+};
+
+template <>
+struct IntegralVec<uint8_t, float> : public IntegralVecF32<uint8_t> {
+    static inline vec load_src(const uint8_t *p) { return _mm_cvtepi32_ps(IntegralVec<uint8_t, int32_t>::load_src(p)); }
+};
+
+template <>
+struct IntegralVec<float, float> : public IntegralVecF32<float> {
+    static inline vec load_src(const float *p) { return _mm_loadu_ps(p); }
+};
+
+template <typename TSrc>
+struct IntegralVecF64 {
+    typedef __m128d vec;
+    enum { lanes = 2 };
+    static inline vec load(const double *p) { return _mm_loadu_pd(p); }
+    static inline void store(double *p, vec v) { _mm_storeu_pd(p, v); }
+    static inline vec zero() { return _mm_setzero_pd(); }
+    static inline vec add(vec a, vec b) { return _mm_add_pd(a, b); }
+    static inline vec sub(vec a, vec b) { return _mm_sub_pd(a, b); }
+    static inline vec mul(vec a, vec b) { return _mm_mul_pd(a, b); }
+    static inline vec scan(vec v) { return _mm_add_pd(v, _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(v), 8))); }
+    static inline vec last(vec v) { return _mm_unpackhi_pd(v, v); }
+    static inline double first(vec v) { return _mm_cvtsd_f64(v); }
+};
+
+template <>
+struct IntegralVec<uint8_t, double> : public IntegralVecF64<uint8_t> {
+    static inline vec load_src(const uint8_t *p)
+    {
+        uint16_t v;
+        memcpy(&v, p, sizeof(v));
+        return _mm_cvtepi32_pd(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(v)));
+    }
+};
+
+template <>
+struct IntegralVec<float, double> : public IntegralVecF64<float> {
+    static inline vec load_src(const float *p) { return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)p))); }
+};
+
+// dst[x] = prev[x] + sum(src[0..x]) for one row, dst and prev skip the leading zero column.
+// A single channel is scanned in register, when channels is a multiple of the lane count
+// every pixel is one or two vectors which are simply accumulated.
+template <typename TSrc, typename TDst, int32_t channels, bool square>
+static void integral_row(const TSrc *src, const TDst *prev, TDst *dst, int32_t width)
+{
+    typedef IntegralVec<TSrc, TDst> V;
+    const int32_t L = V::lanes;
+    int32_t x       = 0;
+    TDst s[channels];
+    if (channels == 1) {
+        typename V::vec v_carry = V::zero();
+        for (; x <= width - L; x += L) {
+            typename V::vec v = V::load_src(src + x);
+            if (square) {
+                v = V::mul(v, v);
+            }
+            v       = V::add(V::scan(v), v_carry);
+            v_carry = V::last(v);
+            V::store(dst + x, V::add(v, V::load(prev + x)));
+        }
+        s[0] = V::first(v_carry);
+    } else if (channels % L == 0) {
+        typename V::vec v_carry[channels / L];
+        for (int32_t k = 0; k < channels / L; ++k) {
+            v_carry[k] = V::zero();
+        }
+        for (; x < width; ++x) {
+            for (int32_t k = 0; k < channels / L; ++k) {
+                typename V::vec v = V::load_src(src + x * channels + k * L);
+                if (square) {
+                    v = V::mul(v, v);
+                }
+                v_carry[k] = V::add(v_carry[k], v);
+                V::store(dst + x * channels + k * L, V::add(v_carry[k], V::load(prev + x * channels + k * L)));
+            }
+        }
+        return;
+    } else {
+        for (int32_t c = 0; c < channels; ++c) {
+            s[c] = 0;
+        }
+    }
+    for (; x < width; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            TDst v = src[x * channels + c];
+            s[c] += square ? v * v : v;
+            dst[x * channels + c] = prev[x * channels + c] + s[c];
+        }
+    }
+}
+
+template <typename TSrc, typename TDst, int32_t channels, bool square>
+static void integral_image(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const TSrc *inData,
+    int32_t outWidthStride,
+    TDst *outData)
+{
+    const int32_t rowLength = (width + 1) * channels;
+    for (int32_t y = 0; y <= height; ++y) {
+        memset(outData + y * outWidthStride, 0, channels * sizeof(TDst));
+    }
+    memset(outData, 0, rowLength * sizeof(TDst));
+    // the carry pass touches every row a second time, so it only pays off with several threads
+    int32_t stripeRows = height;
+#ifdef _OPENMP
+    if (omp_get_max_threads() > 1) {
+        stripeRows = INTEGRAL_STRIPE_ROWS;
+    }
+#endif
+    const int32_t stripes = (height + stripeRows - 1) / stripeRows;
+    // every stripe starts from the zero row 0, its rows only hold the sums of the stripe itself
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        int32_t y0 = s * stripeRows;
+        int32_t y1 = std::min(height, y0 + stripeRows);
+        for (int32_t y = y0; y < y1; ++y) {
+            const TDst *prev = y == y0 ? outData + channels : outData + y * outWidthStride + channels;
+            integral_row<TSrc, TDst, channels, square>(inData + y * inWidthStride, prev, outData + (y + 1) * outWidthStride + channels, width);
+        }
+    }
+    if (stripes == 1) {
+        return;
+    }
+    // carry the last row down the stripes in order, then add it to the other rows of the next stripe
+    for (int32_t s = 1; s < stripes; ++s) {
+        const TDst *carry = outData + s * stripeRows * outWidthStride;
+        TDst *last        = outData + std::min(height, (s + 1) * stripeRows) * outWidthStride;
+        for (int32_t i = channels; i < rowLength; ++i) {
+            last[i] += carry[i];
+        }
+    }
+#pragma omp parallel for
+    for (int32_t s = 1; s < stripes; ++s) {
+        int32_t y0        = s * stripeRows;
+        int32_t y1        = std::min(height, y0 + stripeRows);
+        const TDst *carry = outData + y0 * outWidthStride;
+        for (int32_t y = y0 + 1; y < y1; ++y) {
+            TDst *row = outData + y * outWidthStride;
+            for (int32_t i = channels; i < rowLength; ++i) {
+                row[i] += carry[i];
+            }
+        }
+    }
+}
+
+// tilted(X, Y) = tilted(X - 1, Y - 1) + tilted(X + 1, Y - 1) - tilted(X, Y - 2) + src(X - 1, Y - 1) + src(X - 1, Y - 2),
+// at the borders tilted(-1, Y - 1) and tilted(W + 1, Y - 1) reduce to tilted(0, Y) = tilted(1, Y - 1)
+// and tilted(W, Y) = tilted(W - 1, Y - 1) + src(W - 1, Y - 1) + src(W - 1, Y - 2).
+template <typename TSrc, typename TDst, int32_t channels>
+static void integral_tilted(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const TSrc *inData,
+    int32_t outWidthStride,
+    TDst *outData)
+{
+    typedef IntegralVec<TSrc, TDst> V;
+    const int32_t L         = V::lanes;
+    const int32_t rowLength = (width + 1) * channels;
+    memset(outData, 0, rowLength * sizeof(TDst));
+    if (height == 0) {
+        return;
+    }
+    TDst *t = outData + outWidthStride;
+    for (int32_t c = 0; c < channels; ++c) {
+        t[c] = 0;
+    }
+    for (int32_t i = channels; i < rowLength; ++i) {
+        t[i] = inData[i - channels];
+    }
+    for (int32_t y = 2; y <= height; ++y) {
+        const TDst *t1 = outData + (y - 1) * outWidthStride;
+        const TDst *t2 = outData + (y - 2) * outWidthStride;
+        const TSrc *s1 = inData + (y - 1) * inWidthStride - channels;
+        const TSrc *s2 = inData + (y - 2) * inWidthStride - channels;
+        t              = outData + y * outWidthStride;
+        for (int32_t c = 0; c < channels; ++c) {
+            t[c] = t1[channels + c];
+        }
+        const int32_t end = width * channels;
+        int32_t i         = channels;
+        for (; i <= end - L; i += L) {
+            typename V::vec v = V::add(V::load(t1 + i - channels), V::load(t1 + i + channels));
+            v                 = V::add(v, V::sub(V::add(V::load_src(s1 + i), V::load_src(s2 + i)), V::load(t2 + i)));
+            V::store(t + i, v);
+        }
+        for (; i < end; ++i) {
+            t[i] = t1[i - channels] + t1[i + channels] - t2[i] + s1[i] + s2[i];
+        }
+        for (; i < rowLength; ++i) {
+            t[i] = t1[i - channels] + s1[i] + s2[i];
+        }
+    }
+}
+
+template <typename TSrc, typename TDst, int32_t channels>
+static bool integral_check(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const TSrc *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    const TDst *outData)
+{
+    return inData != nullptr && outData != nullptr && inHeight > 0 && inWidth > 0 &&
+           inWidthStride >= inWidth * channels && outHeight == inHeight + 1 && outWidth == inWidth + 1 &&
+           outWidthStride >= outWidth * channels;
+}
+
+template <typename TSrc, typename TDst, int32_t channels>
+::ppl::common::RetCode Integral(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const TSrc *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    TDst *outData)
+{
+    if (!integral_check<TSrc, TDst, channels>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    integral_image<TSrc, TDst, channels, false>(inHeight, inWidth, inWidthStride, inData, outWidthStride, outData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename TSrc, typename TDst, int32_t channels>
+::ppl::common::RetCode Integral(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const TSrc *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    TDst *outData,
+    int32_t outSqWidthStride,
+    double *outSqData)
+{
+    if (!integral_check<TSrc, TDst, channels>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData) ||
+        !integral_check<TSrc, double, channels>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outSqWidthStride, outSqData)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    integral_image<TSrc, TDst, channels, false>(inHeight, inWidth, inWidthStride, inData, outWidthStride, outData);
+    integral_image<TSrc, double, channels, true>(inHeight, inWidth, inWidthStride, inData, outSqWidthStride, outSqData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename TSrc, typename TDst, int32_t channels>
+::ppl::common::RetCode Integral(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const TSrc *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    TDst *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    TDst *outTiltedData)
+{
+    if (!integral_check<TSrc, TDst, channels>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData) ||
+        !integral_check<TSrc, double, channels>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outSqWidthStride, outSqData) ||
+        !integral_check<TSrc, TDst, channels>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outTiltedWidthStride, outTiltedData)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    integral_image<TSrc, TDst, channels, false>(inHeight, inWidth, inWidthStride, inData, outWidthStride, outData);
+    integral_image<TSrc, double, channels, true>(inHeight, inWidth, inWidthStride, inData, outSqWidthStride, outSqData);
+    integral_tilted<TSrc, TDst, channels>(inHeight, inWidth, inWidthStride, inData, outTiltedWidthStride, outTiltedData);
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode Integral<uint8_t, int32_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int32_t *outData);
+
+template ::ppl::common::RetCode Integral<uint8_t, int32_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int32_t *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<uint8_t, int32_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int32_t *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    int32_t *outTiltedData);
+
+template ::ppl::common::RetCode Integral<uint8_t, int32_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int32_t *outData);
+
+template ::ppl::common::RetCode Integral<uint8_t, int32_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int32_t *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<uint8_t, int32_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int32_t *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    int32_t *outTiltedData);
+
+template ::ppl::common::RetCode Integral<uint8_t, int32_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int32_t *outData);
+
+template ::ppl::common::RetCode Integral<uint8_t, int32_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int32_t *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<uint8_t, int32_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int32_t *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    int32_t *outTiltedData);
+
+template ::ppl::common::RetCode Integral<uint8_t, float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData);
+
+template ::ppl::common::RetCode Integral<uint8_t, float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<uint8_t, float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    float *outTiltedData);
+
+template ::ppl::common::RetCode Integral<uint8_t, float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData);
+
+template ::ppl::common::RetCode Integral<uint8_t, float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<uint8_t, float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    float *outTiltedData);
+
+template ::ppl::common::RetCode Integral<uint8_t, float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData);
+
+template ::ppl::common::RetCode Integral<uint8_t, float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<uint8_t, float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    float *outTiltedData);
+
+template ::ppl::common::RetCode Integral<uint8_t, double, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData);
+
+template ::ppl::common::RetCode Integral<uint8_t, double, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<uint8_t, double, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    double *outTiltedData);
+
+template ::ppl::common::RetCode Integral<uint8_t, double, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData);
+
+template ::ppl::common::RetCode Integral<uint8_t, double, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<uint8_t, double, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    double *outTiltedData);
+
+template ::ppl::common::RetCode Integral<uint8_t, double, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData);
+
+template ::ppl::common::RetCode Integral<uint8_t, double, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<uint8_t, double, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    double *outTiltedData);
+
+template ::ppl::common::RetCode Integral<float, float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData);
+
+template ::ppl::common::RetCode Integral<float, float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<float, float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    float *outTiltedData);
+
+template ::ppl::common::RetCode Integral<float, float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData);
+
+template ::ppl::common::RetCode Integral<float, float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<float, float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    float *outTiltedData);
+
+template ::ppl::common::RetCode Integral<float, float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData);
+
+template ::ppl::common::RetCode Integral<float, float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<float, float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    float *outTiltedData);
+
+template ::ppl::common::RetCode Integral<float, double, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData);
+
+template ::ppl::common::RetCode Integral<float, double, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<float, double, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    double *outTiltedData);
+
+template ::ppl::common::RetCode Integral<float, double, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData);
+
+template ::ppl::common::RetCode Integral<float, double, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<float, double, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    double *outTiltedData);
+
+template ::ppl::common::RetCode Integral<float, double, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData);
+
+template ::ppl::common::RetCode Integral<float, double, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData);
+
+template ::ppl::common::RetCode Integral<float, double, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    double *outData,
+    int32_t outSqWidthStride,
+    double *outSqData,
+    int32_t outTiltedWidthStride,
+    double *outTiltedData);
+
+}
+}
+} // namespace ppl::cv::x86
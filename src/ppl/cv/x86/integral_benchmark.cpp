@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/integral.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+
+namespace {
+
+template<typename TSrc, typename TDst, int32_t nc, bool sqsum>
+void BM_Integral_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<TSrc[]> src(new TSrc[width * height * nc]);
+    std::unique_ptr<TDst[]> dst(new TDst[(width + 1) * (height + 1) * nc]);
+    std::unique_ptr<double[]> dst_sq(new double[(width + 1) * (height + 1) * nc]);
+    ppl::cv::debug::randomFill<TSrc>(src.get(), width * height * nc, 0, 255);
+    for (auto _ : state) {
+        if (sqsum) {
+            ppl::cv::x86::Integral<TSrc, TDst, nc>(height, width, width * nc, src.get(), height + 1, width + 1, (width + 1) * nc, dst.get(), (width + 1) * nc, dst_sq.get());
+        } else {
+            ppl::cv::x86::Integral<TSrc, TDst, nc>(height, width, width * nc, src.get(), height + 1, width + 1, (width + 1) * nc, dst.get());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_Integral_ppl_x86, uint8_t, int32_t, c1, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Integral_ppl_x86, uint8_t, int32_t, c3, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Integral_ppl_x86, uint8_t, int32_t, c1, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Integral_ppl_x86, float, float, c1, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Integral_ppl_x86, float, double, c1, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<typename TSrc, typename TDst, int32_t nc, bool sqsum>
+void BM_Integral_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<TSrc[]> src(new TSrc[width * height * nc]);
+    std::unique_ptr<TDst[]> dst(new TDst[(width + 1) * (height + 1) * nc]);
+    std::unique_ptr<double[]> dst_sq(new double[(width + 1) * (height + 1) * nc]);
+    ppl::cv::debug::randomFill<TSrc>(src.get(), width * height * nc, 0, 255);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<TSrc>::depth, nc), src.get());
+    cv::Mat dst_opencv(height + 1, width + 1, CV_MAKETYPE(cv::DataType<TDst>::depth, nc), dst.get());
+    cv::Mat dst_sq_opencv(height + 1, width + 1, CV_MAKETYPE(CV_64F, nc), dst_sq.get());
+    for (auto _ : state) {
+        if (sqsum) {
+            cv::integral(src_opencv, dst_opencv, dst_sq_opencv, cv::DataType<TDst>::depth, CV_64F);
+        } else {
+            cv::integral(src_opencv, dst_opencv, cv::DataType<TDst>::depth);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Integral_opencv_x86, uint8_t, int32_t, c1, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Integral_opencv_x86, uint8_t, int32_t, c3, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Integral_opencv_x86, uint8_t, int32_t, c1, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Integral_opencv_x86, float, float, c1, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Integral_opencv_x86, float, double, c1, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
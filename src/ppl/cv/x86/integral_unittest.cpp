@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/integral.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <cmath>
+#include <algorithm>
+
+// sums grow with the image, so they are compared relative to their magnitude
+template<typename T>
+static double IntegralMaxRelDiff(const T *data, const T *ref, int32_t length) {
+    double max = 0.0;
+    for (int32_t i = 0; i < length; ++i) {
+        double diff = std::fabs((double)data[i] - (double)ref[i]) / std::max(1.0, std::fabs((double)ref[i]));
+        max = std::max(max, diff);
+    }
+    return max;
+}
+
+template<typename TSrc, typename TDst, int32_t nc, int32_t outputs>
+void IntegralTest(int32_t height, int32_t width, double diff) {
+    const int32_t outLength = (width + 1) * (height + 1) * nc;
+    std::unique_ptr<TSrc[]> src(new TSrc[width * height * nc]);
+    std::unique_ptr<TDst[]> sum(new TDst[outLength]);
+    std::unique_ptr<TDst[]> sum_ref(new TDst[outLength]);
+    std::unique_ptr<double[]> sqsum(new double[outLength]);
+    std::unique_ptr<double[]> sqsum_ref(new double[outLength]);
+    std::unique_ptr<TDst[]> tilted(new TDst[outLength]);
+    std::unique_ptr<TDst[]> tilted_ref(new TDst[outLength]);
+    ppl::cv::debug::randomFill<TSrc>(src.get(), width * height * nc, 0, 255);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<TSrc>::depth, nc), src.get());
+    cv::Mat sum_opencv(height + 1, width + 1, CV_MAKETYPE(cv::DataType<TDst>::depth, nc), sum_ref.get());
+    cv::Mat sqsum_opencv(height + 1, width + 1, CV_MAKETYPE(CV_64F, nc), sqsum_ref.get());
+    cv::Mat tilted_opencv(height + 1, width + 1, CV_MAKETYPE(cv::DataType<TDst>::depth, nc), tilted_ref.get());
+    const int32_t outStride = (width + 1) * nc;
+
+    if (outputs == 1) {
+        ppl::cv::x86::Integral<TSrc, TDst, nc>(height, width, width * nc, src.get(), height + 1, width + 1, outStride, sum.get());
+        cv::integral(src_opencv, sum_opencv, cv::DataType<TDst>::depth);
+    } else if (outputs == 2) {
+        ppl::cv::x86::Integral<TSrc, TDst, nc>(height, width, width * nc, src.get(), height + 1, width + 1, outStride, sum.get(), outStride, sqsum.get());
+        cv::integral(src_opencv, sum_opencv, sqsum_opencv, cv::DataType<TDst>::depth, CV_64F);
+        EXPECT_LT(IntegralMaxRelDiff(sqsum.get(), sqsum_ref.get(), outLength), diff);
+    } else {
+        ppl::cv::x86::Integral<TSrc, TDst, nc>(height, width, width * nc, src.get(), height + 1, width + 1, outStride, sum.get(), outStride, sqsum.get(), outStride, tilted.get());
+        cv::integral(src_opencv, sum_opencv, sqsum_opencv, tilted_opencv, cv::DataType<TDst>::depth, CV_64F);
+        EXPECT_LT(IntegralMaxRelDiff(sqsum.get(), sqsum_ref.get(), outLength), diff);
+        EXPECT_LT(IntegralMaxRelDiff(tilted.get(), tilted_ref.get(), outLength), diff);
+    }
+    EXPECT_LT(IntegralMaxRelDiff(sum.get(), sum_ref.get(), outLength), diff);
+}
+
+#define R(name, tsrc, tdst, nc, outputs, diff) \
+    TEST(name, x86) \
+    { \
+        IntegralTest<tsrc, tdst, nc, outputs>(240, 320, diff); \
+        IntegralTest<tsrc, tdst, nc, outputs>(241, 321, diff); \
+        IntegralTest<tsrc, tdst, nc, outputs>(480, 640, diff); \
+    } \
+
+R(integral_u8s32c1_x86, uint8_t, int32_t, 1, 1, 1e-9);
+R(integral_u8s32c3_x86, uint8_t, int32_t, 3, 1, 1e-9);
+R(integral_u8s32c4_x86, uint8_t, int32_t, 4, 1, 1e-9);
+R(integral_u8f32c1_x86, uint8_t, float, 1, 1, 1e-9);
+R(integral_u8f64c1_x86, uint8_t, double, 1, 1, 1e-9);
+R(integral_fp32f32c1_x86, float, float, 1, 1, 1e-5);
+R(integral_fp32f32c3_x86, float, float, 3, 1, 1e-5);
+R(integral_fp32f32c4_x86, float, float, 4, 1, 1e-5);
+R(integral_fp32f64c1_x86, float, double, 1, 1, 1e-9);
+
+R(integral_sqsum_u8s32c1_x86, uint8_t, int32_t, 1, 2, 1e-9);
+R(integral_sqsum_u8s32c4_x86, uint8_t, int32_t, 4, 2, 1e-9);
+R(integral_sqsum_fp32f64c3_x86, float, double, 3, 2, 1e-9);
+
+R(integral_tilted_u8s32c1_x86, uint8_t, int32_t, 1, 3, 1e-9);
+R(integral_tilted_u8s32c3_x86, uint8_t, int32_t, 3, 3, 1e-9);
+R(integral_tilted_u8f64c4_x86, uint8_t, double, 4, 3, 1e-9);
+R(integral_tilted_fp32f32c1_x86, float, float, 1, 3, 1e-4);
+R(integral_tilted_fp32f64c4_x86, float, double, 4, 3, 1e-9);
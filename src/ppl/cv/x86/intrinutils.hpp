@@ -193,6 +193,70 @@ inline void v_load_deinterleave(const float* ptr, __m128& a, __m128& b, __m128&
     d = _mm_unpackhi_ps(t02hi, t13hi);
 }
 
+inline void v_store_interleave(uint8_t* ptr, const __m128i& a, const __m128i& b, const __m128i& c)
+{
+    const __m128i sh_a0 = _mm_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5);
+    const __m128i sh_a1 = _mm_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1);
+    const __m128i sh_a2 = _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1);
+    const __m128i sh_b0 = _mm_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1);
+    const __m128i sh_b1 = _mm_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10);
+    const __m128i sh_b2 = _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1);
+    const __m128i sh_c0 = _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1);
+    const __m128i sh_c1 = _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1);
+    const __m128i sh_c2 = _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15);
+
+    __m128i v0 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, sh_a0), _mm_shuffle_epi8(b, sh_b0)), _mm_shuffle_epi8(c, sh_c0));
+    __m128i v1 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, sh_a1), _mm_shuffle_epi8(b, sh_b1)), _mm_shuffle_epi8(c, sh_c1));
+    __m128i v2 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, sh_a2), _mm_shuffle_epi8(b, sh_b2)), _mm_shuffle_epi8(c, sh_c2));
+
+    _mm_storeu_si128((__m128i*)(ptr), v0);
+    _mm_storeu_si128((__m128i*)(ptr + 16), v1);
+    _mm_storeu_si128((__m128i*)(ptr + 32), v2);
+}
+
+inline void v_store_interleave(uint8_t* ptr, const __m128i& a, const __m128i& b, const __m128i& c, const __m128i& d)
+{
+    __m128i ab_lo = _mm_unpacklo_epi8(a, b); // a0 b0 a1 b1 ...
+    __m128i ab_hi = _mm_unpackhi_epi8(a, b); // a8 b8 a9 b9 ...
+    __m128i cd_lo = _mm_unpacklo_epi8(c, d); // c0 d0 c1 d1 ...
+    __m128i cd_hi = _mm_unpackhi_epi8(c, d); // c8 d8 c9 d9 ...
+
+    _mm_storeu_si128((__m128i*)(ptr), _mm_unpacklo_epi16(ab_lo, cd_lo));
+    _mm_storeu_si128((__m128i*)(ptr + 16), _mm_unpackhi_epi16(ab_lo, cd_lo));
+    _mm_storeu_si128((__m128i*)(ptr + 32), _mm_unpacklo_epi16(ab_hi, cd_hi));
+    _mm_storeu_si128((__m128i*)(ptr + 48), _mm_unpackhi_epi16(ab_hi, cd_hi));
+}
+
+inline void v_store_interleave(float* ptr, const __m128& a, const __m128& b, const __m128& c)
+{
+    __m128 u0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 0, 0)); // a0 a0 b0 b0
+    __m128 u1 = _mm_shuffle_ps(c, a, _MM_SHUFFLE(1, 1, 0, 0)); // c0 c0 a1 a1
+    __m128 v0 = _mm_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0)); // a0 b0 c0 a1
+    __m128 u2 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 1, 1)); // b1 b1 c1 c1
+    __m128 u3 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 2, 2, 2)); // a2 a2 b2 b2
+    __m128 v1 = _mm_shuffle_ps(u2, u3, _MM_SHUFFLE(2, 0, 2, 0)); // b1 c1 a2 b2
+    __m128 u4 = _mm_shuffle_ps(c, a, _MM_SHUFFLE(3, 3, 2, 2)); // c2 c2 a3 a3
+    __m128 u5 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(3, 3, 3, 3)); // b3 b3 c3 c3
+    __m128 v2 = _mm_shuffle_ps(u4, u5, _MM_SHUFFLE(2, 0, 2, 0)); // c2 a3 b3 c3
+
+    _mm_storeu_ps(ptr, v0);
+    _mm_storeu_ps(ptr + 4, v1);
+    _mm_storeu_ps(ptr + 8, v2);
+}
+
+inline void v_store_interleave(float* ptr, const __m128& a, const __m128& b, const __m128& c, const __m128& d)
+{
+    __m128 ac_lo = _mm_unpacklo_ps(a, c); // a0 c0 a1 c1
+    __m128 bd_lo = _mm_unpacklo_ps(b, d); // b0 d0 b1 d1
+    __m128 ac_hi = _mm_unpackhi_ps(a, c); // a2 c2 a3 c3
+    __m128 bd_hi = _mm_unpackhi_ps(b, d); // b2 d2 b3 d3
+
+    _mm_storeu_ps(ptr, _mm_unpacklo_ps(ac_lo, bd_lo));
+    _mm_storeu_ps(ptr + 4, _mm_unpackhi_ps(ac_lo, bd_lo));
+    _mm_storeu_ps(ptr + 8, _mm_unpacklo_ps(ac_hi, bd_hi));
+    _mm_storeu_ps(ptr + 12, _mm_unpackhi_ps(ac_hi, bd_hi));
+}
+
 inline void _mm_interleave_epi16(__m128i& v_r0, __m128i& v_r1, __m128i& v_g0, __m128i& v_g1)
 {
     __m128i v_mask = _mm_set1_epi32(0x0000ffff);
@@ -217,4 +281,45 @@ inline void _mm_interleave_epi16(__m128i& v_r0, __m128i& v_r1, __m128i& v_g0, __
     v_r1 = _mm_packus_epi32(_mm_and_si128(layer1_chunk2, v_mask), _mm_and_si128(layer1_chunk3, v_mask));
     v_g1 = _mm_packus_epi32(_mm_srli_epi32(layer1_chunk2, 16), _mm_srli_epi32(layer1_chunk3, 16));
 }
+
+// expands a single-channel mask row into one 0x00/0xFF byte per element, so the
+// masked kernels can use it as a blend mask instead of branching per pixel
+inline void v_expand_mask(const uint8_t* mask, int32_t width, int32_t channels, uint8_t* dst)
+{
+    const __m128i v_zero = _mm_setzero_si128();
+    const __m128i v_ones = _mm_set1_epi8(-1);
+    int32_t i = 0;
+    if (channels == 1) {
+        for (; i <= width - 16; i += 16) {
+            __m128i m = _mm_xor_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(mask + i)), v_zero), v_ones);
+            _mm_storeu_si128((__m128i*)(dst + i), m);
+        }
+    } else if (channels == 3) {
+        const __m128i sh0 = _mm_setr_epi8(0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5);
+        const __m128i sh1 = _mm_setr_epi8(5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10);
+        const __m128i sh2 = _mm_setr_epi8(10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15);
+        for (; i <= width - 16; i += 16) {
+            __m128i m = _mm_xor_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(mask + i)), v_zero), v_ones);
+            _mm_storeu_si128((__m128i*)(dst + i * 3), _mm_shuffle_epi8(m, sh0));
+            _mm_storeu_si128((__m128i*)(dst + i * 3 + 16), _mm_shuffle_epi8(m, sh1));
+            _mm_storeu_si128((__m128i*)(dst + i * 3 + 32), _mm_shuffle_epi8(m, sh2));
+        }
+    } else if (channels == 4) {
+        for (; i <= width - 16; i += 16) {
+            __m128i m = _mm_xor_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(mask + i)), v_zero), v_ones);
+            __m128i m0 = _mm_unpacklo_epi8(m, m);
+            __m128i m1 = _mm_unpackhi_epi8(m, m);
+            _mm_storeu_si128((__m128i*)(dst + i * 4), _mm_unpacklo_epi16(m0, m0));
+            _mm_storeu_si128((__m128i*)(dst + i * 4 + 16), _mm_unpackhi_epi16(m0, m0));
+            _mm_storeu_si128((__m128i*)(dst + i * 4 + 32), _mm_unpacklo_epi16(m1, m1));
+            _mm_storeu_si128((__m128i*)(dst + i * 4 + 48), _mm_unpackhi_epi16(m1, m1));
+        }
+    }
+    for (; i < width; ++i) {
+        uint8_t m = mask[i] ? 0xff : 0;
+        for (int32_t c = 0; c < channels; ++c) {
+            dst[i * channels + c] = m;
+        }
+    }
+}
 #endif
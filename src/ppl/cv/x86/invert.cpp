@@ -0,0 +1,294 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/invert.h"
+#include "ppl/cv/x86/invert.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <float.h>
+#include <math.h>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+template <typename T>
+struct LinalgOpsScalar {
+    typedef T value_type;
+    typedef T vec_type;
+    typedef bool mask_type;
+    enum { lanes = 1 };
+    static inline T load(const T *p) { return *p; }
+    static inline void store(T *p, T v) { *p = v; }
+    static inline T set1(T v) { return v; }
+    static inline T add(T a, T b) { return a + b; }
+    static inline T sub(T a, T b) { return a - b; }
+    static inline T mul(T a, T b) { return a * b; }
+    static inline T div(T a, T b) { return a / b; }
+    static inline T abs(T a) { return fabs(a); }
+    static inline T sqrt(T a) { return ::sqrt(a); }
+    static inline bool cmpeq(T a, T b) { return a == b; }
+    static inline bool cmplt(T a, T b) { return a < b; }
+    static inline bool cmpgt(T a, T b) { return a > b; }
+    static inline T blend(T a, T b, bool m) { return m ? b : a; }
+    static inline bool mask_or(bool a, bool b) { return a || b; }
+    static inline int32_t bits(bool m) { return m ? 1 : 0; }
+    typedef LinalgOpsScalar<double> wide_ops;
+    static inline void widen(T v, double *w) { w[0] = v; }
+    static inline T narrow(const double *w) { return (T)w[0]; }
+};
+
+template <typename T>
+struct LinalgOpsSSE;
+
+template <>
+struct LinalgOpsSSE<float> {
+    typedef float value_type;
+    typedef __m128 vec_type;
+    typedef __m128 mask_type;
+    enum { lanes = 4 };
+    static inline __m128 load(const float *p) { return _mm_loadu_ps(p); }
+    static inline void store(float *p, __m128 v) { _mm_storeu_ps(p, v); }
+    static inline __m128 set1(float v) { return _mm_set1_ps(v); }
+    static inline __m128 add(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+    static inline __m128 sub(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+    static inline __m128 mul(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+    static inline __m128 div(__m128 a, __m128 b) { return _mm_div_ps(a, b); }
+    static inline __m128 abs(__m128 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static inline __m128 sqrt(__m128 a) { return _mm_sqrt_ps(a); }
+    static inline __m128 cmpeq(__m128 a, __m128 b) { return _mm_cmpeq_ps(a, b); }
+    static inline __m128 cmplt(__m128 a, __m128 b) { return _mm_cmplt_ps(a, b); }
+    static inline __m128 cmpgt(__m128 a, __m128 b) { return _mm_cmpgt_ps(a, b); }
+    static inline __m128 blend(__m128 a, __m128 b, __m128 m) { return _mm_blendv_ps(a, b, m); }
+    static inline __m128 mask_or(__m128 a, __m128 b) { return _mm_or_ps(a, b); }
+    static inline int32_t bits(__m128 m) { return _mm_movemask_ps(m); }
+    typedef LinalgOpsSSE<double> wide_ops;
+    static inline void widen(__m128 v, __m128d *w)
+    {
+        w[0] = _mm_cvtps_pd(v);
+        w[1] = _mm_cvtps_pd(_mm_movehl_ps(v, v));
+    }
+    static inline __m128 narrow(const __m128d *w) { return _mm_movelh_ps(_mm_cvtpd_ps(w[0]), _mm_cvtpd_ps(w[1])); }
+};
+
+template <>
+struct LinalgOpsSSE<double> {
+    typedef double value_type;
+    typedef __m128d vec_type;
+    typedef __m128d mask_type;
+    enum { lanes = 2 };
+    static inline __m128d load(const double *p) { return _mm_loadu_pd(p); }
+    static inline void store(double *p, __m128d v) { _mm_storeu_pd(p, v); }
+    static inline __m128d set1(double v) { return _mm_set1_pd(v); }
+    static inline __m128d add(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+    static inline __m128d sub(__m128d a, __m128d b) { return _mm_sub_pd(a, b); }
+    static inline __m128d mul(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+    static inline __m128d div(__m128d a, __m128d b) { return _mm_div_pd(a, b); }
+    static inline __m128d abs(__m128d a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    static inline __m128d sqrt(__m128d a) { return _mm_sqrt_pd(a); }
+    static inline __m128d cmpeq(__m128d a, __m128d b) { return _mm_cmpeq_pd(a, b); }
+    static inline __m128d cmplt(__m128d a, __m128d b) { return _mm_cmplt_pd(a, b); }
+    static inline __m128d cmpgt(__m128d a, __m128d b) { return _mm_cmpgt_pd(a, b); }
+    static inline __m128d blend(__m128d a, __m128d b, __m128d m) { return _mm_blendv_pd(a, b, m); }
+    static inline __m128d mask_or(__m128d a, __m128d b) { return _mm_or_pd(a, b); }
+    static inline int32_t bits(__m128d m) { return _mm_movemask_pd(m); }
+    typedef LinalgOpsSSE<double> wide_ops;
+    static inline void widen(__m128d v, __m128d *w) { w[0] = v; }
+    static inline __m128d narrow(const __m128d *w) { return w[0]; }
+};
+
+// pivot threshold of cv::invert and cv::solve with DECOMP_LU
+template <typename T>
+static inline T linalg_lu_eps();
+
+template <>
+inline float linalg_lu_eps<float>()
+{
+    return FLT_EPSILON * 10;
+}
+
+template <>
+inline double linalg_lu_eps<double>()
+{
+    return DBL_EPSILON * 100;
+}
+
+template <typename T>
+static inline T linalg_chol_eps();
+
+template <>
+inline float linalg_chol_eps<float>()
+{
+    return FLT_EPSILON;
+}
+
+template <>
+inline double linalg_chol_eps<double>()
+{
+    return DBL_EPSILON;
+}
+
+template <typename T, int32_t n>
+static ::ppl::common::RetCode small_linalg(
+    int32_t batch,
+    const T *src,
+    const T *rhs,
+    T *dst,
+    InvertMethod method,
+    uint8_t *valid)
+{
+    if (batch <= 0 || nullptr == src || nullptr == dst) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (method != DECOMP_LU && method != DECOMP_CHOLESKY) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const bool cholesky_method = method == DECOMP_CHOLESKY;
+    const T lu_eps             = linalg_lu_eps<T>();
+    const T chol_eps           = linalg_chol_eps<T>();
+    bool any_singular          = false;
+    int32_t b                  = 0;
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        b = fma::small_linalg_batch_fma<T, n>(batch, src, rhs, dst, cholesky_method, lu_eps, chol_eps, valid, &any_singular);
+    }
+    b = small_linalg_batch<LinalgOpsSSE<T>, n>(b, batch, src, rhs, dst, cholesky_method, lu_eps, chol_eps, valid, any_singular);
+    small_linalg_batch<LinalgOpsScalar<T>, n>(b, batch, src, rhs, dst, cholesky_method, lu_eps, chol_eps, valid, any_singular);
+    return any_singular ? ppl::common::RC_INVALID_VALUE : ppl::common::RC_SUCCESS;
+}
+
+template <typename T, int32_t n>
+::ppl::common::RetCode Invert(
+    int32_t batch,
+    const T *src,
+    T *dst,
+    InvertMethod method,
+    uint8_t *valid)
+{
+    return small_linalg<T, n>(batch, src, nullptr, dst, method, valid);
+}
+
+template <typename T, int32_t n>
+::ppl::common::RetCode Solve(
+    int32_t batch,
+    const T *src,
+    const T *rhs,
+    T *dst,
+    InvertMethod method,
+    uint8_t *valid)
+{
+    if (nullptr == rhs) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return small_linalg<T, n>(batch, src, rhs, dst, method, valid);
+}
+
+template ::ppl::common::RetCode Invert<float, 2>(
+    int32_t batch,
+    const float *src,
+    float *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+template ::ppl::common::RetCode Invert<float, 3>(
+    int32_t batch,
+    const float *src,
+    float *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+template ::ppl::common::RetCode Invert<float, 6>(
+    int32_t batch,
+    const float *src,
+    float *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+template ::ppl::common::RetCode Invert<double, 2>(
+    int32_t batch,
+    const double *src,
+    double *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+template ::ppl::common::RetCode Invert<double, 3>(
+    int32_t batch,
+    const double *src,
+    double *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+template ::ppl::common::RetCode Invert<double, 6>(
+    int32_t batch,
+    const double *src,
+    double *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+template ::ppl::common::RetCode Solve<float, 2>(
+    int32_t batch,
+    const float *src,
+    const float *rhs,
+    float *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+template ::ppl::common::RetCode Solve<float, 3>(
+    int32_t batch,
+    const float *src,
+    const float *rhs,
+    float *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+template ::ppl::common::RetCode Solve<float, 6>(
+    int32_t batch,
+    const float *src,
+    const float *rhs,
+    float *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+template ::ppl::common::RetCode Solve<double, 2>(
+    int32_t batch,
+    const double *src,
+    const double *rhs,
+    double *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+template ::ppl::common::RetCode Solve<double, 3>(
+    int32_t batch,
+    const double *src,
+    const double *rhs,
+    double *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+template ::ppl::common::RetCode Solve<double, 6>(
+    int32_t batch,
+    const double *src,
+    const double *rhs,
+    double *dst,
+    InvertMethod method,
+    uint8_t *valid);
+
+}
+}
+} // namespace ppl::cv::x86
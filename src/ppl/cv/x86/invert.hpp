@@ -0,0 +1,301 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_INVERT_HPP_
+#define __ST_HPC_PPL_CV_X86_INVERT_HPP_
+
+#include "ppl/cv/types.h"
+#include <stdint.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// small matrix inversion and solving, one matrix per lane of a register. Ops provides value_type, vec_type,
+// mask_type, lanes, load, store, set1, the arithmetic, abs, sqrt, the comparisons, blend (b where the mask is set),
+// mask_or and store_valid for one register. Ops::wide_ops is the double precision Ops of the same width, widen
+// converts a register to lanes / wide_ops::lanes wide registers and narrow converts them back.
+// Matrices and vectors use the structure of arrays layout of invert.h, step is the batch size.
+template <typename Ops, int32_t n>
+struct SmallLinalg {
+    typedef typename Ops::value_type T;
+    typedef typename Ops::vec_type V;
+    typedef typename Ops::mask_type M;
+
+    static inline void load(const T *src, int32_t step, int32_t count, V *v)
+    {
+        for (int32_t i = 0; i < count; ++i) {
+            v[i] = Ops::load(src + i * step);
+        }
+    }
+
+    // zeros the lanes of singular matrices
+    static inline void store(const V *v, int32_t count, M singular, int32_t step, T *dst)
+    {
+        const V zero = Ops::set1(0);
+        for (int32_t i = 0; i < count; ++i) {
+            Ops::store(dst + i * step, Ops::blend(v[i], zero, singular));
+        }
+    }
+
+    static inline void cswap(V &a, V &b, M m)
+    {
+        V t = Ops::blend(a, b, m);
+        b   = Ops::blend(b, a, m);
+        a   = t;
+    }
+
+    // determinant of a 2x2 or a 3x3 matrix in the order of cv::invert and cv::solve
+    static inline V determinant(const V *a)
+    {
+        if (n == 2) {
+            return Ops::sub(Ops::mul(a[0], a[3]), Ops::mul(a[1], a[2]));
+        }
+        V c0 = Ops::sub(Ops::mul(a[4], a[8]), Ops::mul(a[5], a[7]));
+        V c1 = Ops::sub(Ops::mul(a[5], a[6]), Ops::mul(a[3], a[8]));
+        V c2 = Ops::sub(Ops::mul(a[3], a[7]), Ops::mul(a[4], a[6]));
+        return Ops::add(Ops::add(Ops::mul(a[0], c0), Ops::mul(a[1], c1)), Ops::mul(a[2], c2));
+    }
+
+    // 1 / det(a), singular where det(a) is 0. OpenCV evaluates the determinant in double for float matrices
+    // as well, so it is done on the wide registers, a float determinant misses or invents singular matrices.
+    static inline V inverse_det(const V *a, M &singular)
+    {
+        typedef typename Ops::wide_ops W;
+        typedef typename W::vec_type WV;
+        enum { parts = Ops::lanes / W::lanes };
+        const WV w_zero = W::set1(0);
+        const WV w_one  = W::set1(1);
+        WV wa[n * n][parts], d[parts], z[parts];
+        for (int32_t i = 0; i < n * n; ++i) {
+            Ops::widen(a[i], wa[i]);
+        }
+        for (int32_t p = 0; p < parts; ++p) {
+            WV t[n * n];
+            for (int32_t i = 0; i < n * n; ++i) {
+                t[i] = wa[i][p];
+            }
+            d[p] = SmallLinalg<W, n>::determinant(t);
+            z[p] = W::blend(w_zero, w_one, W::cmpeq(d[p], w_zero));
+        }
+        const V one = Ops::set1(1);
+        singular    = Ops::cmpeq(Ops::narrow(z), one);
+        return Ops::div(one, Ops::blend(Ops::narrow(d), one, singular));
+    }
+
+    // inverse of a 2x2 or a 3x3 matrix from its adjugate
+    static inline void adjugate(const V *a, V *r, M &singular)
+    {
+        V id = inverse_det(a, singular);
+        if (n == 2) {
+            r[0] = Ops::mul(a[3], id);
+            r[1] = Ops::mul(Ops::sub(Ops::set1(0), a[1]), id);
+            r[2] = Ops::mul(Ops::sub(Ops::set1(0), a[2]), id);
+            r[3] = Ops::mul(a[0], id);
+        } else {
+            r[0] = Ops::mul(Ops::sub(Ops::mul(a[4], a[8]), Ops::mul(a[5], a[7])), id);
+            r[1] = Ops::mul(Ops::sub(Ops::mul(a[2], a[7]), Ops::mul(a[1], a[8])), id);
+            r[2] = Ops::mul(Ops::sub(Ops::mul(a[1], a[5]), Ops::mul(a[2], a[4])), id);
+            r[3] = Ops::mul(Ops::sub(Ops::mul(a[5], a[6]), Ops::mul(a[3], a[8])), id);
+            r[4] = Ops::mul(Ops::sub(Ops::mul(a[0], a[8]), Ops::mul(a[2], a[6])), id);
+            r[5] = Ops::mul(Ops::sub(Ops::mul(a[2], a[3]), Ops::mul(a[0], a[5])), id);
+            r[6] = Ops::mul(Ops::sub(Ops::mul(a[3], a[7]), Ops::mul(a[4], a[6])), id);
+            r[7] = Ops::mul(Ops::sub(Ops::mul(a[1], a[6]), Ops::mul(a[0], a[7])), id);
+            r[8] = Ops::mul(Ops::sub(Ops::mul(a[0], a[4]), Ops::mul(a[1], a[3])), id);
+        }
+    }
+
+    // Gauss-Jordan elimination with partial pivoting on [a | r], r (n x m) becomes inv(a) * r.
+    // Every lane picks its own pivot, rows are exchanged lane by lane with blends.
+    template <int32_t m>
+    static inline void gauss_jordan(V *a, V *r, T eps, M &singular)
+    {
+        const V one   = Ops::set1(1);
+        const V v_eps = Ops::set1(eps);
+        singular      = Ops::cmplt(one, one);
+        for (int32_t k = 0; k < n; ++k) {
+            for (int32_t i = k + 1; i < n; ++i) {
+                M swap = Ops::cmpgt(Ops::abs(a[i * n + k]), Ops::abs(a[k * n + k]));
+                for (int32_t c = k; c < n; ++c) {
+                    cswap(a[k * n + c], a[i * n + c], swap);
+                }
+                for (int32_t c = 0; c < m; ++c) {
+                    cswap(r[k * m + c], r[i * m + c], swap);
+                }
+            }
+            M bad    = Ops::cmplt(Ops::abs(a[k * n + k]), v_eps);
+            singular = Ops::mask_or(singular, bad);
+            V ip     = Ops::div(one, Ops::blend(a[k * n + k], one, bad));
+            for (int32_t c = k + 1; c < n; ++c) {
+                a[k * n + c] = Ops::mul(a[k * n + c], ip);
+            }
+            for (int32_t c = 0; c < m; ++c) {
+                r[k * m + c] = Ops::mul(r[k * m + c], ip);
+            }
+            for (int32_t i = 0; i < n; ++i) {
+                if (i == k) {
+                    continue;
+                }
+                V f = a[i * n + k];
+                for (int32_t c = k + 1; c < n; ++c) {
+                    a[i * n + c] = Ops::sub(a[i * n + c], Ops::mul(f, a[k * n + c]));
+                }
+                for (int32_t c = 0; c < m; ++c) {
+                    r[i * m + c] = Ops::sub(r[i * m + c], Ops::mul(f, r[k * m + c]));
+                }
+            }
+        }
+    }
+
+    // a = L * L^T from the lower triangle of a, then r (n x m) becomes inv(a) * r.
+    // L is kept in the lower triangle of a with the reciprocal of its diagonal.
+    template <int32_t m>
+    static inline void cholesky(V *a, V *r, T eps, M &singular)
+    {
+        const V one   = Ops::set1(1);
+        const V v_eps = Ops::set1(eps);
+        singular      = Ops::cmplt(one, one);
+        for (int32_t j = 0; j < n; ++j) {
+            V s = a[j * n + j];
+            for (int32_t k = 0; k < j; ++k) {
+                s = Ops::sub(s, Ops::mul(a[j * n + k], a[j * n + k]));
+            }
+            M bad        = Ops::cmplt(s, v_eps);
+            singular     = Ops::mask_or(singular, bad);
+            V id         = Ops::div(one, Ops::sqrt(Ops::blend(s, one, bad)));
+            a[j * n + j] = id;
+            for (int32_t i = j + 1; i < n; ++i) {
+                V t = a[i * n + j];
+                for (int32_t k = 0; k < j; ++k) {
+                    t = Ops::sub(t, Ops::mul(a[i * n + k], a[j * n + k]));
+                }
+                a[i * n + j] = Ops::mul(t, id);
+            }
+        }
+        for (int32_t c = 0; c < m; ++c) {
+            for (int32_t i = 0; i < n; ++i) {
+                V t = r[i * m + c];
+                for (int32_t k = 0; k < i; ++k) {
+                    t = Ops::sub(t, Ops::mul(a[i * n + k], r[k * m + c]));
+                }
+                r[i * m + c] = Ops::mul(t, a[i * n + i]);
+            }
+            for (int32_t i = n - 1; i >= 0; --i) {
+                V t = r[i * m + c];
+                for (int32_t k = i + 1; k < n; ++k) {
+                    t = Ops::sub(t, Ops::mul(a[k * n + i], r[k * m + c]));
+                }
+                r[i * m + c] = Ops::mul(t, a[i * n + i]);
+            }
+        }
+    }
+
+    static inline void identity(V *r)
+    {
+        for (int32_t i = 0; i < n * n; ++i) {
+            r[i] = Ops::set1(i % (n + 1) == 0 ? 1 : 0);
+        }
+    }
+
+    // inverts the matrices of one register starting at src, returns the lanes that were singular
+    static inline M invert(const T *src, int32_t step, T *dst, bool cholesky_method, T lu_eps, T chol_eps)
+    {
+        V a[n * n], r[n * n];
+        M singular;
+        load(src, step, n * n, a);
+        if (cholesky_method) {
+            identity(r);
+            cholesky<n>(a, r, chol_eps, singular);
+        } else if (n <= 3) {
+            adjugate(a, r, singular);
+        } else {
+            identity(r);
+            gauss_jordan<n>(a, r, lu_eps, singular);
+        }
+        store(r, n * n, singular, step, dst);
+        return singular;
+    }
+
+    // solves the systems of one register, returns the lanes that were singular
+    static inline M solve(const T *src, const T *rhs, int32_t step, T *dst, bool cholesky_method, T lu_eps, T chol_eps)
+    {
+        V a[n * n], r[n];
+        M singular;
+        load(src, step, n * n, a);
+        load(rhs, step, n, r);
+        if (cholesky_method) {
+            cholesky<1>(a, r, chol_eps, singular);
+        } else if (n <= 3) {
+            V inv[n * n], x[n];
+            adjugate(a, inv, singular);
+            for (int32_t i = 0; i < n; ++i) {
+                x[i] = Ops::mul(inv[i * n], r[0]);
+                for (int32_t k = 1; k < n; ++k) {
+                    x[i] = Ops::add(x[i], Ops::mul(inv[i * n + k], r[k]));
+                }
+            }
+            for (int32_t i = 0; i < n; ++i) {
+                r[i] = x[i];
+            }
+        } else {
+            gauss_jordan<1>(a, r, lu_eps, singular);
+        }
+        store(r, n, singular, step, dst);
+        return singular;
+    }
+};
+
+// inverts (rhs is nullptr) or solves the matrices from b0 on, a register at a time, and returns where it stopped.
+// Sets valid and any_singular for the matrices it went through.
+template <typename Ops, int32_t n>
+int32_t small_linalg_batch(
+    int32_t b0,
+    int32_t batch,
+    const typename Ops::value_type *src,
+    const typename Ops::value_type *rhs,
+    typename Ops::value_type *dst,
+    bool cholesky_method,
+    typename Ops::value_type lu_eps,
+    typename Ops::value_type chol_eps,
+    uint8_t *valid,
+    bool &any_singular)
+{
+    typedef SmallLinalg<Ops, n> Kernel;
+    int32_t b = b0;
+    for (; b <= batch - Ops::lanes; b += Ops::lanes) {
+        typename Ops::mask_type singular;
+        if (rhs == nullptr) {
+            singular = Kernel::invert(src + b, batch, dst + b, cholesky_method, lu_eps, chol_eps);
+        } else {
+            singular = Kernel::solve(src + b, rhs + b, batch, dst + b, cholesky_method, lu_eps, chol_eps);
+        }
+        int32_t bits = Ops::bits(singular);
+        any_singular |= bits != 0;
+        if (valid != nullptr) {
+            for (int32_t l = 0; l < Ops::lanes; ++l) {
+                valid[b + l] = ((bits >> l) & 1) ? 0 : 1;
+            }
+        }
+    }
+    return b;
+}
+
+}
+}
+} // namespace ppl::cv::x86
+
+#endif //!__ST_HPC_PPL_CV_X86_INVERT_HPP_
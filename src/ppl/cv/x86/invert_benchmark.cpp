@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <opencv2/core.hpp>
+#include "ppl/cv/x86/invert.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+#include <vector>
+
+namespace {
+
+template<typename T, int32_t n, ppl::cv::InvertMethod method>
+void BM_Invert_ppl_x86(benchmark::State &state) {
+    int32_t batch = state.range(0);
+    std::unique_ptr<T[]> src(new T[batch * n * n]);
+    std::unique_ptr<T[]> dst(new T[batch * n * n]);
+    ppl::cv::debug::randomFill<T>(src.get(), batch * n * n, -10, 10);
+    for (auto _ : state) {
+        ppl::cv::x86::Invert<T, n>(batch, src.get(), dst.get(), method);
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<typename T, int32_t n, ppl::cv::InvertMethod method>
+void BM_Solve_ppl_x86(benchmark::State &state) {
+    int32_t batch = state.range(0);
+    std::unique_ptr<T[]> src(new T[batch * n * n]);
+    std::unique_ptr<T[]> rhs(new T[batch * n]);
+    std::unique_ptr<T[]> dst(new T[batch * n]);
+    ppl::cv::debug::randomFill<T>(src.get(), batch * n * n, -10, 10);
+    ppl::cv::debug::randomFill<T>(rhs.get(), batch * n, -10, 10);
+    for (auto _ : state) {
+        ppl::cv::x86::Solve<T, n>(batch, src.get(), rhs.get(), dst.get(), method);
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+
+BENCHMARK_TEMPLATE(BM_Invert_ppl_x86, float, 3, ppl::cv::DECOMP_LU)->Args({1024})->Args({4096});
+BENCHMARK_TEMPLATE(BM_Invert_ppl_x86, double, 3, ppl::cv::DECOMP_LU)->Args({1024})->Args({4096});
+BENCHMARK_TEMPLATE(BM_Invert_ppl_x86, double, 6, ppl::cv::DECOMP_LU)->Args({1024})->Args({4096});
+BENCHMARK_TEMPLATE(BM_Solve_ppl_x86, double, 3, ppl::cv::DECOMP_LU)->Args({1024})->Args({4096});
+BENCHMARK_TEMPLATE(BM_Solve_ppl_x86, double, 6, ppl::cv::DECOMP_LU)->Args({1024})->Args({4096});
+BENCHMARK_TEMPLATE(BM_Solve_ppl_x86, double, 6, ppl::cv::DECOMP_CHOLESKY)->Args({1024})->Args({4096});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<typename T, int32_t n, int32_t method>
+void BM_Invert_opencv_x86(benchmark::State &state) {
+    int32_t batch = state.range(0);
+    std::vector<cv::Mat> src(batch), dst(batch);
+    for (int32_t b = 0; b < batch; ++b) {
+        src[b].create(n, n, cv::DataType<T>::type);
+        ppl::cv::debug::randomFill<T>((T *)src[b].data, n * n, -10, 10);
+    }
+    for (auto _ : state) {
+        for (int32_t b = 0; b < batch; ++b) {
+            cv::invert(src[b], dst[b], method);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<typename T, int32_t n, int32_t method>
+void BM_Solve_opencv_x86(benchmark::State &state) {
+    int32_t batch = state.range(0);
+    std::vector<cv::Mat> src(batch), rhs(batch), dst(batch);
+    for (int32_t b = 0; b < batch; ++b) {
+        src[b].create(n, n, cv::DataType<T>::type);
+        rhs[b].create(n, 1, cv::DataType<T>::type);
+        ppl::cv::debug::randomFill<T>((T *)src[b].data, n * n, -10, 10);
+        ppl::cv::debug::randomFill<T>((T *)rhs[b].data, n, -10, 10);
+    }
+    for (auto _ : state) {
+        for (int32_t b = 0; b < batch; ++b) {
+            cv::solve(src[b], rhs[b], dst[b], method);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+
+BENCHMARK_TEMPLATE(BM_Invert_opencv_x86, float, 3, cv::DECOMP_LU)->Args({1024})->Args({4096});
+BENCHMARK_TEMPLATE(BM_Invert_opencv_x86, double, 3, cv::DECOMP_LU)->Args({1024})->Args({4096});
+BENCHMARK_TEMPLATE(BM_Invert_opencv_x86, double, 6, cv::DECOMP_LU)->Args({1024})->Args({4096});
+BENCHMARK_TEMPLATE(BM_Solve_opencv_x86, double, 3, cv::DECOMP_LU)->Args({1024})->Args({4096});
+BENCHMARK_TEMPLATE(BM_Solve_opencv_x86, double, 6, cv::DECOMP_LU)->Args({1024})->Args({4096});
+BENCHMARK_TEMPLATE(BM_Solve_opencv_x86, double, 6, cv::DECOMP_CHOLESKY)->Args({1024})->Args({4096});
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/core.hpp>
+#include "ppl/cv/x86/invert.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+template<typename T, int32_t n>
+void InvertTest(int32_t batch, ppl::cv::InvertMethod method, float diff) {
+    std::unique_ptr<T[]> src(new T[batch * n * n]);
+    std::unique_ptr<T[]> rhs(new T[batch * n]);
+    std::unique_ptr<T[]> inv(new T[batch * n * n]);
+    std::unique_ptr<T[]> sol(new T[batch * n]);
+    std::unique_ptr<uint8_t[]> valid(new uint8_t[batch]);
+    std::vector<cv::Mat> mats(batch);
+    for (int32_t b = 0; b < batch; ++b) {
+        cv::Mat m(n, n, cv::DataType<T>::type);
+        ppl::cv::debug::randomFill<T>((T *)m.data, n * n, -10, 10);
+        if (method == ppl::cv::DECOMP_CHOLESKY) {
+            // symmetric positive definite
+            m = m * m.t() + cv::Mat::eye(n, n, cv::DataType<T>::type);
+        }
+        // every seventh matrix is singular
+        if (b % 7 == 3) {
+            m.row(1).setTo(0);
+        }
+        // and so is every seventh with a last row twice the first, its determinant is only 0 if every product is rounded
+        if (method == ppl::cv::DECOMP_LU && n <= 3 && b % 7 == 5) {
+            m.row(n - 1) = m.row(0) * 2;
+        }
+        for (int32_t i = 0; i < n * n; ++i) {
+            src.get()[i * batch + b] = ((const T *)m.data)[i];
+        }
+        mats[b] = m;
+    }
+    ppl::cv::debug::randomFill<T>(rhs.get(), batch * n, -10, 10);
+
+    auto rst = ppl::cv::x86::Invert<T, n>(batch, src.get(), inv.get(), method, valid.get());
+    EXPECT_EQ(rst, batch > 3 ? ppl::common::RC_INVALID_VALUE : ppl::common::RC_SUCCESS);
+    for (int32_t b = 0; b < batch; ++b) {
+        cv::Mat inv_opencv;
+        bool ok = cv::invert(mats[b], inv_opencv, method) != 0;
+        EXPECT_EQ(valid.get()[b], ok ? 1 : 0);
+        if (!ok) {
+            continue;
+        }
+        double scale = std::max(1.0, cv::norm(inv_opencv, cv::NORM_INF));
+        for (int32_t i = 0; i < n * n; ++i) {
+            EXPECT_LT(fabs(inv.get()[i * batch + b] - ((const T *)inv_opencv.data)[i]), diff * scale);
+        }
+    }
+
+    rst = ppl::cv::x86::Solve<T, n>(batch, src.get(), rhs.get(), sol.get(), method, valid.get());
+    EXPECT_EQ(rst, batch > 3 ? ppl::common::RC_INVALID_VALUE : ppl::common::RC_SUCCESS);
+    for (int32_t b = 0; b < batch; ++b) {
+        cv::Mat r(n, 1, cv::DataType<T>::type);
+        for (int32_t i = 0; i < n; ++i) {
+            ((T *)r.data)[i] = rhs.get()[i * batch + b];
+        }
+        cv::Mat sol_opencv;
+        bool ok = cv::solve(mats[b], r, sol_opencv, method);
+        EXPECT_EQ(valid.get()[b], ok ? 1 : 0);
+        if (!ok) {
+            continue;
+        }
+        double scale = std::max(1.0, cv::norm(sol_opencv, cv::NORM_INF));
+        for (int32_t i = 0; i < n; ++i) {
+            EXPECT_LT(fabs(sol.get()[i * batch + b] - ((const T *)sol_opencv.data)[i]), diff * scale);
+        }
+    }
+}
+
+#define R(name, T, n, method, diff) \
+    TEST(name, x86) \
+    { \
+        InvertTest<T, n>(1, method, diff); \
+        InvertTest<T, n>(3, method, diff); \
+        InvertTest<T, n>(37, method, diff); \
+        InvertTest<T, n>(1024, method, diff); \
+    } \
+
+R(INVERT_LU_FLOAT_2, float, 2, ppl::cv::DECOMP_LU, 1e-2f);
+R(INVERT_LU_FLOAT_3, float, 3, ppl::cv::DECOMP_LU, 1e-2f);
+R(INVERT_LU_FLOAT_6, float, 6, ppl::cv::DECOMP_LU, 1e-2f);
+R(INVERT_LU_DOUBLE_2, double, 2, ppl::cv::DECOMP_LU, 1e-8f);
+R(INVERT_LU_DOUBLE_3, double, 3, ppl::cv::DECOMP_LU, 1e-8f);
+R(INVERT_LU_DOUBLE_6, double, 6, ppl::cv::DECOMP_LU, 1e-8f);
+R(INVERT_CHOLESKY_FLOAT_2, float, 2, ppl::cv::DECOMP_CHOLESKY, 1e-2f);
+R(INVERT_CHOLESKY_FLOAT_3, float, 3, ppl::cv::DECOMP_CHOLESKY, 1e-2f);
+R(INVERT_CHOLESKY_FLOAT_6, float, 6, ppl::cv::DECOMP_CHOLESKY, 1e-2f);
+R(INVERT_CHOLESKY_DOUBLE_2, double, 2, ppl::cv::DECOMP_CHOLESKY, 1e-8f);
+R(INVERT_CHOLESKY_DOUBLE_3, double, 3, ppl::cv::DECOMP_CHOLESKY, 1e-8f);
+R(INVERT_CHOLESKY_DOUBLE_6, double, 6, ppl::cv::DECOMP_CHOLESKY, 1e-8f);
@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/lut.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <string.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+template <typename T>
+static void lut_scalar(
+    int32_t height,
+    int32_t length,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    T *outData,
+    const T *lut,
+    int32_t lutChannels)
+{
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        T *dst             = outData + i * outWidthStride;
+        if (lutChannels == 1) {
+            for (int32_t j = 0; j < length; ++j) {
+                dst[j] = lut[src[j]];
+            }
+        } else {
+            for (int32_t j = 0; j < length; j += lutChannels) {
+                for (int32_t c = 0; c < lutChannels; ++c) {
+                    dst[j + c] = lut[src[j + c] * lutChannels + c];
+                }
+            }
+        }
+    }
+}
+
+// per-channel tables which are all the same take the shared table path
+template <typename T, int32_t channels>
+static bool lut_channels_equal(const T *lut)
+{
+    for (int32_t i = 0; i < 256; ++i) {
+        for (int32_t c = 1; c < channels; ++c) {
+            if (lut[i * channels + c] != lut[i * channels]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <int32_t channels>
+static void lut_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const uint8_t *lut,
+    int32_t lutChannels)
+{
+    uint8_t shared[256];
+    if (channels > 1 && lutChannels > 1 && lut_channels_equal<uint8_t, channels>(lut)) {
+        for (int32_t i = 0; i < 256; ++i) {
+            shared[i] = lut[i * channels];
+        }
+        lut         = shared;
+        lutChannels = 1;
+    }
+    if (!ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        lut_scalar<uint8_t>(height, width * channels, inWidthStride, inData, outWidthStride, outData, lut, lutChannels);
+    } else if (lutChannels == 1) {
+        fma::lut_u8_fma(height, width * channels, inWidthStride, inData, outWidthStride, outData, lut);
+    } else {
+        int32_t lut32[256 * channels];
+        for (int32_t i = 0; i < 256 * channels; ++i) {
+            lut32[i] = lut[i];
+        }
+        fma::lut_gather_u8_fma<channels>(height, width, inWidthStride, inData, outWidthStride, outData, lut32);
+    }
+}
+
+template <int32_t channels>
+static void lut_f32(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    const float *lut,
+    int32_t lutChannels)
+{
+    if (!ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        lut_scalar<float>(height, width * channels, inWidthStride, inData, outWidthStride, outData, lut, lutChannels);
+    } else if (lutChannels == 1) {
+        fma::lut_gather_f32_fma<1>(height, width * channels, inWidthStride, inData, outWidthStride, outData, lut);
+    } else {
+        fma::lut_gather_f32_fma<channels>(height, width, inWidthStride, inData, outWidthStride, outData, lut);
+    }
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode LUT(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    T *outData,
+    const T *lut,
+    int32_t lutChannels)
+{
+    if (nullptr == inData || nullptr == outData || nullptr == lut) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (lutChannels != 1 && lutChannels != channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (sizeof(T) == 1) {
+        lut_u8<channels>(height, width, inWidthStride, inData, outWidthStride, (uint8_t *)outData, (const uint8_t *)lut, lutChannels);
+    } else {
+        lut_f32<channels>(height, width, inWidthStride, inData, outWidthStride, (float *)outData, (const float *)lut, lutChannels);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode LUT<uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const uint8_t *lut,
+    int32_t lutChannels);
+
+template ::ppl::common::RetCode LUT<uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const uint8_t *lut,
+    int32_t lutChannels);
+
+template ::ppl::common::RetCode LUT<uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const uint8_t *lut,
+    int32_t lutChannels);
+
+template ::ppl::common::RetCode LUT<float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    const float *lut,
+    int32_t lutChannels);
+
+template ::ppl::common::RetCode LUT<float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    const float *lut,
+    int32_t lutChannels);
+
+template ::ppl::common::RetCode LUT<float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    const float *lut,
+    int32_t lutChannels);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/core.hpp>
+#include "ppl/cv/x86/lut.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <cstring>
+
+template<typename T, int32_t nc, int32_t lutChannels, bool inplace>
+void LUTTest(int32_t height, int32_t width) {
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
+    std::unique_ptr<T[]> lut(new T[256 * lutChannels]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<T>(lut.get(), 256 * lutChannels, 0, 255);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(CV_8U, nc), src.get());
+    cv::Mat dst_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
+    cv::Mat lut_opencv(1, 256, CV_MAKETYPE(cv::DataType<T>::depth, lutChannels), lut.get());
+    cv::LUT(src_opencv, lut_opencv, dst_opencv);
+
+    if (inplace) {
+        memcpy(dst.get(), src.get(), width * height * nc * sizeof(uint8_t));
+        ppl::cv::x86::LUT<T, nc>(height, width, width * nc, (const uint8_t *)dst.get(), width * nc, dst.get(), lut.get(), lutChannels);
+    } else {
+        ppl::cv::x86::LUT<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), lut.get(), lutChannels);
+    }
+    checkResult<T, nc>(dst.get(), dst_ref.get(), height, width, width * nc, width * nc, 1e-6f);
+}
+
+#define R(name, dtype, nc, lutChannels, inplace) \
+    TEST(name, x86) \
+    { \
+        LUTTest<dtype, nc, lutChannels, inplace>(240, 320); \
+        LUTTest<dtype, nc, lutChannels, inplace>(241, 321); \
+        LUTTest<dtype, nc, lutChannels, inplace>(1080, 1920); \
+    } \
+
+R(lut_u8c1_x86, uint8_t, 1, 1, false);
+R(lut_u8c3_x86, uint8_t, 3, 1, false);
+R(lut_u8c4_x86, uint8_t, 4, 1, false);
+R(lut_u8c3_perchannel_x86, uint8_t, 3, 3, false);
+R(lut_u8c4_perchannel_x86, uint8_t, 4, 4, false);
+R(lut_u8c1_inplace_x86, uint8_t, 1, 1, true);
+R(lut_u8c3_perchannel_inplace_x86, uint8_t, 3, 3, true);
+R(lut_f32c1_x86, float, 1, 1, false);
+R(lut_f32c3_x86, float, 3, 1, false);
+R(lut_f32c4_x86, float, 4, 1, false);
+R(lut_f32c3_perchannel_x86, float, 3, 3, false);
+R(lut_f32c4_perchannel_x86, float, 4, 4, false);
@@ -0,0 +1,412 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/mean.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/intrinutils.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <string.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// rows per stripe, stripes are reduced independently and merged in order
+#define MEAN_STRIPE_ROWS 16
+// bytes per block, a 16-bit lane adds two bytes per 48 bytes so 128 iterations sum to at most 65280
+#define MEAN_U8_BLOCK_SIZE 6144
+// floats per block, float lanes only ever hold the sum of one short block
+#define MEAN_F32_BLOCK_SIZE 240
+
+// widens 4 mask bytes (0 or 0xff) to a float lane mask, reading exactly 4 bytes
+static inline __m128 load_mask_ps(const uint8_t *mask)
+{
+    int32_t bits;
+    memcpy(&bits, mask, sizeof(bits));
+    return _mm_castsi128_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(bits)));
+}
+
+// Each iteration adds the vectors of consecutive elements round robin into three accumulators, so lane j of
+// the accumulators stored one after another always sees the elements at offset j modulo three vectors. That
+// is a multiple of 1, 3 and 4 elements, so every lane belongs to a single channel.
+static void sum_channels_row_sse(int32_t length, int32_t channels, const uint8_t *src, const uint8_t *mask, double *sum, double *sqsum)
+{
+    const __m128i v_zero = _mm_setzero_si128();
+    int32_t i            = 0;
+    for (int32_t block = 0; block <= length - 48; block += MEAN_U8_BLOCK_SIZE) {
+        int32_t end    = std::min(length, block + MEAN_U8_BLOCK_SIZE);
+        __m128i v_sum0 = v_zero, v_sum1 = v_zero, v_sum2 = v_zero;
+        __m128i v_sq0 = v_zero, v_sq1 = v_zero, v_sq2 = v_zero;
+        for (i = block; i <= end - 48; i += 48) {
+            __m128i v_src0 = _mm_loadu_si128((const __m128i *)(src + i));
+            __m128i v_src1 = _mm_loadu_si128((const __m128i *)(src + i + 16));
+            __m128i v_src2 = _mm_loadu_si128((const __m128i *)(src + i + 32));
+            if (mask != nullptr) {
+                v_src0 = _mm_and_si128(v_src0, _mm_loadu_si128((const __m128i *)(mask + i)));
+                v_src1 = _mm_and_si128(v_src1, _mm_loadu_si128((const __m128i *)(mask + i + 16)));
+                v_src2 = _mm_and_si128(v_src2, _mm_loadu_si128((const __m128i *)(mask + i + 32)));
+            }
+            // the 16-bit vectors start at element 0, 8, 16, 24, 32 and 40
+            __m128i v_lo0 = _mm_unpacklo_epi8(v_src0, v_zero), v_hi0 = _mm_unpackhi_epi8(v_src0, v_zero);
+            __m128i v_lo1 = _mm_unpacklo_epi8(v_src1, v_zero), v_hi1 = _mm_unpackhi_epi8(v_src1, v_zero);
+            __m128i v_lo2 = _mm_unpacklo_epi8(v_src2, v_zero), v_hi2 = _mm_unpackhi_epi8(v_src2, v_zero);
+            v_sum0        = _mm_add_epi16(v_sum0, _mm_add_epi16(v_lo0, v_hi1));
+            v_sum1        = _mm_add_epi16(v_sum1, _mm_add_epi16(v_hi0, v_lo2));
+            v_sum2        = _mm_add_epi16(v_sum2, _mm_add_epi16(v_lo1, v_hi2));
+            if (sqsum != nullptr) {
+                // the squares fit in 16 bits and are widened to the 32-bit vectors of 4 elements each
+                v_lo0 = _mm_mullo_epi16(v_lo0, v_lo0);
+                v_hi0 = _mm_mullo_epi16(v_hi0, v_hi0);
+                v_lo1 = _mm_mullo_epi16(v_lo1, v_lo1);
+                v_hi1 = _mm_mullo_epi16(v_hi1, v_hi1);
+                v_lo2 = _mm_mullo_epi16(v_lo2, v_lo2);
+                v_hi2 = _mm_mullo_epi16(v_hi2, v_hi2);
+                v_sq0 = _mm_add_epi32(v_sq0, _mm_add_epi32(_mm_add_epi32(_mm_unpacklo_epi16(v_lo0, v_zero), _mm_unpackhi_epi16(v_hi0, v_zero)),
+                                                           _mm_add_epi32(_mm_unpacklo_epi16(v_hi1, v_zero), _mm_unpackhi_epi16(v_lo2, v_zero))));
+                v_sq1 = _mm_add_epi32(v_sq1, _mm_add_epi32(_mm_add_epi32(_mm_unpackhi_epi16(v_lo0, v_zero), _mm_unpacklo_epi16(v_lo1, v_zero)),
+                                                           _mm_add_epi32(_mm_unpackhi_epi16(v_hi1, v_zero), _mm_unpacklo_epi16(v_hi2, v_zero))));
+                v_sq2 = _mm_add_epi32(v_sq2, _mm_add_epi32(_mm_add_epi32(_mm_unpacklo_epi16(v_hi0, v_zero), _mm_unpackhi_epi16(v_lo1, v_zero)),
+                                                           _mm_add_epi32(_mm_unpacklo_epi16(v_lo2, v_zero), _mm_unpackhi_epi16(v_hi2, v_zero))));
+            }
+        }
+        uint16_t buf_sum[24];
+        _mm_storeu_si128((__m128i *)buf_sum, v_sum0);
+        _mm_storeu_si128((__m128i *)(buf_sum + 8), v_sum1);
+        _mm_storeu_si128((__m128i *)(buf_sum + 16), v_sum2);
+        for (int32_t j = 0; j < 24; ++j) {
+            sum[(block + j) % channels] += buf_sum[j];
+        }
+        if (sqsum != nullptr) {
+            uint32_t buf_sq[12];
+            _mm_storeu_si128((__m128i *)buf_sq, v_sq0);
+            _mm_storeu_si128((__m128i *)(buf_sq + 4), v_sq1);
+            _mm_storeu_si128((__m128i *)(buf_sq + 8), v_sq2);
+            for (int32_t j = 0; j < 12; ++j) {
+                sqsum[(block + j) % channels] += buf_sq[j];
+            }
+        }
+    }
+    for (; i < length; ++i) {
+        int32_t v = src[i] & (mask != nullptr ? mask[i] : 0xff);
+        sum[i % channels] += v;
+        if (sqsum != nullptr) {
+            sqsum[i % channels] += v * v;
+        }
+    }
+}
+
+static void sum_channels_row_sse(int32_t length, int32_t channels, const float *src, const uint8_t *mask, double *sum, double *sqsum)
+{
+    int32_t i = 0;
+    for (int32_t block = 0; block <= length - 12; block += MEAN_F32_BLOCK_SIZE) {
+        int32_t end   = std::min(length, block + MEAN_F32_BLOCK_SIZE);
+        __m128 v_sum0 = _mm_setzero_ps(), v_sum1 = _mm_setzero_ps(), v_sum2 = _mm_setzero_ps();
+        __m128 v_sq0 = _mm_setzero_ps(), v_sq1 = _mm_setzero_ps(), v_sq2 = _mm_setzero_ps();
+        for (i = block; i <= end - 12; i += 12) {
+            __m128 v_src0 = _mm_loadu_ps(src + i);
+            __m128 v_src1 = _mm_loadu_ps(src + i + 4);
+            __m128 v_src2 = _mm_loadu_ps(src + i + 8);
+            if (mask != nullptr) {
+                v_src0 = _mm_and_ps(v_src0, load_mask_ps(mask + i));
+                v_src1 = _mm_and_ps(v_src1, load_mask_ps(mask + i + 4));
+                v_src2 = _mm_and_ps(v_src2, load_mask_ps(mask + i + 8));
+            }
+            v_sum0 = _mm_add_ps(v_sum0, v_src0);
+            v_sum1 = _mm_add_ps(v_sum1, v_src1);
+            v_sum2 = _mm_add_ps(v_sum2, v_src2);
+            if (sqsum != nullptr) {
+                v_sq0 = _mm_add_ps(v_sq0, _mm_mul_ps(v_src0, v_src0));
+                v_sq1 = _mm_add_ps(v_sq1, _mm_mul_ps(v_src1, v_src1));
+                v_sq2 = _mm_add_ps(v_sq2, _mm_mul_ps(v_src2, v_src2));
+            }
+        }
+        float buf[12];
+        _mm_storeu_ps(buf, v_sum0);
+        _mm_storeu_ps(buf + 4, v_sum1);
+        _mm_storeu_ps(buf + 8, v_sum2);
+        for (int32_t j = 0; j < 12; ++j) {
+            sum[(block + j) % channels] += buf[j];
+        }
+        if (sqsum != nullptr) {
+            _mm_storeu_ps(buf, v_sq0);
+            _mm_storeu_ps(buf + 4, v_sq1);
+            _mm_storeu_ps(buf + 8, v_sq2);
+            for (int32_t j = 0; j < 12; ++j) {
+                sqsum[(block + j) % channels] += buf[j];
+            }
+        }
+    }
+    for (; i < length; ++i) {
+        if (mask == nullptr || mask[i]) {
+            sum[i % channels] += src[i];
+            if (sqsum != nullptr) {
+                sqsum[i % channels] += static_cast<double>(src[i]) * src[i];
+            }
+        }
+    }
+}
+
+// number of pixels of a mask row that are not 0
+static int32_t count_mask_row(int32_t width, const uint8_t *mask)
+{
+    const __m128i v_zero = _mm_setzero_si128();
+    const __m128i v_one  = _mm_set1_epi8(1);
+    __m128i v_count      = v_zero;
+    int32_t i            = 0;
+    for (; i <= width - 16; i += 16) {
+        __m128i v_sel = _mm_andnot_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(mask + i)), v_zero), v_one);
+        v_count       = _mm_add_epi64(v_count, _mm_sad_epu8(v_sel, v_zero));
+    }
+    int64_t buf[2];
+    _mm_storeu_si128((__m128i *)buf, v_count);
+    int32_t count = static_cast<int32_t>(buf[0] + buf[1]);
+    for (; i < width; ++i) {
+        count += mask[i] != 0;
+    }
+    return count;
+}
+
+// stdDevValue is nullptr for Mean
+template <typename T, int32_t channels>
+static ::ppl::common::RetCode MeanStdDevImpl(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    double *meanValue,
+    double *stdDevValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask)
+{
+    if (nullptr == inData || nullptr == meanValue) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (mask != nullptr && maskWidthStride < inWidth) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const bool use_fma    = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const bool need_sq    = stdDevValue != nullptr;
+    const int32_t length  = inWidth * channels;
+    const int32_t stripes = (inHeight + MEAN_STRIPE_ROWS - 1) / MEAN_STRIPE_ROWS;
+    std::vector<double> partial_sum(stripes * channels, 0);
+    std::vector<double> partial_sqsum(need_sq ? stripes * channels : 0, 0);
+    std::vector<int64_t> partial_count(stripes, 0);
+
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        std::vector<uint8_t> mask_row(mask != nullptr ? length : 0);
+        double *stripe_sum   = partial_sum.data() + s * channels;
+        double *stripe_sqsum = need_sq ? partial_sqsum.data() + s * channels : nullptr;
+        int32_t end          = std::min(inHeight, (s + 1) * MEAN_STRIPE_ROWS);
+        for (int32_t i = s * MEAN_STRIPE_ROWS; i < end; ++i) {
+            const uint8_t *m = nullptr;
+            if (mask != nullptr) {
+                v_expand_mask(mask + i * maskWidthStride, inWidth, channels, mask_row.data());
+                m = mask_row.data();
+                partial_count[s] += count_mask_row(inWidth, mask + i * maskWidthStride);
+            } else {
+                partial_count[s] += inWidth;
+            }
+            const T *src = inData + i * inWidthStride;
+            if (use_fma) {
+                fma::sum_channels_row_fma<T>(length, channels, src, m, stripe_sum, stripe_sqsum);
+            } else {
+                sum_channels_row_sse(length, channels, src, m, stripe_sum, stripe_sqsum);
+            }
+        }
+    }
+
+    int64_t count = 0;
+    for (int32_t s = 0; s < stripes; ++s) {
+        count += partial_count[s];
+    }
+    for (int32_t c = 0; c < channels; ++c) {
+        double sum = 0, sqsum = 0;
+        for (int32_t s = 0; s < stripes; ++s) {
+            sum += partial_sum[s * channels + c];
+            if (need_sq) {
+                sqsum += partial_sqsum[s * channels + c];
+            }
+        }
+        // an empty mask gives 0
+        double scale = count > 0 ? 1. / count : 0.;
+        double mean  = sum * scale;
+        meanValue[c] = mean;
+        if (need_sq) {
+            stdDevValue[c] = std::sqrt(std::max(sqsum * scale - mean * mean, 0.));
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode Mean(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    double *meanValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask)
+{
+    return MeanStdDevImpl<T, channels>(inHeight, inWidth, inWidthStride, inData, meanValue, nullptr, maskWidthStride, mask);
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode MeanStdDev(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    double *meanValue,
+    double *stdDevValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask)
+{
+    if (nullptr == stdDevValue) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return MeanStdDevImpl<T, channels>(inHeight, inWidth, inWidthStride, inData, meanValue, stdDevValue, maskWidthStride, mask);
+}
+
+template ::ppl::common::RetCode Mean<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *meanValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Mean<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *meanValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Mean<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *meanValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Mean<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *meanValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Mean<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *meanValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Mean<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *meanValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode MeanStdDev<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *meanValue,
+    double *stdDevValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode MeanStdDev<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *meanValue,
+    double *stdDevValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode MeanStdDev<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *meanValue,
+    double *stdDevValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode MeanStdDev<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *meanValue,
+    double *stdDevValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode MeanStdDev<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *meanValue,
+    double *stdDevValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode MeanStdDev<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *meanValue,
+    double *stdDevValue,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+}
+}
+} // namespace ppl::cv::x86
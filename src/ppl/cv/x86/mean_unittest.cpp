@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/core.hpp>
+#include "ppl/cv/x86/mean.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+
+template<typename T, int32_t nc, bool use_mask>
+void MeanTest(int32_t height, int32_t width) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(mask.get(), width * height, 0, 1);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * width * nc);
+    cv::Mat mask_opencv(height, width, CV_8UC1, mask.get(), width);
+
+    double mean_value[nc];
+    double mean_sd_value[nc], stddev_value[nc];
+    cv::Scalar mean_ref, mean_sd_ref, stddev_ref;
+    if (use_mask) {
+        ppl::cv::x86::Mean<T, nc>(height, width, width * nc, src.get(), mean_value, width, mask.get());
+        ppl::cv::x86::MeanStdDev<T, nc>(height, width, width * nc, src.get(), mean_sd_value, stddev_value, width, mask.get());
+        mean_ref = cv::mean(src_opencv, mask_opencv);
+        cv::meanStdDev(src_opencv, mean_sd_ref, stddev_ref, mask_opencv);
+    } else {
+        ppl::cv::x86::Mean<T, nc>(height, width, width * nc, src.get(), mean_value);
+        ppl::cv::x86::MeanStdDev<T, nc>(height, width, width * nc, src.get(), mean_sd_value, stddev_value);
+        mean_ref = cv::mean(src_opencv);
+        cv::meanStdDev(src_opencv, mean_sd_ref, stddev_ref);
+    }
+    for (int32_t c = 0; c < nc; ++c) {
+        EXPECT_LE(std::abs(mean_value[c] - mean_ref[c]), 1e-4 * std::max(1.0, std::abs(mean_ref[c])));
+        EXPECT_LE(std::abs(mean_sd_value[c] - mean_sd_ref[c]), 1e-4 * std::max(1.0, std::abs(mean_sd_ref[c])));
+        EXPECT_LE(std::abs(stddev_value[c] - stddev_ref[c]), 1e-4 * std::max(1.0, std::abs(stddev_ref[c])));
+    }
+}
+
+#define R(name, dtype, nc, use_mask) \
+    TEST(name, x86) \
+    { \
+        MeanTest<dtype, nc, use_mask>(240, 320); \
+        MeanTest<dtype, nc, use_mask>(241, 321); \
+        MeanTest<dtype, nc, use_mask>(480, 640); \
+        MeanTest<dtype, nc, use_mask>(1080, 1920); \
+    } \
+
+R(mean_u8c1_x86, uint8_t, 1, false);
+R(mean_u8c3_x86, uint8_t, 3, false);
+R(mean_u8c4_x86, uint8_t, 4, false);
+R(mean_u8c1_mask_x86, uint8_t, 1, true);
+R(mean_u8c3_mask_x86, uint8_t, 3, true);
+R(mean_u8c4_mask_x86, uint8_t, 4, true);
+
+R(mean_fp32c1_x86, float, 1, false);
+R(mean_fp32c3_x86, float, 3, false);
+R(mean_fp32c4_x86, float, 4, false);
+R(mean_fp32c1_mask_x86, float, 1, true);
+R(mean_fp32c3_mask_x86, float, 3, true);
+R(mean_fp32c4_mask_x86, float, 4, true);
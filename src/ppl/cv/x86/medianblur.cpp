@@ -0,0 +1,376 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/medianblur.h"
+#include "ppl/cv/x86/medianblur.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// output rows per stripe of the sorting network path
+#define MEDIANBLUR_STRIPE_ROWS      32
+// output rows per stripe of the histogram path, the column histograms are rebuilt once per stripe
+#define MEDIANBLUR_HIST_STRIPE_ROWS 128
+// output columns per tile of the histogram path, sized so that the column histograms stay in L2
+#define MEDIANBLUR_HIST_TILE_COLS   512
+
+struct MedianOpsU8x16 {
+    typedef __m128i vec_type;
+    enum { lanes = 16 };
+    static inline vec_type load(const uint8_t *p)
+    {
+        return _mm_loadu_si128((const __m128i *)p);
+    }
+    static inline void store(uint8_t *p, vec_type v)
+    {
+        _mm_storeu_si128((__m128i *)p, v);
+    }
+    static inline vec_type min(vec_type a, vec_type b)
+    {
+        return _mm_min_epu8(a, b);
+    }
+    static inline vec_type max(vec_type a, vec_type b)
+    {
+        return _mm_max_epu8(a, b);
+    }
+};
+
+struct MedianOpsU8x1 {
+    typedef uint8_t vec_type;
+    enum { lanes = 1 };
+    static inline vec_type load(const uint8_t *p)
+    {
+        return *p;
+    }
+    static inline void store(uint8_t *p, vec_type v)
+    {
+        *p = v;
+    }
+    static inline vec_type min(vec_type a, vec_type b)
+    {
+        return a < b ? a : b;
+    }
+    static inline vec_type max(vec_type a, vec_type b)
+    {
+        return a > b ? a : b;
+    }
+};
+
+template <int32_t channels>
+static void median_pad_row(
+    int32_t width,
+    const uint8_t *src,
+    int32_t radius,
+    BorderType border_type,
+    uint8_t *row)
+{
+    memcpy(row + radius * channels, src, width * channels);
+    for (int32_t p = 1; p <= radius; ++p) {
+        const uint8_t *left  = src + border_interpolate(-p, width, border_type) * channels;
+        const uint8_t *right = src + border_interpolate(width - 1 + p, width, border_type) * channels;
+        for (int32_t c = 0; c < channels; ++c) {
+            row[(radius - p) * channels + c]             = left[c];
+            row[(radius + width - 1 + p) * channels + c] = right[c];
+        }
+    }
+}
+
+template <int32_t channels, int32_t ksize>
+static void median_blur_sortnet(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    BorderType border_type)
+{
+    const int32_t radius  = ksize / 2;
+    const int32_t length  = width * channels;
+    const int32_t row_len = (width + 2 * radius) * channels;
+    const int32_t stripes = (height + MEDIANBLUR_STRIPE_ROWS - 1) / MEDIANBLUR_STRIPE_ROWS;
+    const bool use_fma    = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        const int32_t y0 = s * MEDIANBLUR_STRIPE_ROWS;
+        const int32_t y1 = std::min(height, y0 + MEDIANBLUR_STRIPE_ROWS);
+        // ring of padded source rows, logical row l lives in slot (l + radius) % ksize
+        std::vector<uint8_t> ring(ksize * row_len);
+        for (int32_t l = y0 - radius; l < y0 + radius; ++l) {
+            median_pad_row<channels>(width, inData + border_interpolate(l, height, border_type) * inWidthStride, radius, border_type, ring.data() + (l + radius) % ksize * row_len);
+        }
+        for (int32_t y = y0; y < y1; ++y) {
+            const int32_t l = y + radius;
+            median_pad_row<channels>(width, inData + border_interpolate(l, height, border_type) * inWidthStride, radius, border_type, ring.data() + (l + radius) % ksize * row_len);
+            const uint8_t *rows[ksize];
+            for (int32_t dy = 0; dy < ksize; ++dy) {
+                rows[dy] = ring.data() + (y + dy) % ksize * row_len + radius * channels;
+            }
+            uint8_t *dst = outData + y * outWidthStride;
+            int32_t i    = 0;
+            if (use_fma) {
+                i = fma::median_sortnet_row_fma<ksize>(rows, length, channels, dst);
+            }
+            if (i == 0) {
+                i = median_sortnet_row<MedianOpsU8x16, ksize>(rows, length, channels, dst);
+            }
+            for (; i < length; ++i) {
+                const uint8_t *taps[ksize];
+                for (int32_t dy = 0; dy < ksize; ++dy) {
+                    taps[dy] = rows[dy] + i;
+                }
+                median_sortnet_row<MedianOpsU8x1, ksize>(taps, 1, channels, dst + i);
+            }
+        }
+    }
+}
+
+// column histograms of one tile: a 16-bin coarse histogram of v >> 4 and a 256-bin fine histogram per column and channel
+template <int32_t channels>
+static void median_hist_update(
+    int32_t ncols,
+    const int32_t *xofs,
+    const uint8_t *src,
+    uint16_t delta,
+    uint16_t *coarse,
+    uint16_t *fine)
+{
+    for (int32_t p = 0; p < ncols; ++p) {
+        const uint8_t *s = src + xofs[p];
+        for (int32_t c = 0; c < channels; ++c) {
+            const int32_t h = p * channels + c;
+            coarse[h * 16 + (s[c] >> 4)] += delta;
+            fine[h * 256 + s[c]] += delta;
+        }
+    }
+}
+
+static inline void median_hist_add(uint16_t *dst, const uint16_t *a)
+{
+    _mm_storeu_si128((__m128i *)dst, _mm_add_epi16(_mm_loadu_si128((const __m128i *)dst), _mm_loadu_si128((const __m128i *)a)));
+    _mm_storeu_si128((__m128i *)(dst + 8), _mm_add_epi16(_mm_loadu_si128((const __m128i *)(dst + 8)), _mm_loadu_si128((const __m128i *)(a + 8))));
+}
+
+// dst += a - b on 16 bins
+static inline void median_hist_slide(uint16_t *dst, const uint16_t *a, const uint16_t *b)
+{
+    __m128i v_lo = _mm_sub_epi16(_mm_add_epi16(_mm_loadu_si128((const __m128i *)dst), _mm_loadu_si128((const __m128i *)a)), _mm_loadu_si128((const __m128i *)b));
+    __m128i v_hi = _mm_sub_epi16(_mm_add_epi16(_mm_loadu_si128((const __m128i *)(dst + 8)), _mm_loadu_si128((const __m128i *)(a + 8))), _mm_loadu_si128((const __m128i *)(b + 8)));
+    _mm_storeu_si128((__m128i *)dst, v_lo);
+    _mm_storeu_si128((__m128i *)(dst + 8), v_hi);
+}
+
+// index of the first of 16 bins whose running total exceeds rank, before receives the total of the bins in front of it
+static inline int32_t median_hist_find(const uint16_t *h, int32_t rank, int32_t *before)
+{
+    __m128i v_lo = _mm_loadu_si128((const __m128i *)h);
+    __m128i v_hi = _mm_loadu_si128((const __m128i *)(h + 8));
+    v_lo         = _mm_add_epi16(v_lo, _mm_slli_si128(v_lo, 2));
+    v_hi         = _mm_add_epi16(v_hi, _mm_slli_si128(v_hi, 2));
+    v_lo         = _mm_add_epi16(v_lo, _mm_slli_si128(v_lo, 4));
+    v_hi         = _mm_add_epi16(v_hi, _mm_slli_si128(v_hi, 4));
+    v_lo         = _mm_add_epi16(v_lo, _mm_slli_si128(v_lo, 8));
+    v_hi         = _mm_add_epi16(v_hi, _mm_slli_si128(v_hi, 8));
+    v_hi         = _mm_add_epi16(v_hi, _mm_unpackhi_epi64(_mm_shufflehi_epi16(v_lo, 0xff), _mm_shufflehi_epi16(v_lo, 0xff)));
+    // running totals go up to 255 * 255, so they are compared unsigned
+    const __m128i v_rank = _mm_set1_epi16((int16_t)(rank + 1));
+    __m128i v_ge_lo      = _mm_cmpeq_epi16(_mm_max_epu16(v_lo, v_rank), v_lo);
+    __m128i v_ge_hi      = _mm_cmpeq_epi16(_mm_max_epu16(v_hi, v_rank), v_hi);
+    uint16_t prefix[16];
+    _mm_storeu_si128((__m128i *)prefix, v_lo);
+    _mm_storeu_si128((__m128i *)(prefix + 8), v_hi);
+    int32_t idx = __builtin_ctz(_mm_movemask_epi8(_mm_packs_epi16(v_ge_lo, v_ge_hi)));
+    *before     = idx > 0 ? prefix[idx - 1] : 0;
+    return idx;
+}
+
+// medians along one row of a tile, columns [x, x + ksize) of the histograms cover output x.
+// The channels are independent chains and are interleaved so that they overlap.
+template <int32_t channels>
+static void median_hist_row(
+    int32_t outCols,
+    int32_t ksize,
+    const uint16_t *coarse,
+    const uint16_t *fine,
+    uint8_t *dst)
+{
+    const int32_t rank = ksize * ksize / 2;
+    uint16_t Hc[channels][16];
+    uint16_t Hf[channels][16 * 16];
+    // the fine bins of coarse bin b sum the columns [luc[b] - ksize, luc[b])
+    int32_t luc[channels][16];
+    memset(Hc, 0, sizeof(Hc));
+    memset(luc, 0, sizeof(luc));
+    for (int32_t p = 0; p < ksize; ++p) {
+        for (int32_t c = 0; c < channels; ++c) {
+            median_hist_add(Hc[c], coarse + (p * channels + c) * 16);
+        }
+    }
+    for (int32_t x = 0; x < outCols; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            int32_t sum;
+            const int32_t b = median_hist_find(Hc[c], rank, &sum);
+            uint16_t *hf    = Hf[c] + b * 16;
+            if (luc[c][b] <= x) {
+                __m128i v_lo = _mm_setzero_si128(), v_hi = _mm_setzero_si128();
+                for (int32_t p = x; p < x + ksize; ++p) {
+                    const uint16_t *col = fine + (p * channels + c) * 256 + b * 16;
+                    v_lo                = _mm_add_epi16(v_lo, _mm_loadu_si128((const __m128i *)col));
+                    v_hi                = _mm_add_epi16(v_hi, _mm_loadu_si128((const __m128i *)(col + 8)));
+                }
+                _mm_storeu_si128((__m128i *)hf, v_lo);
+                _mm_storeu_si128((__m128i *)(hf + 8), v_hi);
+                luc[c][b] = x + ksize;
+            } else {
+                for (; luc[c][b] < x + ksize; ++luc[c][b]) {
+                    median_hist_slide(hf, fine + (luc[c][b] * channels + c) * 256 + b * 16, fine + ((luc[c][b] - ksize) * channels + c) * 256 + b * 16);
+                }
+            }
+            int32_t skip;
+            const int32_t f       = median_hist_find(hf, rank - sum, &skip);
+            dst[x * channels + c] = b * 16 + f;
+            if (x + 1 < outCols) {
+                median_hist_slide(Hc[c], coarse + ((x + ksize) * channels + c) * 16, coarse + (x * channels + c) * 16);
+            }
+        }
+    }
+}
+
+template <int32_t channels>
+static void median_blur_hist(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    int32_t ksize,
+    BorderType border_type)
+{
+    const int32_t radius   = ksize / 2;
+    const int32_t tileCols = MEDIANBLUR_HIST_TILE_COLS / channels;
+    const int32_t stripes  = (height + MEDIANBLUR_HIST_STRIPE_ROWS - 1) / MEDIANBLUR_HIST_STRIPE_ROWS;
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        const int32_t y0      = s * MEDIANBLUR_HIST_STRIPE_ROWS;
+        const int32_t y1      = std::min(height, y0 + MEDIANBLUR_HIST_STRIPE_ROWS);
+        const int32_t maxCols = std::min(width, tileCols) + 2 * radius;
+        std::vector<int32_t> xofs(maxCols);
+        std::vector<uint16_t> coarse(maxCols * channels * 16);
+        std::vector<uint16_t> fine(maxCols * channels * 256);
+        for (int32_t x0 = 0; x0 < width; x0 += tileCols) {
+            const int32_t outCols = std::min(width - x0, tileCols);
+            const int32_t ncols   = outCols + 2 * radius;
+            for (int32_t p = 0; p < ncols; ++p) {
+                xofs[p] = border_interpolate(x0 - radius + p, width, border_type) * channels;
+            }
+            memset(coarse.data(), 0, ncols * channels * 16 * sizeof(uint16_t));
+            memset(fine.data(), 0, ncols * channels * 256 * sizeof(uint16_t));
+            for (int32_t l = y0 - radius; l <= y0 + radius; ++l) {
+                median_hist_update<channels>(ncols, xofs.data(), inData + border_interpolate(l, height, border_type) * inWidthStride, 1, coarse.data(), fine.data());
+            }
+            for (int32_t y = y0; y < y1; ++y) {
+                if (y > y0) {
+                    median_hist_update<channels>(ncols, xofs.data(), inData + border_interpolate(y - radius - 1, height, border_type) * inWidthStride, (uint16_t)-1, coarse.data(), fine.data());
+                    median_hist_update<channels>(ncols, xofs.data(), inData + border_interpolate(y + radius, height, border_type) * inWidthStride, 1, coarse.data(), fine.data());
+                }
+                median_hist_row<channels>(outCols, ksize, coarse.data(), fine.data(), outData + y * outWidthStride + x0 * channels);
+            }
+        }
+    }
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode MedianBlur(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t ksize,
+    BorderType border_type)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ksize < 1 || ksize > 255 || ksize % 2 == 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (border_type != BORDER_TYPE_REPLICATE && border_type != BORDER_TYPE_REFLECT && border_type != BORDER_TYPE_REFLECT_101) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ksize == 1) {
+        for (int32_t i = 0; i < height; ++i) {
+            memcpy(outData + i * outWidthStride, inData + i * inWidthStride, width * channels * sizeof(T));
+        }
+    } else if (ksize == 3) {
+        median_blur_sortnet<channels, 3>(height, width, inWidthStride, inData, outWidthStride, outData, border_type);
+    } else if (ksize == 5) {
+        median_blur_sortnet<channels, 5>(height, width, inWidthStride, inData, outWidthStride, outData, border_type);
+    } else {
+        median_blur_hist<channels>(height, width, inWidthStride, inData, outWidthStride, outData, ksize, border_type);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode MedianBlur<uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    int32_t ksize,
+    BorderType border_type);
+
+template ::ppl::common::RetCode MedianBlur<uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    int32_t ksize,
+    BorderType border_type);
+
+template ::ppl::common::RetCode MedianBlur<uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    int32_t ksize,
+    BorderType border_type);
+
+}
+}
+} // namespace ppl::cv::x86
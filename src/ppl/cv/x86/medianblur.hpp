@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_MEDIANBLUR_HPP_
+#define __ST_HPC_PPL_CV_X86_MEDIANBLUR_HPP_
+
+#include <stdint.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// min/max sorting networks selecting the median of 9 and 25 values, the same networks as cv::medianBlur.
+// Ops provides vec_type, lanes, load, store, min and max for one register of uint8_t lanes.
+template <typename Ops>
+struct MedianSortNet {
+    typedef typename Ops::vec_type vec_type;
+
+    static inline void op(vec_type &a, vec_type &b)
+    {
+        vec_type t = a;
+        a          = Ops::min(a, b);
+        b          = Ops::max(t, b);
+    }
+
+    static inline vec_type median9(vec_type *p)
+    {
+        op(p[1], p[2]); op(p[4], p[5]); op(p[7], p[8]); op(p[0], p[1]);
+        op(p[3], p[4]); op(p[6], p[7]); op(p[1], p[2]); op(p[4], p[5]);
+        op(p[7], p[8]); op(p[0], p[3]); op(p[5], p[8]); op(p[4], p[7]);
+        op(p[3], p[6]); op(p[1], p[4]); op(p[2], p[5]); op(p[4], p[7]);
+        op(p[4], p[2]); op(p[6], p[4]); op(p[4], p[2]);
+        return p[4];
+    }
+
+    static inline vec_type median25(vec_type *p)
+    {
+        op(p[1], p[2]); op(p[0], p[1]); op(p[1], p[2]); op(p[4], p[5]); op(p[3], p[4]);
+        op(p[4], p[5]); op(p[0], p[3]); op(p[2], p[5]); op(p[2], p[3]); op(p[1], p[4]);
+        op(p[1], p[2]); op(p[3], p[4]); op(p[7], p[8]); op(p[6], p[7]); op(p[7], p[8]);
+        op(p[10], p[11]); op(p[9], p[10]); op(p[10], p[11]); op(p[6], p[9]); op(p[8], p[11]);
+        op(p[8], p[9]); op(p[7], p[10]); op(p[7], p[8]); op(p[9], p[10]); op(p[0], p[6]);
+        op(p[4], p[10]); op(p[4], p[6]); op(p[2], p[8]); op(p[2], p[4]); op(p[6], p[8]);
+        op(p[1], p[7]); op(p[5], p[11]); op(p[5], p[7]); op(p[3], p[9]); op(p[3], p[5]);
+        op(p[7], p[9]); op(p[1], p[2]); op(p[3], p[4]); op(p[5], p[6]); op(p[7], p[8]);
+        op(p[9], p[10]); op(p[13], p[14]); op(p[12], p[13]); op(p[13], p[14]); op(p[16], p[17]);
+        op(p[15], p[16]); op(p[16], p[17]); op(p[12], p[15]); op(p[14], p[17]); op(p[14], p[15]);
+        op(p[13], p[16]); op(p[13], p[14]); op(p[15], p[16]); op(p[19], p[20]); op(p[18], p[19]);
+        op(p[19], p[20]); op(p[21], p[22]); op(p[23], p[24]); op(p[21], p[23]); op(p[22], p[24]);
+        op(p[22], p[23]); op(p[18], p[21]); op(p[20], p[23]); op(p[20], p[21]); op(p[19], p[22]);
+        op(p[22], p[24]); op(p[19], p[20]); op(p[21], p[22]); op(p[23], p[24]); op(p[12], p[18]);
+        op(p[16], p[22]); op(p[16], p[18]); op(p[14], p[20]); op(p[20], p[24]); op(p[14], p[16]);
+        op(p[18], p[20]); op(p[22], p[24]); op(p[13], p[19]); op(p[17], p[23]); op(p[17], p[19]);
+        op(p[15], p[21]); op(p[15], p[17]); op(p[19], p[21]); op(p[13], p[14]); op(p[15], p[16]);
+        op(p[17], p[18]); op(p[19], p[20]); op(p[21], p[22]); op(p[23], p[24]); op(p[0], p[12]);
+        op(p[8], p[20]); op(p[8], p[12]); op(p[4], p[16]); op(p[16], p[24]); op(p[12], p[16]);
+        op(p[2], p[14]); op(p[10], p[22]); op(p[10], p[14]); op(p[6], p[18]); op(p[6], p[10]);
+        op(p[10], p[12]); op(p[1], p[13]); op(p[9], p[21]); op(p[9], p[13]); op(p[5], p[17]);
+        op(p[13], p[17]); op(p[3], p[15]); op(p[11], p[23]); op(p[11], p[15]); op(p[7], p[19]);
+        op(p[7], p[11]); op(p[11], p[13]); op(p[11], p[12]);
+        return p[12];
+    }
+
+    static inline vec_type median(vec_type *p, int32_t ksize)
+    {
+        return ksize == 3 ? median9(p) : median25(p);
+    }
+};
+
+// one row of a 3x3 or 5x5 median, rows[dy] points at x = 0 of a row padded by ksize / 2 pixels on both sides,
+// length is width * channels. The last register overlaps the previous one, rows shorter than a register are
+// left to the caller, returns the number of values written.
+template <typename Ops, int32_t ksize>
+inline int32_t median_sortnet_row(
+    const uint8_t *const *rows,
+    int32_t length,
+    int32_t channels,
+    uint8_t *dst)
+{
+    typedef typename Ops::vec_type vec_type;
+    const int32_t radius = ksize / 2;
+    if (length < Ops::lanes) {
+        return 0;
+    }
+    for (int32_t i = 0;; i += Ops::lanes) {
+        i = i > length - Ops::lanes ? length - Ops::lanes : i;
+        vec_type p[ksize * ksize];
+        for (int32_t dy = 0; dy < ksize; ++dy) {
+            for (int32_t dx = 0; dx < ksize; ++dx) {
+                p[dy * ksize + dx] = Ops::load(rows[dy] + i + (dx - radius) * channels);
+            }
+        }
+        Ops::store(dst + i, MedianSortNet<Ops>::median(p, ksize));
+        if (i == length - Ops::lanes) {
+            break;
+        }
+    }
+    return length;
+}
+
+}
+}
+} // namespace ppl::cv::x86
+
+#endif //!__ST_HPC_PPL_CV_X86_MEDIANBLUR_HPP_
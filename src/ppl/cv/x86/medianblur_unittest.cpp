@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/medianblur.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+
+// the reference pads the image with cv::copyMakeBorder first, so every border type is checked against cv::medianBlur
+template<typename T, int32_t nc>
+void MedianBlurTest(int32_t height, int32_t width, int32_t ksize, ppl::cv::BorderType border_type, int32_t cv_border, float diff) {
+    const int32_t radius = ksize / 2;
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat padded_opencv, dst_opencv;
+    cv::copyMakeBorder(src_opencv, padded_opencv, radius, radius, radius, radius, cv_border);
+    cv::medianBlur(padded_opencv, dst_opencv, ksize);
+    cv::Mat dst_ref = dst_opencv(cv::Rect(radius, radius, width, height)).clone();
+
+    auto rst = ppl::cv::x86::MedianBlur<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), ksize, border_type);
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    checkResult<T, nc>(dst.get(), (const T *)dst_ref.data, height, width, width * nc, dst_ref.step / sizeof(T), diff);
+}
+
+#define R(name, dtype, nc, ksize, diff) \
+    TEST(name, x86) \
+    { \
+        MedianBlurTest<dtype, nc>(240, 320, ksize, ppl::cv::BORDER_TYPE_REPLICATE, cv::BORDER_REPLICATE, diff); \
+        MedianBlurTest<dtype, nc>(241, 321, ksize, ppl::cv::BORDER_TYPE_REFLECT, cv::BORDER_REFLECT, diff); \
+        MedianBlurTest<dtype, nc>(241, 321, ksize, ppl::cv::BORDER_TYPE_REFLECT_101, cv::BORDER_REFLECT_101, diff); \
+        MedianBlurTest<dtype, nc>(7, 5, ksize, ppl::cv::BORDER_TYPE_REPLICATE, cv::BORDER_REPLICATE, diff); \
+        MedianBlurTest<dtype, nc>(1080, 1920, ksize, ppl::cv::BORDER_TYPE_REPLICATE, cv::BORDER_REPLICATE, diff); \
+    } \
+
+R(MEDIANBLUR_U8_C1_K3, uint8_t, 1, 3, 1.01f);
+R(MEDIANBLUR_U8_C3_K3, uint8_t, 3, 3, 1.01f);
+R(MEDIANBLUR_U8_C4_K3, uint8_t, 4, 3, 1.01f);
+R(MEDIANBLUR_U8_C1_K5, uint8_t, 1, 5, 1.01f);
+R(MEDIANBLUR_U8_C3_K5, uint8_t, 3, 5, 1.01f);
+R(MEDIANBLUR_U8_C4_K5, uint8_t, 4, 5, 1.01f);
+R(MEDIANBLUR_U8_C1_K7, uint8_t, 1, 7, 1.01f);
+R(MEDIANBLUR_U8_C3_K7, uint8_t, 3, 7, 1.01f);
+R(MEDIANBLUR_U8_C4_K7, uint8_t, 4, 7, 1.01f);
+R(MEDIANBLUR_U8_C1_K15, uint8_t, 1, 15, 1.01f);
+R(MEDIANBLUR_U8_C3_K15, uint8_t, 3, 15, 1.01f);
+R(MEDIANBLUR_U8_C4_K15, uint8_t, 4, 15, 1.01f);
+R(MEDIANBLUR_U8_C1_K31, uint8_t, 1, 31, 1.01f);
+R(MEDIANBLUR_U8_C3_K31, uint8_t, 3, 31, 1.01f);
+R(MEDIANBLUR_U8_C4_K31, uint8_t, 4, 31, 1.01f);
@@ -0,0 +1,315 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/merge.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "intrinutils.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// rounds to nearest-even like _mm_cvtps_epi32, then saturates to [0, 255]
+static inline uint8_t round_sat_u8(float value)
+{
+    int32_t v = _mm_cvtss_si32(_mm_set_ss(value));
+    return v > 255 ? 255 : (v < 0 ? 0 : v);
+}
+
+static inline __m128i convert_f32_u8(const float* src, __m128 scale_vec)
+{
+    __m128i v0 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src), scale_vec));
+    __m128i v1 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src + 4), scale_vec));
+    __m128i v2 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src + 8), scale_vec));
+    __m128i v3 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src + 12), scale_vec));
+    return _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3));
+}
+
+template <>
+::ppl::common::RetCode Merge3Channels<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData0,
+    const uint8_t* inData1,
+    const uint8_t* inData2,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    if (nullptr == inData0 || nullptr == inData1 || nullptr == inData2) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        const uint8_t* inData[3] = {inData0, inData1, inData2};
+        return fma::mergeSOA2AOS<uint8_t, 3>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const uint8_t* src0_ptr = inData0 + h * inWidthStride;
+        const uint8_t* src1_ptr = inData1 + h * inWidthStride;
+        const uint8_t* src2_ptr = inData2 + h * inWidthStride;
+        uint8_t* dst_ptr = outData + h * outWidthStride;
+        for (; w <= width - 16; w += 16) {
+            __m128i va = _mm_loadu_si128((const __m128i*)(src0_ptr + w));
+            __m128i vb = _mm_loadu_si128((const __m128i*)(src1_ptr + w));
+            __m128i vc = _mm_loadu_si128((const __m128i*)(src2_ptr + w));
+            v_store_interleave(dst_ptr + w * 3, va, vb, vc);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 3 + 0] = src0_ptr[w];
+            dst_ptr[w * 3 + 1] = src1_ptr[w];
+            dst_ptr[w * 3 + 2] = src2_ptr[w];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode Merge3Channels<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float* inData0,
+    const float* inData1,
+    const float* inData2,
+    int32_t outWidthStride,
+    float* outData)
+{
+    if (nullptr == inData0 || nullptr == inData1 || nullptr == inData2) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        const float* inData[3] = {inData0, inData1, inData2};
+        return fma::mergeSOA2AOS<float, 3>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const float* src0_ptr = inData0 + h * inWidthStride;
+        const float* src1_ptr = inData1 + h * inWidthStride;
+        const float* src2_ptr = inData2 + h * inWidthStride;
+        float* dst_ptr = outData + h * outWidthStride;
+        for (; w <= width - 4; w += 4) {
+            __m128 va = _mm_loadu_ps(src0_ptr + w);
+            __m128 vb = _mm_loadu_ps(src1_ptr + w);
+            __m128 vc = _mm_loadu_ps(src2_ptr + w);
+            v_store_interleave(dst_ptr + w * 3, va, vb, vc);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 3 + 0] = src0_ptr[w];
+            dst_ptr[w * 3 + 1] = src1_ptr[w];
+            dst_ptr[w * 3 + 2] = src2_ptr[w];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode Merge4Channels<uint8_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData0,
+    const uint8_t* inData1,
+    const uint8_t* inData2,
+    const uint8_t* inData3,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    if (nullptr == inData0 || nullptr == inData1 || nullptr == inData2 || nullptr == inData3) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        const uint8_t* inData[4] = {inData0, inData1, inData2, inData3};
+        return fma::mergeSOA2AOS<uint8_t, 4>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const uint8_t* src0_ptr = inData0 + h * inWidthStride;
+        const uint8_t* src1_ptr = inData1 + h * inWidthStride;
+        const uint8_t* src2_ptr = inData2 + h * inWidthStride;
+        const uint8_t* src3_ptr = inData3 + h * inWidthStride;
+        uint8_t* dst_ptr = outData + h * outWidthStride;
+        for (; w <= width - 16; w += 16) {
+            __m128i va = _mm_loadu_si128((const __m128i*)(src0_ptr + w));
+            __m128i vb = _mm_loadu_si128((const __m128i*)(src1_ptr + w));
+            __m128i vc = _mm_loadu_si128((const __m128i*)(src2_ptr + w));
+            __m128i vd = _mm_loadu_si128((const __m128i*)(src3_ptr + w));
+            v_store_interleave(dst_ptr + w * 4, va, vb, vc, vd);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 4 + 0] = src0_ptr[w];
+            dst_ptr[w * 4 + 1] = src1_ptr[w];
+            dst_ptr[w * 4 + 2] = src2_ptr[w];
+            dst_ptr[w * 4 + 3] = src3_ptr[w];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <>
+::ppl::common::RetCode Merge4Channels<float>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float* inData0,
+    const float* inData1,
+    const float* inData2,
+    const float* inData3,
+    int32_t outWidthStride,
+    float* outData)
+{
+    if (nullptr == inData0 || nullptr == inData1 || nullptr == inData2 || nullptr == inData3) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        const float* inData[4] = {inData0, inData1, inData2, inData3};
+        return fma::mergeSOA2AOS<float, 4>(height, width, inWidthStride, inData, outWidthStride, outData);
+    }
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const float* src0_ptr = inData0 + h * inWidthStride;
+        const float* src1_ptr = inData1 + h * inWidthStride;
+        const float* src2_ptr = inData2 + h * inWidthStride;
+        const float* src3_ptr = inData3 + h * inWidthStride;
+        float* dst_ptr = outData + h * outWidthStride;
+        for (; w <= width - 4; w += 4) {
+            __m128 va = _mm_loadu_ps(src0_ptr + w);
+            __m128 vb = _mm_loadu_ps(src1_ptr + w);
+            __m128 vc = _mm_loadu_ps(src2_ptr + w);
+            __m128 vd = _mm_loadu_ps(src3_ptr + w);
+            v_store_interleave(dst_ptr + w * 4, va, vb, vc, vd);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 4 + 0] = src0_ptr[w];
+            dst_ptr[w * 4 + 1] = src1_ptr[w];
+            dst_ptr[w * 4 + 2] = src2_ptr[w];
+            dst_ptr[w * 4 + 3] = src3_ptr[w];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode Merge3ChannelsConvertTo(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float* inData0,
+    const float* inData1,
+    const float* inData2,
+    float scale,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    if (nullptr == inData0 || nullptr == inData1 || nullptr == inData2) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        const float* inData[3] = {inData0, inData1, inData2};
+        return fma::mergeSOA2AOSConvertTo<3>(height, width, inWidthStride, inData, scale, outWidthStride, outData);
+    }
+    __m128 scale_vec = _mm_set1_ps(scale);
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const float* src0_ptr = inData0 + h * inWidthStride;
+        const float* src1_ptr = inData1 + h * inWidthStride;
+        const float* src2_ptr = inData2 + h * inWidthStride;
+        uint8_t* dst_ptr = outData + h * outWidthStride;
+        for (; w <= width - 16; w += 16) {
+            __m128i va = convert_f32_u8(src0_ptr + w, scale_vec);
+            __m128i vb = convert_f32_u8(src1_ptr + w, scale_vec);
+            __m128i vc = convert_f32_u8(src2_ptr + w, scale_vec);
+            v_store_interleave(dst_ptr + w * 3, va, vb, vc);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 3 + 0] = round_sat_u8(src0_ptr[w] * scale);
+            dst_ptr[w * 3 + 1] = round_sat_u8(src1_ptr[w] * scale);
+            dst_ptr[w * 3 + 2] = round_sat_u8(src2_ptr[w] * scale);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode Merge4ChannelsConvertTo(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float* inData0,
+    const float* inData1,
+    const float* inData2,
+    const float* inData3,
+    float scale,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    if (nullptr == inData0 || nullptr == inData1 || nullptr == inData2 || nullptr == inData3) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        const float* inData[4] = {inData0, inData1, inData2, inData3};
+        return fma::mergeSOA2AOSConvertTo<4>(height, width, inWidthStride, inData, scale, outWidthStride, outData);
+    }
+    __m128 scale_vec = _mm_set1_ps(scale);
+    for (int32_t h = 0; h < height; h++) {
+        int32_t w = 0;
+        const float* src0_ptr = inData0 + h * inWidthStride;
+        const float* src1_ptr = inData1 + h * inWidthStride;
+        const float* src2_ptr = inData2 + h * inWidthStride;
+        const float* src3_ptr = inData3 + h * inWidthStride;
+        uint8_t* dst_ptr = outData + h * outWidthStride;
+        for (; w <= width - 16; w += 16) {
+            __m128i va = convert_f32_u8(src0_ptr + w, scale_vec);
+            __m128i vb = convert_f32_u8(src1_ptr + w, scale_vec);
+            __m128i vc = convert_f32_u8(src2_ptr + w, scale_vec);
+            __m128i vd = convert_f32_u8(src3_ptr + w, scale_vec);
+            v_store_interleave(dst_ptr + w * 4, va, vb, vc, vd);
+        }
+        for (; w < width; w++) {
+            dst_ptr[w * 4 + 0] = round_sat_u8(src0_ptr[w] * scale);
+            dst_ptr[w * 4 + 1] = round_sat_u8(src1_ptr[w] * scale);
+            dst_ptr[w * 4 + 2] = round_sat_u8(src2_ptr[w] * scale);
+            dst_ptr[w * 4 + 3] = round_sat_u8(src3_ptr[w] * scale);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,354 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/minmaxloc.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/intrinutils.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <string.h>
+#include <float.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// rows per stripe, stripes are reduced independently and merged in order
+#define MINMAXLOC_STRIPE_ROWS 16
+
+// widens 4 mask bytes (0 or 0xff) to a float lane mask, reading exactly 4 bytes
+static inline __m128 load_mask_ps(const uint8_t *mask)
+{
+    int32_t bits;
+    memcpy(&bits, mask, sizeof(bits));
+    return _mm_castsi128_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(bits)));
+}
+
+// Each iteration loads three registers into three accumulators, so lane j of the accumulators stored one
+// after another always sees the elements at offset j modulo three registers. That is a multiple of 1, 3
+// and 4 elements, so every lane belongs to a single channel.
+static void minmax_channels_row_sse(int32_t length, int32_t channels, const uint8_t *src, const uint8_t *mask, double *minVal, double *maxVal)
+{
+    const __m128i v_ones = _mm_set1_epi8(-1);
+    __m128i v_min0 = v_ones, v_min1 = v_ones, v_min2 = v_ones;
+    __m128i v_max0 = _mm_setzero_si128(), v_max1 = v_max0, v_max2 = v_max0;
+    int32_t i = 0;
+    for (; i <= length - 48; i += 48) {
+        __m128i v_src0 = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i v_src1 = _mm_loadu_si128((const __m128i *)(src + i + 16));
+        __m128i v_src2 = _mm_loadu_si128((const __m128i *)(src + i + 32));
+        if (mask != nullptr) {
+            // unselected elements become 255 for min and 0 for max
+            __m128i v_msk0 = _mm_loadu_si128((const __m128i *)(mask + i));
+            __m128i v_msk1 = _mm_loadu_si128((const __m128i *)(mask + i + 16));
+            __m128i v_msk2 = _mm_loadu_si128((const __m128i *)(mask + i + 32));
+            v_min0         = _mm_min_epu8(v_min0, _mm_or_si128(v_src0, _mm_xor_si128(v_msk0, v_ones)));
+            v_min1         = _mm_min_epu8(v_min1, _mm_or_si128(v_src1, _mm_xor_si128(v_msk1, v_ones)));
+            v_min2         = _mm_min_epu8(v_min2, _mm_or_si128(v_src2, _mm_xor_si128(v_msk2, v_ones)));
+            v_max0         = _mm_max_epu8(v_max0, _mm_and_si128(v_src0, v_msk0));
+            v_max1         = _mm_max_epu8(v_max1, _mm_and_si128(v_src1, v_msk1));
+            v_max2         = _mm_max_epu8(v_max2, _mm_and_si128(v_src2, v_msk2));
+        } else {
+            v_min0 = _mm_min_epu8(v_min0, v_src0);
+            v_min1 = _mm_min_epu8(v_min1, v_src1);
+            v_min2 = _mm_min_epu8(v_min2, v_src2);
+            v_max0 = _mm_max_epu8(v_max0, v_src0);
+            v_max1 = _mm_max_epu8(v_max1, v_src1);
+            v_max2 = _mm_max_epu8(v_max2, v_src2);
+        }
+    }
+    if (i > 0) {
+        uint8_t buf_min[48], buf_max[48];
+        _mm_storeu_si128((__m128i *)buf_min, v_min0);
+        _mm_storeu_si128((__m128i *)(buf_min + 16), v_min1);
+        _mm_storeu_si128((__m128i *)(buf_min + 32), v_min2);
+        _mm_storeu_si128((__m128i *)buf_max, v_max0);
+        _mm_storeu_si128((__m128i *)(buf_max + 16), v_max1);
+        _mm_storeu_si128((__m128i *)(buf_max + 32), v_max2);
+        for (int32_t j = 0; j < 48; ++j) {
+            minVal[j % channels] = std::min<double>(minVal[j % channels], buf_min[j]);
+            maxVal[j % channels] = std::max<double>(maxVal[j % channels], buf_max[j]);
+        }
+    }
+    for (; i < length; ++i) {
+        if (mask == nullptr || mask[i]) {
+            minVal[i % channels] = std::min<double>(minVal[i % channels], src[i]);
+            maxVal[i % channels] = std::max<double>(maxVal[i % channels], src[i]);
+        }
+    }
+}
+
+static void minmax_channels_row_sse(int32_t length, int32_t channels, const float *src, const uint8_t *mask, double *minVal, double *maxVal)
+{
+    const __m128 v_pos = _mm_set1_ps(FLT_MAX);
+    const __m128 v_neg = _mm_set1_ps(-FLT_MAX);
+    __m128 v_min0 = v_pos, v_min1 = v_pos, v_min2 = v_pos;
+    __m128 v_max0 = v_neg, v_max1 = v_neg, v_max2 = v_neg;
+    int32_t i     = 0;
+    for (; i <= length - 12; i += 12) {
+        __m128 v_src0 = _mm_loadu_ps(src + i);
+        __m128 v_src1 = _mm_loadu_ps(src + i + 4);
+        __m128 v_src2 = _mm_loadu_ps(src + i + 8);
+        if (mask != nullptr) {
+            __m128 v_msk0 = load_mask_ps(mask + i);
+            __m128 v_msk1 = load_mask_ps(mask + i + 4);
+            __m128 v_msk2 = load_mask_ps(mask + i + 8);
+            // the source goes first, so NaN never replaces the accumulator
+            v_min0        = _mm_min_ps(_mm_blendv_ps(v_pos, v_src0, v_msk0), v_min0);
+            v_min1        = _mm_min_ps(_mm_blendv_ps(v_pos, v_src1, v_msk1), v_min1);
+            v_min2        = _mm_min_ps(_mm_blendv_ps(v_pos, v_src2, v_msk2), v_min2);
+            v_max0        = _mm_max_ps(_mm_blendv_ps(v_neg, v_src0, v_msk0), v_max0);
+            v_max1        = _mm_max_ps(_mm_blendv_ps(v_neg, v_src1, v_msk1), v_max1);
+            v_max2        = _mm_max_ps(_mm_blendv_ps(v_neg, v_src2, v_msk2), v_max2);
+        } else {
+            v_min0 = _mm_min_ps(v_src0, v_min0);
+            v_min1 = _mm_min_ps(v_src1, v_min1);
+            v_min2 = _mm_min_ps(v_src2, v_min2);
+            v_max0 = _mm_max_ps(v_src0, v_max0);
+            v_max1 = _mm_max_ps(v_src1, v_max1);
+            v_max2 = _mm_max_ps(v_src2, v_max2);
+        }
+    }
+    if (i > 0) {
+        float buf_min[12], buf_max[12];
+        _mm_storeu_ps(buf_min, v_min0);
+        _mm_storeu_ps(buf_min + 4, v_min1);
+        _mm_storeu_ps(buf_min + 8, v_min2);
+        _mm_storeu_ps(buf_max, v_max0);
+        _mm_storeu_ps(buf_max + 4, v_max1);
+        _mm_storeu_ps(buf_max + 8, v_max2);
+        for (int32_t j = 0; j < 12; ++j) {
+            minVal[j % channels] = std::min<double>(minVal[j % channels], buf_min[j]);
+            maxVal[j % channels] = std::max<double>(maxVal[j % channels], buf_max[j]);
+        }
+    }
+    for (; i < length; ++i) {
+        if ((mask == nullptr || mask[i]) && !std::isnan(src[i])) {
+            minVal[i % channels] = std::min<double>(minVal[i % channels], src[i]);
+            maxVal[i % channels] = std::max<double>(maxVal[i % channels], src[i]);
+        }
+    }
+}
+
+// first column of the row whose channel c is value and is selected by mask, -1 when there is none
+template <typename T>
+static int32_t find_in_row(int32_t width, int32_t channels, int32_t c, const T *src, const uint8_t *mask, double value)
+{
+    for (int32_t x = 0; x < width; ++x) {
+        if ((mask == nullptr || mask[x * channels + c]) && src[x * channels + c] == value) {
+            return x;
+        }
+    }
+    return -1;
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode MinMaxLoc(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    double *minVal,
+    double *maxVal,
+    int32_t *minLoc,
+    int32_t *maxLoc,
+    int32_t maskWidthStride,
+    const uint8_t *mask)
+{
+    if (nullptr == inData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (mask != nullptr && maskWidthStride < inWidth) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const bool use_fma    = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const int32_t length  = inWidth * channels;
+    const int32_t stripes = (inHeight + MINMAXLOC_STRIPE_ROWS - 1) / MINMAXLOC_STRIPE_ROWS;
+    std::vector<double> partial_min(stripes * channels, DBL_MAX);
+    std::vector<double> partial_max(stripes * channels, -DBL_MAX);
+    std::vector<int32_t> partial_min_loc(stripes * channels * 2, -1);
+    std::vector<int32_t> partial_max_loc(stripes * channels * 2, -1);
+
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        std::vector<uint8_t> mask_row(mask != nullptr ? length : 0);
+        double *stripe_min      = partial_min.data() + s * channels;
+        double *stripe_max      = partial_max.data() + s * channels;
+        int32_t *stripe_min_loc = partial_min_loc.data() + s * channels * 2;
+        int32_t *stripe_max_loc = partial_max_loc.data() + s * channels * 2;
+        int32_t end             = std::min(inHeight, (s + 1) * MINMAXLOC_STRIPE_ROWS);
+        for (int32_t i = s * MINMAXLOC_STRIPE_ROWS; i < end; ++i) {
+            const uint8_t *m = nullptr;
+            if (mask != nullptr) {
+                v_expand_mask(mask + i * maskWidthStride, inWidth, channels, mask_row.data());
+                m = mask_row.data();
+            }
+            const T *src = inData + i * inWidthStride;
+            double row_min[channels], row_max[channels];
+            for (int32_t c = 0; c < channels; ++c) {
+                row_min[c] = DBL_MAX;
+                row_max[c] = -DBL_MAX;
+            }
+            if (use_fma) {
+                fma::minmax_channels_row_fma<T>(length, channels, src, m, row_min, row_max);
+            } else {
+                minmax_channels_row_sse(length, channels, src, m, row_min, row_max);
+            }
+            // only a strictly better row is searched, which keeps the first location of the extremum
+            for (int32_t c = 0; c < channels; ++c) {
+                if (row_min[c] < stripe_min[c]) {
+                    int32_t x = find_in_row(inWidth, channels, c, src, m, row_min[c]);
+                    if (x >= 0) {
+                        stripe_min[c]             = row_min[c];
+                        stripe_min_loc[c * 2]     = x;
+                        stripe_min_loc[c * 2 + 1] = i;
+                    }
+                }
+                if (row_max[c] > stripe_max[c]) {
+                    int32_t x = find_in_row(inWidth, channels, c, src, m, row_max[c]);
+                    if (x >= 0) {
+                        stripe_max[c]             = row_max[c];
+                        stripe_max_loc[c * 2]     = x;
+                        stripe_max_loc[c * 2 + 1] = i;
+                    }
+                }
+            }
+        }
+    }
+
+    for (int32_t c = 0; c < channels; ++c) {
+        double min_value = DBL_MAX, max_value = -DBL_MAX;
+        int32_t min_loc[2] = {-1, -1}, max_loc[2] = {-1, -1};
+        for (int32_t s = 0; s < stripes; ++s) {
+            int32_t k = s * channels + c;
+            if (partial_min_loc[k * 2] >= 0 && partial_min[k] < min_value) {
+                min_value  = partial_min[k];
+                min_loc[0] = partial_min_loc[k * 2];
+                min_loc[1] = partial_min_loc[k * 2 + 1];
+            }
+            if (partial_max_loc[k * 2] >= 0 && partial_max[k] > max_value) {
+                max_value  = partial_max[k];
+                max_loc[0] = partial_max_loc[k * 2];
+                max_loc[1] = partial_max_loc[k * 2 + 1];
+            }
+        }
+        if (min_loc[0] < 0) {
+            // empty mask
+            min_value = max_value = 0;
+        }
+        if (minVal != nullptr) {
+            minVal[c] = min_value;
+        }
+        if (maxVal != nullptr) {
+            maxVal[c] = max_value;
+        }
+        if (minLoc != nullptr) {
+            minLoc[c * 2]     = min_loc[0];
+            minLoc[c * 2 + 1] = min_loc[1];
+        }
+        if (maxLoc != nullptr) {
+            maxLoc[c * 2]     = max_loc[0];
+            maxLoc[c * 2 + 1] = max_loc[1];
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode MinMaxLoc<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *minVal,
+    double *maxVal,
+    int32_t *minLoc,
+    int32_t *maxLoc,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode MinMaxLoc<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *minVal,
+    double *maxVal,
+    int32_t *minLoc,
+    int32_t *maxLoc,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode MinMaxLoc<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *minVal,
+    double *maxVal,
+    int32_t *minLoc,
+    int32_t *maxLoc,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode MinMaxLoc<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *minVal,
+    double *maxVal,
+    int32_t *minLoc,
+    int32_t *maxLoc,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode MinMaxLoc<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *minVal,
+    double *maxVal,
+    int32_t *minLoc,
+    int32_t *maxLoc,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode MinMaxLoc<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *minVal,
+    double *maxVal,
+    int32_t *minLoc,
+    int32_t *maxLoc,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/core.hpp>
+#include "ppl/cv/x86/minmaxloc.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <cmath>
+#include <float.h>
+#include <string.h>
+
+template<typename T, int32_t nc, bool use_mask>
+void MinMaxLocTest(int32_t height, int32_t width) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(mask.get(), width * height, 0, 1);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * width * nc);
+    cv::Mat mask_opencv(height, width, CV_8UC1, mask.get(), width);
+
+    double min_value[nc], max_value[nc];
+    int32_t min_loc[nc * 2], max_loc[nc * 2];
+    if (use_mask) {
+        ppl::cv::x86::MinMaxLoc<T, nc>(height, width, width * nc, src.get(), min_value, max_value, min_loc, max_loc, width, mask.get());
+    } else {
+        ppl::cv::x86::MinMaxLoc<T, nc>(height, width, width * nc, src.get(), min_value, max_value, min_loc, max_loc);
+    }
+    for (int32_t c = 0; c < nc; ++c) {
+        cv::Mat channel;
+        cv::extractChannel(src_opencv, channel, c);
+        double min_ref = 0, max_ref = 0;
+        cv::Point min_loc_ref, max_loc_ref;
+        if (use_mask) {
+            cv::minMaxLoc(channel, &min_ref, &max_ref, &min_loc_ref, &max_loc_ref, mask_opencv);
+        } else {
+            cv::minMaxLoc(channel, &min_ref, &max_ref, &min_loc_ref, &max_loc_ref);
+        }
+        EXPECT_EQ(min_value[c], min_ref);
+        EXPECT_EQ(max_value[c], max_ref);
+        // ties are common, the first location in row-major order must win
+        EXPECT_EQ(min_loc[c * 2], min_loc_ref.x);
+        EXPECT_EQ(min_loc[c * 2 + 1], min_loc_ref.y);
+        EXPECT_EQ(max_loc[c * 2], max_loc_ref.x);
+        EXPECT_EQ(max_loc[c * 2 + 1], max_loc_ref.y);
+    }
+}
+
+#define R(name, dtype, nc, use_mask) \
+    TEST(name, x86) \
+    { \
+        MinMaxLocTest<dtype, nc, use_mask>(240, 320); \
+        MinMaxLocTest<dtype, nc, use_mask>(241, 321); \
+        MinMaxLocTest<dtype, nc, use_mask>(480, 640); \
+        MinMaxLocTest<dtype, nc, use_mask>(1080, 1920); \
+    } \
+
+R(minmaxloc_u8c1_x86, uint8_t, 1, false);
+R(minmaxloc_u8c3_x86, uint8_t, 3, false);
+R(minmaxloc_u8c4_x86, uint8_t, 4, false);
+R(minmaxloc_u8c1_mask_x86, uint8_t, 1, true);
+R(minmaxloc_u8c3_mask_x86, uint8_t, 3, true);
+R(minmaxloc_u8c4_mask_x86, uint8_t, 4, true);
+
+R(minmaxloc_fp32c1_x86, float, 1, false);
+R(minmaxloc_fp32c3_x86, float, 3, false);
+R(minmaxloc_fp32c4_x86, float, 4, false);
+R(minmaxloc_fp32c1_mask_x86, float, 1, true);
+R(minmaxloc_fp32c3_mask_x86, float, 3, true);
+R(minmaxloc_fp32c4_mask_x86, float, 4, true);
+
+TEST(minmaxloc_empty_mask_x86, x86)
+{
+    const int32_t height = 31, width = 45;
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<uint8_t>(src.get(), width * height * 3, 0, 255);
+    memset(mask.get(), 0, width * height);
+
+    double min_value[3], max_value[3];
+    int32_t min_loc[6], max_loc[6];
+    ppl::cv::x86::MinMaxLoc<uint8_t, 3>(height, width, width * 3, src.get(), min_value, max_value, min_loc, max_loc, width, mask.get());
+    for (int32_t c = 0; c < 3; ++c) {
+        EXPECT_EQ(min_value[c], 0);
+        EXPECT_EQ(max_value[c], 0);
+        EXPECT_EQ(min_loc[c * 2], -1);
+        EXPECT_EQ(min_loc[c * 2 + 1], -1);
+        EXPECT_EQ(max_loc[c * 2], -1);
+        EXPECT_EQ(max_loc[c * 2 + 1], -1);
+    }
+}
+
+TEST(minmaxloc_fp32_nan_x86, x86)
+{
+    const int32_t height = 37, width = 53;
+    std::unique_ptr<float[]> src(new float[width * height]);
+    ppl::cv::debug::randomFill<float>(src.get(), width * height, 0, 255);
+    // NaN first and spread over the image, including every lane of a vector
+    for (int32_t i = 0; i < width * height; i += 7) {
+        src[i] = NAN;
+    }
+    src[1] = NAN;
+    src[2] = NAN;
+    src[3] = NAN;
+
+    double min_ref = DBL_MAX, max_ref = -DBL_MAX;
+    int32_t min_ref_idx = -1, max_ref_idx = -1;
+    for (int32_t i = 0; i < width * height; ++i) {
+        if (std::isnan(src[i])) {
+            continue;
+        }
+        if (src[i] < min_ref) {
+            min_ref     = src[i];
+            min_ref_idx = i;
+        }
+        if (src[i] > max_ref) {
+            max_ref     = src[i];
+            max_ref_idx = i;
+        }
+    }
+
+    double min_value, max_value;
+    int32_t min_loc[2], max_loc[2];
+    ppl::cv::x86::MinMaxLoc<float, 1>(height, width, width, src.get(), &min_value, &max_value, min_loc, max_loc);
+    EXPECT_EQ(min_value, min_ref);
+    EXPECT_EQ(max_value, max_ref);
+    EXPECT_EQ(min_loc[0], min_ref_idx % width);
+    EXPECT_EQ(min_loc[1], min_ref_idx / width);
+    EXPECT_EQ(max_loc[0], max_ref_idx % width);
+    EXPECT_EQ(max_loc[1], max_ref_idx / width);
+}
@@ -0,0 +1,309 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/norm.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/intrinutils.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <string.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// elements per block whose partial sums are kept in 32-bit lanes before being flushed
+#define NORM_BLOCK_SIZE 4096
+// rows per stripe, stripes are reduced independently and merged in order
+#define NORM_STRIPE_ROWS 16
+
+static inline uint8_t hmax_epu8(__m128i v)
+{
+    v = _mm_max_epu8(v, _mm_srli_si128(v, 8));
+    v = _mm_max_epu8(v, _mm_srli_si128(v, 4));
+    v = _mm_max_epu8(v, _mm_srli_si128(v, 2));
+    v = _mm_max_epu8(v, _mm_srli_si128(v, 1));
+    return static_cast<uint8_t>(_mm_cvtsi128_si32(v));
+}
+
+static inline double hsum_pd(__m128 v)
+{
+    __m128d v_sum = _mm_add_pd(_mm_cvtps_pd(v), _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    return _mm_cvtsd_f64(_mm_add_sd(v_sum, _mm_unpackhi_pd(v_sum, v_sum)));
+}
+
+static double norm_row_sse(int32_t length, const uint8_t *src, const uint8_t *mask, int32_t normType)
+{
+    const __m128i v_zero = _mm_setzero_si128();
+    const __m128i v_ones = _mm_set1_epi8(-1);
+    if (normType == NORM_INF) {
+        __m128i v_max0 = v_zero, v_max1 = v_zero;
+        int32_t i      = 0;
+        for (; i <= length - 32; i += 32) {
+            __m128i v_src0 = _mm_loadu_si128((const __m128i *)(src + i));
+            __m128i v_src1 = _mm_loadu_si128((const __m128i *)(src + i + 16));
+            if (mask != nullptr) {
+                v_src0 = _mm_and_si128(v_src0, _mm_loadu_si128((const __m128i *)(mask + i)));
+                v_src1 = _mm_and_si128(v_src1, _mm_loadu_si128((const __m128i *)(mask + i + 16)));
+            }
+            v_max0 = _mm_max_epu8(v_max0, v_src0);
+            v_max1 = _mm_max_epu8(v_max1, v_src1);
+        }
+        uint8_t result = hmax_epu8(_mm_max_epu8(v_max0, v_max1));
+        for (; i < length; ++i) {
+            result = std::max<uint8_t>(result, src[i] & (mask != nullptr ? mask[i] : 0xff));
+        }
+        return result;
+    }
+    if (normType == NORM_L1) {
+        __m128i v_sum0 = v_zero, v_sum1 = v_zero;
+        int32_t i      = 0;
+        for (; i <= length - 32; i += 32) {
+            __m128i v_src0 = _mm_loadu_si128((const __m128i *)(src + i));
+            __m128i v_src1 = _mm_loadu_si128((const __m128i *)(src + i + 16));
+            if (mask != nullptr) {
+                v_src0 = _mm_and_si128(v_src0, _mm_loadu_si128((const __m128i *)(mask + i)));
+                v_src1 = _mm_and_si128(v_src1, _mm_loadu_si128((const __m128i *)(mask + i + 16)));
+            }
+            v_sum0 = _mm_add_epi64(v_sum0, _mm_sad_epu8(v_src0, v_zero));
+            v_sum1 = _mm_add_epi64(v_sum1, _mm_sad_epu8(v_src1, v_zero));
+        }
+        int64_t buf[2];
+        _mm_storeu_si128((__m128i *)buf, _mm_add_epi64(v_sum0, v_sum1));
+        int64_t result = buf[0] + buf[1];
+        for (; i < length; ++i) {
+            result += src[i] & (mask != nullptr ? mask[i] : 0xff);
+        }
+        return static_cast<double>(result);
+    }
+    int64_t result = 0;
+    for (int32_t block = 0; block < length; block += NORM_BLOCK_SIZE) {
+        int32_t end    = std::min(length, block + NORM_BLOCK_SIZE);
+        __m128i v_sum0 = v_zero, v_sum1 = v_zero;
+        int32_t i      = block;
+        for (; i <= end - 16; i += 16) {
+            __m128i v_src = _mm_loadu_si128((const __m128i *)(src + i));
+            __m128i v_msk = mask != nullptr ? _mm_loadu_si128((const __m128i *)(mask + i)) : v_ones;
+            v_src         = _mm_and_si128(v_src, v_msk);
+            __m128i v_lo  = _mm_cvtepu8_epi16(v_src);
+            __m128i v_hi  = _mm_cvtepu8_epi16(_mm_srli_si128(v_src, 8));
+            v_sum0        = _mm_add_epi32(v_sum0, _mm_madd_epi16(v_lo, v_lo));
+            v_sum1        = _mm_add_epi32(v_sum1, _mm_madd_epi16(v_hi, v_hi));
+        }
+        int32_t buf[4];
+        _mm_storeu_si128((__m128i *)buf, _mm_add_epi32(v_sum0, v_sum1));
+        result += static_cast<int64_t>(buf[0]) + buf[1] + buf[2] + buf[3];
+        for (; i < end; ++i) {
+            int32_t v = src[i] & (mask != nullptr ? mask[i] : 0xff);
+            result += v * v;
+        }
+    }
+    return static_cast<double>(result);
+}
+
+static double norm_row_sse(int32_t length, const float *src, const uint8_t *mask, int32_t normType)
+{
+    const __m128 v_abs   = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128i v_ones = _mm_set1_epi8(-1);
+    if (normType == NORM_INF) {
+        __m128 v_max0 = _mm_setzero_ps(), v_max1 = _mm_setzero_ps();
+        int32_t i     = 0;
+        for (; i <= length - 8; i += 8) {
+            __m128 v_src0 = _mm_and_ps(_mm_loadu_ps(src + i), v_abs);
+            __m128 v_src1 = _mm_and_ps(_mm_loadu_ps(src + i + 4), v_abs);
+            if (mask != nullptr) {
+                __m128i v_msk = _mm_loadl_epi64((const __m128i *)(mask + i));
+                v_src0        = _mm_and_ps(v_src0, _mm_castsi128_ps(_mm_cvtepi8_epi32(v_msk)));
+                v_src1        = _mm_and_ps(v_src1, _mm_castsi128_ps(_mm_cvtepi8_epi32(_mm_srli_si128(v_msk, 4))));
+            }
+            v_max0 = _mm_max_ps(v_max0, v_src0);
+            v_max1 = _mm_max_ps(v_max1, v_src1);
+        }
+        float buf[4];
+        _mm_storeu_ps(buf, _mm_max_ps(v_max0, v_max1));
+        float result = std::max(std::max(buf[0], buf[1]), std::max(buf[2], buf[3]));
+        for (; i < length; ++i) {
+            if (mask == nullptr || mask[i]) {
+                result = std::max(result, std::abs(src[i]));
+            }
+        }
+        return result;
+    }
+    // float lanes only ever hold the sum of one short block, block sums are added in double
+    const bool is_l1 = normType == NORM_L1;
+    double result    = 0;
+    for (int32_t block = 0; block < length; block += 256) {
+        int32_t end   = std::min(length, block + 256);
+        __m128 v_sum0 = _mm_setzero_ps(), v_sum1 = _mm_setzero_ps();
+        __m128 v_sum2 = _mm_setzero_ps(), v_sum3 = _mm_setzero_ps();
+        int32_t i     = block;
+        for (; i <= end - 16; i += 16) {
+            __m128 v_src0 = _mm_loadu_ps(src + i);
+            __m128 v_src1 = _mm_loadu_ps(src + i + 4);
+            __m128 v_src2 = _mm_loadu_ps(src + i + 8);
+            __m128 v_src3 = _mm_loadu_ps(src + i + 12);
+            if (is_l1) {
+                v_src0 = _mm_and_ps(v_src0, v_abs);
+                v_src1 = _mm_and_ps(v_src1, v_abs);
+                v_src2 = _mm_and_ps(v_src2, v_abs);
+                v_src3 = _mm_and_ps(v_src3, v_abs);
+            } else {
+                v_src0 = _mm_mul_ps(v_src0, v_src0);
+                v_src1 = _mm_mul_ps(v_src1, v_src1);
+                v_src2 = _mm_mul_ps(v_src2, v_src2);
+                v_src3 = _mm_mul_ps(v_src3, v_src3);
+            }
+            __m128i v_msk = mask != nullptr ? _mm_loadu_si128((const __m128i *)(mask + i)) : v_ones;
+            v_sum0        = _mm_add_ps(v_sum0, _mm_and_ps(v_src0, _mm_castsi128_ps(_mm_cvtepi8_epi32(v_msk))));
+            v_sum1        = _mm_add_ps(v_sum1, _mm_and_ps(v_src1, _mm_castsi128_ps(_mm_cvtepi8_epi32(_mm_srli_si128(v_msk, 4)))));
+            v_sum2        = _mm_add_ps(v_sum2, _mm_and_ps(v_src2, _mm_castsi128_ps(_mm_cvtepi8_epi32(_mm_srli_si128(v_msk, 8)))));
+            v_sum3        = _mm_add_ps(v_sum3, _mm_and_ps(v_src3, _mm_castsi128_ps(_mm_cvtepi8_epi32(_mm_srli_si128(v_msk, 12)))));
+        }
+        result += hsum_pd(_mm_add_ps(_mm_add_ps(v_sum0, v_sum1), _mm_add_ps(v_sum2, v_sum3)));
+        for (; i < end; ++i) {
+            if (mask == nullptr || mask[i]) {
+                result += is_l1 ? std::abs(src[i]) : static_cast<double>(src[i]) * src[i];
+            }
+        }
+    }
+    return result;
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode Norm(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    double *normValue,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask)
+{
+    if (nullptr == inData || nullptr == normValue) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (mask != nullptr && maskWidthStride < inWidth) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (normType != NORM_INF && normType != NORM_L1 && normType != NORM_L2 && normType != NORM_L2SQR) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const bool use_fma    = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const int32_t length  = inWidth * channels;
+    const int32_t stripes = (inHeight + NORM_STRIPE_ROWS - 1) / NORM_STRIPE_ROWS;
+    std::vector<double> partial(stripes);
+
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        std::vector<uint8_t> mask_row(mask != nullptr ? length : 0);
+        int32_t end = std::min(inHeight, (s + 1) * NORM_STRIPE_ROWS);
+        double acc  = 0;
+        for (int32_t i = s * NORM_STRIPE_ROWS; i < end; ++i) {
+            const uint8_t *m = nullptr;
+            if (mask != nullptr) {
+                v_expand_mask(mask + i * maskWidthStride, inWidth, channels, mask_row.data());
+                m = mask_row.data();
+            }
+            const T *src = inData + i * inWidthStride;
+            double value = use_fma ? fma::norm_row_fma<T>(length, src, m, normType)
+                                   : norm_row_sse(length, src, m, normType);
+            acc = normType == NORM_INF ? std::max(acc, value) : acc + value;
+        }
+        partial[s] = acc;
+    }
+
+    double result = 0;
+    for (int32_t s = 0; s < stripes; ++s) {
+        result = normType == NORM_INF ? std::max(result, partial[s]) : result + partial[s];
+    }
+    *normValue = normType == NORM_L2 ? std::sqrt(result) : result;
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode Norm<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *normValue,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Norm<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *normValue,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Norm<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    double *normValue,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Norm<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *normValue,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Norm<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *normValue,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Norm<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    double *normValue,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+}
+}
+} // namespace ppl::cv::x86
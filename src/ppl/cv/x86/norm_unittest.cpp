@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/core.hpp>
+#include "ppl/cv/x86/norm.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+
+template<typename T, int32_t nc, ppl::cv::NormTypes norm_type, bool use_mask>
+void NormTest(int32_t height, int32_t width) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(mask.get(), width * height, 0, 1);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * width * nc);
+    cv::Mat mask_opencv(height, width, CV_8UC1, mask.get(), width);
+
+    double norm_value = 0;
+    double norm_ref = 0;
+    if (use_mask) {
+        ppl::cv::x86::Norm<T, nc>(height, width, width * nc, src.get(), &norm_value, norm_type, width, mask.get());
+        norm_ref = cv::norm(src_opencv, norm_type, mask_opencv);
+    } else {
+        ppl::cv::x86::Norm<T, nc>(height, width, width * nc, src.get(), &norm_value, norm_type);
+        norm_ref = cv::norm(src_opencv, norm_type);
+    }
+    EXPECT_LE(std::abs(norm_value - norm_ref), 1e-6 * std::max(1.0, std::abs(norm_ref)));
+}
+
+#define R(name, dtype, nc, norm_type, use_mask) \
+    TEST(name, x86) \
+    { \
+        NormTest<dtype, nc, norm_type, use_mask>(240, 320); \
+        NormTest<dtype, nc, norm_type, use_mask>(241, 321); \
+        NormTest<dtype, nc, norm_type, use_mask>(480, 640); \
+        NormTest<dtype, nc, norm_type, use_mask>(1080, 1920); \
+    } \
+
+R(norm_inf_u8c1_x86, uint8_t, 1, ppl::cv::NORM_INF, false);
+R(norm_l1_u8c3_x86, uint8_t, 3, ppl::cv::NORM_L1, false);
+R(norm_l2_u8c4_x86, uint8_t, 4, ppl::cv::NORM_L2, false);
+R(norm_l2sqr_u8c1_x86, uint8_t, 1, ppl::cv::NORM_L2SQR, false);
+R(norm_inf_u8c3_mask_x86, uint8_t, 3, ppl::cv::NORM_INF, true);
+R(norm_l1_u8c4_mask_x86, uint8_t, 4, ppl::cv::NORM_L1, true);
+R(norm_l2_u8c1_mask_x86, uint8_t, 1, ppl::cv::NORM_L2, true);
+
+R(norm_inf_fp32c1_x86, float, 1, ppl::cv::NORM_INF, false);
+R(norm_l1_fp32c3_x86, float, 3, ppl::cv::NORM_L1, false);
+R(norm_l2_fp32c4_x86, float, 4, ppl::cv::NORM_L2, false);
+R(norm_l2sqr_fp32c1_x86, float, 1, ppl::cv::NORM_L2SQR, false);
+R(norm_inf_fp32c3_mask_x86, float, 3, ppl::cv::NORM_INF, true);
+R(norm_l1_fp32c4_mask_x86, float, 4, ppl::cv::NORM_L1, true);
+R(norm_l2_fp32c1_mask_x86, float, 1, ppl::cv::NORM_L2, true);
@@ -0,0 +1,323 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/normalize.h"
+#include "ppl/cv/x86/norm.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/intrinutils.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <string.h>
+#include <float.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// rows per stripe, stripes are reduced independently and merged in order
+#define NORMALIZE_STRIPE_ROWS 16
+
+static void minmax_row_sse(int32_t length, const uint8_t *src, const uint8_t *mask, double *minVal, double *maxVal)
+{
+    __m128i v_min = _mm_set1_epi8(-1);
+    __m128i v_max = _mm_setzero_si128();
+    int32_t i     = 0;
+    for (; i <= length - 16; i += 16) {
+        __m128i v_src = _mm_loadu_si128((const __m128i *)(src + i));
+        if (mask != nullptr) {
+            // unselected elements become 255 for min and 0 for max
+            __m128i v_msk = _mm_loadu_si128((const __m128i *)(mask + i));
+            v_min         = _mm_min_epu8(v_min, _mm_or_si128(v_src, _mm_xor_si128(v_msk, _mm_set1_epi8(-1))));
+            v_max         = _mm_max_epu8(v_max, _mm_and_si128(v_src, v_msk));
+        } else {
+            v_min = _mm_min_epu8(v_min, v_src);
+            v_max = _mm_max_epu8(v_max, v_src);
+        }
+    }
+    v_min = _mm_min_epu8(v_min, _mm_srli_si128(v_min, 8));
+    v_min = _mm_min_epu8(v_min, _mm_srli_si128(v_min, 4));
+    v_min = _mm_min_epu8(v_min, _mm_srli_si128(v_min, 2));
+    v_min = _mm_min_epu8(v_min, _mm_srli_si128(v_min, 1));
+    v_max = _mm_max_epu8(v_max, _mm_srli_si128(v_max, 8));
+    v_max = _mm_max_epu8(v_max, _mm_srli_si128(v_max, 4));
+    v_max = _mm_max_epu8(v_max, _mm_srli_si128(v_max, 2));
+    v_max = _mm_max_epu8(v_max, _mm_srli_si128(v_max, 1));
+    int32_t min_value = _mm_cvtsi128_si32(v_min) & 0xff;
+    int32_t max_value = _mm_cvtsi128_si32(v_max) & 0xff;
+    for (; i < length; ++i) {
+        if (mask == nullptr || mask[i]) {
+            min_value = std::min<int32_t>(min_value, src[i]);
+            max_value = std::max<int32_t>(max_value, src[i]);
+        }
+    }
+    *minVal = std::min<double>(*minVal, min_value);
+    *maxVal = std::max<double>(*maxVal, max_value);
+}
+
+static void minmax_row_sse(int32_t length, const float *src, const uint8_t *mask, double *minVal, double *maxVal)
+{
+    const __m128 v_inf = _mm_set1_ps(FLT_MAX);
+    __m128 v_min       = v_inf;
+    __m128 v_max       = _mm_sub_ps(_mm_setzero_ps(), v_inf);
+    int32_t i          = 0;
+    for (; i <= length - 4; i += 4) {
+        __m128 v_src = _mm_loadu_ps(src + i);
+        if (mask != nullptr) {
+            int32_t m;
+            memcpy(&m, mask + i, sizeof(m));
+            __m128 v_msk = _mm_castsi128_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(m)));
+            v_min        = _mm_min_ps(v_min, _mm_blendv_ps(v_inf, v_src, v_msk));
+            v_max        = _mm_max_ps(v_max, _mm_blendv_ps(_mm_sub_ps(_mm_setzero_ps(), v_inf), v_src, v_msk));
+        } else {
+            v_min = _mm_min_ps(v_min, v_src);
+            v_max = _mm_max_ps(v_max, v_src);
+        }
+    }
+    float buf_min[4], buf_max[4];
+    _mm_storeu_ps(buf_min, v_min);
+    _mm_storeu_ps(buf_max, v_max);
+    float min_value = std::min(std::min(buf_min[0], buf_min[1]), std::min(buf_min[2], buf_min[3]));
+    float max_value = std::max(std::max(buf_max[0], buf_max[1]), std::max(buf_max[2], buf_max[3]));
+    for (; i < length; ++i) {
+        if (mask == nullptr || mask[i]) {
+            min_value = std::min(min_value, src[i]);
+            max_value = std::max(max_value, src[i]);
+        }
+    }
+    *minVal = std::min<double>(*minVal, min_value);
+    *maxVal = std::max<double>(*maxVal, max_value);
+}
+
+static void normalize_row_sse(int32_t length, const uint8_t *src, const uint8_t *mask, float scale, float shift, float *dst)
+{
+    __m128 v_scale = _mm_set1_ps(scale);
+    __m128 v_shift = _mm_set1_ps(shift);
+    int32_t i      = 0;
+    for (; i <= length - 16; i += 16) {
+        __m128i v_src = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i v_msk = mask != nullptr ? _mm_loadu_si128((const __m128i *)(mask + i)) : _mm_set1_epi8(-1);
+        for (int32_t k = 0; k < 4; ++k) {
+            __m128 v_dst = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(v_src)), v_scale), v_shift);
+            v_dst        = _mm_and_ps(v_dst, _mm_castsi128_ps(_mm_cvtepi8_epi32(v_msk)));
+            _mm_storeu_ps(dst + i + 4 * k, v_dst);
+            v_src = _mm_srli_si128(v_src, 4);
+            v_msk = _mm_srli_si128(v_msk, 4);
+        }
+    }
+    for (; i < length; ++i) {
+        dst[i] = (mask == nullptr || mask[i]) ? src[i] * scale + shift : 0.f;
+    }
+}
+
+static void normalize_row_sse(int32_t length, const float *src, const uint8_t *mask, float scale, float shift, float *dst)
+{
+    __m128 v_scale = _mm_set1_ps(scale);
+    __m128 v_shift = _mm_set1_ps(shift);
+    int32_t i      = 0;
+    for (; i <= length - 4; i += 4) {
+        __m128 v_dst = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i), v_scale), v_shift);
+        if (mask != nullptr) {
+            int32_t m;
+            memcpy(&m, mask + i, sizeof(m));
+            v_dst = _mm_and_ps(v_dst, _mm_castsi128_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(m))));
+        }
+        _mm_storeu_ps(dst + i, v_dst);
+    }
+    for (; i < length; ++i) {
+        dst[i] = (mask == nullptr || mask[i]) ? src[i] * scale + shift : 0.f;
+    }
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode Normalize(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float alpha,
+    float beta,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (mask != nullptr && maskWidthStride < width) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (normType != NORM_INF && normType != NORM_L1 && normType != NORM_L2 && normType != NORM_MINMAX) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const bool use_fma   = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const int32_t length = width * channels;
+    double scale = 0, shift = 0;
+    if (normType == NORM_MINMAX) {
+        const int32_t stripes = (height + NORMALIZE_STRIPE_ROWS - 1) / NORMALIZE_STRIPE_ROWS;
+        std::vector<double> partial_min(stripes, DBL_MAX);
+        std::vector<double> partial_max(stripes, -DBL_MAX);
+#pragma omp parallel for
+        for (int32_t s = 0; s < stripes; ++s) {
+            std::vector<uint8_t> mask_row(mask != nullptr ? length : 0);
+            int32_t end = std::min(height, (s + 1) * NORMALIZE_STRIPE_ROWS);
+            for (int32_t i = s * NORMALIZE_STRIPE_ROWS; i < end; ++i) {
+                const uint8_t *m = nullptr;
+                if (mask != nullptr) {
+                    v_expand_mask(mask + i * maskWidthStride, width, channels, mask_row.data());
+                    m = mask_row.data();
+                }
+                if (use_fma) {
+                    fma::minmax_row_fma<T>(length, inData + i * inWidthStride, m, &partial_min[s], &partial_max[s]);
+                } else {
+                    minmax_row_sse(length, inData + i * inWidthStride, m, &partial_min[s], &partial_max[s]);
+                }
+            }
+        }
+        double min_value = *std::min_element(partial_min.begin(), partial_min.end());
+        double max_value = *std::max_element(partial_max.begin(), partial_max.end());
+        if (min_value > max_value) {
+            // empty mask
+            min_value = max_value = 0;
+        }
+        double dmin = std::min(alpha, beta);
+        double dmax = std::max(alpha, beta);
+        scale       = (dmax - dmin) * (max_value - min_value > DBL_EPSILON ? 1. / (max_value - min_value) : 0);
+        shift       = dmin - min_value * scale;
+    } else {
+        double norm_value;
+        ::ppl::common::RetCode ret = Norm<T, channels>(height, width, inWidthStride, inData, &norm_value, normType, maskWidthStride, mask);
+        if (ret != ppl::common::RC_SUCCESS) {
+            return ret;
+        }
+        scale = norm_value > DBL_EPSILON ? alpha / norm_value : 0.;
+    }
+
+    const float fscale    = static_cast<float>(scale);
+    const float fshift    = static_cast<float>(shift);
+    const int32_t stripes = (height + NORMALIZE_STRIPE_ROWS - 1) / NORMALIZE_STRIPE_ROWS;
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        std::vector<uint8_t> mask_row(mask != nullptr ? length : 0);
+        int32_t end = std::min(height, (s + 1) * NORMALIZE_STRIPE_ROWS);
+        for (int32_t i = s * NORMALIZE_STRIPE_ROWS; i < end; ++i) {
+            const uint8_t *m = nullptr;
+            if (mask != nullptr) {
+                v_expand_mask(mask + i * maskWidthStride, width, channels, mask_row.data());
+                m = mask_row.data();
+            }
+            if (use_fma) {
+                fma::normalize_row_fma<T>(length, inData + i * inWidthStride, m, fscale, fshift, outData + i * outWidthStride);
+            } else {
+                normalize_row_sse(length, inData + i * inWidthStride, m, fscale, fshift, outData + i * outWidthStride);
+            }
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode Normalize<uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float alpha,
+    float beta,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Normalize<uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float alpha,
+    float beta,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Normalize<uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float alpha,
+    float beta,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Normalize<float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float alpha,
+    float beta,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Normalize<float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float alpha,
+    float beta,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+template ::ppl::common::RetCode Normalize<float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float alpha,
+    float beta,
+    NormTypes normType,
+    int32_t maskWidthStride,
+    const uint8_t *mask);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/core.hpp>
+#include "ppl/cv/x86/normalize.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+
+template<typename T, int32_t nc, ppl::cv::NormTypes norm_type, bool use_mask>
+void NormalizeTest(int32_t height, int32_t width, float alpha, float beta) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    std::unique_ptr<float[]> dst_ref(new float[width * height * nc]);
+    std::unique_ptr<float[]> dst(new float[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<uint8_t>(mask.get(), width * height, 0, 1);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * width * nc);
+    cv::Mat mask_opencv(height, width, CV_8UC1, mask.get(), width);
+    cv::Mat dst_opencv(height, width, CV_MAKETYPE(CV_32F, nc), dst_ref.get(), sizeof(float) * width * nc);
+
+    if (use_mask) {
+        // pixels outside mask are 0 in ppl.cv, opencv leaves them untouched
+        dst_opencv.setTo(cv::Scalar::all(0));
+        ppl::cv::x86::Normalize<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), alpha, beta, norm_type, width, mask.get());
+        cv::normalize(src_opencv, dst_opencv, alpha, beta, norm_type, CV_32F, mask_opencv);
+    } else {
+        ppl::cv::x86::Normalize<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), alpha, beta, norm_type);
+        cv::normalize(src_opencv, dst_opencv, alpha, beta, norm_type, CV_32F);
+    }
+    checkResult<float, nc>(dst_ref.get(), dst.get(), height, width, width * nc, width * nc, 1e-4f);
+}
+
+#define R(name, dtype, nc, norm_type, use_mask) \
+    TEST(name, x86) \
+    { \
+        NormalizeTest<dtype, nc, norm_type, use_mask>(240, 320, 1.f, 0.f); \
+        NormalizeTest<dtype, nc, norm_type, use_mask>(241, 321, 3.f, 1.f); \
+        NormalizeTest<dtype, nc, norm_type, use_mask>(480, 640, 1.f, -1.f); \
+    } \
+
+R(normalize_inf_u8c1_x86, uint8_t, 1, ppl::cv::NORM_INF, false);
+R(normalize_l1_u8c3_x86, uint8_t, 3, ppl::cv::NORM_L1, false);
+R(normalize_l2_u8c4_x86, uint8_t, 4, ppl::cv::NORM_L2, false);
+R(normalize_minmax_u8c1_x86, uint8_t, 1, ppl::cv::NORM_MINMAX, false);
+R(normalize_l2_u8c3_mask_x86, uint8_t, 3, ppl::cv::NORM_L2, true);
+R(normalize_minmax_u8c4_mask_x86, uint8_t, 4, ppl::cv::NORM_MINMAX, true);
+
+R(normalize_inf_fp32c1_x86, float, 1, ppl::cv::NORM_INF, false);
+R(normalize_l1_fp32c3_x86, float, 3, ppl::cv::NORM_L1, false);
+R(normalize_l2_fp32c4_x86, float, 4, ppl::cv::NORM_L2, false);
+R(normalize_minmax_fp32c1_x86, float, 1, ppl::cv::NORM_MINMAX, false);
+R(normalize_l1_fp32c3_mask_x86, float, 3, ppl::cv::NORM_L1, true);
+R(normalize_minmax_fp32c4_mask_x86, float, 4, ppl::cv::NORM_MINMAX, true);
@@ -0,0 +1,502 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/pyrdown.h"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// output rows per stripe, every stripe keeps its own ring of filtered rows
+#define PYRDOWN_STRIPE_ROWS 64
+// the vector loops may store a few lanes past the end of a filtered row
+#define PYRDOWN_ROW_PADDING 8
+
+// uint8_t rows are summed in uint16_t, 256 * 255 + 128 still fits
+template <typename T>
+struct PyrDownWork;
+
+template <>
+struct PyrDownWork<uint8_t> {
+    typedef uint16_t type;
+};
+
+template <>
+struct PyrDownWork<float> {
+    typedef float type;
+};
+
+template <typename T, typename WT, int32_t channels>
+static inline void pyrdown_pixel_h(
+    int32_t x,
+    int32_t inWidth,
+    const T *src,
+    BorderType border_type,
+    WT *row)
+{
+    const T *p0 = src + border_interpolate(2 * x - 2, inWidth, border_type) * channels;
+    const T *p1 = src + border_interpolate(2 * x - 1, inWidth, border_type) * channels;
+    const T *p2 = src + border_interpolate(2 * x + 0, inWidth, border_type) * channels;
+    const T *p3 = src + border_interpolate(2 * x + 1, inWidth, border_type) * channels;
+    const T *p4 = src + border_interpolate(2 * x + 2, inWidth, border_type) * channels;
+    for (int32_t c = 0; c < channels; ++c) {
+        row[x * channels + c] = p2[c] * 6 + (p1[c] + p3[c]) * 4 + p0[c] + p4[c];
+    }
+}
+
+// horizontal pass of one input row, only the even positions are filtered:
+// row[x] = src[2x - 2] + 4 * src[2x - 1] + 6 * src[2x] + 4 * src[2x + 1] + src[2x + 2]
+template <int32_t channels>
+static void pyrdown_row_h(
+    int32_t inWidth,
+    int32_t outWidth,
+    const uint8_t *src,
+    BorderType border_type,
+    uint16_t *row)
+{
+    // even and odd pixels of 16 bytes loaded at pixel 2x - 2, zero extended to 16 bits
+    __m128i v_even, v_odd;
+    if (channels == 1) {
+        v_even = _mm_setr_epi8(0, -1, 2, -1, 4, -1, 6, -1, 8, -1, 10, -1, 12, -1, 14, -1);
+        v_odd  = _mm_setr_epi8(1, -1, 3, -1, 5, -1, 7, -1, 9, -1, 11, -1, 13, -1, 15, -1);
+    } else if (channels == 3) {
+        v_even = _mm_setr_epi8(0, -1, 1, -1, 2, -1, 6, -1, 7, -1, 8, -1, -1, -1, -1, -1);
+        v_odd  = _mm_setr_epi8(3, -1, 4, -1, 5, -1, 9, -1, 10, -1, 11, -1, -1, -1, -1, -1);
+    } else {
+        v_even = _mm_setr_epi8(0, -1, 1, -1, 2, -1, 3, -1, 8, -1, 9, -1, 10, -1, 11, -1);
+        v_odd  = _mm_setr_epi8(4, -1, 5, -1, 6, -1, 7, -1, 12, -1, 13, -1, 14, -1, 15, -1);
+    }
+    const int32_t step = channels == 1 ? 8 : 2;
+
+    pyrdown_pixel_h<uint8_t, uint16_t, channels>(0, inWidth, src, border_type, row);
+    int32_t x = 1;
+    for (; x + step <= outWidth && (2 * x + 2) * channels + 16 <= inWidth * channels; x += step) {
+        const uint8_t *p = src + (2 * x - 2) * channels;
+        __m128i v_a      = _mm_loadu_si128((const __m128i *)p);
+        __m128i v_b      = _mm_loadu_si128((const __m128i *)(p + 2 * channels));
+        __m128i v_c      = _mm_loadu_si128((const __m128i *)(p + 4 * channels));
+
+        __m128i v_mid = _mm_shuffle_epi8(v_b, v_even);
+        __m128i v_sum = _mm_add_epi16(_mm_slli_epi16(v_mid, 2), _mm_slli_epi16(v_mid, 1));
+        v_sum         = _mm_add_epi16(v_sum, _mm_slli_epi16(_mm_add_epi16(_mm_shuffle_epi8(v_a, v_odd), _mm_shuffle_epi8(v_b, v_odd)), 2));
+        v_sum         = _mm_add_epi16(v_sum, _mm_add_epi16(_mm_shuffle_epi8(v_a, v_even), _mm_shuffle_epi8(v_c, v_even)));
+        _mm_storeu_si128((__m128i *)(row + x * channels), v_sum);
+    }
+    for (; x < outWidth; ++x) {
+        pyrdown_pixel_h<uint8_t, uint16_t, channels>(x, inWidth, src, border_type, row);
+    }
+}
+
+template <int32_t channels>
+static void pyrdown_row_h(
+    int32_t inWidth,
+    int32_t outWidth,
+    const float *src,
+    BorderType border_type,
+    float *row)
+{
+    const __m128 v_4 = _mm_set1_ps(4.0f);
+    const __m128 v_6 = _mm_set1_ps(6.0f);
+
+    pyrdown_pixel_h<float, float, channels>(0, inWidth, src, border_type, row);
+    int32_t x = 1;
+    if (channels == 1) {
+        for (; x + 4 <= outWidth && 2 * x + 10 <= inWidth; x += 4) {
+            const float *p = src + 2 * x - 2;
+            __m128 v_a0    = _mm_loadu_ps(p + 0);
+            __m128 v_b0    = _mm_loadu_ps(p + 2);
+            __m128 v_a1    = _mm_loadu_ps(p + 4);
+            __m128 v_b1    = _mm_loadu_ps(p + 6);
+            __m128 v_a2    = _mm_loadu_ps(p + 8);
+
+            __m128 v_sum = _mm_mul_ps(_mm_shuffle_ps(v_b0, v_b1, _MM_SHUFFLE(2, 0, 2, 0)), v_6);
+            v_sum        = _mm_add_ps(v_sum, _mm_mul_ps(_mm_add_ps(_mm_shuffle_ps(v_a0, v_a1, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(v_b0, v_b1, _MM_SHUFFLE(3, 1, 3, 1))), v_4));
+            v_sum        = _mm_add_ps(v_sum, _mm_shuffle_ps(v_a0, v_a1, _MM_SHUFFLE(2, 0, 2, 0)));
+            v_sum        = _mm_add_ps(v_sum, _mm_shuffle_ps(v_a1, v_a2, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(row + x, v_sum);
+        }
+    } else {
+        // one pixel per vector, the fourth lane of a 3-channel pixel spills into the next one
+        for (; x < outWidth && (2 * x + 2) * channels + 4 <= inWidth * channels; ++x) {
+            const float *p = src + (2 * x - 2) * channels;
+            __m128 v_sum   = _mm_mul_ps(_mm_loadu_ps(p + 2 * channels), v_6);
+            v_sum          = _mm_add_ps(v_sum, _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(p + channels), _mm_loadu_ps(p + 3 * channels)), v_4));
+            v_sum          = _mm_add_ps(v_sum, _mm_loadu_ps(p));
+            v_sum          = _mm_add_ps(v_sum, _mm_loadu_ps(p + 4 * channels));
+            _mm_storeu_ps(row + x * channels, v_sum);
+        }
+    }
+    for (; x < outWidth; ++x) {
+        pyrdown_pixel_h<float, float, channels>(x, inWidth, src, border_type, row);
+    }
+}
+
+// vertical pass: dst = (6 * r2 + 4 * (r1 + r3) + r0 + r4 + 128) >> 8
+static void pyrdown_col_v(
+    int32_t length,
+    const uint16_t *const *rows,
+    uint8_t *dst)
+{
+    const __m128i v_128 = _mm_set1_epi16(128);
+    int32_t i           = 0;
+    for (; i <= length - 8; i += 8) {
+        __m128i v_r2  = _mm_loadu_si128((const __m128i *)(rows[2] + i));
+        __m128i v_sum = _mm_add_epi16(_mm_slli_epi16(v_r2, 2), _mm_slli_epi16(v_r2, 1));
+        v_sum         = _mm_add_epi16(v_sum, _mm_slli_epi16(_mm_add_epi16(_mm_loadu_si128((const __m128i *)(rows[1] + i)), _mm_loadu_si128((const __m128i *)(rows[3] + i))), 2));
+        v_sum         = _mm_add_epi16(v_sum, _mm_add_epi16(_mm_loadu_si128((const __m128i *)(rows[0] + i)), _mm_loadu_si128((const __m128i *)(rows[4] + i))));
+        v_sum         = _mm_srli_epi16(_mm_add_epi16(v_sum, v_128), 8);
+        _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(v_sum, v_sum));
+    }
+    for (; i < length; ++i) {
+        int32_t sum = rows[2][i] * 6 + (rows[1][i] + rows[3][i]) * 4 + rows[0][i] + rows[4][i];
+        dst[i]      = (sum + 128) >> 8;
+    }
+}
+
+static void pyrdown_col_v(
+    int32_t length,
+    const float *const *rows,
+    float *dst)
+{
+    const float scale     = 1.0f / 256;
+    const __m128 v_4      = _mm_set1_ps(4.0f);
+    const __m128 v_6      = _mm_set1_ps(6.0f);
+    const __m128 v_scale  = _mm_set1_ps(scale);
+    int32_t i             = 0;
+    for (; i <= length - 4; i += 4) {
+        __m128 v_sum = _mm_mul_ps(_mm_loadu_ps(rows[2] + i), v_6);
+        v_sum        = _mm_add_ps(v_sum, _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(rows[1] + i), _mm_loadu_ps(rows[3] + i)), v_4));
+        v_sum        = _mm_add_ps(v_sum, _mm_loadu_ps(rows[0] + i));
+        v_sum        = _mm_add_ps(v_sum, _mm_loadu_ps(rows[4] + i));
+        _mm_storeu_ps(dst + i, _mm_mul_ps(v_sum, v_scale));
+    }
+    for (; i < length; ++i) {
+        dst[i] = (rows[2][i] * 6 + (rows[1][i] + rows[3][i]) * 4 + rows[0][i] + rows[4][i]) * scale;
+    }
+}
+
+// Produces the output rows of one PyrDown level in order. Horizontally filtered input rows are
+// kept in a ring of five slots indexed by row % 5, the taps of one output row always lie within
+// five consecutive input rows, so they never evict each other.
+template <typename T, int32_t channels>
+class PyrDownRows {
+public:
+    typedef typename PyrDownWork<T>::type WT;
+
+    PyrDownRows(
+        int32_t inHeight,
+        int32_t inWidth,
+        int32_t inWidthStride,
+        const T *inData,
+        int32_t outWidthStride,
+        T *outData,
+        BorderType border_type,
+        int32_t y)
+        : y(y)
+        , inHeight_(inHeight)
+        , inWidth_(inWidth)
+        , inWidthStride_(inWidthStride)
+        , inData_(inData)
+        , outHeight_((inHeight + 1) / 2)
+        , outWidth_((inWidth + 1) / 2)
+        , outWidthStride_(outWidthStride)
+        , outData_(outData)
+        , border_type_(border_type)
+        , rowStep_(outWidth_ * channels + PYRDOWN_ROW_PADDING)
+        , ring_(5 * rowStep_)
+    {
+        for (int32_t k = 0; k < 5; ++k) {
+            cached_[k] = -1;
+        }
+    }
+
+    // emits the next output row if the input rows [0, available) hold all of its taps
+    bool next(int32_t available)
+    {
+        if (y >= outHeight_) {
+            return false;
+        }
+        int32_t taps[5];
+        for (int32_t k = 0; k < 5; ++k) {
+            taps[k] = border_interpolate(2 * y + k - 2, inHeight_, border_type_);
+            if (taps[k] >= available) {
+                return false;
+            }
+        }
+        const WT *rows[5];
+        for (int32_t k = 0; k < 5; ++k) {
+            int32_t slot = taps[k] % 5;
+            WT *row      = ring_.data() + slot * rowStep_;
+            if (cached_[slot] != taps[k]) {
+                pyrdown_row_h<channels>(inWidth_, outWidth_, inData_ + taps[k] * inWidthStride_, border_type_, row);
+                cached_[slot] = taps[k];
+            }
+            rows[k] = row;
+        }
+        pyrdown_col_v(outWidth_ * channels, rows, outData_ + y * outWidthStride_);
+        ++y;
+        return true;
+    }
+
+    int32_t y; // next output row
+
+private:
+    int32_t inHeight_;
+    int32_t inWidth_;
+    int32_t inWidthStride_;
+    const T *inData_;
+    int32_t outHeight_;
+    int32_t outWidth_;
+    int32_t outWidthStride_;
+    T *outData_;
+    BorderType border_type_;
+    int32_t rowStep_;
+    std::vector<WT> ring_;
+    int32_t cached_[5];
+};
+
+static inline bool pyrdown_border_supported(BorderType border_type)
+{
+    return border_type == BORDER_TYPE_REFLECT_101 ||
+           border_type == BORDER_TYPE_REFLECT ||
+           border_type == BORDER_TYPE_REPLICATE;
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode PyrDown(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    BorderType border_type)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels ||
+        outWidthStride < (inWidth + 1) / 2 * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (!pyrdown_border_supported(border_type)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const int32_t outHeight = (inHeight + 1) / 2;
+    const int32_t stripes   = (outHeight + PYRDOWN_STRIPE_ROWS - 1) / PYRDOWN_STRIPE_ROWS;
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        const int32_t y1 = std::min(outHeight, (s + 1) * PYRDOWN_STRIPE_ROWS);
+        PyrDownRows<T, channels> rows(inHeight, inWidth, inWidthStride, inData, outWidthStride, outData, border_type, s * PYRDOWN_STRIPE_ROWS);
+        while (rows.y < y1) {
+            rows.next(inHeight);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode BuildPyramid(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t maxLevel,
+    const int32_t *outWidthStrides,
+    T **outData,
+    BorderType border_type)
+{
+    if (nullptr == inData || nullptr == outWidthStrides || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || maxLevel < 1) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (!pyrdown_border_supported(border_type)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    for (int32_t i = 0, levelWidth = width; i < maxLevel; ++i) {
+        levelWidth = (levelWidth + 1) / 2;
+        if (nullptr == outData[i] || outWidthStrides[i] < levelWidth * channels) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+    }
+#ifdef _OPENMP
+    // the sweep below is sequential, with several threads every level is striped instead
+    if (omp_get_max_threads() > 1) {
+        int32_t levelHeight = height, levelWidth = width, levelStride = inWidthStride;
+        const T *levelData  = inData;
+        for (int32_t i = 0; i < maxLevel; ++i) {
+            PyrDown<T, channels>(levelHeight, levelWidth, levelStride, levelData, outWidthStrides[i], outData[i], border_type);
+            levelHeight = (levelHeight + 1) / 2;
+            levelWidth  = (levelWidth + 1) / 2;
+            levelStride = outWidthStrides[i];
+            levelData   = outData[i];
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+#endif
+    std::vector<PyrDownRows<T, channels>> levels;
+    levels.reserve(maxLevel);
+    int32_t levelHeight = height, levelWidth = width, levelStride = inWidthStride;
+    const T *levelData  = inData;
+    for (int32_t i = 0; i < maxLevel; ++i) {
+        levels.emplace_back(levelHeight, levelWidth, levelStride, levelData, outWidthStrides[i], outData[i], border_type, 0);
+        levelHeight = (levelHeight + 1) / 2;
+        levelWidth  = (levelWidth + 1) / 2;
+        levelStride = outWidthStrides[i];
+        levelData   = outData[i];
+    }
+    // feed the source one row at a time and let every level drain what it can
+    for (int32_t available = 1; available <= height; ++available) {
+        int32_t rows = available;
+        for (int32_t i = 0; i < maxLevel; ++i) {
+            while (levels[i].next(rows)) {
+            }
+            rows = levels[i].y;
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode PyrDown<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode PyrDown<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode PyrDown<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode PyrDown<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode PyrDown<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode PyrDown<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode BuildPyramid<uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maxLevel,
+    const int32_t *outWidthStrides,
+    uint8_t **outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode BuildPyramid<uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maxLevel,
+    const int32_t *outWidthStrides,
+    uint8_t **outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode BuildPyramid<uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maxLevel,
+    const int32_t *outWidthStrides,
+    uint8_t **outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode BuildPyramid<float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t maxLevel,
+    const int32_t *outWidthStrides,
+    float **outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode BuildPyramid<float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t maxLevel,
+    const int32_t *outWidthStrides,
+    float **outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode BuildPyramid<float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t maxLevel,
+    const int32_t *outWidthStrides,
+    float **outData,
+    BorderType border_type);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/pyrdown.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+template<typename T, int32_t nc>
+void PyrDownTest(int32_t height, int32_t width, ppl::cv::BorderType border_type, int32_t cv_border, float diff) {
+    const int32_t outHeight = (height + 1) / 2;
+    const int32_t outWidth = (width + 1) / 2;
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
+    cv::pyrDown(src_opencv, dst_opencv, cv::Size(outWidth, outHeight), cv_border);
+
+    auto rst = ppl::cv::x86::PyrDown<T, nc>(height, width, width * nc, src.get(), outWidth * nc, dst.get(), border_type);
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    checkResult<T, nc>(dst.get(), dst_ref.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, diff);
+}
+
+template<typename T, int32_t nc>
+void BuildPyramidTest(int32_t height, int32_t width, int32_t maxLevel, float diff) {
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    std::vector<cv::Mat> dst_opencv;
+    cv::buildPyramid(src_opencv, dst_opencv, maxLevel);
+
+    std::vector<std::vector<T>> levels(maxLevel);
+    std::vector<T *> dst(maxLevel);
+    std::vector<int32_t> strides(maxLevel);
+    for (int32_t i = 0; i < maxLevel; ++i) {
+        const cv::Mat &level = dst_opencv[i + 1];
+        levels[i].resize(level.rows * level.cols * nc);
+        dst[i] = levels[i].data();
+        strides[i] = level.cols * nc;
+    }
+    auto rst = ppl::cv::x86::BuildPyramid<T, nc>(height, width, width * nc, src.get(), maxLevel, strides.data(), dst.data());
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    for (int32_t i = 0; i < maxLevel; ++i) {
+        const cv::Mat &level = dst_opencv[i + 1];
+        checkResult<T, nc>(dst[i], (const T *)level.data, level.rows, level.cols, strides[i], level.step / sizeof(T), diff);
+    }
+}
+
+#define R(name, dtype, nc, diff) \
+    TEST(name, x86) \
+    { \
+        PyrDownTest<dtype, nc>(240, 320, ppl::cv::BORDER_TYPE_REFLECT_101, cv::BORDER_REFLECT_101, diff); \
+        PyrDownTest<dtype, nc>(241, 321, ppl::cv::BORDER_TYPE_REFLECT_101, cv::BORDER_REFLECT_101, diff); \
+        PyrDownTest<dtype, nc>(241, 321, ppl::cv::BORDER_TYPE_REFLECT, cv::BORDER_REFLECT, diff); \
+        PyrDownTest<dtype, nc>(241, 321, ppl::cv::BORDER_TYPE_REPLICATE, cv::BORDER_REPLICATE, diff); \
+        PyrDownTest<dtype, nc>(5, 3, ppl::cv::BORDER_TYPE_REFLECT_101, cv::BORDER_REFLECT_101, diff); \
+        PyrDownTest<dtype, nc>(1080, 1920, ppl::cv::BORDER_TYPE_REFLECT_101, cv::BORDER_REFLECT_101, diff); \
+        BuildPyramidTest<dtype, nc>(480, 640, 4, diff); \
+        BuildPyramidTest<dtype, nc>(1081, 1919, 6, diff); \
+    } \
+
+R(pyrdown_u8c1_x86, uint8_t, 1, 1.01f);
+R(pyrdown_u8c3_x86, uint8_t, 3, 1.01f);
+R(pyrdown_u8c4_x86, uint8_t, 4, 1.01f);
+R(pyrdown_f32c1_x86, float, 1, 1e-3f);
+R(pyrdown_f32c3_x86, float, 3, 1e-3f);
+R(pyrdown_f32c4_x86, float, 4, 1e-3f);
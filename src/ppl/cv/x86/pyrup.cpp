@@ -0,0 +1,316 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/pyrup.h"
+#include "ppl/cv/x86/util.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// input rows per stripe, every stripe keeps its own pair of filtered rows
+#define PYRUP_STRIPE_ROWS 32
+
+// uint8_t rows are summed in uint16_t, 64 * 255 + 32 still fits
+template <typename T>
+struct PyrUpWork;
+
+template <>
+struct PyrUpWork<uint8_t> {
+    typedef uint16_t type;
+};
+
+template <>
+struct PyrUpWork<float> {
+    typedef float type;
+};
+
+// neighbour of input pixel i as seen by cv::pyrUp, which reflects the upsampled image of length 2 * len
+static inline int32_t pyrup_border(int32_t i, int32_t len)
+{
+    return border_interpolate(2 * i, 2 * len, BORDER_TYPE_REFLECT_101) / 2;
+}
+
+static inline void pyrup_store(int32_t v, uint8_t *dst)
+{
+    *dst = (v + 32) >> 6;
+}
+
+static inline void pyrup_store(float v, float *dst)
+{
+    *dst = v * (1.0f / 64);
+}
+
+// vertical pass, the even output row is prev + 6 * cur + next and the odd one 4 * (cur + next)
+static void pyrup_col_v(
+    int32_t length,
+    const uint8_t *prev,
+    const uint8_t *cur,
+    const uint8_t *next,
+    uint16_t *even,
+    uint16_t *odd)
+{
+    const __m128i v_zero = _mm_setzero_si128();
+    int32_t i            = 0;
+    for (; i <= length - 16; i += 16) {
+        __m128i v_p = _mm_loadu_si128((const __m128i *)(prev + i));
+        __m128i v_c = _mm_loadu_si128((const __m128i *)(cur + i));
+        __m128i v_n = _mm_loadu_si128((const __m128i *)(next + i));
+
+        __m128i v_c0 = _mm_unpacklo_epi8(v_c, v_zero);
+        __m128i v_c1 = _mm_unpackhi_epi8(v_c, v_zero);
+        __m128i v_n0 = _mm_unpacklo_epi8(v_n, v_zero);
+        __m128i v_n1 = _mm_unpackhi_epi8(v_n, v_zero);
+        __m128i v_e0 = _mm_add_epi16(_mm_add_epi16(_mm_unpacklo_epi8(v_p, v_zero), v_n0), _mm_add_epi16(_mm_slli_epi16(v_c0, 2), _mm_slli_epi16(v_c0, 1)));
+        __m128i v_e1 = _mm_add_epi16(_mm_add_epi16(_mm_unpackhi_epi8(v_p, v_zero), v_n1), _mm_add_epi16(_mm_slli_epi16(v_c1, 2), _mm_slli_epi16(v_c1, 1)));
+        _mm_storeu_si128((__m128i *)(even + i), v_e0);
+        _mm_storeu_si128((__m128i *)(even + i + 8), v_e1);
+        _mm_storeu_si128((__m128i *)(odd + i), _mm_slli_epi16(_mm_add_epi16(v_c0, v_n0), 2));
+        _mm_storeu_si128((__m128i *)(odd + i + 8), _mm_slli_epi16(_mm_add_epi16(v_c1, v_n1), 2));
+    }
+    for (; i < length; ++i) {
+        even[i] = prev[i] + cur[i] * 6 + next[i];
+        odd[i]  = (cur[i] + next[i]) * 4;
+    }
+}
+
+static void pyrup_col_v(
+    int32_t length,
+    const float *prev,
+    const float *cur,
+    const float *next,
+    float *even,
+    float *odd)
+{
+    const __m128 v_4 = _mm_set1_ps(4.0f);
+    const __m128 v_6 = _mm_set1_ps(6.0f);
+    int32_t i        = 0;
+    for (; i <= length - 4; i += 4) {
+        __m128 v_c = _mm_loadu_ps(cur + i);
+        __m128 v_n = _mm_loadu_ps(next + i);
+        _mm_storeu_ps(even + i, _mm_add_ps(_mm_add_ps(_mm_loadu_ps(prev + i), _mm_mul_ps(v_c, v_6)), v_n));
+        _mm_storeu_ps(odd + i, _mm_mul_ps(_mm_add_ps(v_c, v_n), v_4));
+    }
+    for (; i < length; ++i) {
+        even[i] = prev[i] + cur[i] * 6 + next[i];
+        odd[i]  = (cur[i] + next[i]) * 4;
+    }
+}
+
+template <typename T, typename WT, int32_t channels>
+static inline void pyrup_pixel_h(
+    int32_t x,
+    int32_t inWidth,
+    const WT *row,
+    T *dst)
+{
+    const WT *p0 = row + pyrup_border(x - 1, inWidth) * channels;
+    const WT *p1 = row + x * channels;
+    const WT *p2 = row + pyrup_border(x + 1, inWidth) * channels;
+    for (int32_t c = 0; c < channels; ++c) {
+        pyrup_store(p0[c] + p1[c] * 6 + p2[c], dst + 2 * x * channels + c);
+        pyrup_store((p1[c] + p2[c]) * 4, dst + (2 * x + 1) * channels + c);
+    }
+}
+
+// horizontal pass of one filtered row, input pixel x gives output pixels 2x and 2x + 1
+template <int32_t channels>
+static void pyrup_row_h(
+    int32_t inWidth,
+    const uint16_t *row,
+    uint8_t *dst)
+{
+    const __m128i v_32 = _mm_set1_epi16(32);
+    // 4 pixels of 3 channels from the even and the odd vector make 24 output bytes
+    const __m128i v_even_lo = _mm_setr_epi8(0, 1, 2, -1, -1, -1, 3, 4, 5, -1, -1, -1, 6, 7, 8, -1);
+    const __m128i v_odd_lo  = _mm_setr_epi8(-1, -1, -1, 0, 1, 2, -1, -1, -1, 3, 4, 5, -1, -1, -1, 6);
+    const __m128i v_even_hi = _mm_setr_epi8(-1, -1, 9, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i v_odd_hi  = _mm_setr_epi8(7, 8, -1, -1, -1, 9, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1);
+    const int32_t step      = channels == 3 ? 12 : 16;
+
+    pyrup_pixel_h<uint8_t, uint16_t, channels>(0, inWidth, row, dst);
+    int32_t j = channels;
+    for (; j + 16 <= (inWidth - 1) * channels; j += step) {
+        __m128i v_e[2], v_o[2];
+        for (int32_t k = 0; k < 2; ++k) {
+            __m128i v_l = _mm_loadu_si128((const __m128i *)(row + j + k * 8 - channels));
+            __m128i v_m = _mm_loadu_si128((const __m128i *)(row + j + k * 8));
+            __m128i v_r = _mm_loadu_si128((const __m128i *)(row + j + k * 8 + channels));
+            v_e[k]      = _mm_add_epi16(_mm_add_epi16(v_l, v_r), _mm_add_epi16(_mm_slli_epi16(v_m, 2), _mm_slli_epi16(v_m, 1)));
+            v_o[k]      = _mm_slli_epi16(_mm_add_epi16(v_m, v_r), 2);
+            v_e[k]      = _mm_srli_epi16(_mm_add_epi16(v_e[k], v_32), 6);
+            v_o[k]      = _mm_srli_epi16(_mm_add_epi16(v_o[k], v_32), 6);
+        }
+        __m128i v_even = _mm_packus_epi16(v_e[0], v_e[1]);
+        __m128i v_odd  = _mm_packus_epi16(v_o[0], v_o[1]);
+        uint8_t *d     = dst + 2 * j;
+        if (channels == 1) {
+            _mm_storeu_si128((__m128i *)d, _mm_unpacklo_epi8(v_even, v_odd));
+            _mm_storeu_si128((__m128i *)(d + 16), _mm_unpackhi_epi8(v_even, v_odd));
+        } else if (channels == 3) {
+            _mm_storeu_si128((__m128i *)d, _mm_or_si128(_mm_shuffle_epi8(v_even, v_even_lo), _mm_shuffle_epi8(v_odd, v_odd_lo)));
+            _mm_storel_epi64((__m128i *)(d + 16), _mm_or_si128(_mm_shuffle_epi8(v_even, v_even_hi), _mm_shuffle_epi8(v_odd, v_odd_hi)));
+        } else {
+            _mm_storeu_si128((__m128i *)d, _mm_unpacklo_epi32(v_even, v_odd));
+            _mm_storeu_si128((__m128i *)(d + 16), _mm_unpackhi_epi32(v_even, v_odd));
+        }
+    }
+    for (int32_t x = j / channels; x < inWidth; ++x) {
+        pyrup_pixel_h<uint8_t, uint16_t, channels>(x, inWidth, row, dst);
+    }
+}
+
+template <int32_t channels>
+static void pyrup_row_h(
+    int32_t inWidth,
+    const float *row,
+    float *dst)
+{
+    const __m128 v_4     = _mm_set1_ps(4.0f);
+    const __m128 v_6     = _mm_set1_ps(6.0f);
+    const __m128 v_scale = _mm_set1_ps(1.0f / 64);
+
+    pyrup_pixel_h<float, float, channels>(0, inWidth, row, dst);
+    int32_t x = 1;
+    if (channels == 1) {
+        for (; x + 5 <= inWidth; x += 4) {
+            __m128 v_m    = _mm_loadu_ps(row + x);
+            __m128 v_r    = _mm_loadu_ps(row + x + 1);
+            __m128 v_even = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_loadu_ps(row + x - 1), _mm_mul_ps(v_m, v_6)), v_r), v_scale);
+            __m128 v_odd  = _mm_mul_ps(_mm_mul_ps(_mm_add_ps(v_m, v_r), v_4), v_scale);
+            _mm_storeu_ps(dst + 2 * x, _mm_unpacklo_ps(v_even, v_odd));
+            _mm_storeu_ps(dst + 2 * x + 4, _mm_unpackhi_ps(v_even, v_odd));
+        }
+    } else {
+        // one pixel per vector, the fourth lane of a 3-channel pixel is overwritten by the next store
+        for (; (x + 1) * channels + 4 <= inWidth * channels; ++x) {
+            __m128 v_m    = _mm_loadu_ps(row + x * channels);
+            __m128 v_r    = _mm_loadu_ps(row + (x + 1) * channels);
+            __m128 v_even = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_loadu_ps(row + (x - 1) * channels), _mm_mul_ps(v_m, v_6)), v_r), v_scale);
+            __m128 v_odd  = _mm_mul_ps(_mm_mul_ps(_mm_add_ps(v_m, v_r), v_4), v_scale);
+            _mm_storeu_ps(dst + 2 * x * channels, v_even);
+            _mm_storeu_ps(dst + (2 * x + 1) * channels, v_odd);
+        }
+    }
+    for (; x < inWidth; ++x) {
+        pyrup_pixel_h<float, float, channels>(x, inWidth, row, dst);
+    }
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode PyrUp(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    BorderType border_type)
+{
+    typedef typename PyrUpWork<T>::type WT;
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels ||
+        outWidthStride < inWidth * 2 * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (border_type != BORDER_TYPE_REFLECT_101) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const int32_t length  = inWidth * channels;
+    const int32_t stripes = (inHeight + PYRUP_STRIPE_ROWS - 1) / PYRUP_STRIPE_ROWS;
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        std::vector<WT> buffer(2 * length);
+        WT *even         = buffer.data();
+        WT *odd          = even + length;
+        const int32_t y1 = std::min(inHeight, (s + 1) * PYRUP_STRIPE_ROWS);
+        for (int32_t y = s * PYRUP_STRIPE_ROWS; y < y1; ++y) {
+            const T *prev = inData + pyrup_border(y - 1, inHeight) * inWidthStride;
+            const T *next = inData + pyrup_border(y + 1, inHeight) * inWidthStride;
+            pyrup_col_v(length, prev, inData + y * inWidthStride, next, even, odd);
+            pyrup_row_h<channels>(inWidth, even, outData + 2 * y * outWidthStride);
+            pyrup_row_h<channels>(inWidth, odd, outData + (2 * y + 1) * outWidthStride);
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode PyrUp<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode PyrUp<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode PyrUp<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode PyrUp<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode PyrUp<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    BorderType border_type);
+
+template ::ppl::common::RetCode PyrUp<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    BorderType border_type);
+
+}
+}
+} // namespace ppl::cv::x86
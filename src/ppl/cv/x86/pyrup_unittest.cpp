@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/pyrup.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+
+template<typename T, int32_t nc>
+void PyrUpTest(int32_t height, int32_t width, float diff) {
+    const int32_t outHeight = height * 2;
+    const int32_t outWidth = width * 2;
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
+    cv::pyrUp(src_opencv, dst_opencv, cv::Size(outWidth, outHeight));
+
+    auto rst = ppl::cv::x86::PyrUp<T, nc>(height, width, width * nc, src.get(), outWidth * nc, dst.get());
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    checkResult<T, nc>(dst.get(), dst_ref.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, diff);
+}
+
+#define R(name, dtype, nc, diff) \
+    TEST(name, x86) \
+    { \
+        PyrUpTest<dtype, nc>(240, 320, diff); \
+        PyrUpTest<dtype, nc>(241, 321, diff); \
+        PyrUpTest<dtype, nc>(1, 1, diff); \
+        PyrUpTest<dtype, nc>(3, 5, diff); \
+        PyrUpTest<dtype, nc>(540, 960, diff); \
+    } \
+
+R(pyrup_u8c1_x86, uint8_t, 1, 1.01f);
+R(pyrup_u8c3_x86, uint8_t, 3, 1.01f);
+R(pyrup_u8c4_x86, uint8_t, 4, 1.01f);
+R(pyrup_f32c1_x86, float, 1, 1e-3f);
+R(pyrup_f32c3_x86, float, 3, 1e-3f);
+R(pyrup_f32c4_x86, float, 4, 1e-3f);
@@ -0,0 +1,631 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/remap.h"
+#include "ppl/cv/x86/remap.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// output rows per stripe, every stripe converts the rows of float maps into its own buffer
+#define REMAP_STRIPE_ROWS 16
+
+static inline int32_t remap_round(float v)
+{
+    return _mm_cvtss_si32(_mm_set_ss(v));
+}
+
+static void convert_maps_row_linear(
+    int32_t width,
+    const float *mapX,
+    const float *mapY,
+    int16_t *mapXY,
+    uint16_t *mapFrac)
+{
+    const __m128 v_scale = _mm_set1_ps(REMAP_INTER_TAB_SIZE);
+    const __m128i v_mask = _mm_set1_epi32(REMAP_INTER_MASK);
+    int32_t j            = 0;
+    for (; j <= width - 8; j += 8) {
+        __m128i v_x0    = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(mapX + j), v_scale));
+        __m128i v_x1    = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(mapX + j + 4), v_scale));
+        __m128i v_y0    = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(mapY + j), v_scale));
+        __m128i v_y1    = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(mapY + j + 4), v_scale));
+        __m128i v_frac0 = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(v_y0, v_mask), REMAP_INTER_BITS), _mm_and_si128(v_x0, v_mask));
+        __m128i v_frac1 = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(v_y1, v_mask), REMAP_INTER_BITS), _mm_and_si128(v_x1, v_mask));
+        _mm_storeu_si128((__m128i *)(mapFrac + j), _mm_packs_epi32(v_frac0, v_frac1));
+        __m128i v_sx = _mm_packs_epi32(_mm_srai_epi32(v_x0, REMAP_INTER_BITS), _mm_srai_epi32(v_x1, REMAP_INTER_BITS));
+        __m128i v_sy = _mm_packs_epi32(_mm_srai_epi32(v_y0, REMAP_INTER_BITS), _mm_srai_epi32(v_y1, REMAP_INTER_BITS));
+        _mm_storeu_si128((__m128i *)(mapXY + j * 2), _mm_unpacklo_epi16(v_sx, v_sy));
+        _mm_storeu_si128((__m128i *)(mapXY + j * 2 + 8), _mm_unpackhi_epi16(v_sx, v_sy));
+    }
+    for (; j < width; ++j) {
+        int32_t x        = remap_round(mapX[j] * REMAP_INTER_TAB_SIZE);
+        int32_t y        = remap_round(mapY[j] * REMAP_INTER_TAB_SIZE);
+        mapXY[j * 2]     = remap_saturate_s16(x >> REMAP_INTER_BITS);
+        mapXY[j * 2 + 1] = remap_saturate_s16(y >> REMAP_INTER_BITS);
+        mapFrac[j]       = ((y & REMAP_INTER_MASK) << REMAP_INTER_BITS) | (x & REMAP_INTER_MASK);
+    }
+}
+
+static void convert_maps_row_nearest(
+    int32_t width,
+    const float *mapX,
+    const float *mapY,
+    int16_t *mapXY)
+{
+    int32_t j = 0;
+    for (; j <= width - 8; j += 8) {
+        __m128i v_sx = _mm_packs_epi32(_mm_cvtps_epi32(_mm_loadu_ps(mapX + j)), _mm_cvtps_epi32(_mm_loadu_ps(mapX + j + 4)));
+        __m128i v_sy = _mm_packs_epi32(_mm_cvtps_epi32(_mm_loadu_ps(mapY + j)), _mm_cvtps_epi32(_mm_loadu_ps(mapY + j + 4)));
+        _mm_storeu_si128((__m128i *)(mapXY + j * 2), _mm_unpacklo_epi16(v_sx, v_sy));
+        _mm_storeu_si128((__m128i *)(mapXY + j * 2 + 8), _mm_unpackhi_epi16(v_sx, v_sy));
+    }
+    for (; j < width; ++j) {
+        mapXY[j * 2]     = remap_saturate_s16(remap_round(mapX[j]));
+        mapXY[j * 2 + 1] = remap_saturate_s16(remap_round(mapY[j]));
+    }
+}
+
+// either mapX/mapY or mapXY/mapFrac is given, the float maps are converted one row at a time
+template <typename T, int32_t nc, BorderType border_type, bool linear>
+static void remap_rows(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const float *mapX,
+    const float *mapY,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    T border_value)
+{
+    const bool use_fma    = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const int32_t stripes = (outHeight + REMAP_STRIPE_ROWS - 1) / REMAP_STRIPE_ROWS;
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        std::vector<int16_t> xy_buffer;
+        std::vector<uint16_t> frac_buffer;
+        if (mapX) {
+            xy_buffer.resize(outWidth * 2);
+            frac_buffer.resize(linear ? outWidth : 0);
+        }
+        const int32_t i1 = std::min(outHeight, (s + 1) * REMAP_STRIPE_ROWS);
+        for (int32_t i = s * REMAP_STRIPE_ROWS; i < i1; ++i) {
+            const int16_t *xy    = xy_buffer.data();
+            const uint16_t *frac = frac_buffer.data();
+            T *dst               = outData + i * outWidthStride;
+            if (mapX) {
+                const float *row_x = mapX + (int64_t)i * outWidth;
+                const float *row_y = mapY + (int64_t)i * outWidth;
+                if (linear) {
+                    convert_maps_row_linear(outWidth, row_x, row_y, xy_buffer.data(), frac_buffer.data());
+                } else {
+                    convert_maps_row_nearest(outWidth, row_x, row_y, xy_buffer.data());
+                }
+            } else {
+                xy   = mapXY + (int64_t)i * outWidth * 2;
+                frac = linear ? mapFrac + (int64_t)i * outWidth : nullptr;
+            }
+            if (linear) {
+                remap_linear_row<T, nc, border_type>(inHeight, inWidth, inWidthStride, inData, outWidth, xy, frac, border_value, dst, use_fma);
+            } else {
+                remap_nearest_row<T, nc, border_type>(inHeight, inWidth, inWidthStride, inData, outWidth, xy, border_value, dst, use_fma);
+            }
+        }
+    }
+}
+
+template <typename T, int32_t nc, bool linear>
+static ::ppl::common::RetCode remap_dispatch(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const float *mapX,
+    const float *mapY,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    BorderType border_type,
+    T border_value)
+{
+    if (inData == nullptr || outData == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * nc ||
+        outHeight <= 0 || outWidth <= 0 || outWidthStride < outWidth * nc) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (border_type == BORDER_TYPE_CONSTANT) {
+        remap_rows<T, nc, BORDER_TYPE_CONSTANT, linear>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, mapX, mapY, mapXY, mapFrac, border_value);
+    } else if (border_type == BORDER_TYPE_REPLICATE) {
+        remap_rows<T, nc, BORDER_TYPE_REPLICATE, linear>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, mapX, mapY, mapXY, mapFrac, border_value);
+    } else if (border_type == BORDER_TYPE_TRANSPARENT) {
+        remap_rows<T, nc, BORDER_TYPE_TRANSPARENT, linear>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, mapX, mapY, mapXY, mapFrac, border_value);
+    } else {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+::ppl::common::RetCode ConvertMaps(
+    int32_t height,
+    int32_t width,
+    const float *mapX,
+    const float *mapY,
+    int16_t *mapXY,
+    uint16_t *mapFrac,
+    InterpolationType inter_mode)
+{
+    if (mapX == nullptr || mapY == nullptr || mapXY == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inter_mode == INTERPOLATION_TYPE_LINEAR) {
+        if (mapFrac == nullptr) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+#pragma omp parallel for
+        for (int32_t i = 0; i < height; ++i) {
+            int64_t offset = (int64_t)i * width;
+            convert_maps_row_linear(width, mapX + offset, mapY + offset, mapXY + offset * 2, mapFrac + offset);
+        }
+    } else if (inter_mode == INTERPOLATION_TYPE_NEAREST_POINT) {
+#pragma omp parallel for
+        for (int32_t i = 0; i < height; ++i) {
+            int64_t offset = (int64_t)i * width;
+            convert_maps_row_nearest(width, mapX + offset, mapY + offset, mapXY + offset * 2);
+        }
+    } else {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode RemapLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    T border_value)
+{
+    if (mapX == nullptr || mapY == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return remap_dispatch<T, channels, true>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, mapX, mapY, nullptr, nullptr, border_type, border_value);
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode RemapLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    BorderType border_type,
+    T border_value)
+{
+    if (mapXY == nullptr || mapFrac == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return remap_dispatch<T, channels, true>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, nullptr, nullptr, mapXY, mapFrac, border_type, border_value);
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode RemapNearestPoint(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    T border_value)
+{
+    if (mapX == nullptr || mapY == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return remap_dispatch<T, channels, false>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, mapX, mapY, nullptr, nullptr, border_type, border_value);
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode RemapNearestPoint(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const int16_t *mapXY,
+    BorderType border_type,
+    T border_value)
+{
+    if (mapXY == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return remap_dispatch<T, channels, false>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, nullptr, nullptr, mapXY, nullptr, border_type, border_value);
+}
+
+template ::ppl::common::RetCode RemapLinear<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapLinear<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapLinear<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapLinear<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode RemapLinear<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode RemapLinear<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode RemapLinear<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapLinear<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapLinear<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapLinear<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode RemapLinear<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode RemapLinear<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const float *mapX,
+    const float *mapY,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const int16_t *mapXY,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const int16_t *mapXY,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const int16_t *mapXY,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const int16_t *mapXY,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const int16_t *mapXY,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode RemapNearestPoint<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const int16_t *mapXY,
+    BorderType border_type,
+    float border_value);
+
+}
+}
+} // namespace ppl::cv::x86
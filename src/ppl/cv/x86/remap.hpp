@@ -0,0 +1,417 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_REMAP_HPP_
+#define __ST_HPC_PPL_CV_X86_REMAP_HPP_
+
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include <stdint.h>
+#include <string.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// fixed-point maps keep 5 fractional bits per axis, the same as cv::convertMaps
+#define REMAP_INTER_BITS     5
+#define REMAP_INTER_TAB_SIZE (1 << REMAP_INTER_BITS)
+#define REMAP_INTER_MASK     (REMAP_INTER_TAB_SIZE - 1)
+// uint8_t results are (sum(v * w) + 512) >> 10 where the four integer weights add up to 1024
+#define REMAP_WEIGHT_BITS    (2 * REMAP_INTER_BITS)
+
+static inline int16_t remap_saturate_s16(int32_t v)
+{
+    return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v);
+}
+
+static inline void remap_linear_weights(uint16_t frac, int32_t *w)
+{
+    int32_t fx = frac & REMAP_INTER_MASK;
+    int32_t fy = frac >> REMAP_INTER_BITS;
+    w[0]       = (REMAP_INTER_TAB_SIZE - fx) * (REMAP_INTER_TAB_SIZE - fy);
+    w[1]       = fx * (REMAP_INTER_TAB_SIZE - fy);
+    w[2]       = (REMAP_INTER_TAB_SIZE - fx) * fy;
+    w[3]       = fx * fy;
+}
+
+static inline void remap_linear_weights(uint16_t frac, float *w)
+{
+    float fx = (frac & REMAP_INTER_MASK) * (1.0f / REMAP_INTER_TAB_SIZE);
+    float fy = (frac >> REMAP_INTER_BITS) * (1.0f / REMAP_INTER_TAB_SIZE);
+    w[0]     = (1.0f - fx) * (1.0f - fy);
+    w[1]     = fx * (1.0f - fy);
+    w[2]     = (1.0f - fx) * fy;
+    w[3]     = fx * fy;
+}
+
+static inline uint8_t remap_linear_cast(int32_t sum, uint8_t)
+{
+    return (sum + (1 << (REMAP_WEIGHT_BITS - 1))) >> REMAP_WEIGHT_BITS;
+}
+
+static inline float remap_linear_cast(float sum, float)
+{
+    return sum;
+}
+
+template <typename T>
+struct RemapWeight;
+
+template <>
+struct RemapWeight<uint8_t> {
+    typedef int32_t type;
+};
+
+template <>
+struct RemapWeight<float> {
+    typedef float type;
+};
+
+// one output pixel of the linear remap whose four taps are known to be inside the image
+template <typename T, int32_t nc>
+inline void remap_linear_interior(
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t sx,
+    int32_t sy,
+    uint16_t frac,
+    T *dst)
+{
+    typedef typename RemapWeight<T>::type WT;
+    WT w[4];
+    remap_linear_weights(frac, w);
+    const T *p0 = inData + sy * inWidthStride + sx * nc;
+    const T *p1 = p0 + inWidthStride;
+    for (int32_t c = 0; c < nc; ++c) {
+        WT sum = p0[c] * w[0] + p0[nc + c] * w[1] + p1[c] * w[2] + p1[nc + c] * w[3];
+        dst[c] = remap_linear_cast(sum, T());
+    }
+}
+
+// one output pixel of the linear remap, (sx, sy) is the top-left tap
+template <typename T, int32_t nc, BorderType border_type>
+inline void remap_linear_pixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t sx,
+    int32_t sy,
+    uint16_t frac,
+    T border_value,
+    T *dst)
+{
+    if ((uint32_t)sx < (uint32_t)(inWidth - 1) && (uint32_t)sy < (uint32_t)(inHeight - 1)) {
+        remap_linear_interior<T, nc>(inWidthStride, inData, sx, sy, frac, dst);
+        return;
+    }
+    if (border_type == BORDER_TYPE_TRANSPARENT) {
+        return;
+    }
+    if (border_type == BORDER_TYPE_CONSTANT &&
+        (sx >= inWidth || sx + 1 < 0 || sy >= inHeight || sy + 1 < 0)) {
+        for (int32_t c = 0; c < nc; ++c) {
+            dst[c] = border_value;
+        }
+        return;
+    }
+    typedef typename RemapWeight<T>::type WT;
+    WT w[4];
+    remap_linear_weights(frac, w);
+    const T *p[4];
+    int32_t xs[2] = {sx, sx + 1};
+    int32_t ys[2] = {sy, sy + 1};
+    for (int32_t k = 0; k < 4; ++k) {
+        int32_t x = xs[k & 1], y = ys[k >> 1];
+        if (border_type == BORDER_TYPE_REPLICATE) {
+            x = x < 0 ? 0 : (x >= inWidth ? inWidth - 1 : x);
+            y = y < 0 ? 0 : (y >= inHeight ? inHeight - 1 : y);
+        }
+        // a constant border tap is taken from the border value instead of the image
+        p[k] = ((uint32_t)x < (uint32_t)inWidth && (uint32_t)y < (uint32_t)inHeight) ? inData + y * inWidthStride + x * nc : nullptr;
+    }
+    for (int32_t c = 0; c < nc; ++c) {
+        WT sum = 0;
+        for (int32_t k = 0; k < 4; ++k) {
+            sum += (p[k] ? p[k][c] : border_value) * w[k];
+        }
+        dst[c] = remap_linear_cast(sum, T());
+    }
+}
+
+template <typename T, int32_t nc, BorderType border_type>
+inline void remap_nearest_pixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t sx,
+    int32_t sy,
+    T border_value,
+    T *dst)
+{
+    if (border_type == BORDER_TYPE_REPLICATE) {
+        sx = sx < 0 ? 0 : (sx >= inWidth ? inWidth - 1 : sx);
+        sy = sy < 0 ? 0 : (sy >= inHeight ? inHeight - 1 : sy);
+    } else if ((uint32_t)sx >= (uint32_t)inWidth || (uint32_t)sy >= (uint32_t)inHeight) {
+        if (border_type == BORDER_TYPE_CONSTANT) {
+            for (int32_t c = 0; c < nc; ++c) {
+                dst[c] = border_value;
+            }
+        }
+        return;
+    }
+    const T *p = inData + sy * inWidthStride + sx * nc;
+    for (int32_t c = 0; c < nc; ++c) {
+        dst[c] = p[c];
+    }
+}
+
+template <int32_t nc, BorderType border_type>
+inline bool remap_linear_row_fma(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t border_value,
+    uint8_t *outData)
+{
+    fma::remap_linear_u8_fma<nc, border_type>(inHeight, inWidth, inWidthStride, inData, outWidth, mapXY, mapFrac, border_value, outData);
+    return true;
+}
+
+template <int32_t nc, BorderType border_type>
+inline bool remap_linear_row_fma(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    float border_value,
+    float *outData)
+{
+    if (nc != 1) {
+        return false;
+    }
+    fma::remap_linear_f32c1_fma<border_type>(inHeight, inWidth, inWidthStride, inData, outWidth, mapXY, mapFrac, border_value, outData);
+    return true;
+}
+
+// only 4-byte pixels are gathered, uint8_t x 4 and float x 1
+template <int32_t nc, BorderType border_type>
+inline bool remap_nearest_row_fma(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    uint8_t border_value,
+    uint8_t *outData)
+{
+    if (nc != 4) {
+        return false;
+    }
+    fma::remap_nearest_4byte_fma<border_type>(inHeight, inWidth, inWidthStride, inData, outWidth, mapXY, (uint32_t)border_value * 0x01010101u, outData);
+    return true;
+}
+
+template <int32_t nc, BorderType border_type>
+inline bool remap_nearest_row_fma(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    float border_value,
+    float *outData)
+{
+    if (nc != 1) {
+        return false;
+    }
+    int32_t border_pixel;
+    memcpy(&border_pixel, &border_value, sizeof(border_pixel));
+    fma::remap_nearest_4byte_fma<border_type>(inHeight, inWidth, inWidthStride * sizeof(float), (const uint8_t *)inData, outWidth, mapXY, border_pixel, (uint8_t *)outData);
+    return true;
+}
+
+template <int32_t nc>
+inline bool remap_linear_inner_fma(
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    uint8_t *outData)
+{
+    fma::remap_linear_u8_inner_fma<nc>(inWidthStride, inData, outWidth, mapXY, mapFrac, outData);
+    return true;
+}
+
+template <int32_t nc>
+inline bool remap_linear_inner_fma(
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    float *outData)
+{
+    if (nc != 1) {
+        return false;
+    }
+    fma::remap_linear_f32c1_inner_fma(inWidthStride, inData, outWidth, mapXY, mapFrac, outData);
+    return true;
+}
+
+template <int32_t nc>
+inline bool remap_nearest_inner_fma(
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    uint8_t *outData)
+{
+    if (nc != 4) {
+        return false;
+    }
+    fma::remap_nearest_4byte_inner_fma(inWidthStride, inData, outWidth, mapXY, outData);
+    return true;
+}
+
+template <int32_t nc>
+inline bool remap_nearest_inner_fma(
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    float *outData)
+{
+    if (nc != 1) {
+        return false;
+    }
+    fma::remap_nearest_4byte_inner_fma(inWidthStride * sizeof(float), (const uint8_t *)inData, outWidth, mapXY, (uint8_t *)outData);
+    return true;
+}
+
+// one row of the linear remap with border handling
+template <typename T, int32_t nc, BorderType border_type>
+inline void remap_linear_row(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    T border_value,
+    T *outData,
+    bool use_fma)
+{
+    if (use_fma && remap_linear_row_fma<nc, border_type>(inHeight, inWidth, inWidthStride, inData, outWidth, mapXY, mapFrac, border_value, outData)) {
+        return;
+    }
+    for (int32_t j = 0; j < outWidth; ++j) {
+        remap_linear_pixel<T, nc, border_type>(inHeight, inWidth, inWidthStride, inData, mapXY[j * 2], mapXY[j * 2 + 1], mapFrac[j], border_value, outData + j * nc);
+    }
+}
+
+template <typename T, int32_t nc, BorderType border_type>
+inline void remap_nearest_row(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    T border_value,
+    T *outData,
+    bool use_fma)
+{
+    if (use_fma && remap_nearest_row_fma<nc, border_type>(inHeight, inWidth, inWidthStride, inData, outWidth, mapXY, border_value, outData)) {
+        return;
+    }
+    for (int32_t j = 0; j < outWidth; ++j) {
+        remap_nearest_pixel<T, nc, border_type>(inHeight, inWidth, inWidthStride, inData, mapXY[j * 2], mapXY[j * 2 + 1], border_value, outData + j * nc);
+    }
+}
+
+// largest x of the top-left tap the unchecked linear rows accept, the uint8_t gathers
+// fetch 4 bytes from every row tap for 1 channel and 8 bytes for 3 and 4 channels
+template <typename T, int32_t nc>
+inline int32_t remap_linear_inner_max_x(int32_t inWidth, bool use_fma)
+{
+    if (!use_fma || sizeof(T) != 1) {
+        return inWidth - 2;
+    }
+    const int32_t fetch = nc == 1 ? 4 : 8;
+    return inWidth - (fetch + nc - 1) / nc;
+}
+
+// one row of the linear remap where every pixel satisfies 0 <= x <= remap_linear_inner_max_x
+// and 0 <= y <= inHeight - 2, no bounds are checked
+template <typename T, int32_t nc>
+inline void remap_linear_row_inner(
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    const uint16_t *mapFrac,
+    T *outData,
+    bool use_fma)
+{
+    if (use_fma && remap_linear_inner_fma<nc>(inWidthStride, inData, outWidth, mapXY, mapFrac, outData)) {
+        return;
+    }
+    for (int32_t j = 0; j < outWidth; ++j) {
+        remap_linear_interior<T, nc>(inWidthStride, inData, mapXY[j * 2], mapXY[j * 2 + 1], mapFrac[j], outData + j * nc);
+    }
+}
+
+// one row of the nearest remap where every pixel is inside the image
+template <typename T, int32_t nc>
+inline void remap_nearest_row_inner(
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidth,
+    const int16_t *mapXY,
+    T *outData,
+    bool use_fma)
+{
+    if (use_fma && remap_nearest_inner_fma<nc>(inWidthStride, inData, outWidth, mapXY, outData)) {
+        return;
+    }
+    for (int32_t j = 0; j < outWidth; ++j) {
+        const T *p = inData + mapXY[j * 2 + 1] * inWidthStride + mapXY[j * 2] * nc;
+        for (int32_t c = 0; c < nc; ++c) {
+            outData[j * nc + c] = p[c];
+        }
+    }
+}
+
+}
+}
+} // namespace ppl::cv::x86
+
+#endif //!__ST_HPC_PPL_CV_X86_REMAP_HPP_
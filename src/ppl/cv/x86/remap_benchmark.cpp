@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/remap.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+
+namespace {
+
+template<typename T, int32_t nc>
+void BM_RemapLinear_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    std::unique_ptr<float[]> mapX(new float[width * height]);
+    std::unique_ptr<float[]> mapY(new float[width * height]);
+    std::unique_ptr<int16_t[]> mapXY(new int16_t[width * height * 2]);
+    std::unique_ptr<uint16_t[]> mapFrac(new uint16_t[width * height]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<float>(mapX.get(), width * height, 0, width - 1);
+    ppl::cv::debug::randomFill<float>(mapY.get(), width * height, 0, height - 1);
+    ppl::cv::x86::ConvertMaps(height, width, mapX.get(), mapY.get(), mapXY.get(), mapFrac.get());
+    for (auto _ : state) {
+        ppl::cv::x86::RemapLinear<T, nc>(height, width, width * nc, src.get(), height, width, width * nc, dst.get(), mapXY.get(), mapFrac.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template<typename T, int32_t nc>
+void BM_RemapNearestPoint_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    std::unique_ptr<float[]> mapX(new float[width * height]);
+    std::unique_ptr<float[]> mapY(new float[width * height]);
+    std::unique_ptr<int16_t[]> mapXY(new int16_t[width * height * 2]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<float>(mapX.get(), width * height, 0, width - 1);
+    ppl::cv::debug::randomFill<float>(mapY.get(), width * height, 0, height - 1);
+    ppl::cv::x86::ConvertMaps(height, width, mapX.get(), mapY.get(), mapXY.get(), nullptr, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT);
+    for (auto _ : state) {
+        ppl::cv::x86::RemapNearestPoint<T, nc>(height, width, width * nc, src.get(), height, width, width * nc, dst.get(), mapXY.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_RemapLinear_ppl_x86, uint8_t, c1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_RemapLinear_ppl_x86, uint8_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_RemapLinear_ppl_x86, uint8_t, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_RemapLinear_ppl_x86, float, c1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_RemapLinear_ppl_x86, float, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_RemapLinear_ppl_x86, float, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_RemapNearestPoint_ppl_x86, uint8_t, c1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_RemapNearestPoint_ppl_x86, uint8_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_RemapNearestPoint_ppl_x86, uint8_t, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_RemapNearestPoint_ppl_x86, float, c1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_RemapNearestPoint_ppl_x86, float, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_RemapNearestPoint_ppl_x86, float, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<typename T, int32_t nc, int32_t inter_mode>
+void BM_Remap_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    std::unique_ptr<float[]> mapX(new float[width * height]);
+    std::unique_ptr<float[]> mapY(new float[width * height]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<float>(mapX.get(), width * height, 0, width - 1);
+    ppl::cv::debug::randomFill<float>(mapY.get(), width * height, 0, height - 1);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat dst_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst.get());
+    cv::Mat mapX_opencv(height, width, CV_32FC1, mapX.get());
+    cv::Mat mapY_opencv(height, width, CV_32FC1, mapY.get());
+    cv::Mat mapXY_opencv, mapFrac_opencv;
+    cv::convertMaps(mapX_opencv, mapY_opencv, mapXY_opencv, mapFrac_opencv, CV_16SC2, inter_mode == cv::INTER_NEAREST);
+    for (auto _ : state) {
+        cv::remap(src_opencv, dst_opencv, mapXY_opencv, mapFrac_opencv, inter_mode, cv::BORDER_CONSTANT);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, uint8_t, c1, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, uint8_t, c3, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, uint8_t, c4, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, float, c1, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, float, c3, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, float, c4, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, uint8_t, c1, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, uint8_t, c3, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, uint8_t, c4, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, float, c1, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, float, c3, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, float, c4, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
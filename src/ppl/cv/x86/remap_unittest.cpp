@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/remap.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string.h>
+
+template<typename T, int32_t nc, ppl::cv::InterpolationType inter_mode, ppl::cv::BorderType border_type, bool packed>
+void RemapTest(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth, float diff, T border_value = 0) {
+    std::unique_ptr<T[]> src(new T[inWidth * inHeight * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<float[]> mapX(new float[outWidth * outHeight]);
+    std::unique_ptr<float[]> mapY(new float[outWidth * outHeight]);
+    ppl::cv::debug::randomFill<T>(src.get(), inWidth * inHeight * nc, 0, 255);
+    ppl::cv::debug::randomFill<T>(dst.get(), outWidth * outHeight * nc, 0, 255);
+    memcpy(dst_ref.get(), dst.get(), outWidth * outHeight * nc * sizeof(T));
+    // a quarter of the samples fall outside the input image
+    ppl::cv::debug::randomFill<float>(mapX.get(), outWidth * outHeight, -inWidth / 4.0f, inWidth * 5 / 4.0f);
+    ppl::cv::debug::randomFill<float>(mapY.get(), outWidth * outHeight, -inHeight / 4.0f, inHeight * 5 / 4.0f);
+
+    cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get());
+    cv::Mat mapX_opencv(outHeight, outWidth, CV_32FC1, mapX.get());
+    cv::Mat mapY_opencv(outHeight, outWidth, CV_32FC1, mapY.get());
+    cv::BorderTypes cv_border_type = cv::BORDER_CONSTANT;
+    if (border_type == ppl::cv::BORDER_TYPE_REPLICATE) {
+        cv_border_type = cv::BORDER_REPLICATE;
+    } else if (border_type == ppl::cv::BORDER_TYPE_TRANSPARENT) {
+        cv_border_type = cv::BORDER_TRANSPARENT;
+    }
+    const bool linear = inter_mode == ppl::cv::INTERPOLATION_TYPE_LINEAR;
+    ppl::common::RetCode rst;
+    if (packed) {
+        std::unique_ptr<int16_t[]> mapXY(new int16_t[outWidth * outHeight * 2]);
+        std::unique_ptr<uint16_t[]> mapFrac(new uint16_t[outWidth * outHeight]);
+        rst = ppl::cv::x86::ConvertMaps(outHeight, outWidth, mapX.get(), mapY.get(), mapXY.get(), mapFrac.get(), inter_mode);
+        EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+        cv::Mat mapXY_opencv, mapFrac_opencv;
+        cv::convertMaps(mapX_opencv, mapY_opencv, mapXY_opencv, mapFrac_opencv, CV_16SC2, !linear);
+        cv::Mat mapXY_ppl(outHeight, outWidth, CV_16SC2, mapXY.get());
+        EXPECT_EQ(cv::norm(mapXY_ppl, mapXY_opencv, cv::NORM_INF), 0);
+        if (linear) {
+            cv::Mat mapFrac_ppl(outHeight, outWidth, CV_16UC1, mapFrac.get());
+            EXPECT_EQ(cv::norm(mapFrac_ppl, mapFrac_opencv, cv::NORM_INF), 0);
+            cv::remap(src_opencv, dst_opencv, mapXY_opencv, mapFrac_opencv, cv::INTER_LINEAR, cv_border_type, cv::Scalar::all(border_value));
+            rst = ppl::cv::x86::RemapLinear<T, nc>(inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst.get(), mapXY.get(), mapFrac.get(), border_type, border_value);
+        } else {
+            cv::remap(src_opencv, dst_opencv, mapXY_opencv, cv::Mat(), cv::INTER_NEAREST, cv_border_type, cv::Scalar::all(border_value));
+            rst = ppl::cv::x86::RemapNearestPoint<T, nc>(inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst.get(), mapXY.get(), border_type, border_value);
+        }
+    } else if (linear) {
+        cv::remap(src_opencv, dst_opencv, mapX_opencv, mapY_opencv, cv::INTER_LINEAR, cv_border_type, cv::Scalar::all(border_value));
+        rst = ppl::cv::x86::RemapLinear<T, nc>(inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst.get(), mapX.get(), mapY.get(), border_type, border_value);
+    } else {
+        cv::remap(src_opencv, dst_opencv, mapX_opencv, mapY_opencv, cv::INTER_NEAREST, cv_border_type, cv::Scalar::all(border_value));
+        rst = ppl::cv::x86::RemapNearestPoint<T, nc>(inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst.get(), mapX.get(), mapY.get(), border_type, border_value);
+    }
+    EXPECT_EQ(rst, ppl::common::RC_SUCCESS);
+    checkResult<T, nc>(dst.get(), dst_ref.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, diff);
+}
+
+#define R(name, dtype, nc, inter_mode, border_type, diff) \
+    TEST(name, x86) \
+    { \
+        RemapTest<dtype, nc, inter_mode, border_type, false>(240, 320, 240, 320, diff); \
+        RemapTest<dtype, nc, inter_mode, border_type, false>(480, 640, 241, 321, diff); \
+        RemapTest<dtype, nc, inter_mode, border_type, false>(1, 1, 3, 5, diff); \
+        RemapTest<dtype, nc, inter_mode, border_type, true>(240, 320, 240, 320, diff); \
+        RemapTest<dtype, nc, inter_mode, border_type, true>(121, 163, 720, 1280, diff); \
+    } \
+
+R(remap_u8c1_linear_constant_x86, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(remap_u8c3_linear_constant_x86, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(remap_u8c4_linear_constant_x86, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(remap_f32c1_linear_constant_x86, float, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1e-3f);
+R(remap_f32c3_linear_constant_x86, float, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1e-3f);
+R(remap_f32c4_linear_constant_x86, float, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1e-3f);
+R(remap_u8c1_linear_replicate_x86, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(remap_u8c3_linear_replicate_x86, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(remap_u8c4_linear_replicate_x86, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(remap_f32c1_linear_replicate_x86, float, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1e-3f);
+R(remap_f32c3_linear_replicate_x86, float, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1e-3f);
+R(remap_f32c4_linear_replicate_x86, float, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1e-3f);
+R(remap_u8c1_linear_transparent_x86, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(remap_u8c3_linear_transparent_x86, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(remap_u8c4_linear_transparent_x86, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(remap_f32c1_linear_transparent_x86, float, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1e-3f);
+R(remap_f32c3_linear_transparent_x86, float, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1e-3f);
+R(remap_f32c4_linear_transparent_x86, float, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1e-3f);
+
+R(remap_u8c1_nearest_constant_x86, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(remap_u8c3_nearest_constant_x86, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(remap_u8c4_nearest_constant_x86, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(remap_f32c1_nearest_constant_x86, float, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1e-3f);
+R(remap_f32c3_nearest_constant_x86, float, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1e-3f);
+R(remap_f32c4_nearest_constant_x86, float, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1e-3f);
+R(remap_u8c1_nearest_replicate_x86, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(remap_u8c3_nearest_replicate_x86, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(remap_u8c4_nearest_replicate_x86, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(remap_f32c1_nearest_replicate_x86, float, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1e-3f);
+R(remap_f32c3_nearest_replicate_x86, float, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1e-3f);
+R(remap_f32c4_nearest_replicate_x86, float, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1e-3f);
+R(remap_u8c1_nearest_transparent_x86, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(remap_u8c3_nearest_transparent_x86, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(remap_u8c4_nearest_transparent_x86, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(remap_f32c1_nearest_transparent_x86, float, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1e-3f);
+R(remap_f32c3_nearest_transparent_x86, float, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1e-3f);
+R(remap_f32c4_nearest_transparent_x86, float, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1e-3f);
+
+// values from 128 up fill all four bytes of a gathered uint8_t pixel
+#define R_BORDER_VALUE(name, nc, inter_mode) \
+    TEST(name, x86) \
+    { \
+        RemapTest<uint8_t, nc, inter_mode, ppl::cv::BORDER_TYPE_CONSTANT, false>(240, 320, 240, 320, 1.01f, 200); \
+        RemapTest<uint8_t, nc, inter_mode, ppl::cv::BORDER_TYPE_CONSTANT, false>(1, 1, 3, 5, 1.01f, 200); \
+        RemapTest<uint8_t, nc, inter_mode, ppl::cv::BORDER_TYPE_CONSTANT, true>(121, 163, 720, 1280, 1.01f, 200); \
+    } \
+
+R_BORDER_VALUE(remap_u8c3_linear_constant_value_x86, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR);
+R_BORDER_VALUE(remap_u8c4_linear_constant_value_x86, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR);
+R_BORDER_VALUE(remap_u8c3_nearest_constant_value_x86, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT);
+R_BORDER_VALUE(remap_u8c4_nearest_constant_value_x86, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT);
@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/rotate.h"
+#include "ppl/cv/x86/flip.h"
+#include "ppl/cv/x86/transpose.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode Rotate(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t degree)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels || outWidthStride < outWidth * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (degree == 180) {
+        if (outHeight != inHeight || outWidth != inWidth) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        return Flip<T, channels>(inHeight, inWidth, inWidthStride, inData, outWidthStride, outData, -1);
+    }
+    if (degree != 90 && degree != 270) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (outHeight != inWidth || outWidth != inHeight) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (degree == 90) {
+        // dst(i, j) = src(inHeight - 1 - j, i): transpose the input read bottom-up
+        transpose_strided<T, channels>(inHeight, inWidth, inData + (inHeight - 1) * inWidthStride, -inWidthStride, outData, outWidthStride);
+    } else {
+        // dst(i, j) = src(j, inWidth - 1 - i): transpose into the output written bottom-up
+        transpose_strided<T, channels>(inHeight, inWidth, inData, inWidthStride, outData + (outHeight - 1) * outWidthStride, -outWidthStride);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template ::ppl::common::RetCode Rotate<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    int32_t degree);
+
+template ::ppl::common::RetCode Rotate<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    int32_t degree);
+
+template ::ppl::common::RetCode Rotate<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    int32_t degree);
+
+template ::ppl::common::RetCode Rotate<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t degree);
+
+template ::ppl::common::RetCode Rotate<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t degree);
+
+template ::ppl::common::RetCode Rotate<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    int32_t degree);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/rotate.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/core.hpp>
+
+template <typename T, int32_t nc>
+void RotateTest(int32_t height, int32_t width, int32_t degree, int32_t padding = 0)
+{
+    int32_t out_height = degree == 180 ? height : width;
+    int32_t out_width  = degree == 180 ? width : height;
+    int32_t in_stride  = width * nc + padding;
+    int32_t out_stride = out_width * nc + padding;
+    std::unique_ptr<T[]> src(new T[height * in_stride]);
+    ppl::cv::debug::randomFill<T>(src.get(), height * in_stride, 0, 255);
+
+    // the padding of the output rows must be left alone
+    const T guard = T(77);
+    std::unique_ptr<T[]> dst(new T[out_height * out_stride]);
+    std::fill(dst.get(), dst.get() + out_height * out_stride, guard);
+
+    ppl::cv::x86::Rotate<T, nc>(height, width, in_stride, src.get(), out_height, out_width, out_stride, dst.get(), degree);
+
+    std::unique_ptr<T[]> dst_opencv(new T[width * height * nc]);
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), in_stride * sizeof(T));
+    cv::Mat oMat(out_height, out_width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_opencv.get());
+    int32_t rotate_code = degree == 90 ? cv::ROTATE_90_CLOCKWISE : (degree == 180 ? cv::ROTATE_180 : cv::ROTATE_90_COUNTERCLOCKWISE);
+    cv::rotate(iMat, oMat, rotate_code);
+
+    checkResult<T, nc>(dst.get(), dst_opencv.get(), out_height, out_width, out_stride, out_width * nc, 1.01f);
+    for (int32_t i = 0; i < out_height; ++i) {
+        for (int32_t j = out_width * nc; j < out_stride; ++j) {
+            EXPECT_EQ(dst.get()[i * out_stride + j], guard);
+        }
+    }
+}
+
+TEST(ROTATE_FP32, x86)
+{
+    for (int32_t degree = 90; degree < 360; degree += 90) {
+        RotateTest<float, 1>(640, 720, degree);
+        RotateTest<float, 3>(640, 720, degree);
+        RotateTest<float, 4>(640, 720, degree);
+
+        RotateTest<float, 1>(101, 203, degree);
+        RotateTest<float, 3>(101, 203, degree);
+        RotateTest<float, 4>(101, 203, degree);
+
+        RotateTest<float, 3>(101, 203, degree, 5);
+    }
+}
+
+TEST(ROTATE_UINT8, x86)
+{
+    for (int32_t degree = 90; degree < 360; degree += 90) {
+        RotateTest<uint8_t, 1>(640, 720, degree);
+        RotateTest<uint8_t, 3>(640, 720, degree);
+        RotateTest<uint8_t, 4>(640, 720, degree);
+
+        RotateTest<uint8_t, 1>(101, 203, degree);
+        RotateTest<uint8_t, 3>(101, 203, degree);
+        RotateTest<uint8_t, 4>(101, 203, degree);
+
+        RotateTest<uint8_t, 3>(101, 203, degree, 5);
+    }
+}
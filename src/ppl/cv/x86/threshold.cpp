@@ -0,0 +1,460 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/threshold.h"
+#include "ppl/cv/x86/calchist.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <string.h>
+#include <float.h>
+#include <cmath>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+template <int32_t type, typename T>
+static inline T threshold_scalar(T value, T thresh, T maxval)
+{
+    switch (type) {
+        case CV_THRESH_BINARY:
+            return value > thresh ? maxval : 0;
+        case CV_THRESH_BINARY_INV:
+            return value > thresh ? 0 : maxval;
+        case CV_THRESH_TRUNC:
+            return value > thresh ? thresh : value;
+        case CV_THRESH_TOZERO:
+            return value > thresh ? value : 0;
+        default:
+            return value > thresh ? 0 : value;
+    }
+}
+
+template <int32_t type>
+static void threshold_u8_sse(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t thresh,
+    uint8_t maxval)
+{
+    // thresh < 255 is guaranteed by the caller, src > thresh <=> max(src, thresh + 1) == src
+    __m128i v_thresh1 = _mm_set1_epi8(static_cast<char>(thresh + 1));
+    __m128i v_thresh  = _mm_set1_epi8(static_cast<char>(thresh));
+    __m128i v_maxval  = _mm_set1_epi8(static_cast<char>(maxval));
+    for (int32_t i = 0; i < height; ++i) {
+        const uint8_t *src = inData + i * inWidthStride;
+        uint8_t *dst       = outData + i * outWidthStride;
+        int32_t j          = 0;
+        for (; j <= width - 16; j += 16) {
+            __m128i v_src  = _mm_loadu_si128((const __m128i *)(src + j));
+            __m128i v_mask = _mm_cmpeq_epi8(_mm_max_epu8(v_src, v_thresh1), v_src);
+            __m128i v_dst;
+            switch (type) {
+                case CV_THRESH_BINARY:
+                    v_dst = _mm_and_si128(v_mask, v_maxval);
+                    break;
+                case CV_THRESH_BINARY_INV:
+                    v_dst = _mm_andnot_si128(v_mask, v_maxval);
+                    break;
+                case CV_THRESH_TRUNC:
+                    v_dst = _mm_min_epu8(v_src, v_thresh);
+                    break;
+                case CV_THRESH_TOZERO:
+                    v_dst = _mm_and_si128(v_mask, v_src);
+                    break;
+                default:
+                    v_dst = _mm_andnot_si128(v_mask, v_src);
+                    break;
+            }
+            _mm_storeu_si128((__m128i *)(dst + j), v_dst);
+        }
+        for (; j < width; ++j) {
+            dst[j] = threshold_scalar<type, uint8_t>(src[j], thresh, maxval);
+        }
+    }
+}
+
+template <int32_t type>
+static void threshold_f32_sse(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float thresh,
+    float maxval)
+{
+    __m128 v_thresh = _mm_set1_ps(thresh);
+    __m128 v_maxval = _mm_set1_ps(maxval);
+    for (int32_t i = 0; i < height; ++i) {
+        const float *src = inData + i * inWidthStride;
+        float *dst       = outData + i * outWidthStride;
+        int32_t j        = 0;
+        for (; j <= width - 4; j += 4) {
+            __m128 v_src  = _mm_loadu_ps(src + j);
+            __m128 v_mask = _mm_cmpgt_ps(v_src, v_thresh);
+            __m128 v_dst;
+            switch (type) {
+                case CV_THRESH_BINARY:
+                    v_dst = _mm_and_ps(v_mask, v_maxval);
+                    break;
+                case CV_THRESH_BINARY_INV:
+                    v_dst = _mm_andnot_ps(v_mask, v_maxval);
+                    break;
+                case CV_THRESH_TRUNC:
+                    v_dst = _mm_blendv_ps(v_src, v_thresh, v_mask);
+                    break;
+                case CV_THRESH_TOZERO:
+                    v_dst = _mm_and_ps(v_mask, v_src);
+                    break;
+                default:
+                    v_dst = _mm_andnot_ps(v_mask, v_src);
+                    break;
+            }
+            _mm_storeu_ps(dst + j, v_dst);
+        }
+        for (; j < width; ++j) {
+            dst[j] = threshold_scalar<type, float>(src[j], thresh, maxval);
+        }
+    }
+}
+
+static int32_t otsu_thresh_u8(const int32_t *hist, int64_t total)
+{
+    const int32_t N = 256;
+    double mu = 0, scale = 1. / total;
+    for (int32_t i = 0; i < N; ++i) {
+        mu += i * static_cast<double>(hist[i]);
+    }
+    mu *= scale;
+
+    double mu1 = 0, q1 = 0;
+    double max_sigma = 0, max_val = 0;
+    for (int32_t i = 0; i < N; ++i) {
+        double p_i = hist[i] * scale;
+        mu1 *= q1;
+        q1 += p_i;
+        double q2 = 1. - q1;
+        if (std::min(q1, q2) < FLT_EPSILON || std::max(q1, q2) > 1. - FLT_EPSILON) {
+            continue;
+        }
+        mu1          = (mu1 + i * p_i) / q1;
+        double mu2   = (mu - q1 * mu1) / q2;
+        double sigma = q1 * q2 * (mu1 - mu2) * (mu1 - mu2);
+        if (sigma > max_sigma) {
+            max_sigma = sigma;
+            max_val   = i;
+        }
+    }
+    return static_cast<int32_t>(max_val);
+}
+
+static int32_t triangle_thresh_u8(int32_t *hist)
+{
+    const int32_t N     = 256;
+    int32_t left_bound  = 0;
+    int32_t right_bound = 0;
+    int32_t max_ind     = 0;
+    int32_t max         = 0;
+    bool is_flipped     = false;
+
+    for (int32_t i = 0; i < N; ++i) {
+        if (hist[i] > 0) {
+            left_bound = i;
+            break;
+        }
+    }
+    if (left_bound > 0) {
+        left_bound--;
+    }
+    for (int32_t i = N - 1; i > 0; --i) {
+        if (hist[i] > 0) {
+            right_bound = i;
+            break;
+        }
+    }
+    if (right_bound < N - 1) {
+        right_bound++;
+    }
+    for (int32_t i = 0; i < N; ++i) {
+        if (hist[i] > max) {
+            max     = hist[i];
+            max_ind = i;
+        }
+    }
+
+    if (max_ind - left_bound < right_bound - max_ind) {
+        is_flipped = true;
+        std::reverse(hist, hist + N);
+        left_bound = N - 1 - right_bound;
+        max_ind    = N - 1 - max_ind;
+    }
+
+    int32_t thresh = left_bound;
+    double a = max, b = left_bound - max_ind, dist = 0;
+    for (int32_t i = left_bound + 1; i <= max_ind; ++i) {
+        double temp_dist = a * i + b * hist[i];
+        if (temp_dist > dist) {
+            dist   = temp_dist;
+            thresh = i;
+        }
+    }
+    thresh--;
+
+    if (is_flipped) {
+        thresh = N - 1 - thresh;
+    }
+    return thresh;
+}
+
+static ::ppl::common::RetCode threshold_impl(
+    int32_t height,
+    int32_t width,
+    int32_t channels,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float thresh,
+    float maxValue,
+    int32_t type,
+    int32_t automatic,
+    float *computedThresh)
+{
+    if (automatic != 0) {
+        if (channels != 1) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        int32_t hist[256];
+        CalcHist<uint8_t, 1>(height, width, inWidthStride, inData, hist);
+        thresh = automatic == CV_THRESH_OTSU ? otsu_thresh_u8(hist, static_cast<int64_t>(height) * width)
+                                             : triangle_thresh_u8(hist);
+    }
+    thresh = std::floor(thresh);
+    if (computedThresh != nullptr) {
+        *computedThresh = thresh;
+    }
+    width *= channels;
+
+    uint8_t imaxval = maxValue >= 255.f ? 255 : (maxValue <= 0.f ? 0 : static_cast<uint8_t>(std::rint(maxValue)));
+    if (thresh < 0.f || thresh >= 255.f) {
+        bool saturated = type == CV_THRESH_BINARY || type == CV_THRESH_BINARY_INV ||
+                         ((type == CV_THRESH_TRUNC || type == CV_THRESH_TOZERO_INV) && thresh < 0.f) ||
+                         (type == CV_THRESH_TOZERO && thresh >= 255.f);
+        for (int32_t i = 0; i < height; ++i) {
+            uint8_t *dst = outData + i * outWidthStride;
+            if (saturated) {
+                uint8_t value = 0;
+                if (type == CV_THRESH_BINARY) {
+                    value = thresh >= 255.f ? 0 : imaxval;
+                } else if (type == CV_THRESH_BINARY_INV) {
+                    value = thresh >= 255.f ? imaxval : 0;
+                }
+                memset(dst, value, width * sizeof(uint8_t));
+            } else if (dst != inData + i * inWidthStride) {
+                memcpy(dst, inData + i * inWidthStride, width * sizeof(uint8_t));
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    uint8_t ithresh = static_cast<uint8_t>(thresh);
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::threshold_u8_fma(height, width, inWidthStride, inData, outWidthStride, outData, ithresh, imaxval, type);
+        return ppl::common::RC_SUCCESS;
+    }
+    switch (type) {
+        case CV_THRESH_BINARY:
+            threshold_u8_sse<CV_THRESH_BINARY>(height, width, inWidthStride, inData, outWidthStride, outData, ithresh, imaxval);
+            break;
+        case CV_THRESH_BINARY_INV:
+            threshold_u8_sse<CV_THRESH_BINARY_INV>(height, width, inWidthStride, inData, outWidthStride, outData, ithresh, imaxval);
+            break;
+        case CV_THRESH_TRUNC:
+            threshold_u8_sse<CV_THRESH_TRUNC>(height, width, inWidthStride, inData, outWidthStride, outData, ithresh, imaxval);
+            break;
+        case CV_THRESH_TOZERO:
+            threshold_u8_sse<CV_THRESH_TOZERO>(height, width, inWidthStride, inData, outWidthStride, outData, ithresh, imaxval);
+            break;
+        default:
+            threshold_u8_sse<CV_THRESH_TOZERO_INV>(height, width, inWidthStride, inData, outWidthStride, outData, ithresh, imaxval);
+            break;
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+static ::ppl::common::RetCode threshold_impl(
+    int32_t height,
+    int32_t width,
+    int32_t channels,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float thresh,
+    float maxValue,
+    int32_t type,
+    int32_t automatic,
+    float *computedThresh)
+{
+    if (automatic != 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (computedThresh != nullptr) {
+        *computedThresh = thresh;
+    }
+    width *= channels;
+
+    if (ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::threshold_f32_fma(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxValue, type);
+        return ppl::common::RC_SUCCESS;
+    }
+    switch (type) {
+        case CV_THRESH_BINARY:
+            threshold_f32_sse<CV_THRESH_BINARY>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxValue);
+            break;
+        case CV_THRESH_BINARY_INV:
+            threshold_f32_sse<CV_THRESH_BINARY_INV>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxValue);
+            break;
+        case CV_THRESH_TRUNC:
+            threshold_f32_sse<CV_THRESH_TRUNC>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxValue);
+            break;
+        case CV_THRESH_TOZERO:
+            threshold_f32_sse<CV_THRESH_TOZERO>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxValue);
+            break;
+        default:
+            threshold_f32_sse<CV_THRESH_TOZERO_INV>(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxValue);
+            break;
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode Threshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    float thresh,
+    float maxValue,
+    int32_t thresholdType,
+    float *computedThresh)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    int32_t type      = thresholdType & CV_THRESH_MASK;
+    int32_t automatic = thresholdType & ~CV_THRESH_MASK;
+    if (type > CV_THRESH_TOZERO_INV) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (automatic != 0 && automatic != CV_THRESH_OTSU && automatic != CV_THRESH_TRIANGLE) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    return threshold_impl(height, width, channels, inWidthStride, inData, outWidthStride, outData, thresh, maxValue, type, automatic, computedThresh);
+}
+
+template ::ppl::common::RetCode Threshold<uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float thresh,
+    float maxValue,
+    int32_t thresholdType,
+    float *computedThresh);
+
+template ::ppl::common::RetCode Threshold<uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float thresh,
+    float maxValue,
+    int32_t thresholdType,
+    float *computedThresh);
+
+template ::ppl::common::RetCode Threshold<uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float thresh,
+    float maxValue,
+    int32_t thresholdType,
+    float *computedThresh);
+
+template ::ppl::common::RetCode Threshold<float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float thresh,
+    float maxValue,
+    int32_t thresholdType,
+    float *computedThresh);
+
+template ::ppl::common::RetCode Threshold<float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float thresh,
+    float maxValue,
+    int32_t thresholdType,
+    float *computedThresh);
+
+template ::ppl::common::RetCode Threshold<float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float thresh,
+    float maxValue,
+    int32_t thresholdType,
+    float *computedThresh);
+
+}
+}
+} // namespace ppl::cv::x86
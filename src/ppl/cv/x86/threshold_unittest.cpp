@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/threshold.h"
+#include "ppl/cv/debug.h"
+#include "ppl/cv/types.h"
+#include "ppl/cv/x86/test.h"
+#include <gtest/gtest.h>
+#include <memory>
+
+template<typename T, int32_t nc, int32_t threshold_type>
+void ThresholdTest(int32_t height, int32_t width, float thresh, float diff) {
+    float max_value = 155.f;
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * width * nc);
+    cv::Mat dst_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get(), sizeof(T) * width * nc);
+    float computed_thresh = 0.f;
+    ppl::cv::x86::Threshold<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(),
+                                   thresh, max_value, threshold_type, &computed_thresh);
+    double cv_thresh = cv::threshold(src_opencv, dst_opencv, thresh, max_value, threshold_type);
+    EXPECT_EQ(static_cast<float>(cv_thresh), computed_thresh);
+    checkResult<T, nc>(dst_ref.get(), dst.get(), height, width, width * nc, width * nc, diff);
+}
+
+#define R(name, dtype, nc, threshold_type, diff) \
+    TEST(name, x86) \
+    { \
+        ThresholdTest<dtype, nc, threshold_type>(240, 320, 100.5f, diff); \
+        ThresholdTest<dtype, nc, threshold_type>(241, 321, 0.f, diff); \
+        ThresholdTest<dtype, nc, threshold_type>(480, 640, 254.f, diff); \
+        ThresholdTest<dtype, nc, threshold_type>(720, 1280, 300.f, diff); \
+    } \
+
+R(threshold_u8c1_binary_x86, uint8_t, 1, ppl::cv::CV_THRESH_BINARY, 1.01f);
+R(threshold_u8c3_binary_inv_x86, uint8_t, 3, ppl::cv::CV_THRESH_BINARY_INV, 1.01f);
+R(threshold_u8c4_trunc_x86, uint8_t, 4, ppl::cv::CV_THRESH_TRUNC, 1.01f);
+R(threshold_u8c1_tozero_x86, uint8_t, 1, ppl::cv::CV_THRESH_TOZERO, 1.01f);
+R(threshold_u8c3_tozero_inv_x86, uint8_t, 3, ppl::cv::CV_THRESH_TOZERO_INV, 1.01f);
+R(threshold_u8c1_otsu_x86, uint8_t, 1, ppl::cv::CV_THRESH_BINARY | ppl::cv::CV_THRESH_OTSU, 1.01f);
+R(threshold_u8c1_triangle_x86, uint8_t, 1, ppl::cv::CV_THRESH_TOZERO | ppl::cv::CV_THRESH_TRIANGLE, 1.01f);
+
+R(threshold_fp32c1_binary_x86, float, 1, ppl::cv::CV_THRESH_BINARY, 1e-6f);
+R(threshold_fp32c3_binary_inv_x86, float, 3, ppl::cv::CV_THRESH_BINARY_INV, 1e-6f);
+R(threshold_fp32c4_trunc_x86, float, 4, ppl::cv::CV_THRESH_TRUNC, 1e-6f);
+R(threshold_fp32c1_tozero_x86, float, 1, ppl::cv::CV_THRESH_TOZERO, 1e-6f);
+R(threshold_fp32c4_tozero_inv_x86, float, 4, ppl::cv::CV_THRESH_TOZERO_INV, 1e-6f);
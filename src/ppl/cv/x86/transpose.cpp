@@ -0,0 +1,357 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/transpose.h"
+#include "ppl/cv/x86/transpose.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/x86/intrinutils.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/retcode.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <algorithm>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// input plus output of one square tile take at most 32KB, roughly one L1 data cache
+#define TRANSPOSE_TILE_BYTES 32768
+
+// in-register 16x16 byte transpose, r[i] holds row i before and column i after
+static inline void transpose_16x16_epi8(__m128i *r)
+{
+    __m128i a[16], b[16], c[16];
+    for (int32_t p = 0; p < 8; ++p) {
+        a[2 * p]     = _mm_unpacklo_epi8(r[2 * p], r[2 * p + 1]);
+        a[2 * p + 1] = _mm_unpackhi_epi8(r[2 * p], r[2 * p + 1]);
+    }
+    for (int32_t q = 0; q < 4; ++q) {
+        for (int32_t h = 0; h < 2; ++h) {
+            b[q * 4 + h * 2]     = _mm_unpacklo_epi16(a[4 * q + h], a[4 * q + 2 + h]);
+            b[q * 4 + h * 2 + 1] = _mm_unpackhi_epi16(a[4 * q + h], a[4 * q + 2 + h]);
+        }
+    }
+    for (int32_t o = 0; o < 2; ++o) {
+        for (int32_t k = 0; k < 4; ++k) {
+            c[o * 8 + k * 2]     = _mm_unpacklo_epi32(b[o * 8 + k], b[o * 8 + 4 + k]);
+            c[o * 8 + k * 2 + 1] = _mm_unpackhi_epi32(b[o * 8 + k], b[o * 8 + 4 + k]);
+        }
+    }
+    for (int32_t k = 0; k < 8; ++k) {
+        r[2 * k]     = _mm_unpacklo_epi64(c[k], c[8 + k]);
+        r[2 * k + 1] = _mm_unpackhi_epi64(c[k], c[8 + k]);
+    }
+}
+
+template <typename T, int32_t nc>
+struct TransposeBlock;
+
+template <>
+struct TransposeBlock<uint8_t, 1> {
+    static const int32_t size = 16;
+    static inline void run(const uint8_t *src, int32_t srcStride, uint8_t *dst, int32_t dstStride)
+    {
+        __m128i r[16];
+        for (int32_t i = 0; i < 16; ++i) {
+            r[i] = _mm_loadu_si128((const __m128i *)(src + i * srcStride));
+        }
+        transpose_16x16_epi8(r);
+        for (int32_t i = 0; i < 16; ++i) {
+            _mm_storeu_si128((__m128i *)(dst + i * dstStride), r[i]);
+        }
+    }
+};
+
+template <>
+struct TransposeBlock<uint8_t, 3> {
+    static const int32_t size = 16;
+    static inline void run(const uint8_t *src, int32_t srcStride, uint8_t *dst, int32_t dstStride)
+    {
+        __m128i a[16], b[16], c[16];
+        for (int32_t i = 0; i < 16; ++i) {
+            v_load_deinterleave(src + i * srcStride, a[i], b[i], c[i]);
+        }
+        transpose_16x16_epi8(a);
+        transpose_16x16_epi8(b);
+        transpose_16x16_epi8(c);
+        for (int32_t i = 0; i < 16; ++i) {
+            v_store_interleave(dst + i * dstStride, a[i], b[i], c[i]);
+        }
+    }
+};
+
+// 4-byte pixels, shared by uint8_t with 4 channels and float with 1 channel
+static inline void transpose_4x4_32bit(const uint8_t *src, int32_t srcStep, uint8_t *dst, int32_t dstStep)
+{
+    __m128 r0 = _mm_loadu_ps((const float *)(src));
+    __m128 r1 = _mm_loadu_ps((const float *)(src + srcStep));
+    __m128 r2 = _mm_loadu_ps((const float *)(src + 2 * srcStep));
+    __m128 r3 = _mm_loadu_ps((const float *)(src + 3 * srcStep));
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    _mm_storeu_ps((float *)(dst), r0);
+    _mm_storeu_ps((float *)(dst + dstStep), r1);
+    _mm_storeu_ps((float *)(dst + 2 * dstStep), r2);
+    _mm_storeu_ps((float *)(dst + 3 * dstStep), r3);
+}
+
+template <>
+struct TransposeBlock<uint8_t, 4> {
+    static const int32_t size = 4;
+    static inline void run(const uint8_t *src, int32_t srcStride, uint8_t *dst, int32_t dstStride)
+    {
+        transpose_4x4_32bit(src, srcStride, dst, dstStride);
+    }
+};
+
+template <>
+struct TransposeBlock<float, 1> {
+    static const int32_t size = 4;
+    static inline void run(const float *src, int32_t srcStride, float *dst, int32_t dstStride)
+    {
+        transpose_4x4_32bit((const uint8_t *)src, srcStride * sizeof(float), (uint8_t *)dst, dstStride * sizeof(float));
+    }
+};
+
+template <>
+struct TransposeBlock<float, 3> {
+    static const int32_t size = 4;
+    static inline void run(const float *src, int32_t srcStride, float *dst, int32_t dstStride)
+    {
+        __m128 a[4], b[4], c[4];
+        for (int32_t i = 0; i < 4; ++i) {
+            v_load_deinterleave(src + i * srcStride, a[i], b[i], c[i]);
+        }
+        _MM_TRANSPOSE4_PS(a[0], a[1], a[2], a[3]);
+        _MM_TRANSPOSE4_PS(b[0], b[1], b[2], b[3]);
+        _MM_TRANSPOSE4_PS(c[0], c[1], c[2], c[3]);
+        for (int32_t i = 0; i < 4; ++i) {
+            v_store_interleave(dst + i * dstStride, a[i], b[i], c[i]);
+        }
+    }
+};
+
+template <>
+struct TransposeBlock<float, 4> {
+    static const int32_t size = 4;
+    static inline void run(const float *src, int32_t srcStride, float *dst, int32_t dstStride)
+    {
+        // every pixel already fills a register, so the block is a pattern of moves
+        for (int32_t i = 0; i < 4; ++i) {
+            __m128 p0 = _mm_loadu_ps(src + i * srcStride);
+            __m128 p1 = _mm_loadu_ps(src + i * srcStride + 4);
+            __m128 p2 = _mm_loadu_ps(src + i * srcStride + 8);
+            __m128 p3 = _mm_loadu_ps(src + i * srcStride + 12);
+            _mm_storeu_ps(dst + i * 4, p0);
+            _mm_storeu_ps(dst + dstStride + i * 4, p1);
+            _mm_storeu_ps(dst + 2 * dstStride + i * 4, p2);
+            _mm_storeu_ps(dst + 3 * dstStride + i * 4, p3);
+        }
+    }
+};
+
+template <typename T, int32_t nc>
+static inline void transpose_scalar(
+    int32_t i0,
+    int32_t i1,
+    int32_t j0,
+    int32_t j1,
+    const T *src,
+    int32_t srcStride,
+    T *dst,
+    int32_t dstStride)
+{
+    for (int32_t j = j0; j < j1; ++j) {
+        T *dst_row = dst + j * dstStride;
+        for (int32_t i = i0; i < i1; ++i) {
+            const T *src_pixel = src + i * srcStride + j * nc;
+            for (int32_t c = 0; c < nc; ++c) {
+                dst_row[i * nc + c] = src_pixel[c];
+            }
+        }
+    }
+}
+
+template <typename T, int32_t nc>
+static void transpose_tiled(
+    int32_t height,
+    int32_t width,
+    const T *src,
+    int32_t srcStride,
+    T *dst,
+    int32_t dstStride)
+{
+    const int32_t block = TransposeBlock<T, nc>::size;
+    int32_t tile        = block;
+    while (2 * tile * 2 * tile * nc * (int32_t)sizeof(T) * 2 <= TRANSPOSE_TILE_BYTES) {
+        tile *= 2;
+    }
+    const int32_t tile_rows = (height + tile - 1) / tile;
+#pragma omp parallel for
+    for (int32_t ti = 0; ti < tile_rows; ++ti) {
+        int32_t i0 = ti * tile;
+        int32_t i1 = std::min(i0 + tile, height);
+        for (int32_t j0 = 0; j0 < width; j0 += tile) {
+            int32_t j1 = std::min(j0 + tile, width);
+            int32_t i  = i0;
+            for (; i <= i1 - block; i += block) {
+                int32_t j = j0;
+                for (; j <= j1 - block; j += block) {
+                    TransposeBlock<T, nc>::run(src + i * srcStride + j * nc, srcStride, dst + j * dstStride + i * nc, dstStride);
+                }
+                transpose_scalar<T, nc>(i, i + block, j, j1, src, srcStride, dst, dstStride);
+            }
+            transpose_scalar<T, nc>(i, i1, j0, j1, src, srcStride, dst, dstStride);
+        }
+    }
+}
+
+template <typename T, int32_t nc>
+void transpose_strided(
+    int32_t height,
+    int32_t width,
+    const T *src,
+    int32_t srcStride,
+    T *dst,
+    int32_t dstStride)
+{
+    if (nc * sizeof(T) == 4 && ppl::common::CpuSupports(ppl::common::ISA_X86_FMA)) {
+        fma::transpose_32bit_fma(height, width, (const uint8_t *)src, srcStride * sizeof(T), (uint8_t *)dst, dstStride * sizeof(T));
+        return;
+    }
+    transpose_tiled<T, nc>(height, width, src, srcStride, dst, dstStride);
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode Transpose(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels || outWidthStride < inHeight * channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    transpose_strided<T, channels>(inHeight, inWidth, inData, inWidthStride, outData, outWidthStride);
+    return ppl::common::RC_SUCCESS;
+}
+
+template void transpose_strided<uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    const uint8_t *src,
+    int32_t srcStride,
+    uint8_t *dst,
+    int32_t dstStride);
+
+template void transpose_strided<uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    const uint8_t *src,
+    int32_t srcStride,
+    uint8_t *dst,
+    int32_t dstStride);
+
+template void transpose_strided<uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    const uint8_t *src,
+    int32_t srcStride,
+    uint8_t *dst,
+    int32_t dstStride);
+
+template void transpose_strided<float, 1>(
+    int32_t height,
+    int32_t width,
+    const float *src,
+    int32_t srcStride,
+    float *dst,
+    int32_t dstStride);
+
+template void transpose_strided<float, 3>(
+    int32_t height,
+    int32_t width,
+    const float *src,
+    int32_t srcStride,
+    float *dst,
+    int32_t dstStride);
+
+template void transpose_strided<float, 4>(
+    int32_t height,
+    int32_t width,
+    const float *src,
+    int32_t srcStride,
+    float *dst,
+    int32_t dstStride);
+
+template ::ppl::common::RetCode Transpose<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template ::ppl::common::RetCode Transpose<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template ::ppl::common::RetCode Transpose<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template ::ppl::common::RetCode Transpose<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData);
+
+template ::ppl::common::RetCode Transpose<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData);
+
+template ::ppl::common::RetCode Transpose<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData);
+
+}
+}
+} // namespace ppl::cv::x86
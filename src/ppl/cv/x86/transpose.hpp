@@ -0,0 +1,42 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_HPC_PPL_CV_X86_TRANSPOSE_HPP_
+#define __ST_HPC_PPL_CV_X86_TRANSPOSE_HPP_
+
+#include <stdint.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// transposes a height x width image, strides are signed so that a negative input or
+// output stride turns the transpose into a 90 or 270 degree rotation in one pass.
+template <typename T, int32_t nc>
+void transpose_strided(
+    int32_t height,
+    int32_t width,
+    const T *src,
+    int32_t srcStride,
+    T *dst,
+    int32_t dstStride);
+
+}
+}
+} // namespace ppl::cv::x86
+
+#endif //!__ST_HPC_PPL_CV_X86_TRANSPOSE_HPP_
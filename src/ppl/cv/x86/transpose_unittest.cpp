@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/transpose.h"
+#include "ppl/cv/x86/test.h"
+#include <memory>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+#include <opencv2/core.hpp>
+
+template <typename T, int32_t nc>
+void TransposeTest(int32_t height, int32_t width)
+{
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+
+    ppl::cv::x86::Transpose<T, nc>(height, width, width * nc, src.get(), height * nc, dst.get());
+
+    std::unique_ptr<T[]> dst_opencv(new T[width * height * nc]);
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat oMat(width, height, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_opencv.get());
+    cv::transpose(iMat, oMat);
+
+    checkResult<T, nc>(dst.get(), dst_opencv.get(), width, height, height * nc, height * nc, 1.01f);
+}
+
+TEST(TRANSPOSE_FP32, x86)
+{
+    TransposeTest<float, 1>(640, 720);
+    TransposeTest<float, 3>(640, 720);
+    TransposeTest<float, 4>(640, 720);
+
+    TransposeTest<float, 1>(101, 203);
+    TransposeTest<float, 3>(101, 203);
+    TransposeTest<float, 4>(101, 203);
+}
+
+TEST(TRANSPOSE_UINT8, x86)
+{
+    TransposeTest<uint8_t, 1>(640, 720);
+    TransposeTest<uint8_t, 3>(640, 720);
+    TransposeTest<uint8_t, 4>(640, 720);
+
+    TransposeTest<uint8_t, 1>(101, 203);
+    TransposeTest<uint8_t, 3>(101, 203);
+    TransposeTest<uint8_t, 4>(101, 203);
+}
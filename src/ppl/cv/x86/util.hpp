@@ -43,6 +43,34 @@ inline const T round_up(const T &a, const T &b)
     return (a + b - static_cast<T>(1)) / b * b;
 }
 
+// maps an out-of-range coordinate back into [0, len) for REPLICATE, REFLECT,
+// REFLECT_101 and WRAP, kernels wider than the image are handled as well.
+inline int32_t border_interpolate(int32_t p, int32_t len, BorderType border_type)
+{
+    if (static_cast<uint32_t>(p) < static_cast<uint32_t>(len)) {
+        return p;
+    }
+    if (border_type == BORDER_TYPE_REPLICATE) {
+        return p < 0 ? 0 : len - 1;
+    }
+    if (border_type == BORDER_TYPE_WRAP) {
+        p %= len;
+        return p < 0 ? p + len : p;
+    }
+    if (len == 1) {
+        return 0;
+    }
+    int32_t delta = border_type == BORDER_TYPE_REFLECT_101 ? 1 : 0;
+    do {
+        if (p < 0) {
+            p = -p - 1 + delta;
+        } else {
+            p = len - 1 - (p - len) - delta;
+        }
+    } while (static_cast<uint32_t>(p) >= static_cast<uint32_t>(len));
+    return p;
+}
+
 template<typename T, typename FUNCTION>
 inline void Map(T *out_data, const T *in_data, int32_t n, FUNCTION f, T operand0) {
     for (int32_t i = 0; i < n; ++i) {
@@ -0,0 +1,357 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/warpperspective.h"
+#include "ppl/cv/x86/remap.hpp"
+#include "ppl/cv/x86/fma/internal_fma.hpp"
+#include "ppl/cv/types.h"
+#include "ppl/common/sys.h"
+#include "ppl/common/x86/sysinfo.h"
+#include <limits.h>
+#include <algorithm>
+#include <vector>
+#include <immintrin.h>
+
+namespace ppl {
+namespace cv {
+namespace x86 {
+
+// output rows per stripe, every stripe keeps its own row of source coordinates
+#define WARPPERSPECTIVE_STRIPE_ROWS 16
+
+static inline int32_t warpperspective_round(double v)
+{
+    v = std::max((double)INT_MIN, std::min((double)INT_MAX, v));
+    return _mm_cvtsd_si32(_mm_set_sd(v));
+}
+
+// the same contract as fma::warpperspective_coords_fma
+template <bool linear>
+static void warpperspective_coords(
+    const double *M,
+    int32_t y,
+    int32_t width,
+    int32_t maxX,
+    int32_t maxY,
+    int16_t *mapXY,
+    uint16_t *mapFrac,
+    int32_t *span)
+{
+    const double scale = linear ? REMAP_INTER_TAB_SIZE : 1.0;
+    const double X0    = M[1] * y + M[2];
+    const double Y0    = M[4] * y + M[5];
+    const double W0    = M[7] * y + M[8];
+    int32_t first = -1, last = -1, count = 0;
+    for (int32_t j = 0; j < width; ++j) {
+        double W   = W0 + M[6] * j;
+        W          = W != 0 ? scale / W : 0;
+        int32_t sx = warpperspective_round((X0 + M[0] * j) * W);
+        int32_t sy = warpperspective_round((Y0 + M[3] * j) * W);
+        if (linear) {
+            mapFrac[j] = ((sy & REMAP_INTER_MASK) << REMAP_INTER_BITS) | (sx & REMAP_INTER_MASK);
+            sx >>= REMAP_INTER_BITS;
+            sy >>= REMAP_INTER_BITS;
+        }
+        mapXY[j * 2]     = remap_saturate_s16(sx);
+        mapXY[j * 2 + 1] = remap_saturate_s16(sy);
+        if (sx >= 0 && sx <= maxX && sy >= 0 && sy <= maxY) {
+            first = first < 0 ? j : first;
+            last  = j;
+            ++count;
+        }
+    }
+    span[0] = 0;
+    span[1] = 0;
+    if (count > 0 && count == last - first + 1) {
+        span[0] = first;
+        span[1] = last + 1;
+    }
+}
+
+// every row is split into the pixels before, inside and after its span, the span samples without bounds checks
+template <typename T, int32_t nc, BorderType border_type, bool linear>
+static void warpperspective_rows(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const double *M,
+    T border_value)
+{
+    const bool use_fma    = ppl::common::CpuSupports(ppl::common::ISA_X86_FMA);
+    const int32_t maxX    = linear ? remap_linear_inner_max_x<T, nc>(inWidth, use_fma) : inWidth - 1;
+    const int32_t maxY    = linear ? inHeight - 2 : inHeight - 1;
+    const int32_t stripes = (outHeight + WARPPERSPECTIVE_STRIPE_ROWS - 1) / WARPPERSPECTIVE_STRIPE_ROWS;
+#pragma omp parallel for
+    for (int32_t s = 0; s < stripes; ++s) {
+        std::vector<int16_t> xy(outWidth * 2);
+        std::vector<uint16_t> frac(linear ? outWidth : 0);
+        const int32_t i1 = std::min(outHeight, (s + 1) * WARPPERSPECTIVE_STRIPE_ROWS);
+        for (int32_t i = s * WARPPERSPECTIVE_STRIPE_ROWS; i < i1; ++i) {
+            int32_t span[2];
+            if (use_fma) {
+                fma::warpperspective_coords_fma<linear>(M, i, outWidth, maxX, maxY, xy.data(), frac.data(), span);
+            } else {
+                warpperspective_coords<linear>(M, i, outWidth, maxX, maxY, xy.data(), frac.data(), span);
+            }
+            const int32_t j0 = span[0], j1 = span[1];
+            const int16_t *row_xy = xy.data();
+            T *dst                = outData + i * outWidthStride;
+            if (linear) {
+                const uint16_t *row_frac = frac.data();
+                remap_linear_row<T, nc, border_type>(inHeight, inWidth, inWidthStride, inData, j0, row_xy, row_frac, border_value, dst, use_fma);
+                remap_linear_row_inner<T, nc>(inWidthStride, inData, j1 - j0, row_xy + j0 * 2, row_frac + j0, dst + j0 * nc, use_fma);
+                remap_linear_row<T, nc, border_type>(inHeight, inWidth, inWidthStride, inData, outWidth - j1, row_xy + j1 * 2, row_frac + j1, border_value, dst + j1 * nc, use_fma);
+            } else {
+                remap_nearest_row<T, nc, border_type>(inHeight, inWidth, inWidthStride, inData, j0, row_xy, border_value, dst, use_fma);
+                remap_nearest_row_inner<T, nc>(inWidthStride, inData, j1 - j0, row_xy + j0 * 2, dst + j0 * nc, use_fma);
+                remap_nearest_row<T, nc, border_type>(inHeight, inWidth, inWidthStride, inData, outWidth - j1, row_xy + j1 * 2, border_value, dst + j1 * nc, use_fma);
+            }
+        }
+    }
+}
+
+template <typename T, int32_t nc, bool linear>
+static ::ppl::common::RetCode warpperspective_dispatch(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    T border_value)
+{
+    if (inData == nullptr || outData == nullptr || perspectiveMatrix == nullptr) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * nc ||
+        outHeight <= 0 || outWidth <= 0 || outWidthStride < outWidth * nc) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (border_type == BORDER_TYPE_CONSTANT) {
+        warpperspective_rows<T, nc, BORDER_TYPE_CONSTANT, linear>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, perspectiveMatrix, border_value);
+    } else if (border_type == BORDER_TYPE_REPLICATE) {
+        warpperspective_rows<T, nc, BORDER_TYPE_REPLICATE, linear>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, perspectiveMatrix, border_value);
+    } else if (border_type == BORDER_TYPE_TRANSPARENT) {
+        warpperspective_rows<T, nc, BORDER_TYPE_TRANSPARENT, linear>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, perspectiveMatrix, border_value);
+    } else {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode WarpPerspectiveNearestPoint(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    T border_value)
+{
+    return warpperspective_dispatch<T, channels, false>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, perspectiveMatrix, border_type, border_value);
+}
+
+template <typename T, int32_t channels>
+::ppl::common::RetCode WarpPerspectiveLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    T border_value)
+{
+    return warpperspective_dispatch<T, channels, true>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, perspectiveMatrix, border_type, border_value);
+}
+
+template ::ppl::common::RetCode WarpPerspectiveNearestPoint<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode WarpPerspectiveNearestPoint<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode WarpPerspectiveNearestPoint<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode WarpPerspectiveNearestPoint<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode WarpPerspectiveNearestPoint<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode WarpPerspectiveNearestPoint<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode WarpPerspectiveLinear<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode WarpPerspectiveLinear<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode WarpPerspectiveLinear<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    uint8_t border_value);
+
+template ::ppl::common::RetCode WarpPerspectiveLinear<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode WarpPerspectiveLinear<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    float border_value);
+
+template ::ppl::common::RetCode WarpPerspectiveLinear<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    const double *perspectiveMatrix,
+    BorderType border_type,
+    float border_value);
+
+}
+}
+} // namespace ppl::cv::x86
@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <opencv2/imgproc.hpp>
+#include "ppl/cv/x86/warpperspective.h"
+#include "ppl/cv/debug.h"
+#include <memory>
+
+namespace {
+
+static void fill_perspective_matrix(double *M, int32_t width, int32_t height) {
+    ppl::cv::debug::randomFill<double>(M, 9, -0.2, 0.2);
+    M[0] += 1.0;
+    M[4] += 1.0;
+    M[2] *= width;
+    M[5] *= height;
+    M[6] *= 1e-3;
+    M[7] *= 1e-3;
+    M[8] += 1.0;
+}
+
+template<typename T, int32_t nc>
+void BM_WarpPerspectiveLinear_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    double M[9];
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    fill_perspective_matrix(M, width, height);
+    for (auto _ : state) {
+        ppl::cv::x86::WarpPerspectiveLinear<T, nc>(height, width, width * nc, src.get(), height, width, width * nc, dst.get(), M);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template<typename T, int32_t nc>
+void BM_WarpPerspectiveNearestPoint_ppl_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    double M[9];
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    fill_perspective_matrix(M, width, height);
+    for (auto _ : state) {
+        ppl::cv::x86::WarpPerspectiveNearestPoint<T, nc>(height, width, width * nc, src.get(), height, width, width * nc, dst.get(), M);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace ppl::cv::debug;
+
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveLinear_ppl_x86, uint8_t, c1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveLinear_ppl_x86, uint8_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveLinear_ppl_x86, uint8_t, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveLinear_ppl_x86, float, c1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveLinear_ppl_x86, float, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveLinear_ppl_x86, float, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveNearestPoint_ppl_x86, uint8_t, c1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveNearestPoint_ppl_x86, uint8_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveNearestPoint_ppl_x86, uint8_t, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveNearestPoint_ppl_x86, float, c1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveNearestPoint_ppl_x86, float, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspectiveNearestPoint_ppl_x86, float, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+
+#ifdef PPLCV_BENCHMARK_OPENCV
+template<typename T, int32_t nc, int32_t inter_mode>
+void BM_WarpPerspective_opencv_x86(benchmark::State &state) {
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    double M[9];
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    fill_perspective_matrix(M, width, height);
+    cv::Mat src_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat dst_opencv(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst.get());
+    cv::Mat M_opencv(3, 3, CV_64FC1, M);
+    for (auto _ : state) {
+        cv::warpPerspective(src_opencv, dst_opencv, M_opencv, dst_opencv.size(), cv::WARP_INVERSE_MAP | inter_mode, cv::BORDER_CONSTANT);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, uint8_t, c1, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, uint8_t, c3, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, uint8_t, c4, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, float, c1, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, float, c3, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, float, c4, cv::INTER_LINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, uint8_t, c1, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, uint8_t, c3, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, uint8_t, c4, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, float, c1, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, float, c3, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_WarpPerspective_opencv_x86, float, c4, cv::INTER_NEAREST)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+#endif //! PPLCV_BENCHMARK_OPENCV
+} // namespace
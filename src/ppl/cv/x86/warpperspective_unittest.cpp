@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/cv/x86/warpperspective.h"
+#include "ppl/cv/x86/test.h"
+#include <opencv2/imgproc.hpp>
+#include <memory>
+#include <gtest/gtest.h>
+#include "ppl/cv/debug.h"
+
+template<typename T, int32_t nc, ppl::cv::InterpolationType inter_mode, ppl::cv::BorderType border_type>
+void WarpPerspectiveTest(int32_t height, int32_t width, float diff) {
+    int32_t input_height = height;
+    int32_t input_width = width;
+    int32_t output_height = height;
+    int32_t output_width = width;
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    std::unique_ptr<double[]> inv_warpMat(new double[9]);
+    ppl::cv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    ppl::cv::debug::randomFill<T>(dst.get(), width * height * nc, 0, 255);
+    memcpy(dst_ref.get(), dst.get(), height * width * nc * sizeof(T));
+    // a mild perspective around the identity, so that both inside and border pixels are covered
+    ppl::cv::debug::randomFill<double>(inv_warpMat.get(), 9, -0.2, 0.2);
+    inv_warpMat[0] += 1.0;
+    inv_warpMat[4] += 1.0;
+    inv_warpMat[2] *= width;
+    inv_warpMat[5] *= height;
+    inv_warpMat[6] *= 1e-3;
+    inv_warpMat[7] *= 1e-3;
+    inv_warpMat[8] += 1.0;
+    cv::Mat src_opencv(input_height, input_width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * input_width * nc);
+    cv::Mat dst_opencv(output_height, output_width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get(), sizeof(T) * output_width * nc);
+    cv::Mat inv_mat(3, 3, CV_64FC1, inv_warpMat.get());
+    cv::BorderTypes cv_border_type;
+    if (border_type == ppl::cv::BORDER_TYPE_CONSTANT) {
+        cv_border_type = cv::BORDER_CONSTANT;
+    } else if (border_type == ppl::cv::BORDER_TYPE_REPLICATE) {
+        cv_border_type = cv::BORDER_REPLICATE;
+    } else {
+        cv_border_type = cv::BORDER_TRANSPARENT;
+    }
+    if (inter_mode == ppl::cv::INTERPOLATION_TYPE_LINEAR) {
+        cv::warpPerspective(src_opencv, dst_opencv, inv_mat, dst_opencv.size(), cv::WARP_INVERSE_MAP|cv::INTER_LINEAR, cv_border_type);
+        ppl::cv::x86::WarpPerspectiveLinear<T, nc>(input_height, input_width, input_width * nc,
+                                src.get(), output_height, output_width, output_width * nc,
+                                dst.get(), inv_warpMat.get(), border_type);
+    } else {
+        cv::warpPerspective(src_opencv, dst_opencv, inv_mat, dst_opencv.size(), cv::WARP_INVERSE_MAP|cv::INTER_NEAREST, cv_border_type);
+        ppl::cv::x86::WarpPerspectiveNearestPoint<T, nc>(input_height, input_width, input_width * nc,
+                                src.get(), output_height, output_width, output_width * nc,
+                                dst.get(), inv_warpMat.get(), border_type);
+    }
+    checkResult<T, nc>(dst_ref.get(), dst.get(),
+                    output_height, output_width,
+                    output_width * nc, output_width * nc,
+                    diff);
+}
+
+#define R(name, dtype, nc, inter_mode, border_type, diff)\
+    TEST(name, x86)\
+    {\
+        WarpPerspectiveTest<dtype, nc, inter_mode, border_type>(240, 320, diff); \
+        WarpPerspectiveTest<dtype, nc, inter_mode, border_type>(480, 640, diff); \
+        WarpPerspectiveTest<dtype, nc, inter_mode, border_type>(719, 1277, diff); \
+    }\
+
+R(WARPPERSPECTIVE_FP32_C1_NEAREST_BORDER_TYPE_CONSTANT, float, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_FP32_C3_NEAREST_BORDER_TYPE_CONSTANT, float, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_FP32_C4_NEAREST_BORDER_TYPE_CONSTANT, float, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_U8_C1_NEAREST_BORDER_TYPE_CONSTANT, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_U8_C3_NEAREST_BORDER_TYPE_CONSTANT, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_U8_C4_NEAREST_BORDER_TYPE_CONSTANT, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_FP32_C1_NEAREST_BORDER_TYPE_REPLICATE, float, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_FP32_C3_NEAREST_BORDER_TYPE_REPLICATE, float, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_FP32_C4_NEAREST_BORDER_TYPE_REPLICATE, float, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_U8_C1_NEAREST_BORDER_TYPE_REPLICATE, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_U8_C3_NEAREST_BORDER_TYPE_REPLICATE, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_U8_C4_NEAREST_BORDER_TYPE_REPLICATE, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_FP32_C1_NEAREST_BORDER_TYPE_TRANSPARENT, float, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPPERSPECTIVE_FP32_C3_NEAREST_BORDER_TYPE_TRANSPARENT, float, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPPERSPECTIVE_FP32_C4_NEAREST_BORDER_TYPE_TRANSPARENT, float, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPPERSPECTIVE_U8_C1_NEAREST_BORDER_TYPE_TRANSPARENT, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPPERSPECTIVE_U8_C3_NEAREST_BORDER_TYPE_TRANSPARENT, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPPERSPECTIVE_U8_C4_NEAREST_BORDER_TYPE_TRANSPARENT, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_NEAREST_POINT, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+
+R(WARPPERSPECTIVE_FP32_C1_LINEAR_BORDER_TYPE_CONSTANT, float, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_FP32_C3_LINEAR_BORDER_TYPE_CONSTANT, float, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_FP32_C4_LINEAR_BORDER_TYPE_CONSTANT, float, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_U8_C1_LINEAR_BORDER_TYPE_CONSTANT, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_U8_C3_LINEAR_BORDER_TYPE_CONSTANT, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_U8_C4_LINEAR_BORDER_TYPE_CONSTANT, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_CONSTANT, 1.01f);
+R(WARPPERSPECTIVE_FP32_C1_LINEAR_BORDER_TYPE_REPLICATE, float, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_FP32_C3_LINEAR_BORDER_TYPE_REPLICATE, float, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_FP32_C4_LINEAR_BORDER_TYPE_REPLICATE, float, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_U8_C1_LINEAR_BORDER_TYPE_REPLICATE, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_U8_C3_LINEAR_BORDER_TYPE_REPLICATE, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_U8_C4_LINEAR_BORDER_TYPE_REPLICATE, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_REPLICATE, 1.01f);
+R(WARPPERSPECTIVE_FP32_C1_LINEAR_BORDER_TYPE_TRANSPARENT, float, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPPERSPECTIVE_FP32_C3_LINEAR_BORDER_TYPE_TRANSPARENT, float, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPPERSPECTIVE_FP32_C4_LINEAR_BORDER_TYPE_TRANSPARENT, float, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPPERSPECTIVE_U8_C1_LINEAR_BORDER_TYPE_TRANSPARENT, uint8_t, 1, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPPERSPECTIVE_U8_C3_LINEAR_BORDER_TYPE_TRANSPARENT, uint8_t, 3, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);
+R(WARPPERSPECTIVE_U8_C4_LINEAR_BORDER_TYPE_TRANSPARENT, uint8_t, 4, ppl::cv::INTERPOLATION_TYPE_LINEAR, ppl::cv::BORDER_TYPE_TRANSPARENT, 1.01f);